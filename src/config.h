@@ -0,0 +1,16 @@
+/* Configuration header file for PMW. The original is config.h.in, which is
+used as a basis for config.h. */
+
+/* Define NO_PMWRC non-zero to disable support for .pmwrc files. */
+#define NO_PMWRC 0
+
+/* Define SUPPORT_B2PF non-zero to include support for B2PF text processing. */
+#define SUPPORT_B2PF 0
+
+/* Define SUPPORT_XML non-zero to include support for MusicXML files. */
+#define SUPPORT_XML 0
+
+/* Define PDF_DEFAULT non-zero to make the default output format PDF. */
+#define PDF_DEFAULT 0
+
+/* End of config.h */
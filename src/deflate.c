@@ -0,0 +1,788 @@
+/*************************************************
+*         PMW Flate (deflate) compression        *
+*************************************************/
+
+/* Copyright Philip Hazel 2026 */
+/* This file created: October 2026 */
+/* This file last modified: October 2026 */
+
+#include "pmw.h"
+
+/* This file contains a self-contained implementation of the "deflate"
+compression method as specified in RFC 1951, wrapped in the "zlib" format of
+RFC 1950. This is what PDF calls the FlateDecode filter. It is used for
+compressing streams in PDF output. Having our own implementation avoids a
+dependency on an external library; it does not need to be fast, because the
+amount of data is not large, though it does try to be reasonably effective.
+
+The whole of the data to be compressed is always available in memory, so the
+LZ77 matching can look back directly into the input. Matches are found using
+hash chains over a 32K window. The output is split into blocks of a limited
+number of symbols, and each block is written with dynamic Huffman codes, fixed
+Huffman codes, or stored uncompressed, whichever is smallest. */
+
+
+
+/************************************************
+*        Constants, tables, and structures      *
+************************************************/
+
+#define WSIZE          32768       /* LZ77 window */
+#define WMASK          (WSIZE - 1)
+#define HASH_BITS      15
+#define HASH_SIZE      (1 << HASH_BITS)
+#define MIN_MATCH      3
+#define MAX_MATCH      258
+#define BLOCK_SYMBOLS  16384       /* Maximum symbols in a block */
+#define STORED_MAX     65535       /* Maximum length of a stored block */
+
+#define LITLEN_CODES   288         /* Includes 2 that are never used */
+#define DIST_CODES     30
+#define CLEN_CODES     19
+#define END_BLOCK      256
+
+/* Parameters for each compression level: maximum length of hash chain to
+search, match length that is good enough to stop searching, and whether to do
+"lazy" matching, that is, to check whether a better match starts at the next
+byte. Level 0 is never passed to deflate_compress(). */
+
+typedef struct {
+  int chain;
+  int nice;
+  BOOL lazy;
+} dfl_level;
+
+static const dfl_level levels[] = {
+  {    0,   0, FALSE },   /* 0 */
+  {    4,   8, FALSE },   /* 1 */
+  {    8,  16, FALSE },   /* 2 */
+  {   16,  32, FALSE },   /* 3 */
+  {   16,  16, TRUE  },   /* 4 */
+  {   32,  32, TRUE  },   /* 5 */
+  {  128, 128, TRUE  },   /* 6 */
+  {  256, 128, TRUE  },   /* 7 */
+  { 1024, 258, TRUE  },   /* 8 */
+  { 4096, 258, TRUE  }    /* 9 */
+};
+
+/* Bases and extra bits for length codes 257-285 and distance codes 0-29. */
+
+static const uint16_t length_base[] = {
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+
+static const uint8_t length_extra[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+static const uint16_t dist_base[] = {
+  1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289,
+  16385, 24577 };
+
+static const uint8_t dist_extra[] = {
+  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+/* The order in which code length code lengths are transmitted. */
+
+static const uint8_t clen_order[] = {
+  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+/* Output is accumulated in a memory block that is extended as necessary. Bits
+are packed starting at the least significant bit of each byte. */
+
+typedef struct {
+  uschar  *buffer;
+  size_t   size;
+  size_t   used;
+  uint32_t bitbuf;
+  int      bitcount;
+} dfl_output;
+
+/* A block's worth of LZ77 symbols is saved before being encoded. A literal has
+a distance of zero; otherwise the "litlen" value is a match length. */
+
+typedef struct {
+  uint16_t litlen[BLOCK_SYMBOLS];
+  uint16_t dist[BLOCK_SYMBOLS];
+  int      count;
+  size_t   start;               /* Offset of first input byte in block */
+} dfl_block;
+
+
+
+/*************************************************
+*             Output bits and bytes              *
+*************************************************/
+
+/* Make sure there is room for at least n more bytes in the output. */
+
+static void
+out_ensure(dfl_output *out, size_t n)
+{
+if (out->used + n <= out->size) return;
+while (out->used + n > out->size) out->size *= 2;
+out->buffer = realloc(out->buffer, out->size);
+if (out->buffer == NULL)
+  error(ERR0, "re-", "compressed PDF stream", out->size);  /* Hard */
+}
+
+/* Add up to 16 bits to the output, least significant first. */
+
+static void
+out_bits(dfl_output *out, uint32_t value, int n)
+{
+out->bitbuf |= value << out->bitcount;
+out->bitcount += n;
+while (out->bitcount >= 8)
+  {
+  out_ensure(out, 1);
+  out->buffer[out->used++] = out->bitbuf & 0xff;
+  out->bitbuf >>= 8;
+  out->bitcount -= 8;
+  }
+}
+
+/* Pad to a byte boundary with zero bits. */
+
+static void
+out_align(dfl_output *out)
+{
+if (out->bitcount > 0) out_bits(out, 0, 8 - out->bitcount);
+}
+
+/* Add whole bytes; must be on a byte boundary. */
+
+static void
+out_bytes(dfl_output *out, const uschar *s, size_t n)
+{
+out_ensure(out, n);
+memcpy(out->buffer + out->used, s, n);
+out->used += n;
+}
+
+
+
+/*************************************************
+*           Find length and distance codes       *
+*************************************************/
+
+static int
+length_code(int len)
+{
+int i;
+for (i = 28; length_base[i] > len; i--) {};
+return i;
+}
+
+static int
+dist_code(int dist)
+{
+int i;
+for (i = 29; dist_base[i] > dist; i--) {};
+return i;
+}
+
+
+
+/*************************************************
+*       Compute length-limited Huffman code      *
+*************************************************/
+
+/* This computes code lengths for a set of symbol frequencies using the
+standard Huffman algorithm. If the longest code exceeds the limit, the
+frequencies are flattened and the computation is repeated. This is not optimal
+(the package-merge algorithm would be) but the difference is negligible. At
+least two symbols are always given codes, because some decoders do not like
+single-code trees.
+
+Arguments:
+  freq      the symbol frequencies
+  n         the number of symbols
+  limit     the maximum code length
+  lens      where to return the code lengths
+
+Returns:    nothing
+*/
+
+static void
+build_lengths(const uint32_t *freq, int n, int limit, uint8_t *lens)
+{
+uint32_t f[LITLEN_CODES];
+uint32_t weight[2*LITLEN_CODES];
+int parent[2*LITLEN_CODES];
+BOOL active[2*LITLEN_CODES];
+int used = 0;
+
+memset(lens, 0, n);
+for (int i = 0; i < n; i++)
+  {
+  f[i] = freq[i];
+  if (f[i] != 0) used++;
+  }
+
+/* Cases that do not need a tree. */
+
+if (used < 2)
+  {
+  int first = -1;
+  for (int i = 0; i < n; i++) if (f[i] != 0) { first = i; break; }
+  if (first < 0) first = 0;
+  lens[first] = 1;
+  lens[(first == 0)? 1 : 0] = 1;
+  return;
+  }
+
+for (;;)
+  {
+  int nodes = n;
+  int remaining = used;
+  int maxlen = 0;
+
+  for (int i = 0; i < n; i++)
+    {
+    weight[i] = f[i];
+    active[i] = f[i] != 0;
+    parent[i] = -1;
+    }
+
+  /* Repeatedly combine the two lightest active nodes. */
+
+  while (remaining > 1)
+    {
+    int m1 = -1, m2 = -1;
+    for (int i = 0; i < nodes; i++)
+      {
+      if (!active[i]) continue;
+      if (m1 < 0 || weight[i] < weight[m1])
+        {
+        m2 = m1;
+        m1 = i;
+        }
+      else if (m2 < 0 || weight[i] < weight[m2]) m2 = i;
+      }
+    weight[nodes] = weight[m1] + weight[m2];
+    active[nodes] = TRUE;
+    parent[nodes] = -1;
+    active[m1] = active[m2] = FALSE;
+    parent[m1] = parent[m2] = nodes;
+    nodes++;
+    remaining--;
+    }
+
+  /* The depth of each leaf is its code length. */
+
+  for (int i = 0; i < n; i++)
+    {
+    int depth = 0;
+    if (f[i] == 0) continue;
+    for (int j = i; parent[j] >= 0; j = parent[j]) depth++;
+    lens[i] = depth;
+    if (depth > maxlen) maxlen = depth;
+    }
+
+  if (maxlen <= limit) break;
+  for (int i = 0; i < n; i++) if (f[i] != 0) f[i] = (f[i] + 1)/2;
+  }
+}
+
+
+
+/*************************************************
+*       Compute canonical codes from lengths     *
+*************************************************/
+
+/* The codes are returned bit-reversed, ready for least-significant-first
+output.
+
+Arguments:
+  lens      the code lengths
+  n         the number of codes
+  codes     where to put the codes
+
+Returns:    nothing
+*/
+
+static void
+build_codes(const uint8_t *lens, int n, uint16_t *codes)
+{
+int count[16];
+int next[16];
+int code = 0;
+
+memset(count, 0, sizeof(count));
+for (int i = 0; i < n; i++) count[lens[i]]++;
+count[0] = 0;
+
+for (int b = 1; b < 16; b++)
+  {
+  code = (code + count[b-1]) << 1;
+  next[b] = code;
+  }
+
+for (int i = 0; i < n; i++)
+  {
+  int len = lens[i];
+  if (len != 0)
+    {
+    int c = next[len]++;
+    int r = 0;
+    for (int b = 0; b < len; b++)
+      {
+      r = (r << 1) | (c & 1);
+      c >>= 1;
+      }
+    codes[i] = r;
+    }
+  }
+}
+
+
+
+/*************************************************
+*           Set up the fixed Huffman codes       *
+*************************************************/
+
+static void
+fixed_lengths(uint8_t *ll, uint8_t *dl)
+{
+int i;
+for (i = 0; i < 144; i++) ll[i] = 8;
+for (; i < 256; i++) ll[i] = 9;
+for (; i < 280; i++) ll[i] = 7;
+for (; i < LITLEN_CODES; i++) ll[i] = 8;
+for (i = 0; i < DIST_CODES; i++) dl[i] = 5;
+}
+
+
+
+/*************************************************
+*       Run-length encode the code lengths       *
+*************************************************/
+
+/* The literal/length and distance code lengths are concatenated and encoded
+using the code length alphabet. The result is a list of symbols, with the
+extra bits for symbols 16-18 in the upper byte.
+
+Arguments:
+  lens      the concatenated lengths
+  n         the number of lengths
+  rle       where to put the encoded values
+
+Returns:    the number of encoded values
+*/
+
+static int
+rle_lengths(const uint8_t *lens, int n, uint16_t *rle)
+{
+int count = 0;
+
+for (int i = 0; i < n;)
+  {
+  int v = lens[i];
+  int run = 1;
+  while (i + run < n && lens[i + run] == v) run++;
+
+  if (v == 0 && run >= 3)
+    {
+    if (run > 138) run = 138;
+    if (run >= 11) rle[count++] = 18 | ((run - 11) << 8);
+      else rle[count++] = 17 | ((run - 3) << 8);
+    i += run;
+    }
+
+  else if (v != 0 && run >= 4)
+    {
+    rle[count++] = v;
+    i++;
+    run--;
+    while (run >= 3)
+      {
+      int r = (run > 6)? 6 : run;
+      rle[count++] = 16 | ((r - 3) << 8);
+      i += r;
+      run -= r;
+      }
+    }
+
+  else
+    {
+    rle[count++] = v;
+    i++;
+    }
+  }
+
+return count;
+}
+
+
+
+/*************************************************
+*        Cost of encoding a block's symbols      *
+*************************************************/
+
+/* Computes the number of bits needed for the symbols (excluding any header)
+with a given pair of code length tables. */
+
+static size_t
+symbol_cost(const uint32_t *lfreq, const uint32_t *dfreq, const uint8_t *ll,
+  const uint8_t *dl)
+{
+size_t bits = 0;
+for (int i = 0; i < LITLEN_CODES; i++)
+  {
+  bits += (size_t)lfreq[i] * ll[i];
+  if (i > END_BLOCK && i < 286)
+    bits += (size_t)lfreq[i] * length_extra[i - 257];
+  }
+for (int i = 0; i < DIST_CODES; i++)
+  bits += (size_t)dfreq[i] * (dl[i] + dist_extra[i]);
+return bits;
+}
+
+
+
+/*************************************************
+*                Output one block                *
+*************************************************/
+
+/* This chooses the cheapest representation for a block of symbols and writes
+it to the output.
+
+Arguments:
+  out       the output control block
+  blk       the saved symbols
+  data      the input data
+  end       the offset of the end of the block's input
+  final     TRUE for the last block
+
+Returns:    nothing
+*/
+
+static void
+write_block(dfl_output *out, dfl_block *blk, const uschar *data, size_t end,
+  BOOL final)
+{
+uint32_t lfreq[LITLEN_CODES], dfreq[DIST_CODES], cfreq[CLEN_CODES];
+uint8_t ll[LITLEN_CODES], dl[DIST_CODES], cl[CLEN_CODES];
+uint8_t fll[LITLEN_CODES], fdl[DIST_CODES];
+uint8_t all[LITLEN_CODES + DIST_CODES];
+uint16_t lcodes[LITLEN_CODES], dcodes[DIST_CODES], ccodes[CLEN_CODES];
+uint16_t rle[LITLEN_CODES + DIST_CODES];
+size_t dyn_cost, fix_cost, stored_cost;
+size_t rawlen = end - blk->start;
+int hlit, hdist, hclen, rlecount;
+
+memset(lfreq, 0, sizeof(lfreq));
+memset(dfreq, 0, sizeof(dfreq));
+memset(cfreq, 0, sizeof(cfreq));
+
+for (int i = 0; i < blk->count; i++)
+  {
+  if (blk->dist[i] == 0) lfreq[blk->litlen[i]]++; else
+    {
+    lfreq[257 + length_code(blk->litlen[i])]++;
+    dfreq[dist_code(blk->dist[i])]++;
+    }
+  }
+lfreq[END_BLOCK] = 1;
+
+/* Dynamic codes and the cost of the header that describes them. */
+
+build_lengths(lfreq, 286, 15, ll);
+ll[286] = ll[287] = 0;
+build_lengths(dfreq, DIST_CODES, 15, dl);
+
+for (hlit = 286; hlit > 257 && ll[hlit-1] == 0; hlit--) {};
+for (hdist = DIST_CODES; hdist > 1 && dl[hdist-1] == 0; hdist--) {};
+
+memcpy(all, ll, hlit);
+memcpy(all + hlit, dl, hdist);
+rlecount = rle_lengths(all, hlit + hdist, rle);
+for (int i = 0; i < rlecount; i++) cfreq[rle[i] & 0xff]++;
+build_lengths(cfreq, CLEN_CODES, 7, cl);
+for (hclen = CLEN_CODES; hclen > 4 && cl[clen_order[hclen-1]] == 0; hclen--) {};
+
+dyn_cost = 3 + 5 + 5 + 4 + 3 * hclen + symbol_cost(lfreq, dfreq, ll, dl);
+for (int i = 0; i < rlecount; i++)
+  {
+  int sym = rle[i] & 0xff;
+  dyn_cost += cl[sym] + ((sym == 16)? 2 : (sym == 17)? 3 : (sym == 18)? 7 : 0);
+  }
+
+/* Fixed codes */
+
+fixed_lengths(fll, fdl);
+fix_cost = 3 + symbol_cost(lfreq, dfreq, fll, fdl);
+
+/* Stored blocks: allow for alignment and a 4-byte header for each 64K. */
+
+stored_cost = ((rawlen + STORED_MAX - 1)/STORED_MAX) * (3 + 7 + 32) +
+  rawlen * 8;
+if (rawlen == 0) stored_cost = 3 + 7 + 32;
+
+/* Write stored block(s) */
+
+if (stored_cost < dyn_cost && stored_cost < fix_cost)
+  {
+  size_t p = blk->start;
+  do
+    {
+    size_t n = end - p;
+    uschar header[4];
+    if (n > STORED_MAX) n = STORED_MAX;
+    out_bits(out, (final && p + n == end)? 1 : 0, 1);
+    out_bits(out, 0, 2);
+    out_align(out);
+    header[0] = n & 0xff;
+    header[1] = n >> 8;
+    header[2] = ~n & 0xff;
+    header[3] = (~n >> 8) & 0xff;
+    out_bytes(out, header, 4);
+    out_bytes(out, data + p, n);
+    p += n;
+    }
+  while (p < end);
+  return;
+  }
+
+/* Write a Huffman-coded block, with the header for dynamic codes if needed.
+*/
+
+out_bits(out, final? 1 : 0, 1);
+
+if (fix_cost <= dyn_cost)
+  {
+  out_bits(out, 1, 2);
+  memcpy(ll, fll, sizeof(ll));
+  memcpy(dl, fdl, sizeof(dl));
+  }
+else
+  {
+  out_bits(out, 2, 2);
+  out_bits(out, hlit - 257, 5);
+  out_bits(out, hdist - 1, 5);
+  out_bits(out, hclen - 4, 4);
+  for (int i = 0; i < hclen; i++) out_bits(out, cl[clen_order[i]], 3);
+  build_codes(cl, CLEN_CODES, ccodes);
+  for (int i = 0; i < rlecount; i++)
+    {
+    int sym = rle[i] & 0xff;
+    int extra = rle[i] >> 8;
+    out_bits(out, ccodes[sym], cl[sym]);
+    if (sym == 16) out_bits(out, extra, 2);
+      else if (sym == 17) out_bits(out, extra, 3);
+        else if (sym == 18) out_bits(out, extra, 7);
+    }
+  }
+
+build_codes(ll, LITLEN_CODES, lcodes);
+build_codes(dl, DIST_CODES, dcodes);
+
+for (int i = 0; i < blk->count; i++)
+  {
+  int v = blk->litlen[i];
+  int d = blk->dist[i];
+
+  if (d == 0) out_bits(out, lcodes[v], ll[v]); else
+    {
+    int lc = length_code(v);
+    int dc = dist_code(d);
+    out_bits(out, lcodes[257 + lc], ll[257 + lc]);
+    if (length_extra[lc] != 0)
+      out_bits(out, v - length_base[lc], length_extra[lc]);
+    out_bits(out, dcodes[dc], dl[dc]);
+    if (dist_extra[dc] != 0)
+      out_bits(out, d - dist_base[dc], dist_extra[dc]);
+    }
+  }
+
+out_bits(out, lcodes[END_BLOCK], ll[END_BLOCK]);
+}
+
+
+
+/*************************************************
+*          Compress data in zlib format          *
+*************************************************/
+
+/* The result is in a block of memory that is obtained by malloc(); the caller
+must free it.
+
+Arguments:
+  data      the data to compress
+  len       its length
+  level     the compression level, 1-9
+  outlen    where to return the length of the compressed data
+
+Returns:    pointer to the compressed data
+*/
+
+uschar *
+deflate_compress(const uschar *data, size_t len, int level, size_t *outlen)
+{
+dfl_output out;
+dfl_block *blk;
+int32_t *head, *prev;
+size_t inserted = 0;
+size_t pos = 0;
+uint32_t adler_a = 1, adler_b = 0;
+int chain, nice;
+BOOL lazy;
+int flevel;
+
+if (level < 1) level = 1;
+if (level > 9) level = 9;
+chain = levels[level].chain;
+nice = levels[level].nice;
+lazy = levels[level].lazy;
+
+out.size = len/2 + 64;
+out.used = 0;
+out.bitbuf = 0;
+out.bitcount = 0;
+out.buffer = malloc(out.size);
+blk = malloc(sizeof(dfl_block));
+head = malloc(HASH_SIZE * sizeof(int32_t));
+prev = malloc(WSIZE * sizeof(int32_t));
+
+if (out.buffer == NULL || blk == NULL || head == NULL || prev == NULL)
+  error(ERR0, "", "PDF stream compression", out.size);  /* Hard */
+
+for (int i = 0; i < HASH_SIZE; i++) head[i] = -1;
+blk->count = 0;
+blk->start = 0;
+
+/* The zlib header: 32K window, deflate, and a level indication. */
+
+flevel = (level < 2)? 0 : (level < 6)? 1 : (level == 6)? 2 : 3;
+out.buffer[out.used++] = 0x78;
+out.buffer[out.used++] = (flevel << 6) + 31 - ((0x7800 + (flevel << 6)) % 31);
+
+/* The main LZ77 loop. Each position is inserted into the hash chains exactly
+once, in order, just before it is first searched from. */
+
+#define HASH(p) ((((uint32_t)data[p] << 10) ^ ((uint32_t)data[p+1] << 5) ^ \
+  data[p+2]) & (HASH_SIZE - 1))
+
+while (pos < len)
+  {
+  int best_len = 0;
+  int best_dist = 0;
+
+  for (int step = 0; step < 2; step++)
+    {
+    size_t p = pos + step;
+    int this_len = 0;
+    int this_dist = 0;
+    int limit = chain;
+    int32_t cand;
+
+    if (p + MIN_MATCH > len) break;
+
+    while (inserted < p)
+      {
+      if (inserted + MIN_MATCH <= len)
+        {
+        uint32_t h = HASH(inserted);
+        prev[inserted & WMASK] = head[h];
+        head[h] = (int32_t)inserted;
+        }
+      inserted++;
+      }
+
+    /* Search the chain for the longest match. Stop if the chain leads out of
+    the window or goes forwards, which can happen when a slot in "prev" has
+    been re-used. */
+
+    for (cand = head[HASH(p)];
+         cand >= 0 && p - cand <= WSIZE && limit-- > 0;
+         )
+      {
+      size_t maxlen = len - p;
+      int32_t next;
+      int n = 0;
+
+      if (maxlen > MAX_MATCH) maxlen = MAX_MATCH;
+      if ((size_t)this_len >= maxlen) break;
+      if (data[cand + this_len] == data[p + this_len])
+        {
+        while ((size_t)n < maxlen && data[cand + n] == data[p + n]) n++;
+        if (n > this_len)
+          {
+          this_len = n;
+          this_dist = (int)(p - cand);
+          if (n >= nice) break;
+          }
+        }
+      next = prev[cand & WMASK];
+      if (next >= cand) break;
+      cand = next;
+      }
+
+    if (this_len < MIN_MATCH) this_len = 0;
+
+    if (step == 0)
+      {
+      best_len = this_len;
+      best_dist = this_dist;
+      if (best_len == 0 || !lazy || best_len >= nice) break;
+      }
+
+    /* A longer match starts at the next byte; output a literal instead. */
+
+    else if (this_len > best_len) best_len = -1;
+    }
+
+  if (best_len > 0)
+    {
+    blk->litlen[blk->count] = best_len;
+    blk->dist[blk->count++] = best_dist;
+    pos += best_len;
+    }
+  else
+    {
+    blk->litlen[blk->count] = data[pos];
+    blk->dist[blk->count++] = 0;
+    pos++;
+    }
+
+  if (blk->count >= BLOCK_SYMBOLS)
+    {
+    write_block(&out, blk, data, pos, pos >= len);
+    blk->count = 0;
+    blk->start = pos;
+    if (pos >= len) break;
+    }
+  }
+
+#undef HASH
+
+/* Write the final block, which may be empty, and the Adler-32 checksum. */
+
+if (blk->count > 0 || len == 0 || blk->start < len)
+  write_block(&out, blk, data, len, TRUE);
+out_align(&out);
+
+for (size_t i = 0; i < len; i++)
+  {
+  adler_a = (adler_a + data[i]) % 65521;
+  adler_b = (adler_b + adler_a) % 65521;
+  }
+
+out_ensure(&out, 4);
+out.buffer[out.used++] = adler_b >> 8;
+out.buffer[out.used++] = adler_b & 0xff;
+out.buffer[out.used++] = adler_a >> 8;
+out.buffer[out.used++] = adler_a & 0xff;
+
+free(blk);
+free(head);
+free(prev);
+
+*outlen = out.used;
+return out.buffer;
+}
+
+/* End of deflate.c */
@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: February 2021 */
-/* This file last modified: April 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -279,6 +279,10 @@ static draw_op draw_operators[] = {
 
 static int draw_operator_count = sizeof(draw_operators)/sizeof(draw_op);
 
+/* Perfect hash for the table, set up when first needed */
+
+static keyhashstr draw_operator_hash = { NULL, 0, 0, 0, 0, NULL, NULL };
+
 
 
 /*************************************************
@@ -351,7 +355,7 @@ Returns:    pointer to a textstr
 drawtextstr *
 read_draw_text(void)
 {
-drawtextstr *textptr = mem_get(sizeof(drawtextstr));
+drawtextstr *textptr = mem_get(sizeof(drawtextstr), mt_draw);
 
 if ((textptr->text = string_read(font_rm, TRUE)) == NULL) return NULL;
 
@@ -488,7 +492,7 @@ Returns:   nothing
 void
 read_draw_definition(void)
 {
-tree_node *drawnode = mem_get(sizeof(tree_node));
+tree_node *drawnode = mem_get(sizeof(tree_node), mt_draw);
 drawitem *ptr;
 size_t left;
 int bracount = 0;
@@ -497,7 +501,7 @@ read_nextword();
 if (read_wordbuffer[0] == 0) { error(ERR8, "name"); return; }
 
 drawnode->name = mem_copystring(read_wordbuffer);
-drawnode->data = mem_get(DRAW_CHUNKSIZE);
+drawnode->data = mem_get(DRAW_CHUNKSIZE, mt_draw);
 
 ptr = (drawitem *)drawnode->data;
 left = DRAW_CHUNKSIZE/sizeof(drawitem);
@@ -564,7 +568,7 @@ for (;;)
           next_variable--;
           }
         value = next_variable++;
-        node = mem_get(sizeof(tree_node));
+        node = mem_get(sizeof(tree_node), mt_draw);
         node->name = mem_copystring(read_wordbuffer);
         node->value = value;
         tree_insert(&draw_variable_tree, node);
@@ -600,20 +604,16 @@ for (;;)
 
     else
       {
-      draw_op *first = draw_operators;
-      draw_op *last = first + draw_operator_count;
+      int n;
 
       /* Search for a standard variable or operator; if found, the type is set
       but there is no data. */
 
-      while (last > first)
-        {
-        int c;
-        draw_op *middle = first + (last - first)/2;
-        c = Ustrcmp(middle->name, read_wordbuffer);
-        if (c == 0) { type = middle->value; break; }
-        if (c > 0) last = middle; else first = middle + 1;
-        }
+      if (draw_operator_hash.table == NULL)
+        misc_keyhash_build(&draw_operator_hash, draw_operators,
+          draw_operator_count, sizeof(draw_op));
+      n = misc_keyhash_find(&draw_operator_hash, read_wordbuffer);
+      if (n >= 0) type = draw_operators[n].value;
       }
 
     /* If haven't matched a standard variable or operator, try for a user
@@ -647,7 +647,7 @@ for (;;)
   if (left < 4)
     {
     (ptr++)->d.val = dr_jump;
-    ptr->d.ptr = mem_get(DRAW_CHUNKSIZE);
+    ptr->d.ptr = mem_get(DRAW_CHUNKSIZE, mt_draw);
     ptr = (drawitem *)(ptr->d.ptr);
     left = DRAW_CHUNKSIZE/sizeof(drawitem);
     }
@@ -677,6 +677,55 @@ if (!tree_insert(&draw_tree, drawnode)) error(ERR16, drawnode->name);
 
 
 
+/*************************************************
+*      Record a draw program for the cache       *
+*************************************************/
+
+/* This is called when a score is being saved in a cache file. The layout of a
+compiled drawing function is private to this module, so the pointers that it
+contains are found here. A jump to a continuation chunk ends the scan, because
+the chunk is recorded as another program.
+
+Argument:  the start of the program or of a continuation chunk
+Returns:   nothing
+*/
+
+void
+draw_cache_program(drawitem *p)
+{
+for (;;)
+  {
+  switch ((p++)->d.val)
+    {
+    case dr_end:
+    return;
+
+    case dr_jump:
+    scorecache_pointer(&(p->d.ptr), sc_drawprog);
+    return;
+
+    case dr_number:
+    case dr_varname:
+    case dr_varref:
+    p++;
+    break;
+
+    case dr_text:
+    scorecache_pointer(&((p++)->d.ptr), sc_drawtext);
+    break;
+
+    case dr_draw:
+    scorecache_pointer(&((p++)->d.ptr), sc_drawnode);
+    break;
+
+    default:
+    break;
+    }
+  }
+}
+
+
+
 /*************************************************
 *     Generate an error while drawing            *
 *************************************************/
@@ -760,7 +809,7 @@ setup_overdraw(int32_t thickness, int32_t *x, int32_t *y, int *c)
 {
 overdrawstr *last = out_overdraw;
 overdrawstr *new = mem_get_cached((void **)(&main_freeoverdrawstr),
-  sizeof(overdrawstr));
+  sizeof(overdrawstr), mt_draw);
 
 if (last == NULL) out_overdraw = new; else
   {
@@ -776,13 +825,13 @@ new->d.g.dash[1] = dash[1];
 new->d.g.linewidth = thickness;
 new->d.g.ystave = out_ystave;
 
-new->d.g.x = mem_get(xp*sizeof(int32_t));
+new->d.g.x = mem_get(xp*sizeof(int32_t), mt_draw);
 memcpy(new->d.g.x, x, xp*sizeof(int32_t));
 
-new->d.g.y = mem_get(yp*sizeof(int32_t));
+new->d.g.y = mem_get(yp*sizeof(int32_t), mt_draw);
 memcpy(new->d.g.y, y, yp*sizeof(int32_t));
 
-new->d.g.c = mem_get(cp*sizeof(int));
+new->d.g.c = mem_get(cp*sizeof(int), mt_draw);
 memcpy(new->d.g.c, c, cp*sizeof(int));
 }
 
@@ -1172,7 +1221,7 @@ while (p->d.val != dr_end)
       size_t len = (strlen(s) + 1) * sizeof(uint32_t);
       uint32_t *sp = string_pmw(US s, f);
 
-      d->text = mem_get(len);
+      d->text = mem_get(len, mt_draw);
       memcpy(d->text, sp, len);
       draw_stack[out_drawstackptr].dtype = dd_text;
       draw_stack[out_drawstackptr++].d.ptr = d;
@@ -1614,7 +1663,7 @@ while (p->d.val != dr_end)
           {
           overdrawstr *last = out_overdraw;
           overdrawstr *new = mem_get_cached((void **)(&main_freeoverdrawstr),
-            sizeof(overdrawstr));
+            sizeof(overdrawstr), mt_draw);
 
           if (last == NULL) out_overdraw = new; else
             {
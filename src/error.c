@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: December 2020 */
-/* This file last modified: January 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -304,7 +304,14 @@ aborts the run after outputting additional information. */
 { ec_major,   "Too many augmentation dots for short note" },
 /* 200-204 */
 { ec_warning, "unexpected fclose error for %s: %s" },
-{ ec_failed,  "Unexpected %s error: %s" }
+{ ec_failed,  "Unexpected %s error: %s" },
+{ ec_failed,  "-%s must be in the range %d to %d on command line" },
+{ ec_failed,  "internal error: bar item \"%s\" has size %zd (expected %zd)" },
+{ ec_failed,  "server job: %s" },
+/* 205-209 */
+{ ec_failed,  "%s: %s failed: %s" },
+{ ec_failed,  "an input file name cannot be given on the command line with %s" },
+{ ec_failed,  "-batch cannot be used with -server or -socket" }
 };
 
 #define ERROR_MAXERROR (int)(sizeof(error_data)/sizeof(error_struct))
@@ -530,4 +537,23 @@ va_start(ap, skip);
 return error_basic(n, skip, ap);
 }
 
+
+
+/*************************************************
+*         Count errors and warnings              *
+*************************************************/
+
+/* This is used to find out whether any messages were output while an input
+file was being read.
+
+Arguments:  none
+Returns:    the total number of errors and warnings so far
+*/
+
+usint
+error_get_count(void)
+{
+return error_count + warning_count;
+}
+
 /* End of error.c */
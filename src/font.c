@@ -4,10 +4,78 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: January 2021 */
-/* This file last modified: January 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Magic identifier at the start of a font metrics cache file. Change the
+number if the layout of the file changes. */
+
+#define FONTCACHE_MAGIC  "PMWfmc2"
+
+/* The header of a font metrics cache file. The fields up to and including
+"pdf" form the key that is used to validate the file; the remainder describe
+the data that follows, which is, in order: the widths and right-to-left
+adjustments, the heights (if any), the kern table, the Unicode translation
+table, the high character tree items, and the encoding (if any) as a vector of
+offsets followed by the glyph names. */
+
+typedef struct {
+  char     magic[8];
+  char     version[16];
+  uschar   afmname[256];
+  uschar   utrname[256];
+  int64_t  afmmtime;
+  int64_t  afmsize;
+  int64_t  utrmtime;
+  int64_t  utrsize;
+  uint32_t pdf;            /* Encoding is built from the AFM only for PDF */
+  uint32_t flags;          /* Flags set from the AFM file */
+  uint32_t invalid;
+  int32_t  ascent;
+  int32_t  descent;
+  int32_t  capheight;
+  int32_t  italicangle;
+  int32_t  stemv;
+  int32_t  bbox[4];
+  int32_t  kerncount;
+  int32_t  utrcount;
+  int32_t  highcount;
+  int32_t  hasheights;
+  uint32_t encsize;        /* Size of glyph names; 0 if no encoding */
+} fontcache_header;
+
+/* A copy of the music font file that is preloaded in server and batch modes,
+with the directories that were searched to find it. */
+
+static uschar *music_data = NULL;
+static size_t  music_size;
+static const char *music_ext;
+static uschar *music_extra;
+static uschar *music_default;
+
+/* Copies of font metrics cache data that jobs have passed back to the server,
+for use by later jobs. The data follows the block. */
+
+typedef struct fontserverstr {
+  struct fontserverstr *next;
+  size_t size;
+} fontserverstr;
+
+static fontserverstr *font_server_data = NULL;
+
+/* An item in the cached high character tree */
+
+typedef struct {
+  uschar  name[8];
+  int32_t value;
+} fontcache_high;
+
 
 /*************************************************
 *     Convert character name to Unicode value    *
@@ -47,25 +115,164 @@ return -1;
 
 
 /*************************************************
-*        Kern table sorting comparison           *
+*          Hash a kerning pair                   *
 *************************************************/
 
-/* This is the auxiliary routine used for comparing kern table entries when
-sorting them.
+/*
+Arguments:
+  a          the first character
+  b          the second character
+
+Returns:     a hash value
+*/
+
+static inline uint32_t
+kern_hash(uint32_t a, uint32_t b)
+{
+return (a * 2654435761u) ^ (b * 40503u);
+}
+
+
+
+/*************************************************
+*       Build kerning lookup for a font          *
+*************************************************/
+
+/* This is called when the kerning table for a font has been read, either from
+an AFM file or from a cache. Pairs whose characters are both less than
+KERN_DIRECT go into a two-level direct index: the first level is indexed by the
+first character, and points to a vector of kern values indexed by the second
+character, or is NULL if there are no kerns for the first character. Other
+pairs go into an open-addressed hash table whose size is a power of two, at
+least twice the number of pairs. Zero kerns are never stored, so a zero kwidth
+marks an empty hash slot. If a pair is duplicated, the first one is used.
+
+Argument:   the font structure
+Returns:    nothing
+*/
+
+static void
+font_buildkerns(fontstr *fs)
+{
+int32_t *vectors;
+int vcount = 0;
+int hcount = 0;
+uint32_t hsize = 8;
+
+fs->kernindex = NULL;
+fs->kernhash = NULL;
+fs->kernhashmask = 0;
+if (fs->kerncount <= 0) return;
+
+/* Set up the first-level index and count how many second-level vectors and
+hashed pairs are needed. */
+
+fs->kernindex = mem_get_independent(KERN_DIRECT * sizeof(int32_t *), mt_font);
+memset(fs->kernindex, 0, KERN_DIRECT * sizeof(int32_t *));
+
+for (int i = 0; i < fs->kerncount; i++)
+  {
+  kerntablestr *k = fs->kerns + i;
+  if (k->left < KERN_DIRECT && k->right < KERN_DIRECT)
+    {
+    if (fs->kernindex[k->left] == NULL)
+      {
+      fs->kernindex[k->left] = (int32_t *)fs;   /* Non-NULL marker */
+      vcount++;
+      }
+    }
+  else hcount++;
+  }
+
+/* Allocate the second-level vectors in one block, and fill them in. */
+
+vectors = mem_get_independent(vcount * KERN_DIRECT * sizeof(int32_t), mt_font);
+memset(vectors, 0, vcount * KERN_DIRECT * sizeof(int32_t));
+
+for (int i = 0; i < KERN_DIRECT; i++)
+  {
+  if (fs->kernindex[i] == NULL) continue;
+  fs->kernindex[i] = vectors;
+  vectors += KERN_DIRECT;
+  }
+
+/* Set up the hash table if there are any wide character pairs. */
+
+if (hcount > 0)
+  {
+  while (hsize < 2 * (uint32_t)hcount) hsize <<= 1;
+  fs->kernhashmask = hsize - 1;
+  fs->kernhash = mem_get_independent(hsize * sizeof(kerntablestr), mt_font);
+  memset(fs->kernhash, 0, hsize * sizeof(kerntablestr));
+  }
+
+for (int i = 0; i < fs->kerncount; i++)
+  {
+  kerntablestr *k = fs->kerns + i;
+
+  if (k->left < KERN_DIRECT && k->right < KERN_DIRECT)
+    {
+    int32_t *kp = fs->kernindex[k->left] + k->right;
+    if (*kp == 0) *kp = k->kwidth;
+    }
+
+  else
+    {
+    uint32_t h = kern_hash(k->left, k->right) & fs->kernhashmask;
+    kerntablestr *kh;
+    for (;;)
+      {
+      kh = fs->kernhash + h;
+      if (kh->kwidth == 0 || (kh->left == k->left && kh->right == k->right))
+        break;
+      h = (h + 1) & fs->kernhashmask;
+      }
+    if (kh->kwidth == 0) *kh = *k;
+    }
+  }
+}
+
+
+
+/*************************************************
+*          Find the kern for a pair              *
+*************************************************/
+
+/* This is called for every pair of adjacent characters in a string when
+kerning is enabled.
 
 Arguments:
-  a          pointer to kerntable structure
-  b          pointer to kerntable structure
+  fs         the font structure
+  a          the first character
+  b          the second character
 
-Returns      difference between their "pair" values
+Returns:     the kern value in font units, or zero
 */
 
-static int
-kern_table_cmp(const void *a, const void *b)
+int32_t
+font_kern(fontstr *fs, uint32_t a, uint32_t b)
 {
-kerntablestr *ka = (kerntablestr *)a;
-kerntablestr *kb = (kerntablestr *)b;
-return (int)(ka->pair - kb->pair);
+if (a < KERN_DIRECT && b < KERN_DIRECT)
+  {
+  int32_t *kv;
+  if (fs->kernindex == NULL) return 0;
+  kv = fs->kernindex[a];
+  return (kv == NULL)? 0 : kv[b];
+  }
+
+if (fs->kernhash != NULL)
+  {
+  uint32_t h = kern_hash(a, b) & fs->kernhashmask;
+  for (;;)
+    {
+    kerntablestr *kh = fs->kernhash + h;
+    if (kh->kwidth == 0) break;
+    if (kh->left == a && kh->right == b) return kh->kwidth;
+    h = (h + 1) & fs->kernhashmask;
+    }
+  }
+
+return 0;
 }
 
 
@@ -184,6 +391,79 @@ return f;
 
 
 
+/*************************************************
+*          Preload the music font file           *
+*************************************************/
+
+/* This is called in server and batch modes, before any jobs are run, so that
+the music font file that is embedded in the output (the .otf file for PDF or
+the .pfa file for PostScript) is read only once. The directories that were
+searched are remembered, because a job may change them.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+font_preload_music(void)
+{
+FILE *f;
+long size;
+uschar buffer[256];
+const char *ext = PDF? ".otf" : ".pfa";
+
+f = font_finddata(US"PMW-Music", ext, font_music_extra, font_music_default,
+  buffer, FALSE);
+if (f == NULL) return;
+
+if (fseek(f, 0, SEEK_END) == 0 && (size = ftell(f)) > 0 &&
+    fseek(f, 0, SEEK_SET) == 0)
+  {
+  music_data = mem_get_independent((size_t)size, mt_misc);
+  if (fread(music_data, 1, (size_t)size, f) == (size_t)size)
+    {
+    music_size = (size_t)size;
+    music_ext = ext;
+    music_extra = font_music_extra;
+    music_default = font_music_default;
+    }
+  else music_data = NULL;
+  }
+(void)fclose(f);
+}
+
+
+
+/*************************************************
+*            Open the music font file            *
+*************************************************/
+
+/* If the file has been preloaded from the same directories, a stream that
+reads the copy in memory is returned. Otherwise the file is found in the usual
+way, with a hard error if it cannot be found.
+
+Arguments:
+  ext        the file's extension
+  filename   where to return the file name (unset when preloaded)
+
+Returns:     the opened file
+*/
+
+FILE *
+font_open_music(const char *ext, uschar *filename)
+{
+if (music_data != NULL && Ustrcmp(ext, music_ext) == 0 &&
+    font_music_extra == music_extra && font_music_default == music_default)
+  {
+  FILE *f = fmemopen(music_data, music_size, "r");
+  if (f != NULL) return f;
+  }
+return font_finddata(US"PMW-Music", ext, font_music_extra, font_music_default,
+  filename, TRUE);
+}
+
+
+
 /*************************************************
 *        Check character value in std font       *
 *************************************************/
@@ -215,12 +495,558 @@ return (t == NULL)? c : (uint32_t)(LOWCHARLIMIT + t->value);
 
 
 
+/*************************************************
+*     Compute the size of a font cache file      *
+*************************************************/
+
+/*
+Argument:  the cache header
+Returns:   the total size of the file, or 0 if the header is unreasonable
+*/
+
+static size_t
+fontcache_size(fontcache_header *h)
+{
+if (h->kerncount < 0 || h->utrcount < 0 || h->highcount < 0) return 0;
+return sizeof(fontcache_header) +
+  2 * FONTWIDTHS_SIZE * sizeof(int32_t) +
+  ((h->hasheights != 0)? 256 * sizeof(int32_t) : 0) +
+  h->kerncount * sizeof(kerntablestr) +
+  h->utrcount * sizeof(utrtablestr) +
+  h->highcount * sizeof(fontcache_high) +
+  ((h->encsize != 0)? FONTWIDTHS_SIZE * sizeof(uint32_t) + h->encsize : 0);
+}
+
+
+
+/*************************************************
+*        Set up the key for a font cache         *
+*************************************************/
+
+/* The cache file for a font is identified by a hash of the AFM file name and
+the output format, and it is validated against the names, modification times,
+and sizes of the AFM and .utr files, and the PMW version.
+
+Arguments:
+  h           the header to set up
+  afmname     the AFM file name
+  fa          the open AFM file
+  utrname     the .utr file name
+  fu          the open .utr file or NULL
+  cachename   where to return the cache file name (empty if there is no
+                cache directory)
+  size        the size of the cachename buffer
+
+Returns:      TRUE if all is well; FALSE if the cache name is too long
+*/
+
+static BOOL
+fontcache_key(fontcache_header *h, uschar *afmname, FILE *fa, uschar *utrname,
+  FILE *fu, uschar *cachename, size_t size)
+{
+struct stat st;
+uint32_t hash = 2166136261u;    /* FNV-1a */
+uschar *fontname;
+size_t len;
+int n;
+
+memset(h, 0, sizeof(fontcache_header));
+memcpy(h->magic, FONTCACHE_MAGIC, sizeof(h->magic));
+(void)strncpy(h->version, PMW_VERSION, sizeof(h->version) - 1);
+len = Ustrlen(afmname);
+if (len >= sizeof(h->afmname)) len = sizeof(h->afmname) - 1;
+memcpy(h->afmname, afmname, len);
+h->afmname[len] = 0;
+if (fstat(fileno(fa), &st) == 0)
+  {
+  h->afmmtime = (int64_t)st.st_mtime;
+  h->afmsize = (int64_t)st.st_size;
+  }
+if (fu != NULL)
+  {
+  len = Ustrlen(utrname);
+  if (len >= sizeof(h->utrname)) len = sizeof(h->utrname) - 1;
+  memcpy(h->utrname, utrname, len);
+  h->utrname[len] = 0;
+  if (fstat(fileno(fu), &st) == 0)
+    {
+    h->utrmtime = (int64_t)st.st_mtime;
+    h->utrsize = (int64_t)st.st_size;
+    }
+  }
+h->pdf = PDF? 1 : 0;
+
+for (uschar *p = afmname; *p != 0; p++) hash = (hash ^ *p) * 16777619u;
+hash = (hash ^ (h->pdf + '0')) * 16777619u;
+
+/* Use just the final component of the AFM file's name, without ".afm". */
+
+if (font_cache_dir == NULL)
+  {
+  *cachename = 0;
+  return TRUE;
+  }
+
+fontname = Ustrrchr(afmname, '/');
+fontname = (fontname == NULL)? afmname : fontname + 1;
+n = snprintf(CS cachename, size, "%s/%.*s-%08x.fmc", font_cache_dir,
+  (int)Ustrlen(fontname) - 4, fontname, hash);
+return n > 0 && (size_t)n < size;
+}
+
+
+
+/*************************************************
+*      Set up a font from cached font data       *
+*************************************************/
+
+/* The data is used where it is, which must be memory that is private to the
+process, because the few places that modify the width table and the encoding
+write to it. The encoding vector and the high character tree are rebuilt in
+ordinary memory, pointing to names in the data.
+
+Arguments:
+  fs          the font structure
+  base        the start of the data, which has been validated
+
+Returns:      nothing
+*/
+
+static void
+fontcache_use(fontstr *fs, uschar *base)
+{
+fontcache_header *h = (fontcache_header *)base;
+uschar *p;
+
+fs->flags |= h->flags;
+fs->invalid = h->invalid;
+fs->ascent = h->ascent;
+fs->descent = h->descent;
+fs->capheight = h->capheight;
+fs->italicangle = h->italicangle;
+fs->stemv = h->stemv;
+memcpy(fs->bbox, h->bbox, 4*sizeof(int32_t));
+
+p = base + sizeof(fontcache_header);
+fs->widths = (int32_t *)p;
+p += FONTWIDTHS_SIZE * sizeof(int32_t);
+fs->r2ladjusts = (int32_t *)p;
+p += FONTWIDTHS_SIZE * sizeof(int32_t);
+
+if (h->hasheights != 0)
+  {
+  fs->heights = (int32_t *)p;
+  p += 256 * sizeof(int32_t);
+  }
+
+fs->kerncount = h->kerncount;
+if (h->kerncount > 0) fs->kerns = (kerntablestr *)p;
+p += h->kerncount * sizeof(kerntablestr);
+
+fs->utrcount = h->utrcount;
+if (h->utrcount > 0) fs->utr = (utrtablestr *)p;
+p += h->utrcount * sizeof(utrtablestr);
+
+for (int i = 0; i < h->highcount; i++)
+  {
+  fontcache_high *fh = (fontcache_high *)p;
+  tree_node *tc = mem_get(sizeof(tree_node), mt_font);
+  tc->name = fh->name;
+  tc->value = fh->value;
+  (void)tree_insert(&(fs->high_tree), tc);
+  p += sizeof(fontcache_high);
+  }
+
+/* Encoding offsets are stored plus one, so that zero means "no name". */
+
+if (h->encsize != 0)
+  {
+  uint32_t *offsets = (uint32_t *)p;
+  p += FONTWIDTHS_SIZE * sizeof(uint32_t);
+  fs->encoding = mem_get_independent(FONTWIDTHS_SIZE * sizeof(char *), mt_font);
+  for (int i = 0; i < FONTWIDTHS_SIZE; i++)
+    fs->encoding[i] = (offsets[i] == 0)? NULL : p + offsets[i] - 1;
+  }
+}
+
+
+
+/*************************************************
+*         Load font data from a cache file       *
+*************************************************/
+
+/* The cache file is mapped privately, so that the few places that modify the
+width table and the encoding do not change the file. The mapping lasts for the
+rest of the run. In a server job, the data is passed back to the server.
+
+Arguments:
+  fs          the font structure
+  cachename   the cache file name
+  key         the expected header key
+
+Returns:      TRUE if the data was loaded; FALSE if the file is missing or
+                out of date
+*/
+
+static BOOL
+fontcache_load(fontstr *fs, uschar *cachename, fontcache_header *key)
+{
+fontcache_header *h;
+struct stat st;
+uschar *base;
+int fd = open(CS cachename, O_RDONLY);
+
+if (fd < 0) return FALSE;
+if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(fontcache_header))
+  {
+  (void)close(fd);
+  return FALSE;
+  }
+
+base = mmap(NULL, st.st_size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+(void)close(fd);
+if (base == MAP_FAILED) return FALSE;
+
+h = (fontcache_header *)base;
+if (memcmp(h, key, offsetof(fontcache_header, flags)) != 0 ||
+    fontcache_size(h) != (size_t)st.st_size)
+  {
+  (void)munmap(base, st.st_size);
+  return FALSE;
+  }
+
+server_passback_write(pb_font, base, st.st_size);
+fontcache_use(fs, base);
+return TRUE;
+}
+
+
+
+/*************************************************
+*     Find font data passed back to the server   *
+*************************************************/
+
+/* In a server job, this looks for a copy of a font's cached data that an
+earlier job passed back. The job's process has its own copy of the server's
+memory, so the data can be used where it is.
+
+Arguments:
+  fs          the font structure
+  key         the expected header key
+
+Returns:      TRUE if the data was found
+*/
+
+static BOOL
+fontcache_find(fontstr *fs, fontcache_header *key)
+{
+for (fontserverstr *c = font_server_data; c != NULL; c = c->next)
+  {
+  if (memcmp(c + 1, key, offsetof(fontcache_header, flags)) == 0)
+    {
+    fontcache_use(fs, (uschar *)(c + 1));
+    return TRUE;
+    }
+  }
+return FALSE;
+}
+
+
+
+/*************************************************
+*      Add font data passed back by a job        *
+*************************************************/
+
+/* This is called in the server. The data has the same layout as a cache file.
+It replaces any earlier copy for the same files, which must be out of date.
+
+Arguments:
+  data        the data
+  size        its length
+
+Returns:      nothing
+*/
+
+void
+font_server_add(uschar *data, size_t size)
+{
+fontcache_header *h = (fontcache_header *)data;
+fontserverstr *c;
+
+if (size < sizeof(fontcache_header) ||
+    memcmp(h->magic, FONTCACHE_MAGIC, sizeof(h->magic)) != 0 ||
+    fontcache_size(h) != size)
+  return;
+
+for (fontserverstr **cp = &font_server_data; *cp != NULL; cp = &((*cp)->next))
+  {
+  fontcache_header *oh = (fontcache_header *)(*cp + 1);
+  if (Ustrcmp(oh->afmname, h->afmname) == 0 &&
+      Ustrcmp(oh->utrname, h->utrname) == 0 && oh->pdf == h->pdf)
+    {
+    c = *cp;
+    *cp = c->next;
+    free(c);
+    break;
+    }
+  }
+
+c = malloc(sizeof(fontserverstr) + size);
+if (c == NULL) return;     /* This is only an optimization */
+memcpy(c + 1, data, size);
+c->size = size;
+c->next = font_server_data;
+font_server_data = c;
+}
+
+
+
+/*************************************************
+*      Write high character tree to cache        *
+*************************************************/
+
+/* This recursive function writes out the nodes of a font's high character
+tree, or just counts them if the file is NULL.
+
+Arguments:
+  t          the tree node
+  f          the cache file or NULL
+
+Returns:     the number of nodes
+*/
+
+static int
+fontcache_write_tree(tree_node *t, FILE *f)
+{
+fontcache_high fh;
+if (t == NULL) return 0;
+if (f != NULL)
+  {
+  memset(&fh, 0, sizeof(fh));
+  (void)Ustrncpy(fh.name, t->name, sizeof(fh.name) - 1);
+  fh.value = t->value;
+  (void)fwrite(&fh, sizeof(fh), 1, f);
+  }
+return 1 + fontcache_write_tree(t->left, f) + fontcache_write_tree(t->right, f);
+}
+
+
+
+/*************************************************
+*          Write font data in cache form         *
+*************************************************/
+
+/* The rest of the header is set up from the font structure, and then the
+header and the data are written.
+
+Arguments:
+  fs          the font structure
+  h           the header, with the key set up
+  f           the output stream
+
+Returns:      nothing
+*/
+
+static void
+fontcache_output(fontstr *fs, fontcache_header *h, FILE *f)
+{
+uint32_t offsets[FONTWIDTHS_SIZE];
+
+h->flags = fs->flags & (ff_stdencoding|ff_fixedpitch);
+h->invalid = fs->invalid;
+h->ascent = fs->ascent;
+h->descent = fs->descent;
+h->capheight = fs->capheight;
+h->italicangle = fs->italicangle;
+h->stemv = fs->stemv;
+memcpy(h->bbox, fs->bbox, 4*sizeof(int32_t));
+h->kerncount = fs->kerncount;
+h->utrcount = fs->utrcount;
+h->highcount = fontcache_write_tree(fs->high_tree, NULL);
+h->hasheights = fs->heights != NULL;
+h->encsize = 0;
+
+if (fs->encoding != NULL)
+  {
+  for (int i = 0; i < FONTWIDTHS_SIZE; i++)
+    {
+    if (fs->encoding[i] == NULL) offsets[i] = 0; else
+      {
+      offsets[i] = h->encsize + 1;
+      h->encsize += Ustrlen(fs->encoding[i]) + 1;
+      }
+    }
+  if (h->encsize == 0) h->encsize = 1;  /* Encoding with no names */
+  }
+
+(void)fwrite(h, sizeof(fontcache_header), 1, f);
+(void)fwrite(fs->widths, sizeof(int32_t), FONTWIDTHS_SIZE, f);
+(void)fwrite(fs->r2ladjusts, sizeof(int32_t), FONTWIDTHS_SIZE, f);
+if (fs->heights != NULL) (void)fwrite(fs->heights, sizeof(int32_t), 256, f);
+if (fs->kerncount > 0)
+  (void)fwrite(fs->kerns, sizeof(kerntablestr), fs->kerncount, f);
+if (fs->utrcount > 0)
+  (void)fwrite(fs->utr, sizeof(utrtablestr), fs->utrcount, f);
+(void)fontcache_write_tree(fs->high_tree, f);
+
+if (fs->encoding != NULL)
+  {
+  uint32_t written = 0;
+  (void)fwrite(offsets, sizeof(uint32_t), FONTWIDTHS_SIZE, f);
+  for (int i = 0; i < FONTWIDTHS_SIZE; i++)
+    {
+    if (fs->encoding[i] == NULL) continue;
+    written += fwrite(fs->encoding[i], 1, Ustrlen(fs->encoding[i]) + 1, f);
+    }
+  if (written < h->encsize) (void)fputc(0, f);
+  }
+}
+
+
+
+/*************************************************
+*        Write font data to a cache file         *
+*************************************************/
+
+/* The data is written to a temporary file that is then renamed, so that other
+PMW processes that are running at the same time never see a partial file. The
+cache is just an optimization, so any failure is ignored.
+
+Arguments:
+  fs          the font structure
+  cachename   the cache file name
+  h           the header, with the key set up
+
+Returns:      nothing
+*/
+
+static void
+fontcache_write(fontstr *fs, uschar *cachename, fontcache_header *h)
+{
+FILE *f;
+BOOL failed;
+uschar tempname[300];
+
+if (snprintf(CS tempname, sizeof(tempname), "%s.%d", cachename,
+    (int)getpid()) >= (int)sizeof(tempname)) return;
+f = Ufopen(tempname, "wb");
+if (f == NULL) return;
+
+fontcache_output(fs, h, f);
+failed = ferror(f) != 0;
+if (fclose(f) != 0) failed = TRUE;
+if (failed || rename(CS tempname, CS cachename) != 0)
+  (void)unlink(CS tempname);
+else TRACE("Wrote metrics cache %s\n", cachename);
+}
+
+
+
+/*************************************************
+*       Pass font data back to the server        *
+*************************************************/
+
+/* In a server job, a font's data is passed back to the server in cache form,
+so that later jobs need not read the font's files.
+
+Arguments:
+  fs          the font structure
+  h           the header, with the key set up
+
+Returns:      nothing
+*/
+
+static void
+fontcache_passback(fontstr *fs, fontcache_header *h)
+{
+char *buffer = NULL;
+size_t size = 0;
+FILE *f = open_memstream(&buffer, &size);
+
+if (f == NULL) return;
+fontcache_output(fs, h, f);
+if (fclose(f) == 0) server_passback_write(pb_font, buffer, size);
+free(buffer);
+}
+
+
+
+/*************************************************
+*         Set up a font from built-in data       *
+*************************************************/
+
+/* The metrics for the fonts that PMW always uses are compiled into the binary
+in parsed form. The width table and the encoding vector are copied, because
+they may be modified during PDF output; the other tables are used where they
+are. The high character tree is rebuilt, pointing to the built-in names.
+
+Arguments:
+  fs          the font structure
+  fb          the built-in data
+
+Returns:      nothing
+*/
+
+static void
+font_usebuiltin(fontstr *fs, const fontbuiltinstr *fb)
+{
+const char *const *encoding = PDF? fb->pdfencoding : fb->psencoding;
+
+TRACE("Using built-in metrics for %s\n", fs->name);
+
+fs->flags |= fb->flags;
+fs->invalid = fb->invalid;
+fs->ascent = fb->ascent;
+fs->descent = fb->descent;
+fs->capheight = fb->capheight;
+fs->italicangle = fb->italicangle;
+fs->stemv = fb->stemv;
+memcpy(fs->bbox, fb->bbox, 4*sizeof(int32_t));
+
+fs->widths = mem_get_independent(FONTWIDTHS_SIZE * sizeof(int32_t), mt_font);
+memcpy(fs->widths, fb->widths, FONTWIDTHS_SIZE * sizeof(int32_t));
+fs->r2ladjusts = (int32_t *)fb->r2ladjusts;
+fs->heights = (int32_t *)fb->heights;
+
+fs->kerncount = fb->kerncount;
+if (fb->kerncount > 0) fs->kerns = (kerntablestr *)fb->kerns;
+
+fs->utrcount = fb->utrcount;
+if (fb->utrcount > 0) fs->utr = (utrtablestr *)fb->utr;
+
+for (int i = 0; i < fb->highcount; i++)
+  {
+  tree_node *tc = mem_get(sizeof(tree_node), mt_font);
+  tc->name = US fb->high[i].name;
+  tc->value = fb->high[i].value;
+  (void)tree_insert(&(fs->high_tree), tc);
+  }
+
+if (encoding != NULL)
+  {
+  fs->encoding = mem_get_independent(FONTWIDTHS_SIZE * sizeof(char *), mt_font);
+  for (int i = 0; i < FONTWIDTHS_SIZE; i++) fs->encoding[i] = US encoding[i];
+  }
+
+font_buildkerns(fs);
+}
+
+
+
 /***********************************************************
 *  Load width, kern, encoding, & Unicode tables for a font *
 ***********************************************************/
 
 /* This function looks for a mandatory AFM file, containing character widths
-and kerning information, and also checks for an optional UTR file.
+and kerning information, and also checks for an optional UTR file. For the
+fonts whose metrics are compiled into PMW, the built-in data is used unless
+either file is found in one of the directories specified by -F. If a cache
+directory has been specified, the data is taken from a valid cache file if
+there is one; otherwise, after the files have been read, a cache file is
+written, unless there have been errors (so that any errors in a .utr file
+continue to be reported). In a server job, data that an earlier job passed back
+to the server is used in the same way, and data that is read from the files or
+a cache file is passed back.
 
 Argument:   the font id (offset in font_list)
 Returns:    nothing
@@ -229,7 +1055,8 @@ Returns:    nothing
 static void
 font_initialize(uint32_t fontid)
 {
-FILE *fa, *fu;
+FILE *fa = NULL;
+FILE *fu = NULL;
 int kerncount = 0;
 int finalcount = 0;
 kerntablestr *kerntable;
@@ -238,31 +1065,28 @@ tree_node *treebase = NULL;
 uschar *pp;
 uschar filename[256];
 uschar utrfilename[256];
+uschar cachename[512];
 uschar line[1024];       /* Some AFM files have very long lines */
-
-/* Find and open the AFM file */
-
-fa = font_finddata(fs->name, ".afm", font_data_extra, font_data_default,
-  filename, TRUE);   /* Hard error if not found */
+fontcache_header cachekey;
+BOOL havekey = FALSE;
+BOOL usecache = FALSE;
+usint errors = error_get_count();
 
 /* Initialize the font structure */
 
-fs->widths = mem_get_independent(FONTWIDTHS_SIZE * sizeof(int32_t));
-memset(fs->widths, 0xff, FONTWIDTHS_SIZE * sizeof(int32_t));
-
-fs->r2ladjusts = mem_get_independent(FONTWIDTHS_SIZE * sizeof(int32_t));
-memset(fs->r2ladjusts, 0, FONTWIDTHS_SIZE * sizeof(int32_t));
-
-fs->used = mem_get_independent(FONTWIDTHS_SIZE/8);
+fs->used = mem_get_independent(FONTWIDTHS_SIZE/8, mt_font);
 memset(fs->used, 0, FONTWIDTHS_SIZE/8);
 
 fs->heights = NULL;
 fs->kerns = NULL;
+fs->kernindex = NULL;
+fs->kernhash = NULL;
 fs->kerncount = 0;
 fs->utr = NULL;
 fs->utrcount = 0;
 fs->encoding = NULL;
 fs->high_tree = NULL;
+fs->subsetname = NULL;
 
 /* These are used only by PDF output */
 
@@ -278,6 +1102,77 @@ fs->italicangle = 0;
 fs->stemv = 0;
 memset(fs->bbox, 0, 4*sizeof(int32_t));
 
+/* Check for a font whose metrics are compiled in. */
+
+for (usint i = 0; i < font_builtin_count; i++)
+  {
+  const fontbuiltinstr *fb = font_builtin_fonts + i;
+  if (Ustrcmp(fs->name, fb->name) != 0) continue;
+  if (font_data_extra != NULL)
+    {
+    fa = font_finddata(fs->name, ".afm", NULL, font_data_extra, filename,
+      FALSE);
+    fu = font_finddata(fs->name, ".utr", NULL, font_data_extra, utrfilename,
+      FALSE);
+    }
+  if (fa == NULL && fu == NULL)
+    {
+    font_usebuiltin(fs, fb);
+    return;
+    }
+  break;
+  }
+
+/* Find and open the AFM file (a hard error if not found), and look for a .utr
+file, which may contain Unicode translations, choice of unsupported character,
+and/or font encodings. */
+
+if (fa == NULL)
+  fa = font_finddata(fs->name, ".afm", font_data_extra, font_data_default,
+    filename, TRUE);
+if (fu == NULL)
+  fu = font_finddata(fs->name, ".utr", font_data_extra, font_data_default,
+    utrfilename, FALSE);
+
+/* If there is a valid cache file, or a server job has a copy of the data,
+use it instead of reading the files. */
+
+if (font_cache_dir != NULL || server_passback != NULL)
+  {
+  BOOL found = FALSE;
+  havekey = fontcache_key(&cachekey, filename, fa, utrfilename, fu,
+    cachename, sizeof(cachename));
+  usecache = havekey && font_cache_dir != NULL;
+  if (havekey && fontcache_find(fs, &cachekey))
+    {
+    TRACE("Using the server's copy of the metrics for %s\n", fs->name);
+    found = TRUE;
+    }
+  else if (usecache && fontcache_load(fs, cachename, &cachekey))
+    {
+    TRACE("Loaded cached metrics for %s from %s\n", fs->name, cachename);
+    found = TRUE;
+    }
+
+  if (found)
+    {
+    font_buildkerns(fs);
+    if (fu != NULL && fclose(fu) != 0)
+      error(ERR200, ".utr file", strerror(errno));
+    if (fclose(fa) != 0) error(ERR200, "AFM file", strerror(errno));
+    return;
+    }
+  }
+
+/* Set up empty width tables. */
+
+fs->widths = mem_get_independent(FONTWIDTHS_SIZE * sizeof(int32_t), mt_font);
+memset(fs->widths, 0xff, FONTWIDTHS_SIZE * sizeof(int32_t));
+
+fs->r2ladjusts = mem_get_independent(FONTWIDTHS_SIZE * sizeof(int32_t),
+  mt_font);
+memset(fs->r2ladjusts, 0, FONTWIDTHS_SIZE * sizeof(int32_t));
+
 /* Find the start of the metrics in the AFM file; on the way, check for the
 standard encoding scheme and for fixed pitch. */
 
@@ -325,11 +1220,7 @@ if ((fs->flags & ff_stdencoding) == 0)
 else
   fs->invalid = UNKNOWN_CHAR_S | (font_unknown << 24);
 
-/* Look for a .utr file, which may contain Unicode translations, choice of
-unsupported character, and/or font encodings. */
-
-fu = font_finddata(fs->name, ".utr", font_data_extra, font_data_default,
-  utrfilename, FALSE);
+/* Process the .utr file, if there is one. */
 
 if (fu != NULL)
   {
@@ -358,7 +1249,8 @@ if (fu != NULL)
 
       if (fs->encoding == NULL)
         {
-        fs->encoding = mem_get_independent(FONTWIDTHS_SIZE * sizeof(char *));
+        fs->encoding = mem_get_independent(FONTWIDTHS_SIZE * sizeof(char *),
+          mt_font);
         for (int i = 0; i < FONTWIDTHS_SIZE; i++) fs->encoding[i] = NULL;
         }
 
@@ -390,7 +1282,7 @@ if (fu != NULL)
       when reading the AFM file below. */
 
       *ne = 0;
-      tn = mem_get(sizeof(tree_node));
+      tn = mem_get(sizeof(tree_node), mt_font);
       tn->name = fs->encoding[c] = mem_copystring(nb);
       tn->value = c;
       if (!tree_insert(&treebase, tn))
@@ -486,7 +1378,7 @@ if (fu != NULL)
         while(i < ucount - 1 && utable[i].unicode == utable[i+1].unicode) i++;
         }
       }
-    fs->utr = mem_get_independent(ucount * sizeof(utrtablestr));
+    fs->utr = mem_get_independent(ucount * sizeof(utrtablestr), mt_font);
     memcpy(fs->utr, utable, ucount * sizeof(utrtablestr));
     fs->utrcount = ucount;
     }
@@ -585,8 +1477,8 @@ for (;;)
 
       if (code >= LOWCHARLIMIT)
         {
-        tree_node *tc = mem_get(sizeof(tree_node));
-        tc->name = mem_get(8);
+        tree_node *tc = mem_get(sizeof(tree_node), mt_font);
+        tc->name = mem_get(8, mt_font);
         tc->name[misc_ord2utf8(code, tc->name)] = 0;
         tc->value = poffset;
         (void)tree_insert(&(fs->high_tree), tc);
@@ -610,7 +1502,8 @@ for (;;)
     {
     if (fs->encoding == NULL)
       {
-      fs->encoding = mem_get_independent(FONTWIDTHS_SIZE * sizeof(char *));
+      fs->encoding = mem_get_independent(FONTWIDTHS_SIZE * sizeof(char *),
+        mt_font);
       for (int i = 0; i < FONTWIDTHS_SIZE; i++) fs->encoding[i] = NULL;
       }
 
@@ -657,7 +1550,7 @@ for (;;)
       (void)read_number(&height, pp);
       if (fs->heights == NULL)
         {
-        fs->heights = mem_get_independent(256 * sizeof(int32_t));
+        fs->heights = mem_get_independent(256 * sizeof(int32_t), mt_font);
         memset(fs->heights, 0, 256 * sizeof(int));
         }
       fs->heights[code] = height;
@@ -692,7 +1585,8 @@ amount). */
 pp = line + 14;
 while (*pp != 0 && *pp == ' ') pp++;
 (void)read_number(&kerncount, pp);
-fs->kerns = kerntable = mem_get_independent(kerncount*sizeof(kerntablestr));
+fs->kerns = kerntable = mem_get_independent(kerncount*sizeof(kerntablestr),
+  mt_font);
 
 finalcount = 0;
 while (kerncount--)
@@ -738,7 +1632,8 @@ while (kerncount--)
     a = check_lowchar(a, fs);
     b = check_lowchar(b, fs);
 
-    kerntable[finalcount].pair = (a << 16) + b;
+    kerntable[finalcount].left = a;
+    kerntable[finalcount].right = b;
     while (*pp != 0 && *pp == ' ') pp++;
     if (*pp == '-') { sign = -1; pp++; }
     (void)read_number(&value, pp);
@@ -746,15 +1641,26 @@ while (kerncount--)
     }
   }
 
-/* Adjust the count and sort the table into ascending order */
+/* Adjust the count */
 
 fs->kerncount = finalcount;  /* true count */
-qsort(kerntable, fs->kerncount, sizeof(kerntablestr), kern_table_cmp);
 
 /* Finished with the AFM file */
 
 ENDKERN:
 if (fclose(fa) != 0) error(ERR200, "AFM file", strerror(errno));
+font_buildkerns(fs);
+
+/* Save the data in the cache if required. */
+
+if (usecache && !main_suppress_output)
+  fontcache_write(fs, cachename, &cachekey);
+
+/* In a server job, pass the data back to the server, unless there were errors
+or warnings, which later jobs must also give. */
+
+if (havekey && server_passback != NULL && error_get_count() == errors)
+  fontcache_passback(fs, &cachekey);
 
 /* Early checking debugging code; retained in the source in case it is ever
 needed again. */
@@ -785,9 +1691,7 @@ debug_printf("FONT %s\n", fs->name);
   for (i = 0; i < fs->kerncount; i++)
     {
     kerntablestr *k = &(fs->kerns[i]);
-    int a = (k->pair >> 16) & 0xffff;
-    int b = (k->pair) & 0xffff;
-    debug_printf("%04x %04x %5d\n", a, b, k->kwidth);
+    debug_printf("%04x %04x %5d\n", k->left, k->right, k->kwidth);
     }
   }
 #endif
@@ -800,7 +1704,9 @@ debug_printf("FONT %s\n", fs->name);
 *************************************************/
 
 /* This function is called from font_init() below, and also by the textfont and
-musicfont commands, to add a typeface to the list of fonts.
+musicfont commands, to add a typeface to the list of fonts. The font's metrics
+are not loaded until it is first used (see font_load() below), so that fonts
+that are declared but never used cost very little.
 
 Arguments:
   name     name of font
@@ -826,8 +1732,35 @@ if (font_count >= font_list_size)
 fs = &(font_list[font_count]);
 fs->name = mem_copystring(name);
 fs->flags = flags;
-font_table[fontid] = font_count;
-font_initialize(font_count++);
+font_table[fontid] = font_count++;
+string_widthcache_flush();
+}
+
+
+
+/*************************************************
+*       Get a font, loading it if necessary      *
+*************************************************/
+
+/* All code that needs a font's metrics or encoding must get the font structure
+via this function, which loads the data from the font's AFM and .utr files
+when the font is first used. Code that needs only the font's name can access
+font_list directly.
+
+Argument:   the font's offset in font_list
+Returns:    pointer to the font structure
+*/
+
+fontstr *
+font_load(uint32_t n)
+{
+fontstr *fs = font_list + n;
+if ((fs->flags & ff_loaded) == 0)
+  {
+  font_initialize(n);
+  fs->flags |= ff_loaded;
+  }
+return fs;
 }
 
 
@@ -954,7 +1887,6 @@ font_charwidth(uint32_t c, uint32_t lastc, uint32_t font, int32_t pointsize,
   int32_t *hptr)
 {
 fontstr *fs;
-kerntablestr *ktable;
 int32_t yield;
 
 DEBUG(D_font) eprintf("font_charwidth %d %s \'%c\'\n", font, sff(pointsize), c);
@@ -970,7 +1902,7 @@ if (font >= font_small)
 
 /* Get the basic width from the font information. */
 
-fs = &(font_list[font_table[font]]);
+fs = font_load(font_table[font]);
 
 if (c <= MAX_UNICODE)
   {
@@ -985,30 +1917,10 @@ else
   if (hptr != NULL) *hptr = 0;
   }
 
-/* Deal with kerning. At the moment, this is supported only for characters
-whose code points are less than 0xffff. It should be easy to extend by
-converting to 64-bit combinations. */
-
-ktable = fs->kerns;
-if (main_kerning && ktable != NULL &&
-    lastc > 0 && lastc <= 0xffff && c <= 0xffff)
-  {
-  uint32_t pair = (lastc << 16) | c;
-  int top = fs->kerncount;
-  int bot = 0;
+/* Deal with kerning. */
 
-  while (top > bot)
-    {
-    int mid = (top + bot)/2;
-    kerntablestr *k = &(ktable[mid]);
-    if (pair == k->pair)
-      {
-      yield += k->kwidth;
-      break;
-      }
-    if (pair > k->pair) bot = mid + 1; else top = mid;
-    }
-  }
+if (main_kerning && fs->kerncount > 0 && lastc > 0)
+  yield += font_kern(fs, lastc, c);
 
 return mac_muldiv(yield, pointsize, 1000);
 }
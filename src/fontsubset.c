@@ -0,0 +1,1112 @@
+/*************************************************
+*         PMW OpenType (CFF) font subsetting     *
+*************************************************/
+
+/* Copyright Philip Hazel 2026 */
+/* This file created: October 2026 */
+/* This file last modified: October 2026 */
+
+#include "pmw.h"
+
+/* This file contains code for creating a subset of an OpenType font with CFF
+outlines, for embedding in PDF output. Only the glyphs whose names are given
+are retained; all the others are replaced by empty charstrings (just "endchar")
+so that glyph ids, the charset, and the horizontal metrics all remain valid.
+This is much simpler than renumbering glyphs, and saves almost all of the
+space.
+
+The CFF table is re-built because the change in size of the CharStrings INDEX
+alters the offsets of items that follow it. The other tables in the sfnt
+wrapper are copied unchanged, except that DSIG, if present, is omitted because
+the signature is no longer valid, and the checksums are recomputed.
+
+CID-keyed CFF fonts and fonts with TrueType outlines are not handled; the
+subsetting function returns NULL for these, and for anything else that it does
+not understand, in which case the caller embeds the whole font. */
+
+
+
+/************************************************
+*             Tables and structures             *
+************************************************/
+
+/* The CFF standard strings, indexed by SID. */
+
+#define STD_STRINGS 391
+
+static const char *std_strings[STD_STRINGS] = {
+  ".notdef", "space", "exclam", "quotedbl", "numbersign", "dollar",
+  "percent", "ampersand", "quoteright", "parenleft", "parenright",
+  "asterisk", "plus", "comma", "hyphen", "period", "slash", "zero", "one",
+  "two", "three", "four", "five", "six", "seven", "eight", "nine", "colon",
+  "semicolon", "less", "equal", "greater", "question", "at", "A", "B", "C",
+  "D", "E", "F", "G", "H", "I", "J", "K", "L", "M", "N", "O", "P", "Q", "R",
+  "S", "T", "U", "V", "W", "X", "Y", "Z", "bracketleft", "backslash",
+  "bracketright", "asciicircum", "underscore", "quoteleft", "a", "b", "c",
+  "d", "e", "f", "g", "h", "i", "j", "k", "l", "m", "n", "o", "p", "q", "r",
+  "s", "t", "u", "v", "w", "x", "y", "z", "braceleft", "bar", "braceright",
+  "asciitilde", "exclamdown", "cent", "sterling", "fraction", "yen",
+  "florin", "section", "currency", "quotesingle", "quotedblleft",
+  "guillemotleft", "guilsinglleft", "guilsinglright", "fi", "fl", "endash",
+  "dagger", "daggerdbl", "periodcentered", "paragraph", "bullet",
+  "quotesinglbase", "quotedblbase", "quotedblright", "guillemotright",
+  "ellipsis", "perthousand", "questiondown", "grave", "acute", "circumflex",
+  "tilde", "macron", "breve", "dotaccent", "dieresis", "ring", "cedilla",
+  "hungarumlaut", "ogonek", "caron", "emdash", "AE", "ordfeminine", "Lslash",
+  "Oslash", "OE", "ordmasculine", "ae", "dotlessi", "lslash", "oslash", "oe",
+  "germandbls", "onesuperior", "logicalnot", "mu", "trademark", "Eth",
+  "onehalf", "plusminus", "Thorn", "onequarter", "divide", "brokenbar",
+  "degree", "thorn", "threequarters", "twosuperior", "registered", "minus",
+  "eth", "multiply", "threesuperior", "copyright", "Aacute", "Acircumflex",
+  "Adieresis", "Agrave", "Aring", "Atilde", "Ccedilla", "Eacute",
+  "Ecircumflex", "Edieresis", "Egrave", "Iacute", "Icircumflex", "Idieresis",
+  "Igrave", "Ntilde", "Oacute", "Ocircumflex", "Odieresis", "Ograve",
+  "Otilde", "Scaron", "Uacute", "Ucircumflex", "Udieresis", "Ugrave",
+  "Yacute", "Ydieresis", "Zcaron", "aacute", "acircumflex", "adieresis",
+  "agrave", "aring", "atilde", "ccedilla", "eacute", "ecircumflex",
+  "edieresis", "egrave", "iacute", "icircumflex", "idieresis", "igrave",
+  "ntilde", "oacute", "ocircumflex", "odieresis", "ograve", "otilde",
+  "scaron", "uacute", "ucircumflex", "udieresis", "ugrave", "yacute",
+  "ydieresis", "zcaron", "exclamsmall", "Hungarumlautsmall",
+  "dollaroldstyle", "dollarsuperior", "ampersandsmall", "Acutesmall",
+  "parenleftsuperior", "parenrightsuperior", "twodotenleader",
+  "onedotenleader", "zerooldstyle", "oneoldstyle", "twooldstyle",
+  "threeoldstyle", "fouroldstyle", "fiveoldstyle", "sixoldstyle",
+  "sevenoldstyle", "eightoldstyle", "nineoldstyle", "commasuperior",
+  "threequartersemdash", "periodsuperior", "questionsmall", "asuperior",
+  "bsuperior", "centsuperior", "dsuperior", "esuperior", "isuperior",
+  "lsuperior", "msuperior", "nsuperior", "osuperior", "rsuperior",
+  "ssuperior", "tsuperior", "ff", "ffi", "ffl", "parenleftinferior",
+  "parenrightinferior", "Circumflexsmall", "hyphensuperior", "Gravesmall",
+  "Asmall", "Bsmall", "Csmall", "Dsmall", "Esmall", "Fsmall", "Gsmall",
+  "Hsmall", "Ismall", "Jsmall", "Ksmall", "Lsmall", "Msmall", "Nsmall",
+  "Osmall", "Psmall", "Qsmall", "Rsmall", "Ssmall", "Tsmall", "Usmall",
+  "Vsmall", "Wsmall", "Xsmall", "Ysmall", "Zsmall", "colonmonetary",
+  "onefitted", "rupiah", "Tildesmall", "exclamdownsmall", "centoldstyle",
+  "Lslashsmall", "Scaronsmall", "Zcaronsmall", "Dieresissmall",
+  "Brevesmall", "Caronsmall", "Dotaccentsmall", "Macronsmall", "figuredash",
+  "hypheninferior", "Ogoneksmall", "Ringsmall", "Cedillasmall",
+  "questiondownsmall", "oneeighth", "threeeighths", "fiveeighths",
+  "seveneighths", "onethird", "twothirds", "zerosuperior", "foursuperior",
+  "fivesuperior", "sixsuperior", "sevensuperior", "eightsuperior",
+  "ninesuperior", "zeroinferior", "oneinferior", "twoinferior",
+  "threeinferior", "fourinferior", "fiveinferior", "sixinferior",
+  "seveninferior", "eightinferior", "nineinferior", "centinferior",
+  "dollarinferior", "periodinferior", "commainferior", "Agravesmall",
+  "Aacutesmall", "Acircumflexsmall", "Atildesmall", "Adieresissmall",
+  "Aringsmall", "AEsmall", "Ccedillasmall", "Egravesmall", "Eacutesmall",
+  "Ecircumflexsmall", "Edieresissmall", "Igravesmall", "Iacutesmall",
+  "Icircumflexsmall", "Idieresissmall", "Ethsmall", "Ntildesmall",
+  "Ogravesmall", "Oacutesmall", "Ocircumflexsmall", "Otildesmall",
+  "Odieresissmall", "OEsmall", "Oslashsmall", "Ugravesmall", "Uacutesmall",
+  "Ucircumflexsmall", "Udieresissmall", "Yacutesmall", "Thornsmall",
+  "Ydieresissmall", "001.000", "001.001", "001.002", "001.003", "Black",
+  "Bold", "Book", "Light", "Medium", "Regular", "Roman", "Semibold" };
+
+/* An obsolete form of "endchar" with extra arguments makes an accented
+character from two others, identified by their codes in Adobe's standard
+encoding. Codes 32-126 correspond to SIDs 1-95; the codes in this table
+correspond to SIDs 96 onwards. */
+
+static const uint8_t std_upper_codes[] = {
+  161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  177, 178, 179, 180, 182, 183, 184, 185, 186, 187, 188, 189, 191, 193, 194,
+  195, 196, 197, 198, 199, 200, 202, 203, 205, 206, 207, 208, 225, 227, 232,
+  233, 234, 235, 241, 245, 248, 249, 250, 251 };
+
+/* Top DICT and Private DICT operators that we need to know about. Two-byte
+operators are represented as 1200 + the second byte. */
+
+#define OP_ENCODING        16
+#define OP_CHARSET         15
+#define OP_CHARSTRINGS     17
+#define OP_PRIVATE         18
+#define OP_SUBRS           19
+#define OP_CHARSTRINGTYPE  1206
+#define OP_ROS             1230
+#define OP_FDARRAY         1236
+#define OP_FDSELECT        1237
+
+#define MAX_DICT_OPS       64
+#define MAX_OPERANDS       48
+
+/* A CFF INDEX structure, once located. The offsets are converted to be
+relative to the start of the CFF data. */
+
+typedef struct {
+  size_t start;         /* Offset of the INDEX */
+  size_t end;           /* Offset of the byte following */
+  int    count;
+  const uschar *cff;    /* The CFF data */
+  size_t offbase;       /* Base for the offsets */
+  int    offsize;
+} cffindex;
+
+/* One parsed DICT operator with its operands, and where they lie. */
+
+typedef struct {
+  int     op;
+  int     count;
+  size_t  start;        /* Offset of first operand byte */
+  size_t  end;          /* Offset after the operator */
+  int32_t operands[MAX_OPERANDS];
+} dictop;
+
+/* Growing output buffer */
+
+typedef struct {
+  uschar *buffer;
+  size_t  size;
+  size_t  used;
+} outbuffer;
+
+/* Data needed while walking charstrings to find seac components. */
+
+typedef struct {
+  const uschar *cff;
+  cffindex *gsubrs;
+  cffindex *lsubrs;
+  int32_t  stack[MAX_OPERANDS];
+  int      sp;
+  int      nstems;
+  int      depth;
+  int      seac[2];
+} cswalk;
+
+
+
+/*************************************************
+*              Output buffer handling            *
+*************************************************/
+
+static void
+ob_ensure(outbuffer *ob, size_t n)
+{
+if (ob->used + n <= ob->size) return;
+while (ob->used + n > ob->size) ob->size = (ob->size == 0)? 4096 : 2*ob->size;
+ob->buffer = realloc(ob->buffer, ob->size);
+if (ob->buffer == NULL)
+  error(ERR0, "re-", "font subset buffer", ob->size);  /* Hard */
+}
+
+static void
+ob_bytes(outbuffer *ob, const uschar *s, size_t n)
+{
+ob_ensure(ob, n);
+memcpy(ob->buffer + ob->used, s, n);
+ob->used += n;
+}
+
+static void
+ob_byte(outbuffer *ob, int c)
+{
+ob_ensure(ob, 1);
+ob->buffer[ob->used++] = c;
+}
+
+static void
+ob_int(outbuffer *ob, uint32_t value, int n)
+{
+while (n-- > 0) ob_byte(ob, (value >> (8*n)) & 0xff);
+}
+
+/* Write a DICT integer operand in the fixed 5-byte format, so that its size
+does not depend on its value. */
+
+static void
+ob_dictint(outbuffer *ob, int32_t value)
+{
+ob_byte(ob, 29);
+ob_int(ob, (uint32_t)value, 4);
+}
+
+
+
+/*************************************************
+*              Read big-endian values            *
+*************************************************/
+
+static uint32_t
+get_int(const uschar *p, int n)
+{
+uint32_t yield = 0;
+while (n-- > 0) yield = (yield << 8) | *p++;
+return yield;
+}
+
+
+
+/*************************************************
+*               Locate a CFF INDEX               *
+*************************************************/
+
+/*
+Arguments:
+  cff       the CFF data
+  len       its length
+  start     the offset of the INDEX
+  ix        the structure to fill in
+
+Returns:    FALSE if the INDEX is malformed
+*/
+
+static BOOL
+read_index(const uschar *cff, size_t len, size_t start, cffindex *ix)
+{
+ix->cff = cff;
+ix->start = start;
+if (start + 2 > len) return FALSE;
+ix->count = get_int(cff + start, 2);
+
+if (ix->count == 0)
+  {
+  ix->end = start + 2;
+  ix->offsize = 0;
+  ix->offbase = 0;
+  return TRUE;
+  }
+
+if (start + 3 > len) return FALSE;
+ix->offsize = cff[start + 2];
+if (ix->offsize < 1 || ix->offsize > 4) return FALSE;
+if (start + 3 + (ix->count + 1) * ix->offsize > len) return FALSE;
+ix->offbase = start + 2 + (ix->count + 1) * ix->offsize;
+ix->end = ix->offbase + get_int(cff + start + 3 + ix->count * ix->offsize,
+  ix->offsize);
+return ix->end <= len;
+}
+
+/* Get the data for an INDEX entry */
+
+static const uschar *
+index_item(cffindex *ix, int n, size_t *len)
+{
+size_t p = ix->start + 3 + n * ix->offsize;
+size_t a = get_int(ix->cff + p, ix->offsize);
+size_t b = get_int(ix->cff + p + ix->offsize, ix->offsize);
+*len = (b > a)? b - a : 0;
+return ix->cff + ix->offbase + a;
+}
+
+
+
+/*************************************************
+*                Parse a DICT                    *
+*************************************************/
+
+/* Real number operands are skipped and recorded as zero; we never need their
+values.
+
+Arguments:
+  cff       the CFF data
+  start     offset of the DICT
+  end       offset of its end
+  ops       where to put the operators
+  maxops    size of ops
+
+Returns:    the number of operators, or -1 if malformed
+*/
+
+static int
+parse_dict(const uschar *cff, size_t start, size_t end, dictop *ops,
+  int maxops)
+{
+int n = 0;
+size_t p = start;
+size_t opstart = start;
+int count = 0;
+
+while (p < end)
+  {
+  int b = cff[p];
+  int32_t value = 0;
+
+  if (b <= 21)
+    {
+    if (n >= maxops) return -1;
+    if (b == 12)
+      {
+      if (p + 1 >= end) return -1;
+      b = 1200 + cff[++p];
+      }
+    p++;
+    ops[n].op = b;
+    ops[n].count = count;
+    ops[n].start = opstart;
+    ops[n].end = p;
+    n++;
+    count = 0;
+    opstart = p;
+    continue;
+    }
+
+  if (b == 28)
+    {
+    if (p + 3 > end) return -1;
+    value = (int16_t)get_int(cff + p + 1, 2);
+    p += 3;
+    }
+  else if (b == 29)
+    {
+    if (p + 5 > end) return -1;
+    value = (int32_t)get_int(cff + p + 1, 4);
+    p += 5;
+    }
+  else if (b == 30)
+    {
+    for (p++; p < end; p++)
+      {
+      if ((cff[p] & 0x0f) == 0x0f || (cff[p] & 0xf0) == 0xf0) break;
+      }
+    if (p++ >= end) return -1;
+    }
+  else if (b >= 32 && b <= 246)
+    {
+    value = b - 139;
+    p++;
+    }
+  else if (b >= 247 && b <= 250)
+    {
+    if (p + 2 > end) return -1;
+    value = (b - 247) * 256 + cff[p+1] + 108;
+    p += 2;
+    }
+  else if (b >= 251 && b <= 254)
+    {
+    if (p + 2 > end) return -1;
+    value = -(b - 251) * 256 - cff[p+1] - 108;
+    p += 2;
+    }
+  else return -1;
+
+  if (n < maxops && count < MAX_OPERANDS) ops[n].operands[count] = value;
+  count++;
+  }
+
+return n;
+}
+
+/* Find an operator in a parsed DICT */
+
+static dictop *
+find_op(dictop *ops, int n, int op)
+{
+for (int i = 0; i < n; i++) if (ops[i].op == op) return ops + i;
+return NULL;
+}
+
+
+
+/*************************************************
+*      Walk a charstring to find seac glyphs     *
+*************************************************/
+
+/* This interprets a Type 2 charstring just enough to find the obsolete
+"endchar" with four arguments that specifies an accented character. This means
+counting stem hints, so that the mask bytes of hintmask and cntrmask can be
+skipped, and following subroutine calls. The operand stack is shared with
+subroutines, so it is kept in the walk data.
+
+Arguments:
+  w         the walk data
+  s         the charstring
+  len       its length
+
+Returns:    TRUE at endchar, FALSE at return or on error
+*/
+
+static int
+subr_bias(int count)
+{
+return (count < 1240)? 107 : (count < 33900)? 1131 : 32768;
+}
+
+static BOOL
+walk_charstring(cswalk *w, const uschar *s, size_t len)
+{
+int32_t *stack = w->stack;
+size_t p = 0;
+
+if (++w->depth > 10) return FALSE;
+
+while (p < len)
+  {
+  int b = s[p++];
+
+  if (b >= 32 || b == 28)
+    {
+    int32_t value;
+    if (b == 28)
+      {
+      if (p + 2 > len) return FALSE;
+      value = (int16_t)get_int(s + p, 2);
+      p += 2;
+      }
+    else if (b <= 246) value = b - 139;
+    else if (b <= 250)
+      {
+      if (p >= len) return FALSE;
+      value = (b - 247) * 256 + s[p++] + 108;
+      }
+    else if (b <= 254)
+      {
+      if (p >= len) return FALSE;
+      value = -(b - 251) * 256 - s[p++] - 108;
+      }
+    else
+      {
+      if (p + 4 > len) return FALSE;
+      value = (int32_t)get_int(s + p, 4) >> 16;
+      p += 4;
+      }
+    if (w->sp < MAX_OPERANDS) stack[w->sp++] = value;
+    continue;
+    }
+
+  switch (b)
+    {
+    case 1:   /* hstem */
+    case 3:   /* vstem */
+    case 18:  /* hstemhm */
+    case 23:  /* vstemhm */
+    w->nstems += w->sp/2;
+    w->sp = 0;
+    break;
+
+    case 19:  /* hintmask */
+    case 20:  /* cntrmask */
+    w->nstems += w->sp/2;
+    w->sp = 0;
+    p += (w->nstems + 7)/8;
+    break;
+
+    case 10:  /* callsubr */
+    case 29:  /* callgsubr */
+      {
+      cffindex *ix = (b == 10)? w->lsubrs : w->gsubrs;
+      const uschar *subr;
+      size_t sublen;
+      int n;
+
+      if (w->sp < 1 || ix == NULL) return FALSE;
+      n = stack[--w->sp] + subr_bias(ix->count);
+      if (n < 0 || n >= ix->count) return FALSE;
+      subr = index_item(ix, n, &sublen);
+      if (walk_charstring(w, subr, sublen)) return TRUE;
+      w->depth--;
+      }
+    break;
+
+    case 11:  /* return */
+    return FALSE;
+
+    case 14:  /* endchar */
+    if (w->sp >= 4)
+      {
+      w->seac[0] = stack[w->sp-2];
+      w->seac[1] = stack[w->sp-1];
+      }
+    return TRUE;
+
+    case 12:  /* Two-byte operator */
+    p++;
+    w->sp = 0;
+    break;
+
+    default:
+    w->sp = 0;
+    break;
+    }
+  }
+
+return FALSE;
+}
+
+
+
+/*************************************************
+*     Convert a standard encoding code to a SID  *
+*************************************************/
+
+static int
+std_code_sid(int code)
+{
+if (code >= 32 && code <= 126) return code - 31;
+for (size_t i = 0; i < sizeof(std_upper_codes); i++)
+  if (std_upper_codes[i] == code) return 96 + i;
+return -1;
+}
+
+
+
+/*************************************************
+*          Size of charset and encoding          *
+*************************************************/
+
+/* These functions return the size of custom charset and encoding data, or 0
+if malformed. The charset function also fills in the SID for each glyph. */
+
+static size_t
+charset_size(const uschar *cff, size_t len, size_t start, int nglyphs,
+  int *sids)
+{
+size_t p = start + 1;
+int format;
+
+if (start >= len) return 0;
+format = cff[start];
+sids[0] = 0;
+
+if (format == 0)
+  {
+  if (p + 2*(nglyphs - 1) > len) return 0;
+  for (int g = 1; g < nglyphs; g++, p += 2) sids[g] = get_int(cff + p, 2);
+  }
+
+else if (format == 1 || format == 2)
+  {
+  int csize = (format == 1)? 1 : 2;
+  for (int g = 1; g < nglyphs;)
+    {
+    int sid, left;
+    if (p + 2 + csize > len) return 0;
+    sid = get_int(cff + p, 2);
+    left = get_int(cff + p + 2, csize);
+    p += 2 + csize;
+    for (int i = 0; i <= left && g < nglyphs; i++) sids[g++] = sid + i;
+    }
+  }
+
+else return 0;
+
+return p - start;
+}
+
+static size_t
+encoding_size(const uschar *cff, size_t len, size_t start)
+{
+size_t p;
+int format;
+
+if (start + 2 > len) return 0;
+format = cff[start];
+
+switch (format & 0x7f)
+  {
+  case 0: p = start + 2 + cff[start + 1]; break;
+  case 1: p = start + 2 + 2 * cff[start + 1]; break;
+  default: return 0;
+  }
+
+if ((format & 0x80) != 0)
+  {
+  if (p >= len) return 0;
+  p += 1 + 3 * cff[p];
+  }
+
+return (p > len)? 0 : p - start;
+}
+
+
+
+/*************************************************
+*              Subset a CFF table                *
+*************************************************/
+
+/*
+Arguments:
+  cff       the CFF data
+  len       its length
+  names     names of glyphs to keep
+  ncount    number of names
+  newlen    where to return the new length
+
+Returns:    pointer to new CFF in malloc'd memory, or NULL on failure
+*/
+
+static uschar *
+subset_cff(const uschar *cff, size_t len, const uschar **names, int ncount,
+  size_t *newlen)
+{
+cffindex nameix, topix, stringix, gsubrix, csix, lsubrix;
+cffindex *lsubrs = NULL;
+dictop topops[MAX_DICT_OPS], privops[MAX_DICT_OPS];
+dictop *op;
+const uschar *topdict;
+size_t topdictlen;
+size_t charset_off = 0, charset_len = 0;
+size_t encoding_off = 0, encoding_len = 0;
+size_t priv_off, priv_len, cs_off;
+size_t newtoplen, newprivlen, newcslen, cstotal;
+size_t pos, charset_pos, encoding_pos, cs_pos, priv_pos;
+int ntop, npriv, nglyphs, csoffsize;
+int *sids = NULL;
+BOOL *keep = NULL;
+outbuffer ob = { NULL, 0, 0 };
+
+if (len < 4 || cff[0] != 1) return NULL;
+
+if (!read_index(cff, len, cff[2], &nameix) ||
+    !read_index(cff, len, nameix.end, &topix) ||
+    !read_index(cff, len, topix.end, &stringix) ||
+    !read_index(cff, len, stringix.end, &gsubrix) ||
+    nameix.count != 1 || topix.count != 1)
+  return NULL;
+
+topdict = index_item(&topix, 0, &topdictlen);
+ntop = parse_dict(cff, topdict - cff, topdict - cff + topdictlen, topops,
+  MAX_DICT_OPS);
+if (ntop < 0) return NULL;
+
+/* We can't handle CID-keyed fonts, or anything other than Type 2
+charstrings. */
+
+if (find_op(topops, ntop, OP_ROS) != NULL ||
+    find_op(topops, ntop, OP_FDARRAY) != NULL ||
+    find_op(topops, ntop, OP_FDSELECT) != NULL)
+  return NULL;
+op = find_op(topops, ntop, OP_CHARSTRINGTYPE);
+if (op != NULL && (op->count != 1 || op->operands[0] != 2)) return NULL;
+
+/* Locate the charstrings and the private dictionary, which are mandatory. */
+
+op = find_op(topops, ntop, OP_CHARSTRINGS);
+if (op == NULL || op->count != 1) return NULL;
+cs_off = op->operands[0];
+if (!read_index(cff, len, cs_off, &csix) || csix.count < 1) return NULL;
+nglyphs = csix.count;
+
+op = find_op(topops, ntop, OP_PRIVATE);
+if (op == NULL || op->count != 2) return NULL;
+priv_len = op->operands[0];
+priv_off = op->operands[1];
+if (priv_off + priv_len > len) return NULL;
+npriv = parse_dict(cff, priv_off, priv_off + priv_len, privops, MAX_DICT_OPS);
+if (npriv < 0) return NULL;
+
+op = find_op(privops, npriv, OP_SUBRS);
+if (op != NULL)
+  {
+  if (op->count != 1 ||
+      !read_index(cff, len, priv_off + op->operands[0], &lsubrix))
+    return NULL;
+  lsubrs = &lsubrix;
+  }
+
+/* Get the SID of each glyph. Of the predefined charsets, only ISOAdobe (in
+which glyph ids and SIDs are the same) is supported. */
+
+sids = malloc(nglyphs * sizeof(int));
+keep = malloc(nglyphs * sizeof(BOOL));
+if (sids == NULL || keep == NULL)
+  error(ERR0, "", "font subset tables", nglyphs * sizeof(int));  /* Hard */
+
+op = find_op(topops, ntop, OP_CHARSET);
+if (op != NULL && op->count == 1 && op->operands[0] > 2)
+  {
+  charset_off = op->operands[0];
+  charset_len = charset_size(cff, len, charset_off, nglyphs, sids);
+  if (charset_len == 0) goto FAILED;
+  }
+else if (op != NULL && (op->count != 1 || op->operands[0] != 0)) goto FAILED;
+else for (int g = 0; g < nglyphs; g++) sids[g] = g;
+
+op = find_op(topops, ntop, OP_ENCODING);
+if (op != NULL && op->count == 1 && op->operands[0] > 1)
+  {
+  encoding_off = op->operands[0];
+  encoding_len = encoding_size(cff, len, encoding_off);
+  if (encoding_len == 0) goto FAILED;
+  }
+
+/* Decide which glyphs to keep; .notdef is always kept. */
+
+keep[0] = TRUE;
+for (int g = 1; g < nglyphs; g++)
+  {
+  const char *gname;
+  int sid = sids[g];
+  keep[g] = FALSE;
+
+  if (sid < STD_STRINGS) gname = std_strings[sid];
+  else if (sid - STD_STRINGS < stringix.count)
+    {
+    size_t slen;
+    const uschar *s = index_item(&stringix, sid - STD_STRINGS, &slen);
+    for (int i = 0; i < ncount; i++)
+      {
+      if (Ustrlen(names[i]) == slen && memcmp(names[i], s, slen) == 0)
+        {
+        keep[g] = TRUE;
+        break;
+        }
+      }
+    continue;
+    }
+  else continue;
+
+  for (int i = 0; i < ncount; i++)
+    {
+    if (Ustrcmp(names[i], gname) == 0)
+      {
+      keep[g] = TRUE;
+      break;
+      }
+    }
+  }
+
+/* Ensure that components of any accented characters are kept. */
+
+for (int g = 1; g < nglyphs; g++)
+  {
+  cswalk w;
+  const uschar *s;
+  size_t slen;
+
+  if (!keep[g]) continue;
+  w.cff = cff;
+  w.gsubrs = &gsubrix;
+  w.lsubrs = lsubrs;
+  w.sp = w.nstems = w.depth = 0;
+  w.seac[0] = w.seac[1] = -1;
+  s = index_item(&csix, g, &slen);
+  (void)walk_charstring(&w, s, slen);
+
+  for (int i = 0; i < 2; i++)
+    {
+    int sid;
+    if (w.seac[i] < 0) continue;
+    sid = std_code_sid(w.seac[i]);
+    for (int gg = 1; gg < nglyphs; gg++)
+      if (sids[gg] == sid) keep[gg] = TRUE;
+    }
+  }
+
+/* Work out the sizes of the new structures. The new Top DICT has all offsets
+in 5-byte form; other operators are copied. The new Private DICT likewise has
+its Subrs offset in 5-byte form. */
+
+newtoplen = 0;
+for (int i = 0; i < ntop; i++)
+  {
+  switch (topops[i].op)
+    {
+    case OP_CHARSET:
+    newtoplen += (charset_len > 0)? 6 : topops[i].end - topops[i].start;
+    break;
+
+    case OP_ENCODING:
+    newtoplen += (encoding_len > 0)? 6 : topops[i].end - topops[i].start;
+    break;
+
+    case OP_CHARSTRINGS: newtoplen += 6; break;
+    case OP_PRIVATE:     newtoplen += 11; break;
+    default: newtoplen += topops[i].end - topops[i].start; break;
+    }
+  }
+
+newprivlen = 0;
+for (int i = 0; i < npriv; i++)
+  newprivlen += (privops[i].op == OP_SUBRS)? 6 :
+    privops[i].end - privops[i].start;
+
+cstotal = 0;
+for (int g = 0; g < nglyphs; g++)
+  {
+  size_t slen;
+  if (keep[g]) (void)index_item(&csix, g, &slen); else slen = 1;
+  cstotal += slen;
+  }
+csoffsize = (cstotal + 1 < 0x100)? 1 : (cstotal + 1 < 0x10000)? 2 :
+  (cstotal + 1 < 0x1000000)? 3 : 4;
+newcslen = 3 + (nglyphs + 1) * csoffsize + cstotal;
+
+/* Lay out the new CFF. */
+
+pos = cff[2] + (nameix.end - nameix.start);
+pos += 2 + 1 + 2 * ((newtoplen + 1 < 0x100)? 1 : 2) + newtoplen;
+pos += (stringix.end - stringix.start) + (gsubrix.end - gsubrix.start);
+
+encoding_pos = pos;
+pos += encoding_len;
+charset_pos = pos;
+pos += charset_len;
+cs_pos = pos;
+pos += newcslen;
+priv_pos = pos;
+
+/* Header, Name INDEX, and Top DICT INDEX */
+
+ob_bytes(&ob, cff, nameix.end);
+ob_int(&ob, 1, 2);
+if (newtoplen + 1 < 0x100)
+  {
+  ob_byte(&ob, 1);
+  ob_int(&ob, 1, 1);
+  ob_int(&ob, newtoplen + 1, 1);
+  }
+else
+  {
+  ob_byte(&ob, 2);
+  ob_int(&ob, 1, 2);
+  ob_int(&ob, newtoplen + 1, 2);
+  }
+
+for (int i = 0; i < ntop; i++)
+  {
+  dictop *t = topops + i;
+  switch (t->op)
+    {
+    case OP_CHARSET:
+    if (charset_len == 0) goto COPYTOP;
+    ob_dictint(&ob, charset_pos);
+    ob_byte(&ob, OP_CHARSET);
+    break;
+
+    case OP_ENCODING:
+    if (encoding_len == 0) goto COPYTOP;
+    ob_dictint(&ob, encoding_pos);
+    ob_byte(&ob, OP_ENCODING);
+    break;
+
+    case OP_CHARSTRINGS:
+    ob_dictint(&ob, cs_pos);
+    ob_byte(&ob, OP_CHARSTRINGS);
+    break;
+
+    case OP_PRIVATE:
+    ob_dictint(&ob, newprivlen);
+    ob_dictint(&ob, priv_pos);
+    ob_byte(&ob, OP_PRIVATE);
+    break;
+
+    default:
+    COPYTOP:
+    ob_bytes(&ob, cff + t->start, t->end - t->start);
+    break;
+    }
+  }
+
+/* String and Global Subr INDEXes, encoding, charset */
+
+ob_bytes(&ob, cff + stringix.start, stringix.end - stringix.start);
+ob_bytes(&ob, cff + gsubrix.start, gsubrix.end - gsubrix.start);
+if (encoding_len > 0) ob_bytes(&ob, cff + encoding_off, encoding_len);
+if (charset_len > 0) ob_bytes(&ob, cff + charset_off, charset_len);
+
+/* CharStrings INDEX, with unwanted glyphs replaced by "endchar". */
+
+ob_int(&ob, nglyphs, 2);
+ob_byte(&ob, csoffsize);
+pos = 1;
+ob_int(&ob, pos, csoffsize);
+for (int g = 0; g < nglyphs; g++)
+  {
+  size_t slen;
+  if (keep[g]) (void)index_item(&csix, g, &slen); else slen = 1;
+  pos += slen;
+  ob_int(&ob, pos, csoffsize);
+  }
+
+for (int g = 0; g < nglyphs; g++)
+  {
+  if (keep[g])
+    {
+    size_t slen;
+    const uschar *s = index_item(&csix, g, &slen);
+    ob_bytes(&ob, s, slen);
+    }
+  else ob_byte(&ob, 14);
+  }
+
+/* Private DICT followed by the local subroutines, if any. */
+
+for (int i = 0; i < npriv; i++)
+  {
+  if (privops[i].op == OP_SUBRS)
+    {
+    ob_dictint(&ob, newprivlen);
+    ob_byte(&ob, OP_SUBRS);
+    }
+  else ob_bytes(&ob, cff + privops[i].start, privops[i].end - privops[i].start);
+  }
+
+if (lsubrs != NULL)
+  ob_bytes(&ob, cff + lsubrs->start, lsubrs->end - lsubrs->start);
+
+free(sids);
+free(keep);
+*newlen = ob.used;
+return ob.buffer;
+
+FAILED:
+free(sids);
+free(keep);
+return NULL;
+}
+
+
+
+/*************************************************
+*           Compute an sfnt table checksum       *
+*************************************************/
+
+static uint32_t
+table_checksum(const uschar *p, size_t len)
+{
+uint32_t sum = 0;
+for (size_t i = 0; i < len; i += 4)
+  {
+  uint32_t v = 0;
+  for (size_t j = 0; j < 4; j++)
+    v = (v << 8) | ((i + j < len)? p[i + j] : 0);
+  sum += v;
+  }
+return sum;
+}
+
+
+
+/*************************************************
+*       Subset an OpenType font with CFF data    *
+*************************************************/
+
+/* This is the externally-called function.
+
+Arguments:
+  font      the font file data
+  len       its length
+  names     names of the glyphs that are to be kept
+  ncount    the number of names
+  newlen    where to return the length of the subset font
+
+Returns:    pointer to the subset font in malloc'd memory, or NULL if the font
+              cannot be subset
+*/
+
+uschar *
+fontsubset_otf(const uschar *font, size_t len, const uschar **names,
+  int ncount, size_t *newlen)
+{
+typedef struct {
+  const uschar *tag;
+  const uschar *data;
+  size_t length;
+} tableinfo;
+
+tableinfo tables[64];
+usint ntables;
+int nt = 0;
+int cff_index = -1;
+int head_index = -1;
+int sr, es;
+uschar *newcff, *yield;
+size_t cfflen, offset, headadj;
+uint32_t sum;
+
+if (len < 12 || memcmp(font, "OTTO", 4) != 0) return NULL;
+ntables = get_int(font + 4, 2);
+if (ntables > 64 || 12 + 16 * ntables > len) return NULL;
+
+for (usint i = 0; i < ntables; i++)
+  {
+  const uschar *rec = font + 12 + 16*i;
+  size_t toff = get_int(rec + 8, 4);
+  size_t tlen = get_int(rec + 12, 4);
+
+  if (toff + tlen > len) return NULL;
+  if (memcmp(rec, "DSIG", 4) == 0) continue;
+  if (memcmp(rec, "CFF ", 4) == 0) cff_index = nt;
+  if (memcmp(rec, "head", 4) == 0)
+    {
+    if (tlen < 12) return NULL;
+    head_index = nt;
+    }
+
+  tables[nt].tag = rec;
+  tables[nt].data = font + toff;
+  tables[nt].length = tlen;
+  nt++;
+  }
+
+if (cff_index < 0 || head_index < 0) return NULL;
+
+newcff = subset_cff(tables[cff_index].data, tables[cff_index].length, names,
+  ncount, &cfflen);
+if (newcff == NULL) return NULL;
+tables[cff_index].data = newcff;
+tables[cff_index].length = cfflen;
+
+/* Table records must be sorted by tag. */
+
+for (int i = 1; i < nt; i++)
+  {
+  for (int j = i; j > 0 && memcmp(tables[j-1].tag, tables[j].tag, 4) > 0; j--)
+    {
+    tableinfo temp = tables[j];
+    tables[j] = tables[j-1];
+    tables[j-1] = temp;
+    if (head_index == j) head_index = j - 1;
+      else if (head_index == j - 1) head_index = j;
+    }
+  }
+
+/* Compute the total size and get memory. */
+
+offset = 12 + 16 * nt;
+for (int i = 0; i < nt; i++) offset += (tables[i].length + 3) & ~3u;
+yield = malloc(offset);
+if (yield == NULL) error(ERR0, "", "font subset", offset);  /* Hard */
+memset(yield, 0, offset);
+
+/* The sfnt header */
+
+for (sr = 1, es = 0; sr * 2 <= nt; sr *= 2, es++) {};
+memcpy(yield, "OTTO", 4);
+for (int i = 0, v = nt; i < 2; i++) yield[5 - i] = (v >> (8*i)) & 0xff;
+yield[6] = (sr * 16) >> 8;
+yield[7] = (sr * 16) & 0xff;
+yield[8] = es >> 8;
+yield[9] = es & 0xff;
+yield[10] = ((nt - sr) * 16) >> 8;
+yield[11] = ((nt - sr) * 16) & 0xff;
+
+/* The tables and their records. The checksum adjustment in the head table is
+zeroed for computing its checksum and then set at the end. */
+
+offset = 12 + 16 * nt;
+headadj = 0;
+
+for (int i = 0; i < nt; i++)
+  {
+  uschar *rec = yield + 12 + 16*i;
+  uint32_t cs;
+
+  memcpy(yield + offset, tables[i].data, tables[i].length);
+  if (i == head_index)
+    {
+    headadj = offset + 8;
+    memset(yield + headadj, 0, 4);
+    }
+  cs = table_checksum(yield + offset, tables[i].length);
+
+  memcpy(rec, tables[i].tag, 4);
+  for (int j = 0; j < 4; j++)
+    {
+    rec[4 + j] = (cs >> (24 - 8*j)) & 0xff;
+    rec[8 + j] = (offset >> (24 - 8*j)) & 0xff;
+    rec[12 + j] = (tables[i].length >> (24 - 8*j)) & 0xff;
+    }
+
+  offset += (tables[i].length + 3) & ~3u;
+  }
+
+sum = 0xb1b0afbau - table_checksum(yield, offset);
+for (int j = 0; j < 4; j++) yield[headadj + j] = (sum >> (24 - 8*j)) & 0xff;
+
+free(newcff);
+*newlen = offset;
+return yield;
+}
+
+/* End of fontsubset.c */
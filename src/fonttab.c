@@ -0,0 +1,3749 @@
+/* This file was generated by mkfonttab from the PMW fontmetrics files. */
+/* Do not edit it; edit the original files instead. */
+
+#include "pmw.h"
+
+/* PMW-Alpha */
+
+static const int32_t widths_0[] = {
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 640, -1, 260, 460, 380, 360, 700, 380,
+  924, 924, 770, 640, 260, -1, 130, 380, 640, 640,
+  640, 640, 640, 640, 640, 640, 640, 640, 260, 380,
+  130, 564, 130, 260, -1, -1, 640, 640, -1, 380,
+  800, 640, 0, -1, 0, 0, 380, 380, -1, 800,
+  1400, 640, 380, 720, 380, -1, 640, 380, -1, 380,
+  -1, 510, 380, 510, 460, 530, 700, -1, -1, 640,
+  817, 380, 470, 640, 0, -1, 0, 0, -1, 880,
+  -1, 760, 690, 640, 380, 320, 380, 817, -1, 380,
+  -1, 380, 420, 260, 20, 260, 700, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 750, 750,
+  750, 750, 750, 750, 750, 750, 750, 750, 750, 750,
+  750, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  300, 300, 300, 300, 300, 300, 300, 300, 300, 300,
+  300, 300, 300, 300, 300, 300, 300, 300, 300, 300,
+  -1, -1, 150, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1 };
+
+static const int32_t r2ladjusts_0[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0 };
+
+static const char *const pdfencoding_0[FONTWIDTHS_SIZE] = {
+  [32] = "PMWAspace",
+  [34] = "PMWAsmsqrest",
+  [35] = "PMWAsharp",
+  [36] = "PMWAflat",
+  [37] = "PMWAnatural",
+  [38] = "PMWAdoubleflat",
+  [39] = "PMWAsqrest",
+  [40] = "PMWAleftarrow",
+  [41] = "PMWArightarrow",
+  [42] = "PMWAstar",
+  [43] = "PMWAplus",
+  [44] = "PMWAddspace",
+  [46] = "PMWAudot",
+  [47] = "PMWAcrest",
+  [48] = "PMWAzero",
+  [49] = "PMWAone",
+  [50] = "PMWAtwo",
+  [51] = "PMWAthree",
+  [52] = "PMWAfour",
+  [53] = "PMWAfive",
+  [54] = "PMWAsix",
+  [55] = "PMWAseven",
+  [56] = "PMWAeight",
+  [57] = "PMWAnine",
+  [58] = "PMWAsmqrest",
+  [59] = "PMWAqrest",
+  [60] = "PMWAdspace",
+  [61] = "PMWAequals",
+  [62] = "PMWAddot",
+  [63] = "PMWAsmcrest",
+  [66] = "PMWAbassclef",
+  [67] = "PMWAC",
+  [69] = "PMWAdminim",
+  [70] = "PMWAfermata",
+  [71] = "PMWAtrebleclef",
+  [72] = "PMWAbeam1d",
+  [74] = "PMWAbeam2d",
+  [75] = "PMWAbeam15d",
+  [76] = "PMWAcnh",
+  [77] = "PMWAmnh",
+  [79] = "PMWAds1",
+  [80] = "PMWAped",
+  [81] = "PMWAbreve",
+  [82] = "PMWAdcrotchet",
+  [83] = "PMWAds2",
+  [84] = "PMWAdquaver",
+  [86] = "PMWAaltoclef",
+  [87] = "PMWAsemibreve",
+  [89] = "PMWAdsquaver",
+  [91] = "PMWAlsbrest",
+  [92] = "PMWAnspace",
+  [93] = "PMWAlmrest",
+  [94] = "PMWAdoublesharp",
+  [95] = "PMWArunon",
+  [96] = "PMWAiturn",
+  [99] = "PMWAcut",
+  [100] = "PMWAdownto",
+  [101] = "PMWAuminim",
+  [102] = "PMWAf",
+  [103] = "PMWAxtclef",
+  [104] = "PMWAbeam1u",
+  [106] = "PMWAbeam2u",
+  [107] = "PMWAbeam15u",
+  [109] = "PMWAm",
+  [111] = "PMWAtrill",
+  [112] = "PMWAp",
+  [113] = "PMWAxbreve",
+  [114] = "PMWAucrotchet",
+  [115] = "PMWAs",
+  [116] = "PMWAuquaver",
+  [117] = "PMWAupto",
+  [119] = "PMWAxsemibreve",
+  [121] = "PMWAusquaver",
+  [122] = "PMWAz",
+  [123] = "PMWAsbrest",
+  [124] = "PMWAbar",
+  [125] = "PMWAmrest",
+  [126] = "PMWAturn",
+  [160] = "PMWAstave",
+  [178] = "PMWAtwothirds",
+  [179] = "PMWAthreefifths",
+  [180] = "PMWAonefifth",
+  [181] = "PMWAtwofifths",
+  [182] = "PMWAfourfifths",
+  [183] = "PMWAoneseventh",
+  [184] = "PMWAtwosevenths",
+  [185] = "PMWAonethird",
+  [186] = "PMWAoneninth",
+  [187] = "PMWAeightninths",
+  [188] = "PMWAonequarter",
+  [189] = "PMWAonehalf",
+  [190] = "PMWAthreequarters",
+  [200] = "PMWAsup0",
+  [201] = "PMWAsup1",
+  [202] = "PMWAsup2",
+  [203] = "PMWAsup3",
+  [204] = "PMWAsup4",
+  [205] = "PMWAsup5",
+  [206] = "PMWAsup6",
+  [207] = "PMWAsup7",
+  [208] = "PMWAsup8",
+  [209] = "PMWAsup9",
+  [210] = "PMWAsub0",
+  [211] = "PMWAsub1",
+  [212] = "PMWAsub2",
+  [213] = "PMWAsub3",
+  [214] = "PMWAsub4",
+  [215] = "PMWAsub5",
+  [216] = "PMWAsub6",
+  [217] = "PMWAsub7",
+  [218] = "PMWAsub8",
+  [219] = "PMWAsub9",
+  [222] = "PMWAslash",
+  };
+
+/* PMW-Music */
+
+static const int32_t widths_1[] = {
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 750, 1500, 1500, 1500, 1000, 600, 600, 500,
+  450, 0, 660, 660, 660, 660, 590, 0, 3500, 1340,
+  840, 840, 840, 840, 840, 1200, 840, 1200, 840, 0,
+  0, 0, 0, 400, 600, 760, 760, 1000, 1000, 0,
+  10000, 10000, 0, 600, 0, 0, 840, 840, 600, 0,
+  0, 0, 0, 0, 0, 0, 1000, 0, 0, 0,
+  0, 600, 1000, 0, 1000, 1000, 400, 0, 0, 1500,
+  1500, 0, 0, 0, 0, 0, 550, 760, 840, 840,
+  840, 0, 0, 0, 0, 500, 550, 550, 0, 0,
+  0, -100, 100, -330, 0, 550, 0, -1, 600, 0,
+  0, 0, 600, 0, 0, 0, 800, 600, 600, 350,
+  350, 350, 350, 500, 0, 0, 0, 1000, 1000, 0,
+  0, 0, 0, 1000, 1000, 1580, 0, 350, 350, 330,
+  330, 330, 330, 1400, 0, 0, 0, 333, 333, 1000,
+  1000, 1000, 1000, 1500, 1500, 1500, 0, 0, 1000, 550,
+  750, 675, 675, 550, 0, -420, -760, 0, 0, 424,
+  600, 500, 500, 600, 0, 0, 0, 0, 0, 0,
+  840, 840, 0, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 10000, 10000, 10000,
+  10000, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1 };
+
+static const int32_t r2ladjusts_1[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1310, 1600, 1600, 750, 441, 475, 365,
+  320, 700, 400, 480, 480, 451, 400, 700, 3000, 1180,
+  660, 700, 700, 700, 700, 1110, 710, 1150, 700, 1700,
+  600, 700, 700, 130, 40, 200, 200, 1000, 1000, 1600,
+  10000, 10000, 610, 130, 190, 1220, 705, 705, 300, 750,
+  1025, 750, 1025, 800, 800, 640, 600, 760, 760, 700,
+  700, 40, 600, 360, 750, 750, 700, 550, 550, 1200,
+  1008, 900, 900, 780, 780, 800, 500, 684, 695, 695,
+  700, 1220, 190, 1220, 190, 590, 1000, 1000, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 400, 1350,
+  290, 3750, 80, 1350, 600, 700, 729, 40, 40, 250,
+  150, 250, 90, 800, 800, -600, 700, 1240, 1240, 1500,
+  1900, 540, 540, 750, 750, 1400, 700, 335, 13, 334,
+  334, 334, 334, 1326, -652, -566, 593, 330, 330, 1000,
+  1000, 1000, 1000, 1600, 1143, 1354, 400, 400, 993, 570,
+  700, 645, 705, 1000, 700, 0, 0, 0, 0, 363,
+  430, 343, 216, 300, 700, 700, 800, 800, 1240, 1240,
+  800, 700, 640, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 10000, 10000, 10000,
+  10000, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0 };
+
+static const int32_t heights_1[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, -100, -400,
+  400, 0, 0, 0, -200, 0, 200, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 400, 400, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 400, 400, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 400, -400, 1200, -1200, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0 };
+
+static const utrtablestr utr_1[] = {
+  { 0x266d, 39 }, { 0x266e, 40 }, { 0x266f, 37 }, { 0x1d100, 64 },
+  { 0x1d101, 65 }, { 0x1d104, 91 }, { 0x1d10b, 100 }, { 0x1d10c, 99 },
+  { 0x1d10d, 143 }, { 0x1d110, 41 }, { 0x1d111, 47 }, { 0x1d112, 78 },
+  { 0x1d113, 86 }, { 0x1d116, 68 }, { 0x1d117, 169 }, { 0x1d118, 170 },
+  { 0x1d119, 171 }, { 0x1d11a, 67 }, { 0x1d11b, 172 }, { 0x1d11c, 131 },
+  { 0x1d11e, 33 }, { 0x1d121, 1114124 }, { 0x1d122, 34 }, { 0x1d125, 173 },
+  { 0x1d129, 48 }, { 0x1d12a, 38 }, { 0x1d134, 94 }, { 0x1d135, 95 },
+  { 0x1d13a, 42 }, { 0x1d13b, 43 }, { 0x1d13c, 44 }, { 0x1d13d, 1114122 },
+  { 0x1d13e, 46 }, { 0x1d157, 77 }, { 0x1d158, 76 }, { 0x1d15c, 49 },
+  { 0x1d15d, 50 }, { 0x1d15e, 51 }, { 0x1d15f, 53 }, { 0x1d160, 55 },
+  { 0x1d161, 57 }, { 0x1d165, 74 }, { 0x1d167, 146 }, { 0x1d16e, 69 },
+  { 0x1d17d, 84 }, { 0x1d17e, 90 }, { 0x1d181, 85 }, { 0x1d196, 136 },
+  { 0x1d197, 83 }, { 0x1d198, 196 }, { 0x1d199, 105 }, { 0x1d19c, 87 },
+  { 0x1d1a0, 132 }, { 0x1d1aa, 101 }, { 0x1d1ab, 103 }, { 0x1d1ae, 163 },
+  { 0x1d1af, 36 }, { 0x1d1b9, 109 }, { 0x1d1ba, 108 }, { 0x1d1c8, 147 },
+  { 0x1d1c9, 148 } };
+
+static const char *const pdfencoding_1[FONTWIDTHS_SIZE] = {
+  [32] = "PMWspace",
+  [33] = "PMWtrebleclef",
+  [34] = "PMWbassclef",
+  [35] = "PMWaltoclef",
+  [36] = "PMWstar",
+  [37] = "PMWsharp",
+  [38] = "PMWdoublesharp",
+  [39] = "PMWflat",
+  [40] = "PMWnatural",
+  [41] = "PMWtfermata",
+  [42] = "PMWbrest",
+  [43] = "PMWsbrest",
+  [44] = "PMWmrest",
+  [45] = "PMWcrest",
+  [46] = "PMWqrest",
+  [47] = "PMWbfermata",
+  [48] = "PMWlongrest",
+  [49] = "PMWbreve",
+  [50] = "PMWsemibreve",
+  [51] = "PMWuminim",
+  [52] = "PMWdminim",
+  [53] = "PMWucrotchet",
+  [54] = "PMWdcrotchet",
+  [55] = "PMWuquaver",
+  [56] = "PMWdquaver",
+  [57] = "PMWusquaver",
+  [58] = "PMWdsquaver",
+  [59] = "PMWusqtail",
+  [60] = "PMWdsqtail",
+  [61] = "PMWledger",
+  [62] = "PMWvdot",
+  [63] = "PMWhdot",
+  [64] = "PMWbarsingle",
+  [65] = "PMWbardouble",
+  [66] = "PMWbarthick",
+  [67] = "PMWstave1",
+  [68] = "PMWpstave1",
+  [69] = "PMWuqtail",
+  [70] = "PMWstave10",
+  [71] = "PMWpstave10",
+  [72] = "PMWdqtail",
+  [73] = "PMWrepeatdots",
+  [74] = "PMWustem",
+  [75] = "PMWdstem",
+  [76] = "PMWcnh",
+  [77] = "PMWmnh",
+  [78] = "PMWcomma",
+  [79] = "PMWmordent",
+  [80] = "PMWdmordent",
+  [81] = "PMWimordent",
+  [82] = "PMWdimordent",
+  [83] = "PMWturn",
+  [84] = "PMWhbar",
+  [85] = "PMWaccent1",
+  [86] = "PMWcaesura",
+  [87] = "PMWaccent2",
+  [88] = "PMWaccent3",
+  [89] = "PMWaccent4",
+  [90] = "PMWaccent5",
+  [91] = "PMWbardotted",
+  [92] = "PMWcaesura1",
+  [93] = "PMWlittle8",
+  [94] = "PMWC",
+  [95] = "PMWcut",
+  [96] = "PMWtilde",
+  [97] = "PMWthumba",
+  [98] = "PMWthumbb",
+  [99] = "PMWds1",
+  [100] = "PMWds2",
+  [101] = "PMWdowna",
+  [102] = "PMWdownb",
+  [103] = "PMWupa",
+  [104] = "PMWupb",
+  [105] = "PMWiturn",
+  [106] = "PMWseven",
+  [107] = "PMWfour",
+  [108] = "PMWhcnh",
+  [109] = "PMWhmnh",
+  [110] = "PMWxnh",
+  [111] = "PMWxustem",
+  [112] = "PMWxdstem",
+  [113] = "PMWfustem",
+  [114] = "PMWfdstem",
+  [115] = "PMWsix",
+  [116] = "PMWgdot",
+  [117] = "PMWgring",
+  [118] = "PMWd1",
+  [119] = "PMWd4",
+  [120] = "PMWu4",
+  [121] = "PMWl1",
+  [122] = "PMWr1",
+  [123] = "PMWbs",
+  [124] = "PMWds",
+  [125] = "PMWfs",
+  [126] = "PMWus",
+  [128] = "PMWtick",
+  [129] = "PMWuacc",
+  [130] = "PMWdacc",
+  [131] = "PMWgrid",
+  [132] = "PMWbarshort",
+  [133] = "PMWbreath",
+  [134] = "PMWvring",
+  [135] = "PMWcross",
+  [136] = "PMWtrill",
+  [137] = "PMWscaesura",
+  [138] = "PMWlcaesura",
+  [139] = "PMWsbra",
+  [140] = "PMWsket",
+  [141] = "PMWrbra",
+  [142] = "PMWrket",
+  [143] = "PMWrep",
+  [144] = "PMWrepdots",
+  [145] = "PMWvtilde",
+  [146] = "PMWtrem",
+  [147] = "PMWcirc",
+  [148] = "PMWcutcirc",
+  [149] = "PMWslur1",
+  [150] = "PMWslur2",
+  [151] = "PMWup",
+  [152] = "PMWdown",
+  [153] = "PMWiC",
+  [154] = "PMWicut",
+  [155] = "PMWunibreve",
+  [156] = "PMWaccent6",
+  [157] = "PMWsrbra",
+  [158] = "PMWsrket",
+  [159] = "PMWangle1",
+  [160] = "PMWangle2",
+  [161] = "PMWangle3",
+  [162] = "PMWangle4",
+  [163] = "PMWped",
+  [164] = "PMWuvtilde",
+  [165] = "PMWdvtilde",
+  [166] = "PMWnail",
+  [167] = "PMWangle5",
+  [168] = "PMWangle6",
+  [169] = "PMWstave21",
+  [170] = "PMWstave31",
+  [171] = "PMWstave41",
+  [172] = "PMWstave61",
+  [173] = "PMWhclef",
+  [174] = "PMWoldbassclef",
+  [175] = "PMWoldaltoclef",
+  [176] = "PMWbratop",
+  [177] = "PMWbrabot",
+  [178] = "PMWdirect",
+  [179] = "PMWfive",
+  [180] = "PMWmajor",
+  [181] = "PMWdimsh",
+  [182] = "PMWhdimsh",
+  [183] = "PMWgcross",
+  [184] = "PMWledger2",
+  [185] = "PMWsrm1",
+  [186] = "PMWsrm2",
+  [187] = "PMWu12",
+  [188] = "PMWd12",
+  [189] = "PMWhalfsharp1",
+  [190] = "PMWhalfsharp2",
+  [191] = "PMWhalfflat1",
+  [192] = "PMWhalfflat2",
+  [193] = "PMWicomma",
+  [194] = "PMWaccent7",
+  [195] = "PMWaccent8",
+  [196] = "PMWrturn",
+  [197] = "PMWirturn",
+  [198] = "PMWthcirc",
+  [199] = "PMWbhcirc",
+  [200] = "PMWrcnh",
+  [201] = "PMWrmnh",
+  [202] = "PMWaccent9",
+  [247] = "PMWstave210",
+  [248] = "PMWstave310",
+  [249] = "PMWstave410",
+  [250] = "PMWstave610",
+  };
+
+/* Symbol */
+
+static const int32_t widths_2[] = {
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 250, 333, 713, 500, 549, 833, 778, 439,
+  333, 333, 500, 549, 250, 549, 250, 278, 500, 500,
+  500, 500, 500, 500, 500, 500, 500, 500, 278, 278,
+  549, 549, 549, 444, 549, 722, 667, 722, 612, 611,
+  763, 603, 722, 333, 631, 722, 686, 889, 722, 722,
+  768, 741, 556, 592, 611, 690, 439, 768, 645, 795,
+  611, 333, 863, 333, 658, 500, 500, 631, 549, 549,
+  494, 439, 521, 411, 603, 329, 603, 549, 549, 576,
+  521, 549, 549, 521, 549, 603, 439, 576, 713, 686,
+  493, 686, 494, 480, 200, 480, 549, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  750, 620, 247, 549, 167, 713, 500, 753, 753, 753,
+  753, 1042, 987, 603, 987, 603, 400, 549, 411, 549,
+  549, 713, 494, 460, 549, 549, 549, 549, 1000, 603,
+  1000, 658, 823, 686, 795, 987, 768, 768, 823, 768,
+  768, 713, 713, 713, 713, 713, 713, 713, 768, 713,
+  790, 790, 890, 823, 549, 250, 713, 603, 603, 1042,
+  987, 603, 987, 603, 494, 329, 790, 790, 786, 713,
+  384, 384, 384, 384, 384, 384, 494, 494, 494, 494,
+  -1, 329, 274, 686, 686, 686, 384, 384, 384, 384,
+  384, 384, 494, 494, 494, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1 };
+
+static const int32_t r2ladjusts_2[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 368, 712, 501, 503, 834, 791, 462,
+  353, 307, 492, 549, 250, 546, 250, 254, 500, 507,
+  500, 478, 484, 477, 502, 472, 501, 489, 274, 304,
+  549, 548, 549, 482, 548, 688, 621, 695, 614, 649,
+  767, 633, 768, 348, 641, 757, 686, 915, 749, 756,
+  770, 756, 591, 594, 640, 686, 476, 770, 639, 796,
+  680, 385, 864, 279, 667, 500, 1570, 663, 576, 534,
+  521, 449, 520, 489, 527, 301, 623, 591, 572, 600,
+  466, 536, 540, 528, 540, 618, 428, 542, 683, 726,
+  496, 713, 527, 455, 200, 497, 546, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  734, 608, 255, 555, 160, 714, 496, 746, 742, 748,
+  742, 1048, 974, 616, 1008, 616, 400, 549, 433, 555,
+  550, 666, 488, 460, 546, 555, 552, 541, 1000, 616,
+  990, 617, 836, 588, 785, 1029, 776, 776, 820, 772,
+  772, 693, 693, 726, 727, 727, 550, 550, 764, 717,
+  790, 792, 873, 828, 525, 238, 695, 606, 608, 1050,
+  969, 606, 999, 616, 484, 331, 790, 788, 730, 709,
+  460, 132, 460, 349, 77, 349, 654, 304, 654, 493,
+  0, 323, 293, 983, 686, 389, 520, 848, 520, 393,
+  665, 393, 332, 682, 332, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0 };
+
+static const utrtablestr utr_2[] = {
+  { 0x0020, 32 }, { 0x0021, 33 }, { 0x0023, 1114124 }, { 0x0025, 37 },
+  { 0x0026, 38 }, { 0x0028, 40 }, { 0x0029, 41 }, { 0x002b, 43 },
+  { 0x002c, 44 }, { 0x002e, 46 }, { 0x002f, 47 }, { 0x0030, 48 },
+  { 0x0031, 49 }, { 0x0032, 50 }, { 0x0033, 51 }, { 0x0034, 52 },
+  { 0x0035, 53 }, { 0x0036, 54 }, { 0x0037, 55 }, { 0x0038, 56 },
+  { 0x0039, 57 }, { 0x003a, 58 }, { 0x003b, 59 }, { 0x003c, 60 },
+  { 0x003d, 1114123 }, { 0x003e, 62 }, { 0x003f, 63 }, { 0x005b, 91 },
+  { 0x005d, 93 }, { 0x005f, 95 }, { 0x007b, 123 }, { 0x007c, 124 },
+  { 0x007d, 125 }, { 0x007e, 126 }, { 0x00a9, 211 }, { 0x00ac, 216 },
+  { 0x00ae, 210 }, { 0x00b0, 176 }, { 0x00b1, 177 }, { 0x00b7, 215 },
+  { 0x00d7, 180 }, { 0x00f7, 184 }, { 0x0192, 166 }, { 0x0391, 65 },
+  { 0x0392, 66 }, { 0x0393, 71 }, { 0x0394, 68 }, { 0x0395, 69 },
+  { 0x0396, 90 }, { 0x0397, 72 }, { 0x0398, 81 }, { 0x0399, 73 },
+  { 0x039a, 75 }, { 0x039b, 76 }, { 0x039c, 77 }, { 0x039d, 78 },
+  { 0x039e, 88 }, { 0x039f, 79 }, { 0x03a0, 80 }, { 0x03a1, 82 },
+  { 0x03a3, 83 }, { 0x03a4, 84 }, { 0x03a5, 85 }, { 0x03a6, 70 },
+  { 0x03a7, 67 }, { 0x03a8, 89 }, { 0x03a9, 87 }, { 0x03b1, 97 },
+  { 0x03b2, 98 }, { 0x03b3, 103 }, { 0x03b4, 100 }, { 0x03b5, 101 },
+  { 0x03b6, 122 }, { 0x03b7, 104 }, { 0x03b8, 113 }, { 0x03b9, 105 },
+  { 0x03ba, 107 }, { 0x03bb, 108 }, { 0x03bc, 109 }, { 0x03bd, 110 },
+  { 0x03be, 120 }, { 0x03bf, 111 }, { 0x03c0, 112 }, { 0x03c1, 114 },
+  { 0x03c2, 86 }, { 0x03c3, 115 }, { 0x03c4, 116 }, { 0x03c5, 117 },
+  { 0x03c6, 102 }, { 0x03c7, 99 }, { 0x03c8, 121 }, { 0x03c9, 119 },
+  { 0x03ce, 118 }, { 0x03d1, 74 }, { 0x03d2, 161 }, { 0x03d5, 106 },
+  { 0x05d0, 192 }, { 0x0eaf, 188 }, { 0x2022, 183 }, { 0x2032, 162 },
+  { 0x2033, 178 }, { 0x2039, 225 }, { 0x203a, 241 }, { 0x20ac, 160 },
+  { 0x2118, 195 }, { 0x2122, 212 }, { 0x2190, 172 }, { 0x2191, 173 },
+  { 0x2192, 174 }, { 0x2193, 175 }, { 0x2194, 171 }, { 0x21d0, 220 },
+  { 0x21d1, 221 }, { 0x21d2, 222 }, { 0x21d3, 223 }, { 0x21d4, 219 },
+  { 0x2200, 34 }, { 0x2202, 182 }, { 0x2203, 36 }, { 0x2205, 198 },
+  { 0x2207, 209 }, { 0x2208, 206 }, { 0x2209, 207 }, { 0x220d, 39 },
+  { 0x220f, 213 }, { 0x2211, 229 }, { 0x2212, 1114122 }, { 0x2215, 164 },
+  { 0x2217, 42 }, { 0x221a, 214 }, { 0x221d, 181 }, { 0x221e, 165 },
+  { 0x2220, 208 }, { 0x2227, 217 }, { 0x2228, 218 }, { 0x2229, 199 },
+  { 0x222a, 200 }, { 0x222b, 242 }, { 0x2234, 92 }, { 0x2245, 187 },
+  { 0x224c, 64 }, { 0x2260, 185 }, { 0x2261, 186 }, { 0x2264, 163 },
+  { 0x2265, 179 }, { 0x2282, 204 }, { 0x2283, 201 }, { 0x2284, 203 },
+  { 0x2286, 205 }, { 0x2287, 202 }, { 0x2295, 197 }, { 0x2297, 196 },
+  { 0x2320, 243 }, { 0x2321, 245 }, { 0x239b, 230 }, { 0x239c, 231 },
+  { 0x239d, 232 }, { 0x239e, 246 }, { 0x239f, 247 }, { 0x23a0, 248 },
+  { 0x23a1, 233 }, { 0x23a2, 234 }, { 0x23a3, 235 }, { 0x23a4, 249 },
+  { 0x23a5, 250 }, { 0x23a6, 251 }, { 0x23a7, 236 }, { 0x23a8, 237 },
+  { 0x23aa, 239 }, { 0x23ab, 252 }, { 0x23ac, 253 }, { 0x23ad, 254 },
+  { 0x23ae, 244 }, { 0x23af, 190 }, { 0x23d0, 189 }, { 0x240d, 191 },
+  { 0x25ca, 224 }, { 0x2660, 170 }, { 0x2663, 167 }, { 0x2665, 169 },
+  { 0x2666, 168 }, { 0x27c2, 94 }, { 0xa3a9, 238 }, { 0x1d574, 193 },
+  { 0x1d57d, 194 } };
+
+static const char *const pdfencoding_2[FONTWIDTHS_SIZE] = {
+  [32] = "space",
+  [33] = "exclam",
+  [34] = "universal",
+  [35] = "numbersign",
+  [36] = "existential",
+  [37] = "percent",
+  [38] = "ampersand",
+  [39] = "suchthat",
+  [40] = "parenleft",
+  [41] = "parenright",
+  [42] = "asteriskmath",
+  [43] = "plus",
+  [44] = "comma",
+  [45] = "minus",
+  [46] = "period",
+  [47] = "slash",
+  [48] = "zero",
+  [49] = "one",
+  [50] = "two",
+  [51] = "three",
+  [52] = "four",
+  [53] = "five",
+  [54] = "six",
+  [55] = "seven",
+  [56] = "eight",
+  [57] = "nine",
+  [58] = "colon",
+  [59] = "semicolon",
+  [60] = "less",
+  [61] = "equal",
+  [62] = "greater",
+  [63] = "question",
+  [64] = "congruent",
+  [65] = "Alpha",
+  [66] = "Beta",
+  [67] = "Chi",
+  [68] = "Delta",
+  [69] = "Epsilon",
+  [70] = "Phi",
+  [71] = "Gamma",
+  [72] = "Eta",
+  [73] = "Iota",
+  [74] = "theta1",
+  [75] = "Kappa",
+  [76] = "Lambda",
+  [77] = "Mu",
+  [78] = "Nu",
+  [79] = "Omicron",
+  [80] = "Pi",
+  [81] = "Theta",
+  [82] = "Rho",
+  [83] = "Sigma",
+  [84] = "Tau",
+  [85] = "Upsilon",
+  [86] = "sigma1",
+  [87] = "Omega",
+  [88] = "Xi",
+  [89] = "Psi",
+  [90] = "Zeta",
+  [91] = "bracketleft",
+  [92] = "therefore",
+  [93] = "bracketright",
+  [94] = "perpendicular",
+  [95] = "underscore",
+  [96] = "radicalex",
+  [97] = "alpha",
+  [98] = "beta",
+  [99] = "chi",
+  [100] = "delta",
+  [101] = "epsilon",
+  [102] = "phi",
+  [103] = "gamma",
+  [104] = "eta",
+  [105] = "iota",
+  [106] = "phi1",
+  [107] = "kappa",
+  [108] = "lambda",
+  [109] = "mu",
+  [110] = "nu",
+  [111] = "omicron",
+  [112] = "pi",
+  [113] = "theta",
+  [114] = "rho",
+  [115] = "sigma",
+  [116] = "tau",
+  [117] = "upsilon",
+  [118] = "omega1",
+  [119] = "omega",
+  [120] = "xi",
+  [121] = "psi",
+  [122] = "zeta",
+  [123] = "braceleft",
+  [124] = "bar",
+  [125] = "braceright",
+  [126] = "similar",
+  [160] = "Euro",
+  [161] = "Upsilon1",
+  [162] = "minute",
+  [163] = "lessequal",
+  [164] = "fraction",
+  [165] = "infinity",
+  [166] = "florin",
+  [167] = "club",
+  [168] = "diamond",
+  [169] = "heart",
+  [170] = "spade",
+  [171] = "arrowboth",
+  [172] = "arrowleft",
+  [173] = "arrowup",
+  [174] = "arrowright",
+  [175] = "arrowdown",
+  [176] = "degree",
+  [177] = "plusminus",
+  [178] = "second",
+  [179] = "greaterequal",
+  [180] = "multiply",
+  [181] = "proportional",
+  [182] = "partialdiff",
+  [183] = "bullet",
+  [184] = "divide",
+  [185] = "notequal",
+  [186] = "equivalence",
+  [187] = "approxequal",
+  [188] = "ellipsis",
+  [189] = "arrowvertex",
+  [190] = "arrowhorizex",
+  [191] = "carriagereturn",
+  [192] = "aleph",
+  [193] = "Ifraktur",
+  [194] = "Rfraktur",
+  [195] = "weierstrass",
+  [196] = "circlemultiply",
+  [197] = "circleplus",
+  [198] = "emptyset",
+  [199] = "intersection",
+  [200] = "union",
+  [201] = "propersuperset",
+  [202] = "reflexsuperset",
+  [203] = "notsubset",
+  [204] = "propersubset",
+  [205] = "reflexsubset",
+  [206] = "element",
+  [207] = "notelement",
+  [208] = "angle",
+  [209] = "gradient",
+  [210] = "registerserif",
+  [211] = "copyrightserif",
+  [212] = "trademarkserif",
+  [213] = "product",
+  [214] = "radical",
+  [215] = "dotmath",
+  [216] = "logicalnot",
+  [217] = "logicaland",
+  [218] = "logicalor",
+  [219] = "arrowdblboth",
+  [220] = "arrowdblleft",
+  [221] = "arrowdblup",
+  [222] = "arrowdblright",
+  [223] = "arrowdbldown",
+  [224] = "lozenge",
+  [225] = "angleleft",
+  [226] = "registersans",
+  [227] = "copyrightsans",
+  [228] = "trademarksans",
+  [229] = "summation",
+  [230] = "parenlefttp",
+  [231] = "parenleftex",
+  [232] = "parenleftbt",
+  [233] = "bracketlefttp",
+  [234] = "bracketleftex",
+  [235] = "bracketleftbt",
+  [236] = "bracelefttp",
+  [237] = "braceleftmid",
+  [238] = "braceleftbt",
+  [239] = "braceex",
+  [241] = "angleright",
+  [242] = "integral",
+  [243] = "integraltp",
+  [244] = "integralex",
+  [245] = "integralbt",
+  [246] = "parenrighttp",
+  [247] = "parenrightex",
+  [248] = "parenrightbt",
+  [249] = "bracketrighttp",
+  [250] = "bracketrightex",
+  [251] = "bracketrightbt",
+  [252] = "bracerighttp",
+  [253] = "bracerightmid",
+  [254] = "bracerightbt",
+  };
+
+/* Times-Bold */
+
+static const int32_t widths_3[] = {
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 250, 333, 555, 500, 500, 1000, 833, 278,
+  333, 333, 500, 570, 250, 333, 250, 278, 500, 500,
+  500, 500, 500, 500, 500, 500, 500, 500, 333, 333,
+  570, 570, 570, 500, 930, 722, 667, 722, 722, 667,
+  611, 778, 778, 389, 500, 778, 667, 944, 722, 778,
+  611, 778, 722, 556, 667, 722, 722, 1000, 722, 722,
+  667, 333, 278, 333, 581, 500, 333, 500, 556, 444,
+  556, 444, 333, 500, 556, 278, 333, 556, 278, 833,
+  556, 500, 556, 556, 444, 389, 333, 556, 500, 722,
+  500, 500, 444, 394, 220, 394, 520, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  250, 333, 500, 500, 500, 500, 220, 500, 333, 747,
+  300, 500, 570, 333, 747, 333, 400, 570, 300, 300,
+  333, 556, 540, 350, 333, 300, 330, 500, 750, 750,
+  750, 500, 722, 722, 722, 722, 722, 722, 1000, 722,
+  667, 667, 667, 667, 389, 389, 389, 389, 722, 722,
+  778, 778, 778, 778, 778, 570, 778, 722, 722, 722,
+  722, 722, 611, 556, 500, 500, 500, 500, 500, 500,
+  722, 444, 444, 444, 444, 444, 278, 278, 278, 278,
+  500, 556, 500, 500, 500, 500, 500, 570, 500, 556,
+  556, 556, 556, 500, 556, 500, 722, 500, 722, 500,
+  722, 500, 722, 444, 722, 444, 722, 444, 722, 444,
+  722, 672, 722, 556, 667, 444, 667, 444, 667, 444,
+  667, 444, 667, 444, 778, 500, 778, 500, 778, 500,
+  778, 500, 778, 556, 778, 556, 389, 278, 389, 278,
+  389, 278, 389, 278, 389, 278, 882, 486, 500, 333,
+  778, 556, 534, 667, 278, 667, 278, 667, 394, 667,
+  528, 667, 278, 722, 556, 722, 556, 722, 556, 704,
+  722, 556, 778, 500, 778, 500, 778, 500, 1000, 722,
+  722, 444, 722, 444, 722, 444, 556, 389, 556, 389,
+  556, 389, 556, 389, 667, 333, 667, 416, 667, 333,
+  722, 556, 722, 556, 722, 556, 722, 556, 722, 556,
+  722, 556, 1000, 722, 722, 500, 722, 667, 444, 667,
+  444, 667, 444, 333, 612, 500, 556, 667, 333, 333,
+  333, 250, 500, 500, 333, 1000, 1000, 500, 556, 556,
+  500, 167, 549, 333, 333, 333, 549, 494, 570, 549,
+  333, 494, 250, 1000, 500, 500, 500, 333, 333, 333,
+  549, 333, 389, 600, 333, 333, 1000, 752, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1 };
+
+static const int32_t r2ladjusts_3[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 332, 555, 500, 501, 1001, 849, 279,
+  352, 314, 503, 570, 262, 331, 251, 278, 500, 507,
+  495, 484, 494, 492, 503, 494, 500, 499, 333, 348,
+  570, 570, 570, 502, 930, 698, 635, 736, 704, 657,
+  599, 792, 780, 390, 482, 799, 657, 935, 717, 778,
+  616, 778, 741, 548, 667, 717, 717, 1000, 715, 714,
+  662, 368, 278, 298, 582, 500, 254, 513, 538, 455,
+  559, 451, 403, 511, 550, 271, 206, 565, 271, 830,
+  560, 501, 543, 570, 463, 386, 352, 553, 506, 730,
+  496, 496, 441, 362, 220, 426, 520, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 334, 511, 498, 500, 483, 220, 500, 333, 747,
+  300, 496, 570, 0, 747, 332, 400, 570, 300, 300,
+  410, 569, 519, 350, 362, 301, 330, 504, 771, 768,
+  756, 498, 698, 698, 698, 698, 698, 698, 955, 736,
+  657, 657, 657, 657, 390, 390, 390, 390, 696, 717,
+  778, 778, 778, 778, 778, 570, 778, 717, 717, 717,
+  717, 714, 616, 536, 513, 513, 513, 513, 513, 513,
+  726, 455, 451, 451, 451, 451, 228, 305, 263, 263,
+  501, 560, 501, 501, 501, 501, 501, 570, 501, 553,
+  553, 553, 553, 496, 543, 496, 698, 513, 698, 513,
+  708, 529, 736, 455, 736, 455, 736, 455, 736, 455,
+  704, 706, 696, 559, 657, 451, 657, 451, 657, 451,
+  660, 451, 657, 451, 792, 511, 792, 511, 792, 511,
+  792, 511, 770, 536, 780, 547, 381, 271, 390, 264,
+  382, 271, 390, 290, 390, 271, 885, 479, 482, 279,
+  799, 565, 536, 657, 313, 657, 271, 671, 428, 651,
+  504, 657, 281, 717, 560, 717, 560, 717, 560, 708,
+  717, 511, 778, 501, 778, 501, 778, 554, 1003, 718,
+  741, 463, 741, 463, 741, 463, 548, 386, 548, 385,
+  548, 386, 548, 388, 667, 352, 667, 445, 669, 345,
+  717, 553, 717, 553, 717, 553, 717, 553, 717, 573,
+  717, 555, 1000, 730, 714, 496, 714, 662, 441, 662,
+  441, 662, 441, 403, 614, 0, 548, 667, 333, 333,
+  333, 250, 500, 501, 361, 999, 1000, 500, 550, 550,
+  498, 161, 549, 356, 310, 412, 555, 494, 570, 555,
+  409, 505, 251, 1002, 482, 518, 482, 324, 342, 342,
+  522, 333, 386, 599, 352, 333, 1001, 745, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0 };
+
+static const kerntablestr kerns_3[] = {
+  { 65, 67, -55 }, { 65, 262, -55 }, { 65, 268, -55 }, { 65, 199, -55 },
+  { 65, 71, -55 }, { 65, 286, -55 }, { 65, 290, -55 }, { 65, 79, -45 },
+  { 65, 211, -45 }, { 65, 212, -45 }, { 65, 214, -45 }, { 65, 210, -45 },
+  { 65, 336, -45 }, { 65, 332, -45 }, { 65, 216, -45 }, { 65, 213, -45 },
+  { 65, 81, -45 }, { 65, 84, -95 }, { 65, 356, -95 }, { 65, 387, -95 },
+  { 65, 85, -50 }, { 65, 218, -50 }, { 65, 219, -50 }, { 65, 220, -50 },
+  { 65, 217, -50 }, { 65, 368, -50 }, { 65, 362, -50 }, { 65, 370, -50 },
+  { 65, 366, -50 }, { 65, 86, -145 }, { 65, 87, -130 }, { 65, 89, -100 },
+  { 65, 221, -100 }, { 65, 376, -100 }, { 65, 112, -25 }, { 65, 418, -74 },
+  { 65, 117, -50 }, { 65, 250, -50 }, { 65, 251, -50 }, { 65, 252, -50 },
+  { 65, 249, -50 }, { 65, 369, -50 }, { 65, 363, -50 }, { 65, 371, -50 },
+  { 65, 367, -50 }, { 65, 118, -100 }, { 65, 119, -90 }, { 65, 121, -74 },
+  { 65, 253, -74 }, { 65, 255, -74 }, { 193, 67, -55 }, { 193, 262, -55 },
+  { 193, 268, -55 }, { 193, 199, -55 }, { 193, 71, -55 }, { 193, 286, -55 },
+  { 193, 290, -55 }, { 193, 79, -45 }, { 193, 211, -45 }, { 193, 212, -45 },
+  { 193, 214, -45 }, { 193, 210, -45 }, { 193, 336, -45 }, { 193, 332, -45 },
+  { 193, 216, -45 }, { 193, 213, -45 }, { 193, 81, -45 }, { 193, 84, -95 },
+  { 193, 356, -95 }, { 193, 387, -95 }, { 193, 85, -50 }, { 193, 218, -50 },
+  { 193, 219, -50 }, { 193, 220, -50 }, { 193, 217, -50 }, { 193, 368, -50 },
+  { 193, 362, -50 }, { 193, 370, -50 }, { 193, 366, -50 }, { 193, 86, -145 },
+  { 193, 87, -130 }, { 193, 89, -100 }, { 193, 221, -100 }, { 193, 376, -100 },
+  { 193, 112, -25 }, { 193, 418, -74 }, { 193, 117, -50 }, { 193, 250, -50 },
+  { 193, 251, -50 }, { 193, 252, -50 }, { 193, 249, -50 }, { 193, 369, -50 },
+  { 193, 363, -50 }, { 193, 371, -50 }, { 193, 367, -50 }, { 193, 118, -100 },
+  { 193, 119, -90 }, { 193, 121, -74 }, { 193, 253, -74 }, { 193, 255, -74 },
+  { 258, 67, -55 }, { 258, 262, -55 }, { 258, 268, -55 }, { 258, 199, -55 },
+  { 258, 71, -55 }, { 258, 286, -55 }, { 258, 290, -55 }, { 258, 79, -45 },
+  { 258, 211, -45 }, { 258, 212, -45 }, { 258, 214, -45 }, { 258, 210, -45 },
+  { 258, 336, -45 }, { 258, 332, -45 }, { 258, 216, -45 }, { 258, 213, -45 },
+  { 258, 81, -45 }, { 258, 84, -95 }, { 258, 356, -95 }, { 258, 387, -95 },
+  { 258, 85, -50 }, { 258, 218, -50 }, { 258, 219, -50 }, { 258, 220, -50 },
+  { 258, 217, -50 }, { 258, 368, -50 }, { 258, 362, -50 }, { 258, 370, -50 },
+  { 258, 366, -50 }, { 258, 86, -145 }, { 258, 87, -130 }, { 258, 89, -100 },
+  { 258, 221, -100 }, { 258, 376, -100 }, { 258, 112, -25 }, { 258, 418, -74 },
+  { 258, 117, -50 }, { 258, 250, -50 }, { 258, 251, -50 }, { 258, 252, -50 },
+  { 258, 249, -50 }, { 258, 369, -50 }, { 258, 363, -50 }, { 258, 371, -50 },
+  { 258, 367, -50 }, { 258, 118, -100 }, { 258, 119, -90 }, { 258, 121, -74 },
+  { 258, 253, -74 }, { 258, 255, -74 }, { 194, 67, -55 }, { 194, 262, -55 },
+  { 194, 268, -55 }, { 194, 199, -55 }, { 194, 71, -55 }, { 194, 286, -55 },
+  { 194, 290, -55 }, { 194, 79, -45 }, { 194, 211, -45 }, { 194, 212, -45 },
+  { 194, 214, -45 }, { 194, 210, -45 }, { 194, 336, -45 }, { 194, 332, -45 },
+  { 194, 216, -45 }, { 194, 213, -45 }, { 194, 81, -45 }, { 194, 84, -95 },
+  { 194, 356, -95 }, { 194, 387, -95 }, { 194, 85, -50 }, { 194, 218, -50 },
+  { 194, 219, -50 }, { 194, 220, -50 }, { 194, 217, -50 }, { 194, 368, -50 },
+  { 194, 362, -50 }, { 194, 370, -50 }, { 194, 366, -50 }, { 194, 86, -145 },
+  { 194, 87, -130 }, { 194, 89, -100 }, { 194, 221, -100 }, { 194, 376, -100 },
+  { 194, 112, -25 }, { 194, 418, -74 }, { 194, 117, -50 }, { 194, 250, -50 },
+  { 194, 251, -50 }, { 194, 252, -50 }, { 194, 249, -50 }, { 194, 369, -50 },
+  { 194, 363, -50 }, { 194, 371, -50 }, { 194, 367, -50 }, { 194, 118, -100 },
+  { 194, 119, -90 }, { 194, 121, -74 }, { 194, 253, -74 }, { 194, 255, -74 },
+  { 196, 67, -55 }, { 196, 262, -55 }, { 196, 268, -55 }, { 196, 199, -55 },
+  { 196, 71, -55 }, { 196, 286, -55 }, { 196, 290, -55 }, { 196, 79, -45 },
+  { 196, 211, -45 }, { 196, 212, -45 }, { 196, 214, -45 }, { 196, 210, -45 },
+  { 196, 336, -45 }, { 196, 332, -45 }, { 196, 216, -45 }, { 196, 213, -45 },
+  { 196, 81, -45 }, { 196, 84, -95 }, { 196, 356, -95 }, { 196, 387, -95 },
+  { 196, 85, -50 }, { 196, 218, -50 }, { 196, 219, -50 }, { 196, 220, -50 },
+  { 196, 217, -50 }, { 196, 368, -50 }, { 196, 362, -50 }, { 196, 370, -50 },
+  { 196, 366, -50 }, { 196, 86, -145 }, { 196, 87, -130 }, { 196, 89, -100 },
+  { 196, 221, -100 }, { 196, 376, -100 }, { 196, 112, -25 }, { 196, 418, -74 },
+  { 196, 117, -50 }, { 196, 250, -50 }, { 196, 251, -50 }, { 196, 252, -50 },
+  { 196, 249, -50 }, { 196, 369, -50 }, { 196, 363, -50 }, { 196, 371, -50 },
+  { 196, 367, -50 }, { 196, 118, -100 }, { 196, 119, -90 }, { 196, 121, -74 },
+  { 196, 253, -74 }, { 196, 255, -74 }, { 192, 67, -55 }, { 192, 262, -55 },
+  { 192, 268, -55 }, { 192, 199, -55 }, { 192, 71, -55 }, { 192, 286, -55 },
+  { 192, 290, -55 }, { 192, 79, -45 }, { 192, 211, -45 }, { 192, 212, -45 },
+  { 192, 214, -45 }, { 192, 210, -45 }, { 192, 336, -45 }, { 192, 332, -45 },
+  { 192, 216, -45 }, { 192, 213, -45 }, { 192, 81, -45 }, { 192, 84, -95 },
+  { 192, 356, -95 }, { 192, 387, -95 }, { 192, 85, -50 }, { 192, 218, -50 },
+  { 192, 219, -50 }, { 192, 220, -50 }, { 192, 217, -50 }, { 192, 368, -50 },
+  { 192, 362, -50 }, { 192, 370, -50 }, { 192, 366, -50 }, { 192, 86, -145 },
+  { 192, 87, -130 }, { 192, 89, -100 }, { 192, 221, -100 }, { 192, 376, -100 },
+  { 192, 112, -25 }, { 192, 418, -74 }, { 192, 117, -50 }, { 192, 250, -50 },
+  { 192, 251, -50 }, { 192, 252, -50 }, { 192, 249, -50 }, { 192, 369, -50 },
+  { 192, 363, -50 }, { 192, 371, -50 }, { 192, 367, -50 }, { 192, 118, -100 },
+  { 192, 119, -90 }, { 192, 121, -74 }, { 192, 253, -74 }, { 192, 255, -74 },
+  { 256, 67, -55 }, { 256, 262, -55 }, { 256, 268, -55 }, { 256, 199, -55 },
+  { 256, 71, -55 }, { 256, 286, -55 }, { 256, 290, -55 }, { 256, 79, -45 },
+  { 256, 211, -45 }, { 256, 212, -45 }, { 256, 214, -45 }, { 256, 210, -45 },
+  { 256, 336, -45 }, { 256, 332, -45 }, { 256, 216, -45 }, { 256, 213, -45 },
+  { 256, 81, -45 }, { 256, 84, -95 }, { 256, 356, -95 }, { 256, 387, -95 },
+  { 256, 85, -50 }, { 256, 218, -50 }, { 256, 219, -50 }, { 256, 220, -50 },
+  { 256, 217, -50 }, { 256, 368, -50 }, { 256, 362, -50 }, { 256, 370, -50 },
+  { 256, 366, -50 }, { 256, 86, -145 }, { 256, 87, -130 }, { 256, 89, -100 },
+  { 256, 221, -100 }, { 256, 376, -100 }, { 256, 112, -25 }, { 256, 418, -74 },
+  { 256, 117, -50 }, { 256, 250, -50 }, { 256, 251, -50 }, { 256, 252, -50 },
+  { 256, 249, -50 }, { 256, 369, -50 }, { 256, 363, -50 }, { 256, 371, -50 },
+  { 256, 367, -50 }, { 256, 118, -100 }, { 256, 119, -90 }, { 256, 121, -74 },
+  { 256, 253, -74 }, { 256, 255, -74 }, { 260, 67, -55 }, { 260, 262, -55 },
+  { 260, 268, -55 }, { 260, 199, -55 }, { 260, 71, -55 }, { 260, 286, -55 },
+  { 260, 290, -55 }, { 260, 79, -45 }, { 260, 211, -45 }, { 260, 212, -45 },
+  { 260, 214, -45 }, { 260, 210, -45 }, { 260, 336, -45 }, { 260, 332, -45 },
+  { 260, 216, -45 }, { 260, 213, -45 }, { 260, 81, -45 }, { 260, 84, -95 },
+  { 260, 356, -95 }, { 260, 387, -95 }, { 260, 85, -50 }, { 260, 218, -50 },
+  { 260, 219, -50 }, { 260, 220, -50 }, { 260, 217, -50 }, { 260, 368, -50 },
+  { 260, 362, -50 }, { 260, 370, -50 }, { 260, 366, -50 }, { 260, 86, -145 },
+  { 260, 87, -130 }, { 260, 89, -100 }, { 260, 221, -100 }, { 260, 376, -100 },
+  { 260, 112, -25 }, { 260, 418, -74 }, { 260, 117, -50 }, { 260, 250, -50 },
+  { 260, 251, -50 }, { 260, 252, -50 }, { 260, 249, -50 }, { 260, 369, -50 },
+  { 260, 363, -50 }, { 260, 371, -50 }, { 260, 367, -50 }, { 260, 118, -100 },
+  { 260, 119, -90 }, { 260, 121, -34 }, { 260, 253, -34 }, { 260, 255, -34 },
+  { 197, 67, -55 }, { 197, 262, -55 }, { 197, 268, -55 }, { 197, 199, -55 },
+  { 197, 71, -55 }, { 197, 286, -55 }, { 197, 290, -55 }, { 197, 79, -45 },
+  { 197, 211, -45 }, { 197, 212, -45 }, { 197, 214, -45 }, { 197, 210, -45 },
+  { 197, 336, -45 }, { 197, 332, -45 }, { 197, 216, -45 }, { 197, 213, -45 },
+  { 197, 81, -45 }, { 197, 84, -95 }, { 197, 356, -95 }, { 197, 387, -95 },
+  { 197, 85, -50 }, { 197, 218, -50 }, { 197, 219, -50 }, { 197, 220, -50 },
+  { 197, 217, -50 }, { 197, 368, -50 }, { 197, 362, -50 }, { 197, 370, -50 },
+  { 197, 366, -50 }, { 197, 86, -145 }, { 197, 87, -130 }, { 197, 89, -100 },
+  { 197, 221, -100 }, { 197, 376, -100 }, { 197, 112, -25 }, { 197, 418, -74 },
+  { 197, 117, -50 }, { 197, 250, -50 }, { 197, 251, -50 }, { 197, 252, -50 },
+  { 197, 249, -50 }, { 197, 369, -50 }, { 197, 363, -50 }, { 197, 371, -50 },
+  { 197, 367, -50 }, { 197, 118, -100 }, { 197, 119, -90 }, { 197, 121, -74 },
+  { 197, 253, -74 }, { 197, 255, -74 }, { 195, 67, -55 }, { 195, 262, -55 },
+  { 195, 268, -55 }, { 195, 199, -55 }, { 195, 71, -55 }, { 195, 286, -55 },
+  { 195, 290, -55 }, { 195, 79, -45 }, { 195, 211, -45 }, { 195, 212, -45 },
+  { 195, 214, -45 }, { 195, 210, -45 }, { 195, 336, -45 }, { 195, 332, -45 },
+  { 195, 216, -45 }, { 195, 213, -45 }, { 195, 81, -45 }, { 195, 84, -95 },
+  { 195, 356, -95 }, { 195, 387, -95 }, { 195, 85, -50 }, { 195, 218, -50 },
+  { 195, 219, -50 }, { 195, 220, -50 }, { 195, 217, -50 }, { 195, 368, -50 },
+  { 195, 362, -50 }, { 195, 370, -50 }, { 195, 366, -50 }, { 195, 86, -145 },
+  { 195, 87, -130 }, { 195, 89, -100 }, { 195, 221, -100 }, { 195, 376, -100 },
+  { 195, 112, -25 }, { 195, 418, -74 }, { 195, 117, -50 }, { 195, 250, -50 },
+  { 195, 251, -50 }, { 195, 252, -50 }, { 195, 249, -50 }, { 195, 369, -50 },
+  { 195, 363, -50 }, { 195, 371, -50 }, { 195, 367, -50 }, { 195, 118, -100 },
+  { 195, 119, -90 }, { 195, 121, -74 }, { 195, 253, -74 }, { 195, 255, -74 },
+  { 66, 65, -30 }, { 66, 193, -30 }, { 66, 258, -30 }, { 66, 194, -30 },
+  { 66, 196, -30 }, { 66, 192, -30 }, { 66, 256, -30 }, { 66, 260, -30 },
+  { 66, 197, -30 }, { 66, 195, -30 }, { 66, 85, -10 }, { 66, 218, -10 },
+  { 66, 219, -10 }, { 66, 220, -10 }, { 66, 217, -10 }, { 66, 368, -10 },
+  { 66, 362, -10 }, { 66, 370, -10 }, { 66, 366, -10 }, { 68, 65, -35 },
+  { 68, 193, -35 }, { 68, 258, -35 }, { 68, 194, -35 }, { 68, 196, -35 },
+  { 68, 192, -35 }, { 68, 256, -35 }, { 68, 260, -35 }, { 68, 197, -35 },
+  { 68, 195, -35 }, { 68, 86, -40 }, { 68, 87, -40 }, { 68, 89, -40 },
+  { 68, 221, -40 }, { 68, 376, -40 }, { 68, 46, -20 }, { 270, 65, -35 },
+  { 270, 193, -35 }, { 270, 258, -35 }, { 270, 194, -35 }, { 270, 196, -35 },
+  { 270, 192, -35 }, { 270, 256, -35 }, { 270, 260, -35 }, { 270, 197, -35 },
+  { 270, 195, -35 }, { 270, 86, -40 }, { 270, 87, -40 }, { 270, 89, -40 },
+  { 270, 221, -40 }, { 270, 376, -40 }, { 270, 46, -20 }, { 272, 65, -35 },
+  { 272, 193, -35 }, { 272, 258, -35 }, { 272, 194, -35 }, { 272, 196, -35 },
+  { 272, 192, -35 }, { 272, 256, -35 }, { 272, 260, -35 }, { 272, 197, -35 },
+  { 272, 195, -35 }, { 272, 86, -40 }, { 272, 87, -40 }, { 272, 89, -40 },
+  { 272, 221, -40 }, { 272, 376, -40 }, { 272, 46, -20 }, { 70, 65, -90 },
+  { 70, 193, -90 }, { 70, 258, -90 }, { 70, 194, -90 }, { 70, 196, -90 },
+  { 70, 192, -90 }, { 70, 256, -90 }, { 70, 260, -90 }, { 70, 197, -90 },
+  { 70, 195, -90 }, { 70, 97, -25 }, { 70, 225, -25 }, { 70, 259, -25 },
+  { 70, 226, -25 }, { 70, 228, -25 }, { 70, 224, -25 }, { 70, 257, -25 },
+  { 70, 261, -25 }, { 70, 229, -25 }, { 70, 227, -25 }, { 70, 44, -92 },
+  { 70, 101, -25 }, { 70, 233, -25 }, { 70, 283, -25 }, { 70, 234, -25 },
+  { 70, 235, -25 }, { 70, 279, -25 }, { 70, 232, -25 }, { 70, 275, -25 },
+  { 70, 281, -25 }, { 70, 111, -25 }, { 70, 243, -25 }, { 70, 244, -25 },
+  { 70, 246, -25 }, { 70, 242, -25 }, { 70, 337, -25 }, { 70, 333, -25 },
+  { 70, 248, -25 }, { 70, 245, -25 }, { 70, 46, -110 }, { 74, 65, -30 },
+  { 74, 193, -30 }, { 74, 258, -30 }, { 74, 194, -30 }, { 74, 196, -30 },
+  { 74, 192, -30 }, { 74, 256, -30 }, { 74, 260, -30 }, { 74, 197, -30 },
+  { 74, 195, -30 }, { 74, 97, -15 }, { 74, 225, -15 }, { 74, 259, -15 },
+  { 74, 226, -15 }, { 74, 228, -15 }, { 74, 224, -15 }, { 74, 257, -15 },
+  { 74, 261, -15 }, { 74, 229, -15 }, { 74, 227, -15 }, { 74, 101, -15 },
+  { 74, 233, -15 }, { 74, 283, -15 }, { 74, 234, -15 }, { 74, 235, -15 },
+  { 74, 279, -15 }, { 74, 232, -15 }, { 74, 275, -15 }, { 74, 281, -15 },
+  { 74, 111, -15 }, { 74, 243, -15 }, { 74, 244, -15 }, { 74, 246, -15 },
+  { 74, 242, -15 }, { 74, 337, -15 }, { 74, 333, -15 }, { 74, 248, -15 },
+  { 74, 245, -15 }, { 74, 46, -20 }, { 74, 117, -15 }, { 74, 250, -15 },
+  { 74, 251, -15 }, { 74, 252, -15 }, { 74, 249, -15 }, { 74, 369, -15 },
+  { 74, 363, -15 }, { 74, 371, -15 }, { 74, 367, -15 }, { 75, 79, -30 },
+  { 75, 211, -30 }, { 75, 212, -30 }, { 75, 214, -30 }, { 75, 210, -30 },
+  { 75, 336, -30 }, { 75, 332, -30 }, { 75, 216, -30 }, { 75, 213, -30 },
+  { 75, 101, -25 }, { 75, 233, -25 }, { 75, 283, -25 }, { 75, 234, -25 },
+  { 75, 235, -25 }, { 75, 279, -25 }, { 75, 232, -25 }, { 75, 275, -25 },
+  { 75, 281, -25 }, { 75, 111, -25 }, { 75, 243, -25 }, { 75, 244, -25 },
+  { 75, 246, -25 }, { 75, 242, -25 }, { 75, 337, -25 }, { 75, 333, -25 },
+  { 75, 248, -25 }, { 75, 245, -25 }, { 75, 117, -15 }, { 75, 250, -15 },
+  { 75, 251, -15 }, { 75, 252, -15 }, { 75, 249, -15 }, { 75, 369, -15 },
+  { 75, 363, -15 }, { 75, 371, -15 }, { 75, 367, -15 }, { 75, 121, -45 },
+  { 75, 253, -45 }, { 75, 255, -45 }, { 310, 79, -30 }, { 310, 211, -30 },
+  { 310, 212, -30 }, { 310, 214, -30 }, { 310, 210, -30 }, { 310, 336, -30 },
+  { 310, 332, -30 }, { 310, 216, -30 }, { 310, 213, -30 }, { 310, 101, -25 },
+  { 310, 233, -25 }, { 310, 283, -25 }, { 310, 234, -25 }, { 310, 235, -25 },
+  { 310, 279, -25 }, { 310, 232, -25 }, { 310, 275, -25 }, { 310, 281, -25 },
+  { 310, 111, -25 }, { 310, 243, -25 }, { 310, 244, -25 }, { 310, 246, -25 },
+  { 310, 242, -25 }, { 310, 337, -25 }, { 310, 333, -25 }, { 310, 248, -25 },
+  { 310, 245, -25 }, { 310, 117, -15 }, { 310, 250, -15 }, { 310, 251, -15 },
+  { 310, 252, -15 }, { 310, 249, -15 }, { 310, 369, -15 }, { 310, 363, -15 },
+  { 310, 371, -15 }, { 310, 367, -15 }, { 310, 121, -45 }, { 310, 253, -45 },
+  { 310, 255, -45 }, { 76, 84, -92 }, { 76, 356, -92 }, { 76, 387, -92 },
+  { 76, 86, -92 }, { 76, 87, -92 }, { 76, 89, -92 }, { 76, 221, -92 },
+  { 76, 376, -92 }, { 76, 416, -20 }, { 76, 418, -110 }, { 76, 121, -55 },
+  { 76, 253, -55 }, { 76, 255, -55 }, { 313, 84, -92 }, { 313, 356, -92 },
+  { 313, 387, -92 }, { 313, 86, -92 }, { 313, 87, -92 }, { 313, 89, -92 },
+  { 313, 221, -92 }, { 313, 376, -92 }, { 313, 416, -20 }, { 313, 418, -110 },
+  { 313, 121, -55 }, { 313, 253, -55 }, { 313, 255, -55 }, { 315, 84, -92 },
+  { 315, 356, -92 }, { 315, 387, -92 }, { 315, 86, -92 }, { 315, 87, -92 },
+  { 315, 89, -92 }, { 315, 221, -92 }, { 315, 376, -92 }, { 315, 416, -20 },
+  { 315, 418, -110 }, { 315, 121, -55 }, { 315, 253, -55 }, { 315, 255, -55 },
+  { 321, 84, -92 }, { 321, 356, -92 }, { 321, 387, -92 }, { 321, 86, -92 },
+  { 321, 87, -92 }, { 321, 89, -92 }, { 321, 221, -92 }, { 321, 376, -92 },
+  { 321, 416, -20 }, { 321, 418, -110 }, { 321, 121, -55 }, { 321, 253, -55 },
+  { 321, 255, -55 }, { 78, 65, -20 }, { 78, 193, -20 }, { 78, 258, -20 },
+  { 78, 194, -20 }, { 78, 196, -20 }, { 78, 192, -20 }, { 78, 256, -20 },
+  { 78, 260, -20 }, { 78, 197, -20 }, { 78, 195, -20 }, { 323, 65, -20 },
+  { 323, 193, -20 }, { 323, 258, -20 }, { 323, 194, -20 }, { 323, 196, -20 },
+  { 323, 192, -20 }, { 323, 256, -20 }, { 323, 260, -20 }, { 323, 197, -20 },
+  { 323, 195, -20 }, { 327, 65, -20 }, { 327, 193, -20 }, { 327, 258, -20 },
+  { 327, 194, -20 }, { 327, 196, -20 }, { 327, 192, -20 }, { 327, 256, -20 },
+  { 327, 260, -20 }, { 327, 197, -20 }, { 327, 195, -20 }, { 325, 65, -20 },
+  { 325, 193, -20 }, { 325, 258, -20 }, { 325, 194, -20 }, { 325, 196, -20 },
+  { 325, 192, -20 }, { 325, 256, -20 }, { 325, 260, -20 }, { 325, 197, -20 },
+  { 325, 195, -20 }, { 209, 65, -20 }, { 209, 193, -20 }, { 209, 258, -20 },
+  { 209, 194, -20 }, { 209, 196, -20 }, { 209, 192, -20 }, { 209, 256, -20 },
+  { 209, 260, -20 }, { 209, 197, -20 }, { 209, 195, -20 }, { 79, 65, -40 },
+  { 79, 193, -40 }, { 79, 258, -40 }, { 79, 194, -40 }, { 79, 196, -40 },
+  { 79, 192, -40 }, { 79, 256, -40 }, { 79, 260, -40 }, { 79, 197, -40 },
+  { 79, 195, -40 }, { 79, 84, -40 }, { 79, 356, -40 }, { 79, 387, -40 },
+  { 79, 86, -50 }, { 79, 87, -50 }, { 79, 88, -40 }, { 79, 89, -50 },
+  { 79, 221, -50 }, { 79, 376, -50 }, { 211, 65, -40 }, { 211, 193, -40 },
+  { 211, 258, -40 }, { 211, 194, -40 }, { 211, 196, -40 }, { 211, 192, -40 },
+  { 211, 256, -40 }, { 211, 260, -40 }, { 211, 197, -40 }, { 211, 195, -40 },
+  { 211, 84, -40 }, { 211, 356, -40 }, { 211, 387, -40 }, { 211, 86, -50 },
+  { 211, 87, -50 }, { 211, 88, -40 }, { 211, 89, -50 }, { 211, 221, -50 },
+  { 211, 376, -50 }, { 212, 65, -40 }, { 212, 193, -40 }, { 212, 258, -40 },
+  { 212, 194, -40 }, { 212, 196, -40 }, { 212, 192, -40 }, { 212, 256, -40 },
+  { 212, 260, -40 }, { 212, 197, -40 }, { 212, 195, -40 }, { 212, 84, -40 },
+  { 212, 356, -40 }, { 212, 387, -40 }, { 212, 86, -50 }, { 212, 87, -50 },
+  { 212, 88, -40 }, { 212, 89, -50 }, { 212, 221, -50 }, { 212, 376, -50 },
+  { 214, 65, -40 }, { 214, 193, -40 }, { 214, 258, -40 }, { 214, 194, -40 },
+  { 214, 196, -40 }, { 214, 192, -40 }, { 214, 256, -40 }, { 214, 260, -40 },
+  { 214, 197, -40 }, { 214, 195, -40 }, { 214, 84, -40 }, { 214, 356, -40 },
+  { 214, 387, -40 }, { 214, 86, -50 }, { 214, 87, -50 }, { 214, 88, -40 },
+  { 214, 89, -50 }, { 214, 221, -50 }, { 214, 376, -50 }, { 210, 65, -40 },
+  { 210, 193, -40 }, { 210, 258, -40 }, { 210, 194, -40 }, { 210, 196, -40 },
+  { 210, 192, -40 }, { 210, 256, -40 }, { 210, 260, -40 }, { 210, 197, -40 },
+  { 210, 195, -40 }, { 210, 84, -40 }, { 210, 356, -40 }, { 210, 387, -40 },
+  { 210, 86, -50 }, { 210, 87, -50 }, { 210, 88, -40 }, { 210, 89, -50 },
+  { 210, 221, -50 }, { 210, 376, -50 }, { 336, 65, -40 }, { 336, 193, -40 },
+  { 336, 258, -40 }, { 336, 194, -40 }, { 336, 196, -40 }, { 336, 192, -40 },
+  { 336, 256, -40 }, { 336, 260, -40 }, { 336, 197, -40 }, { 336, 195, -40 },
+  { 336, 84, -40 }, { 336, 356, -40 }, { 336, 387, -40 }, { 336, 86, -50 },
+  { 336, 87, -50 }, { 336, 88, -40 }, { 336, 89, -50 }, { 336, 221, -50 },
+  { 336, 376, -50 }, { 332, 65, -40 }, { 332, 193, -40 }, { 332, 258, -40 },
+  { 332, 194, -40 }, { 332, 196, -40 }, { 332, 192, -40 }, { 332, 256, -40 },
+  { 332, 260, -40 }, { 332, 197, -40 }, { 332, 195, -40 }, { 332, 84, -40 },
+  { 332, 356, -40 }, { 332, 387, -40 }, { 332, 86, -50 }, { 332, 87, -50 },
+  { 332, 88, -40 }, { 332, 89, -50 }, { 332, 221, -50 }, { 332, 376, -50 },
+  { 216, 65, -40 }, { 216, 193, -40 }, { 216, 258, -40 }, { 216, 194, -40 },
+  { 216, 196, -40 }, { 216, 192, -40 }, { 216, 256, -40 }, { 216, 260, -40 },
+  { 216, 197, -40 }, { 216, 195, -40 }, { 216, 84, -40 }, { 216, 356, -40 },
+  { 216, 387, -40 }, { 216, 86, -50 }, { 216, 87, -50 }, { 216, 88, -40 },
+  { 216, 89, -50 }, { 216, 221, -50 }, { 216, 376, -50 }, { 213, 65, -40 },
+  { 213, 193, -40 }, { 213, 258, -40 }, { 213, 194, -40 }, { 213, 196, -40 },
+  { 213, 192, -40 }, { 213, 256, -40 }, { 213, 260, -40 }, { 213, 197, -40 },
+  { 213, 195, -40 }, { 213, 84, -40 }, { 213, 356, -40 }, { 213, 387, -40 },
+  { 213, 86, -50 }, { 213, 87, -50 }, { 213, 88, -40 }, { 213, 89, -50 },
+  { 213, 221, -50 }, { 213, 376, -50 }, { 80, 65, -74 }, { 80, 193, -74 },
+  { 80, 258, -74 }, { 80, 194, -74 }, { 80, 196, -74 }, { 80, 192, -74 },
+  { 80, 256, -74 }, { 80, 260, -74 }, { 80, 197, -74 }, { 80, 195, -74 },
+  { 80, 97, -10 }, { 80, 225, -10 }, { 80, 259, -10 }, { 80, 226, -10 },
+  { 80, 228, -10 }, { 80, 224, -10 }, { 80, 257, -10 }, { 80, 261, -10 },
+  { 80, 229, -10 }, { 80, 227, -10 }, { 80, 44, -92 }, { 80, 101, -20 },
+  { 80, 233, -20 }, { 80, 283, -20 }, { 80, 234, -20 }, { 80, 235, -20 },
+  { 80, 279, -20 }, { 80, 232, -20 }, { 80, 275, -20 }, { 80, 281, -20 },
+  { 80, 111, -20 }, { 80, 243, -20 }, { 80, 244, -20 }, { 80, 246, -20 },
+  { 80, 242, -20 }, { 80, 337, -20 }, { 80, 333, -20 }, { 80, 248, -20 },
+  { 80, 245, -20 }, { 80, 46, -110 }, { 81, 85, -10 }, { 81, 218, -10 },
+  { 81, 219, -10 }, { 81, 220, -10 }, { 81, 217, -10 }, { 81, 368, -10 },
+  { 81, 362, -10 }, { 81, 370, -10 }, { 81, 366, -10 }, { 81, 46, -20 },
+  { 82, 79, -30 }, { 82, 211, -30 }, { 82, 212, -30 }, { 82, 214, -30 },
+  { 82, 210, -30 }, { 82, 336, -30 }, { 82, 332, -30 }, { 82, 216, -30 },
+  { 82, 213, -30 }, { 82, 84, -40 }, { 82, 356, -40 }, { 82, 387, -40 },
+  { 82, 85, -30 }, { 82, 218, -30 }, { 82, 219, -30 }, { 82, 220, -30 },
+  { 82, 217, -30 }, { 82, 368, -30 }, { 82, 362, -30 }, { 82, 370, -30 },
+  { 82, 366, -30 }, { 82, 86, -55 }, { 82, 87, -35 }, { 82, 89, -35 },
+  { 82, 221, -35 }, { 82, 376, -35 }, { 340, 79, -30 }, { 340, 211, -30 },
+  { 340, 212, -30 }, { 340, 214, -30 }, { 340, 210, -30 }, { 340, 336, -30 },
+  { 340, 332, -30 }, { 340, 216, -30 }, { 340, 213, -30 }, { 340, 84, -40 },
+  { 340, 356, -40 }, { 340, 387, -40 }, { 340, 85, -30 }, { 340, 218, -30 },
+  { 340, 219, -30 }, { 340, 220, -30 }, { 340, 217, -30 }, { 340, 368, -30 },
+  { 340, 362, -30 }, { 340, 370, -30 }, { 340, 366, -30 }, { 340, 86, -55 },
+  { 340, 87, -35 }, { 340, 89, -35 }, { 340, 221, -35 }, { 340, 376, -35 },
+  { 344, 79, -30 }, { 344, 211, -30 }, { 344, 212, -30 }, { 344, 214, -30 },
+  { 344, 210, -30 }, { 344, 336, -30 }, { 344, 332, -30 }, { 344, 216, -30 },
+  { 344, 213, -30 }, { 344, 84, -40 }, { 344, 356, -40 }, { 344, 387, -40 },
+  { 344, 85, -30 }, { 344, 218, -30 }, { 344, 219, -30 }, { 344, 220, -30 },
+  { 344, 217, -30 }, { 344, 368, -30 }, { 344, 362, -30 }, { 344, 370, -30 },
+  { 344, 366, -30 }, { 344, 86, -55 }, { 344, 87, -35 }, { 344, 89, -35 },
+  { 344, 221, -35 }, { 344, 376, -35 }, { 342, 79, -30 }, { 342, 211, -30 },
+  { 342, 212, -30 }, { 342, 214, -30 }, { 342, 210, -30 }, { 342, 336, -30 },
+  { 342, 332, -30 }, { 342, 216, -30 }, { 342, 213, -30 }, { 342, 84, -40 },
+  { 342, 356, -40 }, { 342, 387, -40 }, { 342, 85, -30 }, { 342, 218, -30 },
+  { 342, 219, -30 }, { 342, 220, -30 }, { 342, 217, -30 }, { 342, 368, -30 },
+  { 342, 362, -30 }, { 342, 370, -30 }, { 342, 366, -30 }, { 342, 86, -55 },
+  { 342, 87, -35 }, { 342, 89, -35 }, { 342, 221, -35 }, { 342, 376, -35 },
+  { 84, 65, -90 }, { 84, 193, -90 }, { 84, 258, -90 }, { 84, 194, -90 },
+  { 84, 196, -90 }, { 84, 192, -90 }, { 84, 256, -90 }, { 84, 260, -90 },
+  { 84, 197, -90 }, { 84, 195, -90 }, { 84, 79, -18 }, { 84, 211, -18 },
+  { 84, 212, -18 }, { 84, 214, -18 }, { 84, 210, -18 }, { 84, 336, -18 },
+  { 84, 332, -18 }, { 84, 216, -18 }, { 84, 213, -18 }, { 84, 97, -92 },
+  { 84, 225, -92 }, { 84, 259, -52 }, { 84, 226, -52 }, { 84, 228, -52 },
+  { 84, 224, -52 }, { 84, 257, -52 }, { 84, 261, -92 }, { 84, 229, -92 },
+  { 84, 227, -52 }, { 84, 58, -74 }, { 84, 44, -74 }, { 84, 101, -92 },
+  { 84, 233, -92 }, { 84, 283, -92 }, { 84, 234, -92 }, { 84, 235, -52 },
+  { 84, 279, -92 }, { 84, 232, -52 }, { 84, 275, -52 }, { 84, 281, -92 },
+  { 84, 45, -92 }, { 84, 105, -18 }, { 84, 237, -18 }, { 84, 303, -18 },
+  { 84, 111, -92 }, { 84, 243, -92 }, { 84, 244, -92 }, { 84, 246, -92 },
+  { 84, 242, -92 }, { 84, 337, -92 }, { 84, 333, -92 }, { 84, 248, -92 },
+  { 84, 245, -92 }, { 84, 46, -90 }, { 84, 114, -74 }, { 84, 341, -74 },
+  { 84, 345, -74 }, { 84, 343, -74 }, { 84, 59, -74 }, { 84, 117, -92 },
+  { 84, 250, -92 }, { 84, 251, -92 }, { 84, 252, -92 }, { 84, 249, -92 },
+  { 84, 369, -92 }, { 84, 363, -92 }, { 84, 371, -92 }, { 84, 367, -92 },
+  { 84, 119, -74 }, { 84, 121, -34 }, { 84, 253, -34 }, { 84, 255, -34 },
+  { 356, 65, -90 }, { 356, 193, -90 }, { 356, 258, -90 }, { 356, 194, -90 },
+  { 356, 196, -90 }, { 356, 192, -90 }, { 356, 256, -90 }, { 356, 260, -90 },
+  { 356, 197, -90 }, { 356, 195, -90 }, { 356, 79, -18 }, { 356, 211, -18 },
+  { 356, 212, -18 }, { 356, 214, -18 }, { 356, 210, -18 }, { 356, 336, -18 },
+  { 356, 332, -18 }, { 356, 216, -18 }, { 356, 213, -18 }, { 356, 97, -92 },
+  { 356, 225, -92 }, { 356, 259, -52 }, { 356, 226, -52 }, { 356, 228, -52 },
+  { 356, 224, -52 }, { 356, 257, -52 }, { 356, 261, -92 }, { 356, 229, -92 },
+  { 356, 227, -52 }, { 356, 58, -74 }, { 356, 44, -74 }, { 356, 101, -92 },
+  { 356, 233, -92 }, { 356, 283, -92 }, { 356, 234, -92 }, { 356, 235, -52 },
+  { 356, 279, -92 }, { 356, 232, -52 }, { 356, 275, -52 }, { 356, 281, -92 },
+  { 356, 45, -92 }, { 356, 105, -18 }, { 356, 237, -18 }, { 356, 303, -18 },
+  { 356, 111, -92 }, { 356, 243, -92 }, { 356, 244, -92 }, { 356, 246, -92 },
+  { 356, 242, -92 }, { 356, 337, -92 }, { 356, 333, -92 }, { 356, 248, -92 },
+  { 356, 245, -92 }, { 356, 46, -90 }, { 356, 114, -74 }, { 356, 341, -74 },
+  { 356, 345, -74 }, { 356, 343, -74 }, { 356, 59, -74 }, { 356, 117, -92 },
+  { 356, 250, -92 }, { 356, 251, -92 }, { 356, 252, -92 }, { 356, 249, -92 },
+  { 356, 369, -92 }, { 356, 363, -92 }, { 356, 371, -92 }, { 356, 367, -92 },
+  { 356, 119, -74 }, { 356, 121, -34 }, { 356, 253, -34 }, { 356, 255, -34 },
+  { 387, 65, -90 }, { 387, 193, -90 }, { 387, 258, -90 }, { 387, 194, -90 },
+  { 387, 196, -90 }, { 387, 192, -90 }, { 387, 256, -90 }, { 387, 260, -90 },
+  { 387, 197, -90 }, { 387, 195, -90 }, { 387, 79, -18 }, { 387, 211, -18 },
+  { 387, 212, -18 }, { 387, 214, -18 }, { 387, 210, -18 }, { 387, 336, -18 },
+  { 387, 332, -18 }, { 387, 216, -18 }, { 387, 213, -18 }, { 387, 97, -92 },
+  { 387, 225, -92 }, { 387, 259, -52 }, { 387, 226, -52 }, { 387, 228, -52 },
+  { 387, 224, -52 }, { 387, 257, -52 }, { 387, 261, -92 }, { 387, 229, -92 },
+  { 387, 227, -52 }, { 387, 58, -74 }, { 387, 44, -74 }, { 387, 101, -92 },
+  { 387, 233, -92 }, { 387, 283, -92 }, { 387, 234, -92 }, { 387, 235, -52 },
+  { 387, 279, -92 }, { 387, 232, -52 }, { 387, 275, -52 }, { 387, 281, -92 },
+  { 387, 45, -92 }, { 387, 105, -18 }, { 387, 237, -18 }, { 387, 303, -18 },
+  { 387, 111, -92 }, { 387, 243, -92 }, { 387, 244, -92 }, { 387, 246, -92 },
+  { 387, 242, -92 }, { 387, 337, -92 }, { 387, 333, -92 }, { 387, 248, -92 },
+  { 387, 245, -92 }, { 387, 46, -90 }, { 387, 114, -74 }, { 387, 341, -74 },
+  { 387, 345, -74 }, { 387, 343, -74 }, { 387, 59, -74 }, { 387, 117, -92 },
+  { 387, 250, -92 }, { 387, 251, -92 }, { 387, 252, -92 }, { 387, 249, -92 },
+  { 387, 369, -92 }, { 387, 363, -92 }, { 387, 371, -92 }, { 387, 367, -92 },
+  { 387, 119, -74 }, { 387, 121, -34 }, { 387, 253, -34 }, { 387, 255, -34 },
+  { 85, 65, -60 }, { 85, 193, -60 }, { 85, 258, -60 }, { 85, 194, -60 },
+  { 85, 196, -60 }, { 85, 192, -60 }, { 85, 256, -60 }, { 85, 260, -60 },
+  { 85, 197, -60 }, { 85, 195, -60 }, { 85, 44, -50 }, { 85, 46, -50 },
+  { 218, 65, -60 }, { 218, 193, -60 }, { 218, 258, -60 }, { 218, 194, -60 },
+  { 218, 196, -60 }, { 218, 192, -60 }, { 218, 256, -60 }, { 218, 260, -60 },
+  { 218, 197, -60 }, { 218, 195, -60 }, { 218, 44, -50 }, { 218, 46, -50 },
+  { 219, 65, -60 }, { 219, 193, -60 }, { 219, 258, -60 }, { 219, 194, -60 },
+  { 219, 196, -60 }, { 219, 192, -60 }, { 219, 256, -60 }, { 219, 260, -60 },
+  { 219, 197, -60 }, { 219, 195, -60 }, { 219, 44, -50 }, { 219, 46, -50 },
+  { 220, 65, -60 }, { 220, 193, -60 }, { 220, 258, -60 }, { 220, 194, -60 },
+  { 220, 196, -60 }, { 220, 192, -60 }, { 220, 256, -60 }, { 220, 260, -60 },
+  { 220, 197, -60 }, { 220, 195, -60 }, { 220, 44, -50 }, { 220, 46, -50 },
+  { 217, 65, -60 }, { 217, 193, -60 }, { 217, 258, -60 }, { 217, 194, -60 },
+  { 217, 196, -60 }, { 217, 192, -60 }, { 217, 256, -60 }, { 217, 260, -60 },
+  { 217, 197, -60 }, { 217, 195, -60 }, { 217, 44, -50 }, { 217, 46, -50 },
+  { 368, 65, -60 }, { 368, 193, -60 }, { 368, 258, -60 }, { 368, 194, -60 },
+  { 368, 196, -60 }, { 368, 192, -60 }, { 368, 256, -60 }, { 368, 260, -60 },
+  { 368, 197, -60 }, { 368, 195, -60 }, { 368, 44, -50 }, { 368, 46, -50 },
+  { 362, 65, -60 }, { 362, 193, -60 }, { 362, 258, -60 }, { 362, 194, -60 },
+  { 362, 196, -60 }, { 362, 192, -60 }, { 362, 256, -60 }, { 362, 260, -60 },
+  { 362, 197, -60 }, { 362, 195, -60 }, { 362, 44, -50 }, { 362, 46, -50 },
+  { 370, 65, -60 }, { 370, 193, -60 }, { 370, 258, -60 }, { 370, 194, -60 },
+  { 370, 196, -60 }, { 370, 192, -60 }, { 370, 256, -60 }, { 370, 260, -60 },
+  { 370, 197, -60 }, { 370, 195, -60 }, { 370, 44, -50 }, { 370, 46, -50 },
+  { 366, 65, -60 }, { 366, 193, -60 }, { 366, 258, -60 }, { 366, 194, -60 },
+  { 366, 196, -60 }, { 366, 192, -60 }, { 366, 256, -60 }, { 366, 260, -60 },
+  { 366, 197, -60 }, { 366, 195, -60 }, { 366, 44, -50 }, { 366, 46, -50 },
+  { 86, 65, -135 }, { 86, 193, -135 }, { 86, 258, -135 }, { 86, 194, -135 },
+  { 86, 196, -135 }, { 86, 192, -135 }, { 86, 256, -135 }, { 86, 260, -135 },
+  { 86, 197, -135 }, { 86, 195, -135 }, { 86, 71, -30 }, { 86, 286, -30 },
+  { 86, 290, -30 }, { 86, 79, -45 }, { 86, 211, -45 }, { 86, 212, -45 },
+  { 86, 214, -45 }, { 86, 210, -45 }, { 86, 336, -45 }, { 86, 332, -45 },
+  { 86, 216, -45 }, { 86, 213, -45 }, { 86, 97, -92 }, { 86, 225, -92 },
+  { 86, 259, -92 }, { 86, 226, -92 }, { 86, 228, -92 }, { 86, 224, -92 },
+  { 86, 257, -92 }, { 86, 261, -92 }, { 86, 229, -92 }, { 86, 227, -92 },
+  { 86, 58, -92 }, { 86, 44, -129 }, { 86, 101, -100 }, { 86, 233, -100 },
+  { 86, 283, -100 }, { 86, 234, -100 }, { 86, 235, -100 }, { 86, 279, -100 },
+  { 86, 232, -100 }, { 86, 275, -100 }, { 86, 281, -100 }, { 86, 45, -74 },
+  { 86, 105, -37 }, { 86, 237, -37 }, { 86, 238, -37 }, { 86, 239, -37 },
+  { 86, 236, -37 }, { 86, 299, -37 }, { 86, 303, -37 }, { 86, 111, -100 },
+  { 86, 243, -100 }, { 86, 244, -100 }, { 86, 246, -100 }, { 86, 242, -100 },
+  { 86, 337, -100 }, { 86, 333, -100 }, { 86, 248, -100 }, { 86, 245, -100 },
+  { 86, 46, -145 }, { 86, 59, -92 }, { 86, 117, -92 }, { 86, 250, -92 },
+  { 86, 251, -92 }, { 86, 252, -92 }, { 86, 249, -92 }, { 86, 369, -92 },
+  { 86, 363, -92 }, { 86, 371, -92 }, { 86, 367, -92 }, { 87, 65, -120 },
+  { 87, 193, -120 }, { 87, 258, -120 }, { 87, 194, -120 }, { 87, 196, -120 },
+  { 87, 192, -120 }, { 87, 256, -120 }, { 87, 260, -120 }, { 87, 197, -120 },
+  { 87, 195, -120 }, { 87, 79, -10 }, { 87, 211, -10 }, { 87, 212, -10 },
+  { 87, 214, -10 }, { 87, 210, -10 }, { 87, 336, -10 }, { 87, 332, -10 },
+  { 87, 216, -10 }, { 87, 213, -10 }, { 87, 97, -65 }, { 87, 225, -65 },
+  { 87, 259, -65 }, { 87, 226, -65 }, { 87, 228, -65 }, { 87, 224, -65 },
+  { 87, 257, -65 }, { 87, 261, -65 }, { 87, 229, -65 }, { 87, 227, -65 },
+  { 87, 58, -55 }, { 87, 44, -92 }, { 87, 101, -65 }, { 87, 233, -65 },
+  { 87, 283, -65 }, { 87, 234, -65 }, { 87, 235, -65 }, { 87, 279, -65 },
+  { 87, 232, -65 }, { 87, 275, -65 }, { 87, 281, -65 }, { 87, 45, -37 },
+  { 87, 105, -18 }, { 87, 237, -18 }, { 87, 303, -18 }, { 87, 111, -75 },
+  { 87, 243, -75 }, { 87, 244, -75 }, { 87, 246, -75 }, { 87, 242, -75 },
+  { 87, 337, -75 }, { 87, 333, -75 }, { 87, 248, -75 }, { 87, 245, -75 },
+  { 87, 46, -92 }, { 87, 59, -55 }, { 87, 117, -50 }, { 87, 250, -50 },
+  { 87, 251, -50 }, { 87, 252, -50 }, { 87, 249, -50 }, { 87, 369, -50 },
+  { 87, 363, -50 }, { 87, 371, -50 }, { 87, 367, -50 }, { 87, 121, -60 },
+  { 87, 253, -60 }, { 87, 255, -60 }, { 89, 65, -110 }, { 89, 193, -110 },
+  { 89, 258, -110 }, { 89, 194, -110 }, { 89, 196, -110 }, { 89, 192, -110 },
+  { 89, 256, -110 }, { 89, 260, -110 }, { 89, 197, -110 }, { 89, 195, -110 },
+  { 89, 79, -35 }, { 89, 211, -35 }, { 89, 212, -35 }, { 89, 214, -35 },
+  { 89, 210, -35 }, { 89, 336, -35 }, { 89, 332, -35 }, { 89, 216, -35 },
+  { 89, 213, -35 }, { 89, 97, -85 }, { 89, 225, -85 }, { 89, 259, -85 },
+  { 89, 226, -85 }, { 89, 228, -85 }, { 89, 224, -85 }, { 89, 257, -85 },
+  { 89, 261, -85 }, { 89, 229, -85 }, { 89, 227, -85 }, { 89, 58, -92 },
+  { 89, 44, -92 }, { 89, 101, -111 }, { 89, 233, -111 }, { 89, 283, -111 },
+  { 89, 234, -111 }, { 89, 235, -71 }, { 89, 279, -111 }, { 89, 232, -71 },
+  { 89, 275, -71 }, { 89, 281, -111 }, { 89, 45, -92 }, { 89, 105, -37 },
+  { 89, 237, -37 }, { 89, 303, -37 }, { 89, 111, -111 }, { 89, 243, -111 },
+  { 89, 244, -111 }, { 89, 246, -111 }, { 89, 242, -111 }, { 89, 337, -111 },
+  { 89, 333, -111 }, { 89, 248, -111 }, { 89, 245, -111 }, { 89, 46, -92 },
+  { 89, 59, -92 }, { 89, 117, -92 }, { 89, 250, -92 }, { 89, 251, -92 },
+  { 89, 252, -92 }, { 89, 249, -92 }, { 89, 369, -92 }, { 89, 363, -92 },
+  { 89, 371, -92 }, { 89, 367, -92 }, { 221, 65, -110 }, { 221, 193, -110 },
+  { 221, 258, -110 }, { 221, 194, -110 }, { 221, 196, -110 }, { 221, 192, -110 },
+  { 221, 256, -110 }, { 221, 260, -110 }, { 221, 197, -110 }, { 221, 195, -110 },
+  { 221, 79, -35 }, { 221, 211, -35 }, { 221, 212, -35 }, { 221, 214, -35 },
+  { 221, 210, -35 }, { 221, 336, -35 }, { 221, 332, -35 }, { 221, 216, -35 },
+  { 221, 213, -35 }, { 221, 97, -85 }, { 221, 225, -85 }, { 221, 259, -85 },
+  { 221, 226, -85 }, { 221, 228, -85 }, { 221, 224, -85 }, { 221, 257, -85 },
+  { 221, 261, -85 }, { 221, 229, -85 }, { 221, 227, -85 }, { 221, 58, -92 },
+  { 221, 44, -92 }, { 221, 101, -111 }, { 221, 233, -111 }, { 221, 283, -111 },
+  { 221, 234, -111 }, { 221, 235, -71 }, { 221, 279, -111 }, { 221, 232, -71 },
+  { 221, 275, -71 }, { 221, 281, -111 }, { 221, 45, -92 }, { 221, 105, -37 },
+  { 221, 237, -37 }, { 221, 303, -37 }, { 221, 111, -111 }, { 221, 243, -111 },
+  { 221, 244, -111 }, { 221, 246, -111 }, { 221, 242, -111 }, { 221, 337, -111 },
+  { 221, 333, -111 }, { 221, 248, -111 }, { 221, 245, -111 }, { 221, 46, -92 },
+  { 221, 59, -92 }, { 221, 117, -92 }, { 221, 250, -92 }, { 221, 251, -92 },
+  { 221, 252, -92 }, { 221, 249, -92 }, { 221, 369, -92 }, { 221, 363, -92 },
+  { 221, 371, -92 }, { 221, 367, -92 }, { 376, 65, -110 }, { 376, 193, -110 },
+  { 376, 258, -110 }, { 376, 194, -110 }, { 376, 196, -110 }, { 376, 192, -110 },
+  { 376, 256, -110 }, { 376, 260, -110 }, { 376, 197, -110 }, { 376, 195, -110 },
+  { 376, 79, -35 }, { 376, 211, -35 }, { 376, 212, -35 }, { 376, 214, -35 },
+  { 376, 210, -35 }, { 376, 336, -35 }, { 376, 332, -35 }, { 376, 216, -35 },
+  { 376, 213, -35 }, { 376, 97, -85 }, { 376, 225, -85 }, { 376, 259, -85 },
+  { 376, 226, -85 }, { 376, 228, -85 }, { 376, 224, -85 }, { 376, 257, -85 },
+  { 376, 261, -85 }, { 376, 229, -85 }, { 376, 227, -85 }, { 376, 58, -92 },
+  { 376, 44, -92 }, { 376, 101, -111 }, { 376, 233, -111 }, { 376, 283, -111 },
+  { 376, 234, -111 }, { 376, 235, -71 }, { 376, 279, -111 }, { 376, 232, -71 },
+  { 376, 275, -71 }, { 376, 281, -111 }, { 376, 45, -92 }, { 376, 105, -37 },
+  { 376, 237, -37 }, { 376, 303, -37 }, { 376, 111, -111 }, { 376, 243, -111 },
+  { 376, 244, -111 }, { 376, 246, -111 }, { 376, 242, -111 }, { 376, 337, -111 },
+  { 376, 333, -111 }, { 376, 248, -111 }, { 376, 245, -111 }, { 376, 46, -92 },
+  { 376, 59, -92 }, { 376, 117, -92 }, { 376, 250, -92 }, { 376, 251, -92 },
+  { 376, 252, -92 }, { 376, 249, -92 }, { 376, 369, -92 }, { 376, 363, -92 },
+  { 376, 371, -92 }, { 376, 367, -92 }, { 97, 118, -25 }, { 225, 118, -25 },
+  { 259, 118, -25 }, { 226, 118, -25 }, { 228, 118, -25 }, { 224, 118, -25 },
+  { 257, 118, -25 }, { 261, 118, -25 }, { 229, 118, -25 }, { 227, 118, -25 },
+  { 98, 98, -10 }, { 98, 46, -40 }, { 98, 117, -20 }, { 98, 250, -20 },
+  { 98, 251, -20 }, { 98, 252, -20 }, { 98, 249, -20 }, { 98, 369, -20 },
+  { 98, 363, -20 }, { 98, 371, -20 }, { 98, 367, -20 }, { 98, 118, -15 },
+  { 44, 416, -45 }, { 44, 418, -55 }, { 100, 119, -15 }, { 273, 119, -15 },
+  { 101, 118, -15 }, { 233, 118, -15 }, { 283, 118, -15 }, { 234, 118, -15 },
+  { 235, 118, -15 }, { 279, 118, -15 }, { 232, 118, -15 }, { 275, 118, -15 },
+  { 281, 118, -15 }, { 102, 44, -15 }, { 102, 305, -35 }, { 102, 105, -25 },
+  { 102, 111, -25 }, { 102, 243, -25 }, { 102, 244, -25 }, { 102, 246, -25 },
+  { 102, 242, -25 }, { 102, 337, -25 }, { 102, 333, -25 }, { 102, 248, -25 },
+  { 102, 245, -25 }, { 102, 46, -15 }, { 102, 416, 50 }, { 102, 418, 55 },
+  { 103, 46, -15 }, { 287, 46, -15 }, { 291, 46, -15 }, { 104, 121, -15 },
+  { 104, 253, -15 }, { 104, 255, -15 }, { 105, 118, -10 }, { 237, 118, -10 },
+  { 238, 118, -10 }, { 239, 118, -10 }, { 236, 118, -10 }, { 299, 118, -10 },
+  { 303, 118, -10 }, { 107, 101, -10 }, { 107, 233, -10 }, { 107, 283, -10 },
+  { 107, 234, -10 }, { 107, 235, -10 }, { 107, 279, -10 }, { 107, 232, -10 },
+  { 107, 275, -10 }, { 107, 281, -10 }, { 107, 111, -15 }, { 107, 243, -15 },
+  { 107, 244, -15 }, { 107, 246, -15 }, { 107, 242, -15 }, { 107, 337, -15 },
+  { 107, 333, -15 }, { 107, 248, -15 }, { 107, 245, -15 }, { 107, 121, -15 },
+  { 107, 253, -15 }, { 107, 255, -15 }, { 311, 101, -10 }, { 311, 233, -10 },
+  { 311, 283, -10 }, { 311, 234, -10 }, { 311, 235, -10 }, { 311, 279, -10 },
+  { 311, 232, -10 }, { 311, 275, -10 }, { 311, 281, -10 }, { 311, 111, -15 },
+  { 311, 243, -15 }, { 311, 244, -15 }, { 311, 246, -15 }, { 311, 242, -15 },
+  { 311, 337, -15 }, { 311, 333, -15 }, { 311, 248, -15 }, { 311, 245, -15 },
+  { 311, 121, -15 }, { 311, 253, -15 }, { 311, 255, -15 }, { 110, 118, -40 },
+  { 324, 118, -40 }, { 328, 118, -40 }, { 326, 118, -40 }, { 241, 118, -40 },
+  { 111, 118, -10 }, { 111, 119, -10 }, { 243, 118, -10 }, { 243, 119, -10 },
+  { 244, 118, -10 }, { 244, 119, -10 }, { 246, 118, -10 }, { 246, 119, -10 },
+  { 242, 118, -10 }, { 242, 119, -10 }, { 337, 118, -10 }, { 337, 119, -10 },
+  { 333, 118, -10 }, { 333, 119, -10 }, { 248, 118, -10 }, { 248, 119, -10 },
+  { 245, 118, -10 }, { 245, 119, -10 }, { 46, 416, -55 }, { 46, 418, -55 },
+  { 415, 65, -10 }, { 415, 193, -10 }, { 415, 258, -10 }, { 415, 194, -10 },
+  { 415, 196, -10 }, { 415, 192, -10 }, { 415, 256, -10 }, { 415, 260, -10 },
+  { 415, 197, -10 }, { 415, 195, -10 }, { 417, 65, -10 }, { 417, 193, -10 },
+  { 417, 258, -10 }, { 417, 194, -10 }, { 417, 196, -10 }, { 417, 192, -10 },
+  { 417, 256, -10 }, { 417, 260, -10 }, { 417, 197, -10 }, { 417, 195, -10 },
+  { 417, 417, -63 }, { 418, 100, -20 }, { 418, 273, -20 }, { 418, 418, -63 },
+  { 418, 114, -20 }, { 418, 341, -20 }, { 418, 345, -20 }, { 418, 343, -20 },
+  { 418, 115, -37 }, { 418, 347, -37 }, { 418, 353, -37 }, { 418, 351, -37 },
+  { 418, 422, -37 }, { 418, 32, -74 }, { 418, 118, -20 }, { 114, 99, -18 },
+  { 114, 263, -18 }, { 114, 269, -18 }, { 114, 231, -18 }, { 114, 44, -92 },
+  { 114, 101, -18 }, { 114, 233, -18 }, { 114, 283, -18 }, { 114, 234, -18 },
+  { 114, 235, -18 }, { 114, 279, -18 }, { 114, 232, -18 }, { 114, 275, -18 },
+  { 114, 281, -18 }, { 114, 103, -10 }, { 114, 287, -10 }, { 114, 291, -10 },
+  { 114, 45, -37 }, { 114, 110, -15 }, { 114, 324, -15 }, { 114, 328, -15 },
+  { 114, 326, -15 }, { 114, 241, -15 }, { 114, 111, -18 }, { 114, 243, -18 },
+  { 114, 244, -18 }, { 114, 246, -18 }, { 114, 242, -18 }, { 114, 337, -18 },
+  { 114, 333, -18 }, { 114, 248, -18 }, { 114, 245, -18 }, { 114, 112, -10 },
+  { 114, 46, -100 }, { 114, 113, -18 }, { 114, 118, -10 }, { 341, 99, -18 },
+  { 341, 263, -18 }, { 341, 269, -18 }, { 341, 231, -18 }, { 341, 44, -92 },
+  { 341, 101, -18 }, { 341, 233, -18 }, { 341, 283, -18 }, { 341, 234, -18 },
+  { 341, 235, -18 }, { 341, 279, -18 }, { 341, 232, -18 }, { 341, 275, -18 },
+  { 341, 281, -18 }, { 341, 103, -10 }, { 341, 287, -10 }, { 341, 291, -10 },
+  { 341, 45, -37 }, { 341, 110, -15 }, { 341, 324, -15 }, { 341, 328, -15 },
+  { 341, 326, -15 }, { 341, 241, -15 }, { 341, 111, -18 }, { 341, 243, -18 },
+  { 341, 244, -18 }, { 341, 246, -18 }, { 341, 242, -18 }, { 341, 337, -18 },
+  { 341, 333, -18 }, { 341, 248, -18 }, { 341, 245, -18 }, { 341, 112, -10 },
+  { 341, 46, -100 }, { 341, 113, -18 }, { 341, 118, -10 }, { 345, 99, -18 },
+  { 345, 263, -18 }, { 345, 269, -18 }, { 345, 231, -18 }, { 345, 44, -92 },
+  { 345, 101, -18 }, { 345, 233, -18 }, { 345, 283, -18 }, { 345, 234, -18 },
+  { 345, 235, -18 }, { 345, 279, -18 }, { 345, 232, -18 }, { 345, 275, -18 },
+  { 345, 281, -18 }, { 345, 103, -10 }, { 345, 287, -10 }, { 345, 291, -10 },
+  { 345, 45, -37 }, { 345, 110, -15 }, { 345, 324, -15 }, { 345, 328, -15 },
+  { 345, 326, -15 }, { 345, 241, -15 }, { 345, 111, -18 }, { 345, 243, -18 },
+  { 345, 244, -18 }, { 345, 246, -18 }, { 345, 242, -18 }, { 345, 337, -18 },
+  { 345, 333, -18 }, { 345, 248, -18 }, { 345, 245, -18 }, { 345, 112, -10 },
+  { 345, 46, -100 }, { 345, 113, -18 }, { 345, 118, -10 }, { 343, 99, -18 },
+  { 343, 263, -18 }, { 343, 269, -18 }, { 343, 231, -18 }, { 343, 44, -92 },
+  { 343, 101, -18 }, { 343, 233, -18 }, { 343, 283, -18 }, { 343, 234, -18 },
+  { 343, 235, -18 }, { 343, 279, -18 }, { 343, 232, -18 }, { 343, 275, -18 },
+  { 343, 281, -18 }, { 343, 103, -10 }, { 343, 287, -10 }, { 343, 291, -10 },
+  { 343, 45, -37 }, { 343, 110, -15 }, { 343, 324, -15 }, { 343, 328, -15 },
+  { 343, 326, -15 }, { 343, 241, -15 }, { 343, 111, -18 }, { 343, 243, -18 },
+  { 343, 244, -18 }, { 343, 246, -18 }, { 343, 242, -18 }, { 343, 337, -18 },
+  { 343, 333, -18 }, { 343, 248, -18 }, { 343, 245, -18 }, { 343, 112, -10 },
+  { 343, 46, -100 }, { 343, 113, -18 }, { 343, 118, -10 }, { 32, 65, -55 },
+  { 32, 193, -55 }, { 32, 258, -55 }, { 32, 194, -55 }, { 32, 196, -55 },
+  { 32, 192, -55 }, { 32, 256, -55 }, { 32, 260, -55 }, { 32, 197, -55 },
+  { 32, 195, -55 }, { 32, 84, -30 }, { 32, 356, -30 }, { 32, 387, -30 },
+  { 32, 86, -45 }, { 32, 87, -30 }, { 32, 89, -55 }, { 32, 221, -55 },
+  { 32, 376, -55 }, { 118, 97, -10 }, { 118, 225, -10 }, { 118, 259, -10 },
+  { 118, 226, -10 }, { 118, 228, -10 }, { 118, 224, -10 }, { 118, 257, -10 },
+  { 118, 261, -10 }, { 118, 229, -10 }, { 118, 227, -10 }, { 118, 44, -55 },
+  { 118, 101, -10 }, { 118, 233, -10 }, { 118, 283, -10 }, { 118, 234, -10 },
+  { 118, 235, -10 }, { 118, 279, -10 }, { 118, 232, -10 }, { 118, 275, -10 },
+  { 118, 281, -10 }, { 118, 111, -10 }, { 118, 243, -10 }, { 118, 244, -10 },
+  { 118, 246, -10 }, { 118, 242, -10 }, { 118, 337, -10 }, { 118, 333, -10 },
+  { 118, 248, -10 }, { 118, 245, -10 }, { 118, 46, -70 }, { 119, 44, -55 },
+  { 119, 111, -10 }, { 119, 243, -10 }, { 119, 244, -10 }, { 119, 246, -10 },
+  { 119, 242, -10 }, { 119, 337, -10 }, { 119, 333, -10 }, { 119, 248, -10 },
+  { 119, 245, -10 }, { 119, 46, -70 }, { 121, 44, -55 }, { 121, 101, -10 },
+  { 121, 233, -10 }, { 121, 283, -10 }, { 121, 234, -10 }, { 121, 235, -10 },
+  { 121, 279, -10 }, { 121, 232, -10 }, { 121, 275, -10 }, { 121, 281, -10 },
+  { 121, 111, -25 }, { 121, 243, -25 }, { 121, 244, -25 }, { 121, 246, -25 },
+  { 121, 242, -25 }, { 121, 337, -25 }, { 121, 333, -25 }, { 121, 248, -25 },
+  { 121, 245, -25 }, { 121, 46, -70 }, { 253, 44, -55 }, { 253, 101, -10 },
+  { 253, 233, -10 }, { 253, 283, -10 }, { 253, 234, -10 }, { 253, 235, -10 },
+  { 253, 279, -10 }, { 253, 232, -10 }, { 253, 275, -10 }, { 253, 281, -10 },
+  { 253, 111, -25 }, { 253, 243, -25 }, { 253, 244, -25 }, { 253, 246, -25 },
+  { 253, 242, -25 }, { 253, 337, -25 }, { 253, 333, -25 }, { 253, 248, -25 },
+  { 253, 245, -25 }, { 253, 46, -70 }, { 255, 44, -55 }, { 255, 101, -10 },
+  { 255, 233, -10 }, { 255, 283, -10 }, { 255, 234, -10 }, { 255, 235, -10 },
+  { 255, 279, -10 }, { 255, 232, -10 }, { 255, 275, -10 }, { 255, 281, -10 },
+  { 255, 111, -25 }, { 255, 243, -25 }, { 255, 244, -25 }, { 255, 246, -25 },
+  { 255, 242, -25 }, { 255, 337, -25 }, { 255, 333, -25 }, { 255, 248, -25 },
+  { 255, 245, -25 }, { 255, 46, -70 } };
+
+static const fontbuilthighstr high_3[] = {
+  { "\306\222", 16 },
+  { "\310\230", 2 },
+  { "\310\231", 38 },
+  { "\310\232", 3 },
+  { "\310\233", 40 },
+  { "\314\202", 6 },
+  { "\314\203", 41 },
+  { "\314\206", 4 },
+  { "\314\207", 10 },
+  { "\314\212", 37 },
+  { "\314\213", 21 },
+  { "\314\214", 5 },
+  { "\314\246", 7 },
+  { "\314\250", 26 },
+  { "\316\224", 0 },
+  { "\342\200\223", 13 },
+  { "\342\200\224", 12 },
+  { "\342\200\230", 33 },
+  { "\342\200\231", 34 },
+  { "\342\200\232", 35 },
+  { "\342\200\234", 31 },
+  { "\342\200\235", 32 },
+  { "\342\200\236", 30 },
+  { "\342\200\240", 8 },
+  { "\342\200\241", 9 },
+  { "\342\200\246", 11 },
+  { "\342\200\247", 28 },
+  { "\342\200\261", 29 },
+  { "\342\200\271", 19 },
+  { "\342\200\272", 20 },
+  { "\342\201\204", 17 },
+  { "\342\202\254", 1 },
+  { "\342\204\242", 42 },
+  { "\342\210\202", 27 },
+  { "\342\210\221", 39 },
+  { "\342\210\222", 24 },
+  { "\342\210\232", 36 },
+  { "\342\210\236", 43 },
+  { "\342\211\240", 25 },
+  { "\342\211\244", 22 },
+  { "\342\211\245", 18 },
+  { "\342\227\212", 23 },
+  { "\357\254\201", 14 },
+  { "\357\254\202", 15 },
+  };
+
+/* Times-BoldItalic */
+
+static const int32_t widths_4[] = {
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 250, 389, 555, 500, 500, 833, 778, 278,
+  333, 333, 500, 570, 250, 333, 250, 278, 500, 500,
+  500, 500, 500, 500, 500, 500, 500, 500, 333, 333,
+  570, 570, 570, 500, 832, 667, 667, 667, 722, 667,
+  667, 722, 778, 389, 500, 667, 611, 889, 722, 722,
+  611, 722, 667, 556, 611, 722, 667, 889, 667, 611,
+  611, 333, 278, 333, 570, 500, 333, 500, 500, 444,
+  500, 444, 333, 500, 556, 278, 278, 500, 278, 778,
+  556, 500, 500, 500, 389, 389, 278, 556, 444, 667,
+  500, 444, 389, 348, 220, 348, 570, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  250, 389, 500, 500, 500, 500, 220, 500, 333, 747,
+  266, 500, 606, 333, 747, 333, 400, 570, 300, 300,
+  333, 576, 500, 350, 333, 300, 300, 500, 750, 750,
+  750, 500, 667, 667, 667, 667, 667, 667, 944, 667,
+  667, 667, 667, 667, 389, 389, 389, 389, 722, 722,
+  722, 722, 722, 722, 722, 570, 722, 722, 722, 722,
+  722, 611, 611, 500, 500, 500, 500, 500, 500, 500,
+  722, 444, 444, 444, 444, 444, 278, 278, 278, 278,
+  500, 556, 500, 500, 500, 500, 500, 570, 500, 556,
+  556, 556, 556, 444, 500, 444, 667, 500, 667, 500,
+  667, 500, 667, 444, 667, 444, 667, 444, 667, 444,
+  722, 608, 722, 500, 667, 444, 667, 444, 667, 444,
+  667, 444, 667, 444, 722, 500, 722, 500, 722, 500,
+  722, 500, 778, 556, 778, 556, 389, 278, 389, 278,
+  389, 278, 389, 278, 389, 278, 826, 525, 500, 278,
+  667, 500, 534, 611, 278, 611, 278, 611, 382, 611,
+  528, 611, 278, 722, 556, 722, 556, 722, 556, 556,
+  -1, -1, 722, 500, 722, 500, 722, 500, 944, 722,
+  667, 389, 667, 389, 667, 389, 556, 389, 556, 389,
+  556, 389, 556, 389, 611, 278, 611, 366, 611, 278,
+  722, 556, 722, 556, 722, 556, 722, 556, 722, 556,
+  722, 556, 889, 667, 611, 444, 611, 611, 389, 611,
+  389, 611, 389, 333, 612, 500, 556, 611, 333, 333,
+  333, 250, 500, 500, 333, 1000, 1000, 500, 556, 556,
+  500, 167, 549, 333, 333, 333, 549, 494, 606, 549,
+  333, 494, 250, 1000, 500, 500, 500, 333, 333, 333,
+  549, 333, 389, 600, 278, 333, 1000, 752, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1 };
+
+static const int32_t r2ladjusts_4[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 437, 672, 500, 477, 832, 704, 396,
+  372, 227, 521, 570, 84, 273, 130, 278, 494, 424,
+  419, 435, 488, 476, 532, 577, 479, 463, 287, 239,
+  570, 570, 570, 549, 833, 526, 600, 709, 639, 626,
+  647, 727, 775, 374, 478, 681, 568, 888, 721, 718,
+  586, 718, 594, 528, 700, 811, 780, 1005, 670, 732,
+  579, 325, 278, 287, 570, 500, 382, 434, 430, 387,
+  496, 403, 277, 426, 485, 265, 90, 460, 292, 708,
+  487, 438, 326, 472, 368, 314, 270, 507, 417, 630,
+  423, 298, 325, 441, 220, 173, 570, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 341, 481, 478, 500, 661, 220, 495, 457, 748,
+  346, 480, 606, 0, 748, 444, 452, 570, 315, 338,
+  518, 456, 505, 350, 76, 331, 403, 480, 728, 714,
+  733, 451, 526, 526, 526, 526, 526, 526, 854, 709,
+  626, 626, 626, 626, 374, 400, 418, 418, 669, 721,
+  718, 718, 718, 718, 718, 570, 718, 811, 811, 811,
+  811, 732, 546, 273, 434, 442, 434, 470, 455, 434,
+  668, 387, 403, 440, 428, 453, 261, 354, 321, 366,
+  451, 498, 438, 460, 448, 488, 468, 570, 438, 507,
+  507, 507, 514, 341, 326, 349, 526, 446, 526, 450,
+  537, 434, 709, 430, 709, 434, 709, 387, 709, 462,
+  639, 654, 669, 531, 626, 444, 632, 488, 626, 403,
+  626, 403, 626, 472, 727, 426, 727, 426, 727, 426,
+  727, 426, 775, 485, 775, 485, 471, 391, 429, 296,
+  478, 397, 374, 243, 374, 240, 834, 521, 478, 154,
+  681, 460, 508, 568, 394, 568, 248, 649, 450, 564,
+  479, 568, 300, 721, 487, 721, 487, 721, 517, 487,
+  0, 0, 718, 459, 718, 498, 750, 579, 969, 680,
+  594, 386, 594, 322, 594, 403, 533, 388, 555, 386,
+  528, 314, 555, 405, 700, 219, 700, 423, 700, 266,
+  811, 538, 811, 507, 811, 545, 811, 507, 811, 625,
+  811, 507, 1005, 630, 732, 298, 732, 579, 364, 579,
+  325, 579, 381, 277, 614, 0, 528, 700, 458, 490,
+  407, 95, 585, 503, 461, 892, 937, 437, 326, 367,
+  450, 155, 549, 335, 291, 567, 555, 494, 606, 555,
+  259, 505, 250, 1003, 346, 566, 566, 460, 400, 194,
+  522, 467, 314, 599, 219, 455, 1000, 748, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0 };
+
+static const kerntablestr kerns_4[] = {
+  { 65, 67, -65 }, { 65, 262, -65 }, { 65, 268, -65 }, { 65, 199, -65 },
+  { 65, 71, -60 }, { 65, 286, -60 }, { 65, 290, -60 }, { 65, 79, -50 },
+  { 65, 211, -50 }, { 65, 212, -50 }, { 65, 214, -50 }, { 65, 210, -50 },
+  { 65, 336, -50 }, { 65, 332, -50 }, { 65, 216, -50 }, { 65, 213, -50 },
+  { 65, 81, -55 }, { 65, 84, -55 }, { 65, 356, -55 }, { 65, 387, -55 },
+  { 65, 85, -50 }, { 65, 218, -50 }, { 65, 219, -50 }, { 65, 220, -50 },
+  { 65, 217, -50 }, { 65, 368, -50 }, { 65, 362, -50 }, { 65, 370, -50 },
+  { 65, 366, -50 }, { 65, 86, -95 }, { 65, 87, -100 }, { 65, 89, -70 },
+  { 65, 221, -70 }, { 65, 376, -70 }, { 65, 418, -74 }, { 65, 117, -30 },
+  { 65, 250, -30 }, { 65, 251, -30 }, { 65, 252, -30 }, { 65, 249, -30 },
+  { 65, 369, -30 }, { 65, 363, -30 }, { 65, 371, -30 }, { 65, 367, -30 },
+  { 65, 118, -74 }, { 65, 119, -74 }, { 65, 121, -74 }, { 65, 253, -74 },
+  { 65, 255, -74 }, { 193, 67, -65 }, { 193, 262, -65 }, { 193, 268, -65 },
+  { 193, 199, -65 }, { 193, 71, -60 }, { 193, 286, -60 }, { 193, 290, -60 },
+  { 193, 79, -50 }, { 193, 211, -50 }, { 193, 212, -50 }, { 193, 214, -50 },
+  { 193, 210, -50 }, { 193, 336, -50 }, { 193, 332, -50 }, { 193, 216, -50 },
+  { 193, 213, -50 }, { 193, 81, -55 }, { 193, 84, -55 }, { 193, 356, -55 },
+  { 193, 387, -55 }, { 193, 85, -50 }, { 193, 218, -50 }, { 193, 219, -50 },
+  { 193, 220, -50 }, { 193, 217, -50 }, { 193, 368, -50 }, { 193, 362, -50 },
+  { 193, 370, -50 }, { 193, 366, -50 }, { 193, 86, -95 }, { 193, 87, -100 },
+  { 193, 89, -70 }, { 193, 221, -70 }, { 193, 376, -70 }, { 193, 418, -74 },
+  { 193, 117, -30 }, { 193, 250, -30 }, { 193, 251, -30 }, { 193, 252, -30 },
+  { 193, 249, -30 }, { 193, 369, -30 }, { 193, 363, -30 }, { 193, 371, -30 },
+  { 193, 367, -30 }, { 193, 118, -74 }, { 193, 119, -74 }, { 193, 121, -74 },
+  { 193, 253, -74 }, { 193, 255, -74 }, { 258, 67, -65 }, { 258, 262, -65 },
+  { 258, 268, -65 }, { 258, 199, -65 }, { 258, 71, -60 }, { 258, 286, -60 },
+  { 258, 290, -60 }, { 258, 79, -50 }, { 258, 211, -50 }, { 258, 212, -50 },
+  { 258, 214, -50 }, { 258, 210, -50 }, { 258, 336, -50 }, { 258, 332, -50 },
+  { 258, 216, -50 }, { 258, 213, -50 }, { 258, 81, -55 }, { 258, 84, -55 },
+  { 258, 356, -55 }, { 258, 387, -55 }, { 258, 85, -50 }, { 258, 218, -50 },
+  { 258, 219, -50 }, { 258, 220, -50 }, { 258, 217, -50 }, { 258, 368, -50 },
+  { 258, 362, -50 }, { 258, 370, -50 }, { 258, 366, -50 }, { 258, 86, -95 },
+  { 258, 87, -100 }, { 258, 89, -70 }, { 258, 221, -70 }, { 258, 376, -70 },
+  { 258, 418, -74 }, { 258, 117, -30 }, { 258, 250, -30 }, { 258, 251, -30 },
+  { 258, 252, -30 }, { 258, 249, -30 }, { 258, 369, -30 }, { 258, 363, -30 },
+  { 258, 371, -30 }, { 258, 367, -30 }, { 258, 118, -74 }, { 258, 119, -74 },
+  { 258, 121, -74 }, { 258, 253, -74 }, { 258, 255, -74 }, { 194, 67, -65 },
+  { 194, 262, -65 }, { 194, 268, -65 }, { 194, 199, -65 }, { 194, 71, -60 },
+  { 194, 286, -60 }, { 194, 290, -60 }, { 194, 79, -50 }, { 194, 211, -50 },
+  { 194, 212, -50 }, { 194, 214, -50 }, { 194, 210, -50 }, { 194, 336, -50 },
+  { 194, 332, -50 }, { 194, 216, -50 }, { 194, 213, -50 }, { 194, 81, -55 },
+  { 194, 84, -55 }, { 194, 356, -55 }, { 194, 387, -55 }, { 194, 85, -50 },
+  { 194, 218, -50 }, { 194, 219, -50 }, { 194, 220, -50 }, { 194, 217, -50 },
+  { 194, 368, -50 }, { 194, 362, -50 }, { 194, 370, -50 }, { 194, 366, -50 },
+  { 194, 86, -95 }, { 194, 87, -100 }, { 194, 89, -70 }, { 194, 221, -70 },
+  { 194, 376, -70 }, { 194, 418, -74 }, { 194, 117, -30 }, { 194, 250, -30 },
+  { 194, 251, -30 }, { 194, 252, -30 }, { 194, 249, -30 }, { 194, 369, -30 },
+  { 194, 363, -30 }, { 194, 371, -30 }, { 194, 367, -30 }, { 194, 118, -74 },
+  { 194, 119, -74 }, { 194, 121, -74 }, { 194, 253, -74 }, { 194, 255, -74 },
+  { 196, 67, -65 }, { 196, 262, -65 }, { 196, 268, -65 }, { 196, 199, -65 },
+  { 196, 71, -60 }, { 196, 286, -60 }, { 196, 290, -60 }, { 196, 79, -50 },
+  { 196, 211, -50 }, { 196, 212, -50 }, { 196, 214, -50 }, { 196, 210, -50 },
+  { 196, 336, -50 }, { 196, 332, -50 }, { 196, 216, -50 }, { 196, 213, -50 },
+  { 196, 81, -55 }, { 196, 84, -55 }, { 196, 356, -55 }, { 196, 387, -55 },
+  { 196, 85, -50 }, { 196, 218, -50 }, { 196, 219, -50 }, { 196, 220, -50 },
+  { 196, 217, -50 }, { 196, 368, -50 }, { 196, 362, -50 }, { 196, 370, -50 },
+  { 196, 366, -50 }, { 196, 86, -95 }, { 196, 87, -100 }, { 196, 89, -70 },
+  { 196, 221, -70 }, { 196, 376, -70 }, { 196, 418, -74 }, { 196, 117, -30 },
+  { 196, 250, -30 }, { 196, 251, -30 }, { 196, 252, -30 }, { 196, 249, -30 },
+  { 196, 369, -30 }, { 196, 363, -30 }, { 196, 371, -30 }, { 196, 367, -30 },
+  { 196, 118, -74 }, { 196, 119, -74 }, { 196, 121, -74 }, { 196, 253, -74 },
+  { 196, 255, -74 }, { 192, 67, -65 }, { 192, 262, -65 }, { 192, 268, -65 },
+  { 192, 199, -65 }, { 192, 71, -60 }, { 192, 286, -60 }, { 192, 290, -60 },
+  { 192, 79, -50 }, { 192, 211, -50 }, { 192, 212, -50 }, { 192, 214, -50 },
+  { 192, 210, -50 }, { 192, 336, -50 }, { 192, 332, -50 }, { 192, 216, -50 },
+  { 192, 213, -50 }, { 192, 81, -55 }, { 192, 84, -55 }, { 192, 356, -55 },
+  { 192, 387, -55 }, { 192, 85, -50 }, { 192, 218, -50 }, { 192, 219, -50 },
+  { 192, 220, -50 }, { 192, 217, -50 }, { 192, 368, -50 }, { 192, 362, -50 },
+  { 192, 370, -50 }, { 192, 366, -50 }, { 192, 86, -95 }, { 192, 87, -100 },
+  { 192, 89, -70 }, { 192, 221, -70 }, { 192, 376, -70 }, { 192, 418, -74 },
+  { 192, 117, -30 }, { 192, 250, -30 }, { 192, 251, -30 }, { 192, 252, -30 },
+  { 192, 249, -30 }, { 192, 369, -30 }, { 192, 363, -30 }, { 192, 371, -30 },
+  { 192, 367, -30 }, { 192, 118, -74 }, { 192, 119, -74 }, { 192, 121, -74 },
+  { 192, 253, -74 }, { 192, 255, -74 }, { 256, 67, -65 }, { 256, 262, -65 },
+  { 256, 268, -65 }, { 256, 199, -65 }, { 256, 71, -60 }, { 256, 286, -60 },
+  { 256, 290, -60 }, { 256, 79, -50 }, { 256, 211, -50 }, { 256, 212, -50 },
+  { 256, 214, -50 }, { 256, 210, -50 }, { 256, 336, -50 }, { 256, 332, -50 },
+  { 256, 216, -50 }, { 256, 213, -50 }, { 256, 81, -55 }, { 256, 84, -55 },
+  { 256, 356, -55 }, { 256, 387, -55 }, { 256, 85, -50 }, { 256, 218, -50 },
+  { 256, 219, -50 }, { 256, 220, -50 }, { 256, 217, -50 }, { 256, 368, -50 },
+  { 256, 362, -50 }, { 256, 370, -50 }, { 256, 366, -50 }, { 256, 86, -95 },
+  { 256, 87, -100 }, { 256, 89, -70 }, { 256, 221, -70 }, { 256, 376, -70 },
+  { 256, 418, -74 }, { 256, 117, -30 }, { 256, 250, -30 }, { 256, 251, -30 },
+  { 256, 252, -30 }, { 256, 249, -30 }, { 256, 369, -30 }, { 256, 363, -30 },
+  { 256, 371, -30 }, { 256, 367, -30 }, { 256, 118, -74 }, { 256, 119, -74 },
+  { 256, 121, -74 }, { 256, 253, -74 }, { 256, 255, -74 }, { 260, 67, -65 },
+  { 260, 262, -65 }, { 260, 268, -65 }, { 260, 199, -65 }, { 260, 71, -60 },
+  { 260, 286, -60 }, { 260, 290, -60 }, { 260, 79, -50 }, { 260, 211, -50 },
+  { 260, 212, -50 }, { 260, 214, -50 }, { 260, 210, -50 }, { 260, 336, -50 },
+  { 260, 332, -50 }, { 260, 216, -50 }, { 260, 213, -50 }, { 260, 81, -55 },
+  { 260, 84, -55 }, { 260, 356, -55 }, { 260, 387, -55 }, { 260, 85, -50 },
+  { 260, 218, -50 }, { 260, 219, -50 }, { 260, 220, -50 }, { 260, 217, -50 },
+  { 260, 368, -50 }, { 260, 362, -50 }, { 260, 370, -50 }, { 260, 366, -50 },
+  { 260, 86, -95 }, { 260, 87, -100 }, { 260, 89, -70 }, { 260, 221, -70 },
+  { 260, 376, -70 }, { 260, 418, -74 }, { 260, 117, -30 }, { 260, 250, -30 },
+  { 260, 251, -30 }, { 260, 252, -30 }, { 260, 249, -30 }, { 260, 369, -30 },
+  { 260, 363, -30 }, { 260, 371, -30 }, { 260, 367, -30 }, { 260, 118, -74 },
+  { 260, 119, -74 }, { 260, 121, -34 }, { 260, 253, -34 }, { 260, 255, -34 },
+  { 197, 67, -65 }, { 197, 262, -65 }, { 197, 268, -65 }, { 197, 199, -65 },
+  { 197, 71, -60 }, { 197, 286, -60 }, { 197, 290, -60 }, { 197, 79, -50 },
+  { 197, 211, -50 }, { 197, 212, -50 }, { 197, 214, -50 }, { 197, 210, -50 },
+  { 197, 336, -50 }, { 197, 332, -50 }, { 197, 216, -50 }, { 197, 213, -50 },
+  { 197, 81, -55 }, { 197, 84, -55 }, { 197, 356, -55 }, { 197, 387, -55 },
+  { 197, 85, -50 }, { 197, 218, -50 }, { 197, 219, -50 }, { 197, 220, -50 },
+  { 197, 217, -50 }, { 197, 368, -50 }, { 197, 362, -50 }, { 197, 370, -50 },
+  { 197, 366, -50 }, { 197, 86, -95 }, { 197, 87, -100 }, { 197, 89, -70 },
+  { 197, 221, -70 }, { 197, 376, -70 }, { 197, 418, -74 }, { 197, 117, -30 },
+  { 197, 250, -30 }, { 197, 251, -30 }, { 197, 252, -30 }, { 197, 249, -30 },
+  { 197, 369, -30 }, { 197, 363, -30 }, { 197, 371, -30 }, { 197, 367, -30 },
+  { 197, 118, -74 }, { 197, 119, -74 }, { 197, 121, -74 }, { 197, 253, -74 },
+  { 197, 255, -74 }, { 195, 67, -65 }, { 195, 262, -65 }, { 195, 268, -65 },
+  { 195, 199, -65 }, { 195, 71, -60 }, { 195, 286, -60 }, { 195, 290, -60 },
+  { 195, 79, -50 }, { 195, 211, -50 }, { 195, 212, -50 }, { 195, 214, -50 },
+  { 195, 210, -50 }, { 195, 336, -50 }, { 195, 332, -50 }, { 195, 216, -50 },
+  { 195, 213, -50 }, { 195, 81, -55 }, { 195, 84, -55 }, { 195, 356, -55 },
+  { 195, 387, -55 }, { 195, 85, -50 }, { 195, 218, -50 }, { 195, 219, -50 },
+  { 195, 220, -50 }, { 195, 217, -50 }, { 195, 368, -50 }, { 195, 362, -50 },
+  { 195, 370, -50 }, { 195, 366, -50 }, { 195, 86, -95 }, { 195, 87, -100 },
+  { 195, 89, -70 }, { 195, 221, -70 }, { 195, 376, -70 }, { 195, 418, -74 },
+  { 195, 117, -30 }, { 195, 250, -30 }, { 195, 251, -30 }, { 195, 252, -30 },
+  { 195, 249, -30 }, { 195, 369, -30 }, { 195, 363, -30 }, { 195, 371, -30 },
+  { 195, 367, -30 }, { 195, 118, -74 }, { 195, 119, -74 }, { 195, 121, -74 },
+  { 195, 253, -74 }, { 195, 255, -74 }, { 66, 65, -25 }, { 66, 193, -25 },
+  { 66, 258, -25 }, { 66, 194, -25 }, { 66, 196, -25 }, { 66, 192, -25 },
+  { 66, 256, -25 }, { 66, 260, -25 }, { 66, 197, -25 }, { 66, 195, -25 },
+  { 66, 85, -10 }, { 66, 218, -10 }, { 66, 219, -10 }, { 66, 220, -10 },
+  { 66, 217, -10 }, { 66, 368, -10 }, { 66, 362, -10 }, { 66, 370, -10 },
+  { 66, 366, -10 }, { 68, 65, -25 }, { 68, 193, -25 }, { 68, 258, -25 },
+  { 68, 194, -25 }, { 68, 196, -25 }, { 68, 192, -25 }, { 68, 256, -25 },
+  { 68, 260, -25 }, { 68, 197, -25 }, { 68, 195, -25 }, { 68, 86, -50 },
+  { 68, 87, -40 }, { 68, 89, -50 }, { 68, 221, -50 }, { 68, 376, -50 },
+  { 270, 65, -25 }, { 270, 193, -25 }, { 270, 258, -25 }, { 270, 194, -25 },
+  { 270, 196, -25 }, { 270, 192, -25 }, { 270, 256, -25 }, { 270, 260, -25 },
+  { 270, 197, -25 }, { 270, 195, -25 }, { 270, 86, -50 }, { 270, 87, -40 },
+  { 270, 89, -50 }, { 270, 221, -50 }, { 270, 376, -50 }, { 272, 65, -25 },
+  { 272, 193, -25 }, { 272, 258, -25 }, { 272, 194, -25 }, { 272, 196, -25 },
+  { 272, 192, -25 }, { 272, 256, -25 }, { 272, 260, -25 }, { 272, 197, -25 },
+  { 272, 195, -25 }, { 272, 86, -50 }, { 272, 87, -40 }, { 272, 89, -50 },
+  { 272, 221, -50 }, { 272, 376, -50 }, { 70, 65, -100 }, { 70, 193, -100 },
+  { 70, 258, -100 }, { 70, 194, -100 }, { 70, 196, -100 }, { 70, 192, -100 },
+  { 70, 256, -100 }, { 70, 260, -100 }, { 70, 197, -100 }, { 70, 195, -100 },
+  { 70, 97, -95 }, { 70, 225, -95 }, { 70, 259, -95 }, { 70, 226, -95 },
+  { 70, 228, -95 }, { 70, 224, -95 }, { 70, 257, -95 }, { 70, 261, -95 },
+  { 70, 229, -95 }, { 70, 227, -95 }, { 70, 44, -129 }, { 70, 101, -100 },
+  { 70, 233, -100 }, { 70, 283, -100 }, { 70, 234, -100 }, { 70, 235, -100 },
+  { 70, 279, -100 }, { 70, 232, -100 }, { 70, 275, -100 }, { 70, 281, -100 },
+  { 70, 105, -40 }, { 70, 237, -40 }, { 70, 238, -40 }, { 70, 239, -40 },
+  { 70, 236, -40 }, { 70, 299, -40 }, { 70, 303, -40 }, { 70, 111, -70 },
+  { 70, 243, -70 }, { 70, 244, -70 }, { 70, 246, -70 }, { 70, 242, -70 },
+  { 70, 337, -70 }, { 70, 333, -70 }, { 70, 248, -70 }, { 70, 245, -70 },
+  { 70, 46, -129 }, { 70, 114, -50 }, { 70, 341, -50 }, { 70, 345, -50 },
+  { 70, 343, -50 }, { 74, 65, -25 }, { 74, 193, -25 }, { 74, 258, -25 },
+  { 74, 194, -25 }, { 74, 196, -25 }, { 74, 192, -25 }, { 74, 256, -25 },
+  { 74, 260, -25 }, { 74, 197, -25 }, { 74, 195, -25 }, { 74, 97, -40 },
+  { 74, 225, -40 }, { 74, 259, -40 }, { 74, 226, -40 }, { 74, 228, -40 },
+  { 74, 224, -40 }, { 74, 257, -40 }, { 74, 261, -40 }, { 74, 229, -40 },
+  { 74, 227, -40 }, { 74, 44, -10 }, { 74, 101, -40 }, { 74, 233, -40 },
+  { 74, 283, -40 }, { 74, 234, -40 }, { 74, 235, -40 }, { 74, 279, -40 },
+  { 74, 232, -40 }, { 74, 275, -40 }, { 74, 281, -40 }, { 74, 111, -40 },
+  { 74, 243, -40 }, { 74, 244, -40 }, { 74, 246, -40 }, { 74, 242, -40 },
+  { 74, 337, -40 }, { 74, 333, -40 }, { 74, 248, -40 }, { 74, 245, -40 },
+  { 74, 46, -10 }, { 74, 117, -40 }, { 74, 250, -40 }, { 74, 251, -40 },
+  { 74, 252, -40 }, { 74, 249, -40 }, { 74, 369, -40 }, { 74, 363, -40 },
+  { 74, 371, -40 }, { 74, 367, -40 }, { 75, 79, -30 }, { 75, 211, -30 },
+  { 75, 212, -30 }, { 75, 214, -30 }, { 75, 210, -30 }, { 75, 336, -30 },
+  { 75, 332, -30 }, { 75, 216, -30 }, { 75, 213, -30 }, { 75, 101, -25 },
+  { 75, 233, -25 }, { 75, 283, -25 }, { 75, 234, -25 }, { 75, 235, -25 },
+  { 75, 279, -25 }, { 75, 232, -25 }, { 75, 275, -25 }, { 75, 281, -25 },
+  { 75, 111, -25 }, { 75, 243, -25 }, { 75, 244, -25 }, { 75, 246, -25 },
+  { 75, 242, -25 }, { 75, 337, -25 }, { 75, 333, -25 }, { 75, 248, -25 },
+  { 75, 245, -25 }, { 75, 117, -20 }, { 75, 250, -20 }, { 75, 251, -20 },
+  { 75, 252, -20 }, { 75, 249, -20 }, { 75, 369, -20 }, { 75, 363, -20 },
+  { 75, 371, -20 }, { 75, 367, -20 }, { 75, 121, -20 }, { 75, 253, -20 },
+  { 75, 255, -20 }, { 310, 79, -30 }, { 310, 211, -30 }, { 310, 212, -30 },
+  { 310, 214, -30 }, { 310, 210, -30 }, { 310, 336, -30 }, { 310, 332, -30 },
+  { 310, 216, -30 }, { 310, 213, -30 }, { 310, 101, -25 }, { 310, 233, -25 },
+  { 310, 283, -25 }, { 310, 234, -25 }, { 310, 235, -25 }, { 310, 279, -25 },
+  { 310, 232, -25 }, { 310, 275, -25 }, { 310, 281, -25 }, { 310, 111, -25 },
+  { 310, 243, -25 }, { 310, 244, -25 }, { 310, 246, -25 }, { 310, 242, -25 },
+  { 310, 337, -25 }, { 310, 333, -25 }, { 310, 248, -25 }, { 310, 245, -25 },
+  { 310, 117, -20 }, { 310, 250, -20 }, { 310, 251, -20 }, { 310, 252, -20 },
+  { 310, 249, -20 }, { 310, 369, -20 }, { 310, 363, -20 }, { 310, 371, -20 },
+  { 310, 367, -20 }, { 310, 121, -20 }, { 310, 253, -20 }, { 310, 255, -20 },
+  { 76, 84, -18 }, { 76, 356, -18 }, { 76, 387, -18 }, { 76, 86, -37 },
+  { 76, 87, -37 }, { 76, 89, -37 }, { 76, 221, -37 }, { 76, 376, -37 },
+  { 76, 418, -55 }, { 76, 121, -37 }, { 76, 253, -37 }, { 76, 255, -37 },
+  { 313, 84, -18 }, { 313, 356, -18 }, { 313, 387, -18 }, { 313, 86, -37 },
+  { 313, 87, -37 }, { 313, 89, -37 }, { 313, 221, -37 }, { 313, 376, -37 },
+  { 313, 418, -55 }, { 313, 121, -37 }, { 313, 253, -37 }, { 313, 255, -37 },
+  { 315, 84, -18 }, { 315, 356, -18 }, { 315, 387, -18 }, { 315, 86, -37 },
+  { 315, 87, -37 }, { 315, 89, -37 }, { 315, 221, -37 }, { 315, 376, -37 },
+  { 315, 418, -55 }, { 315, 121, -37 }, { 315, 253, -37 }, { 315, 255, -37 },
+  { 321, 84, -18 }, { 321, 356, -18 }, { 321, 387, -18 }, { 321, 86, -37 },
+  { 321, 87, -37 }, { 321, 89, -37 }, { 321, 221, -37 }, { 321, 376, -37 },
+  { 321, 418, -55 }, { 321, 121, -37 }, { 321, 253, -37 }, { 321, 255, -37 },
+  { 78, 65, -30 }, { 78, 193, -30 }, { 78, 258, -30 }, { 78, 194, -30 },
+  { 78, 196, -30 }, { 78, 192, -30 }, { 78, 256, -30 }, { 78, 260, -30 },
+  { 78, 197, -30 }, { 78, 195, -30 }, { 323, 65, -30 }, { 323, 193, -30 },
+  { 323, 258, -30 }, { 323, 194, -30 }, { 323, 196, -30 }, { 323, 192, -30 },
+  { 323, 256, -30 }, { 323, 260, -30 }, { 323, 197, -30 }, { 323, 195, -30 },
+  { 327, 65, -30 }, { 327, 193, -30 }, { 327, 258, -30 }, { 327, 194, -30 },
+  { 327, 196, -30 }, { 327, 192, -30 }, { 327, 256, -30 }, { 327, 260, -30 },
+  { 327, 197, -30 }, { 327, 195, -30 }, { 325, 65, -30 }, { 325, 193, -30 },
+  { 325, 258, -30 }, { 325, 194, -30 }, { 325, 196, -30 }, { 325, 192, -30 },
+  { 325, 256, -30 }, { 325, 260, -30 }, { 325, 197, -30 }, { 325, 195, -30 },
+  { 209, 65, -30 }, { 209, 193, -30 }, { 209, 258, -30 }, { 209, 194, -30 },
+  { 209, 196, -30 }, { 209, 192, -30 }, { 209, 256, -30 }, { 209, 260, -30 },
+  { 209, 197, -30 }, { 209, 195, -30 }, { 79, 65, -40 }, { 79, 193, -40 },
+  { 79, 258, -40 }, { 79, 194, -40 }, { 79, 196, -40 }, { 79, 192, -40 },
+  { 79, 256, -40 }, { 79, 260, -40 }, { 79, 197, -40 }, { 79, 195, -40 },
+  { 79, 84, -40 }, { 79, 356, -40 }, { 79, 387, -40 }, { 79, 86, -50 },
+  { 79, 87, -50 }, { 79, 88, -40 }, { 79, 89, -50 }, { 79, 221, -50 },
+  { 79, 376, -50 }, { 211, 65, -40 }, { 211, 193, -40 }, { 211, 258, -40 },
+  { 211, 194, -40 }, { 211, 196, -40 }, { 211, 192, -40 }, { 211, 256, -40 },
+  { 211, 260, -40 }, { 211, 197, -40 }, { 211, 195, -40 }, { 211, 84, -40 },
+  { 211, 356, -40 }, { 211, 387, -40 }, { 211, 86, -50 }, { 211, 87, -50 },
+  { 211, 88, -40 }, { 211, 89, -50 }, { 211, 221, -50 }, { 211, 376, -50 },
+  { 212, 65, -40 }, { 212, 193, -40 }, { 212, 258, -40 }, { 212, 194, -40 },
+  { 212, 196, -40 }, { 212, 192, -40 }, { 212, 256, -40 }, { 212, 260, -40 },
+  { 212, 197, -40 }, { 212, 195, -40 }, { 212, 84, -40 }, { 212, 356, -40 },
+  { 212, 387, -40 }, { 212, 86, -50 }, { 212, 87, -50 }, { 212, 88, -40 },
+  { 212, 89, -50 }, { 212, 221, -50 }, { 212, 376, -50 }, { 214, 65, -40 },
+  { 214, 193, -40 }, { 214, 258, -40 }, { 214, 194, -40 }, { 214, 196, -40 },
+  { 214, 192, -40 }, { 214, 256, -40 }, { 214, 260, -40 }, { 214, 197, -40 },
+  { 214, 195, -40 }, { 214, 84, -40 }, { 214, 356, -40 }, { 214, 387, -40 },
+  { 214, 86, -50 }, { 214, 87, -50 }, { 214, 88, -40 }, { 214, 89, -50 },
+  { 214, 221, -50 }, { 214, 376, -50 }, { 210, 65, -40 }, { 210, 193, -40 },
+  { 210, 258, -40 }, { 210, 194, -40 }, { 210, 196, -40 }, { 210, 192, -40 },
+  { 210, 256, -40 }, { 210, 260, -40 }, { 210, 197, -40 }, { 210, 195, -40 },
+  { 210, 84, -40 }, { 210, 356, -40 }, { 210, 387, -40 }, { 210, 86, -50 },
+  { 210, 87, -50 }, { 210, 88, -40 }, { 210, 89, -50 }, { 210, 221, -50 },
+  { 210, 376, -50 }, { 336, 65, -40 }, { 336, 193, -40 }, { 336, 258, -40 },
+  { 336, 194, -40 }, { 336, 196, -40 }, { 336, 192, -40 }, { 336, 256, -40 },
+  { 336, 260, -40 }, { 336, 197, -40 }, { 336, 195, -40 }, { 336, 84, -40 },
+  { 336, 356, -40 }, { 336, 387, -40 }, { 336, 86, -50 }, { 336, 87, -50 },
+  { 336, 88, -40 }, { 336, 89, -50 }, { 336, 221, -50 }, { 336, 376, -50 },
+  { 332, 65, -40 }, { 332, 193, -40 }, { 332, 258, -40 }, { 332, 194, -40 },
+  { 332, 196, -40 }, { 332, 192, -40 }, { 332, 256, -40 }, { 332, 260, -40 },
+  { 332, 197, -40 }, { 332, 195, -40 }, { 332, 84, -40 }, { 332, 356, -40 },
+  { 332, 387, -40 }, { 332, 86, -50 }, { 332, 87, -50 }, { 332, 88, -40 },
+  { 332, 89, -50 }, { 332, 221, -50 }, { 332, 376, -50 }, { 216, 65, -40 },
+  { 216, 193, -40 }, { 216, 258, -40 }, { 216, 194, -40 }, { 216, 196, -40 },
+  { 216, 192, -40 }, { 216, 256, -40 }, { 216, 260, -40 }, { 216, 197, -40 },
+  { 216, 195, -40 }, { 216, 84, -40 }, { 216, 356, -40 }, { 216, 387, -40 },
+  { 216, 86, -50 }, { 216, 87, -50 }, { 216, 88, -40 }, { 216, 89, -50 },
+  { 216, 221, -50 }, { 216, 376, -50 }, { 213, 65, -40 }, { 213, 193, -40 },
+  { 213, 258, -40 }, { 213, 194, -40 }, { 213, 196, -40 }, { 213, 192, -40 },
+  { 213, 256, -40 }, { 213, 260, -40 }, { 213, 197, -40 }, { 213, 195, -40 },
+  { 213, 84, -40 }, { 213, 356, -40 }, { 213, 387, -40 }, { 213, 86, -50 },
+  { 213, 87, -50 }, { 213, 88, -40 }, { 213, 89, -50 }, { 213, 221, -50 },
+  { 213, 376, -50 }, { 80, 65, -85 }, { 80, 193, -85 }, { 80, 258, -85 },
+  { 80, 194, -85 }, { 80, 196, -85 }, { 80, 192, -85 }, { 80, 256, -85 },
+  { 80, 260, -85 }, { 80, 197, -85 }, { 80, 195, -85 }, { 80, 97, -40 },
+  { 80, 225, -40 }, { 80, 259, -40 }, { 80, 226, -40 }, { 80, 228, -40 },
+  { 80, 224, -40 }, { 80, 257, -40 }, { 80, 261, -40 }, { 80, 229, -40 },
+  { 80, 227, -40 }, { 80, 44, -129 }, { 80, 101, -50 }, { 80, 233, -50 },
+  { 80, 283, -50 }, { 80, 234, -50 }, { 80, 235, -50 }, { 80, 279, -50 },
+  { 80, 232, -50 }, { 80, 275, -50 }, { 80, 281, -50 }, { 80, 111, -55 },
+  { 80, 243, -55 }, { 80, 244, -55 }, { 80, 246, -55 }, { 80, 242, -55 },
+  { 80, 337, -55 }, { 80, 333, -55 }, { 80, 248, -55 }, { 80, 245, -55 },
+  { 80, 46, -129 }, { 81, 85, -10 }, { 81, 218, -10 }, { 81, 219, -10 },
+  { 81, 220, -10 }, { 81, 217, -10 }, { 81, 368, -10 }, { 81, 362, -10 },
+  { 81, 370, -10 }, { 81, 366, -10 }, { 82, 79, -40 }, { 82, 211, -40 },
+  { 82, 212, -40 }, { 82, 214, -40 }, { 82, 210, -40 }, { 82, 336, -40 },
+  { 82, 332, -40 }, { 82, 216, -40 }, { 82, 213, -40 }, { 82, 84, -30 },
+  { 82, 356, -30 }, { 82, 387, -30 }, { 82, 85, -40 }, { 82, 218, -40 },
+  { 82, 219, -40 }, { 82, 220, -40 }, { 82, 217, -40 }, { 82, 368, -40 },
+  { 82, 362, -40 }, { 82, 370, -40 }, { 82, 366, -40 }, { 82, 86, -18 },
+  { 82, 87, -18 }, { 82, 89, -18 }, { 82, 221, -18 }, { 82, 376, -18 },
+  { 340, 79, -40 }, { 340, 211, -40 }, { 340, 212, -40 }, { 340, 214, -40 },
+  { 340, 210, -40 }, { 340, 336, -40 }, { 340, 332, -40 }, { 340, 216, -40 },
+  { 340, 213, -40 }, { 340, 84, -30 }, { 340, 356, -30 }, { 340, 387, -30 },
+  { 340, 85, -40 }, { 340, 218, -40 }, { 340, 219, -40 }, { 340, 220, -40 },
+  { 340, 217, -40 }, { 340, 368, -40 }, { 340, 362, -40 }, { 340, 370, -40 },
+  { 340, 366, -40 }, { 340, 86, -18 }, { 340, 87, -18 }, { 340, 89, -18 },
+  { 340, 221, -18 }, { 340, 376, -18 }, { 344, 79, -40 }, { 344, 211, -40 },
+  { 344, 212, -40 }, { 344, 214, -40 }, { 344, 210, -40 }, { 344, 336, -40 },
+  { 344, 332, -40 }, { 344, 216, -40 }, { 344, 213, -40 }, { 344, 84, -30 },
+  { 344, 356, -30 }, { 344, 387, -30 }, { 344, 85, -40 }, { 344, 218, -40 },
+  { 344, 219, -40 }, { 344, 220, -40 }, { 344, 217, -40 }, { 344, 368, -40 },
+  { 344, 362, -40 }, { 344, 370, -40 }, { 344, 366, -40 }, { 344, 86, -18 },
+  { 344, 87, -18 }, { 344, 89, -18 }, { 344, 221, -18 }, { 344, 376, -18 },
+  { 342, 79, -40 }, { 342, 211, -40 }, { 342, 212, -40 }, { 342, 214, -40 },
+  { 342, 210, -40 }, { 342, 336, -40 }, { 342, 332, -40 }, { 342, 216, -40 },
+  { 342, 213, -40 }, { 342, 84, -30 }, { 342, 356, -30 }, { 342, 387, -30 },
+  { 342, 85, -40 }, { 342, 218, -40 }, { 342, 219, -40 }, { 342, 220, -40 },
+  { 342, 217, -40 }, { 342, 368, -40 }, { 342, 362, -40 }, { 342, 370, -40 },
+  { 342, 366, -40 }, { 342, 86, -18 }, { 342, 87, -18 }, { 342, 89, -18 },
+  { 342, 221, -18 }, { 342, 376, -18 }, { 84, 65, -55 }, { 84, 193, -55 },
+  { 84, 258, -55 }, { 84, 194, -55 }, { 84, 196, -55 }, { 84, 192, -55 },
+  { 84, 256, -55 }, { 84, 260, -55 }, { 84, 197, -55 }, { 84, 195, -55 },
+  { 84, 79, -18 }, { 84, 211, -18 }, { 84, 212, -18 }, { 84, 214, -18 },
+  { 84, 210, -18 }, { 84, 336, -18 }, { 84, 332, -18 }, { 84, 216, -18 },
+  { 84, 213, -18 }, { 84, 97, -92 }, { 84, 225, -92 }, { 84, 259, -92 },
+  { 84, 226, -92 }, { 84, 228, -92 }, { 84, 224, -92 }, { 84, 257, -92 },
+  { 84, 261, -92 }, { 84, 229, -92 }, { 84, 227, -92 }, { 84, 58, -74 },
+  { 84, 44, -92 }, { 84, 101, -92 }, { 84, 233, -92 }, { 84, 283, -92 },
+  { 84, 234, -92 }, { 84, 235, -52 }, { 84, 279, -92 }, { 84, 232, -52 },
+  { 84, 275, -52 }, { 84, 281, -92 }, { 84, 45, -92 }, { 84, 105, -37 },
+  { 84, 237, -37 }, { 84, 303, -37 }, { 84, 111, -95 }, { 84, 243, -95 },
+  { 84, 244, -95 }, { 84, 246, -95 }, { 84, 242, -95 }, { 84, 337, -95 },
+  { 84, 333, -95 }, { 84, 248, -95 }, { 84, 245, -95 }, { 84, 46, -92 },
+  { 84, 114, -37 }, { 84, 341, -37 }, { 84, 345, -37 }, { 84, 343, -37 },
+  { 84, 59, -74 }, { 84, 117, -37 }, { 84, 250, -37 }, { 84, 251, -37 },
+  { 84, 252, -37 }, { 84, 249, -37 }, { 84, 369, -37 }, { 84, 363, -37 },
+  { 84, 371, -37 }, { 84, 367, -37 }, { 84, 119, -37 }, { 84, 121, -37 },
+  { 84, 253, -37 }, { 84, 255, -37 }, { 356, 65, -55 }, { 356, 193, -55 },
+  { 356, 258, -55 }, { 356, 194, -55 }, { 356, 196, -55 }, { 356, 192, -55 },
+  { 356, 256, -55 }, { 356, 260, -55 }, { 356, 197, -55 }, { 356, 195, -55 },
+  { 356, 79, -18 }, { 356, 211, -18 }, { 356, 212, -18 }, { 356, 214, -18 },
+  { 356, 210, -18 }, { 356, 336, -18 }, { 356, 332, -18 }, { 356, 216, -18 },
+  { 356, 213, -18 }, { 356, 97, -92 }, { 356, 225, -92 }, { 356, 259, -92 },
+  { 356, 226, -92 }, { 356, 228, -92 }, { 356, 224, -92 }, { 356, 257, -92 },
+  { 356, 261, -92 }, { 356, 229, -92 }, { 356, 227, -92 }, { 356, 58, -74 },
+  { 356, 44, -92 }, { 356, 101, -92 }, { 356, 233, -92 }, { 356, 283, -92 },
+  { 356, 234, -92 }, { 356, 235, -52 }, { 356, 279, -92 }, { 356, 232, -52 },
+  { 356, 275, -52 }, { 356, 281, -92 }, { 356, 45, -92 }, { 356, 105, -37 },
+  { 356, 237, -37 }, { 356, 303, -37 }, { 356, 111, -95 }, { 356, 243, -95 },
+  { 356, 244, -95 }, { 356, 246, -95 }, { 356, 242, -95 }, { 356, 337, -95 },
+  { 356, 333, -95 }, { 356, 248, -95 }, { 356, 245, -95 }, { 356, 46, -92 },
+  { 356, 114, -37 }, { 356, 341, -37 }, { 356, 345, -37 }, { 356, 343, -37 },
+  { 356, 59, -74 }, { 356, 117, -37 }, { 356, 250, -37 }, { 356, 251, -37 },
+  { 356, 252, -37 }, { 356, 249, -37 }, { 356, 369, -37 }, { 356, 363, -37 },
+  { 356, 371, -37 }, { 356, 367, -37 }, { 356, 119, -37 }, { 356, 121, -37 },
+  { 356, 253, -37 }, { 356, 255, -37 }, { 387, 65, -55 }, { 387, 193, -55 },
+  { 387, 258, -55 }, { 387, 194, -55 }, { 387, 196, -55 }, { 387, 192, -55 },
+  { 387, 256, -55 }, { 387, 260, -55 }, { 387, 197, -55 }, { 387, 195, -55 },
+  { 387, 79, -18 }, { 387, 211, -18 }, { 387, 212, -18 }, { 387, 214, -18 },
+  { 387, 210, -18 }, { 387, 336, -18 }, { 387, 332, -18 }, { 387, 216, -18 },
+  { 387, 213, -18 }, { 387, 97, -92 }, { 387, 225, -92 }, { 387, 259, -92 },
+  { 387, 226, -92 }, { 387, 228, -92 }, { 387, 224, -92 }, { 387, 257, -92 },
+  { 387, 261, -92 }, { 387, 229, -92 }, { 387, 227, -92 }, { 387, 58, -74 },
+  { 387, 44, -92 }, { 387, 101, -92 }, { 387, 233, -92 }, { 387, 283, -92 },
+  { 387, 234, -92 }, { 387, 235, -52 }, { 387, 279, -92 }, { 387, 232, -52 },
+  { 387, 275, -52 }, { 387, 281, -92 }, { 387, 45, -92 }, { 387, 105, -37 },
+  { 387, 237, -37 }, { 387, 303, -37 }, { 387, 111, -95 }, { 387, 243, -95 },
+  { 387, 244, -95 }, { 387, 246, -95 }, { 387, 242, -95 }, { 387, 337, -95 },
+  { 387, 333, -95 }, { 387, 248, -95 }, { 387, 245, -95 }, { 387, 46, -92 },
+  { 387, 114, -37 }, { 387, 341, -37 }, { 387, 345, -37 }, { 387, 343, -37 },
+  { 387, 59, -74 }, { 387, 117, -37 }, { 387, 250, -37 }, { 387, 251, -37 },
+  { 387, 252, -37 }, { 387, 249, -37 }, { 387, 369, -37 }, { 387, 363, -37 },
+  { 387, 371, -37 }, { 387, 367, -37 }, { 387, 119, -37 }, { 387, 121, -37 },
+  { 387, 253, -37 }, { 387, 255, -37 }, { 85, 65, -45 }, { 85, 193, -45 },
+  { 85, 258, -45 }, { 85, 194, -45 }, { 85, 196, -45 }, { 85, 192, -45 },
+  { 85, 256, -45 }, { 85, 260, -45 }, { 85, 197, -45 }, { 85, 195, -45 },
+  { 218, 65, -45 }, { 218, 193, -45 }, { 218, 258, -45 }, { 218, 194, -45 },
+  { 218, 196, -45 }, { 218, 192, -45 }, { 218, 256, -45 }, { 218, 260, -45 },
+  { 218, 197, -45 }, { 218, 195, -45 }, { 219, 65, -45 }, { 219, 193, -45 },
+  { 219, 258, -45 }, { 219, 194, -45 }, { 219, 196, -45 }, { 219, 192, -45 },
+  { 219, 256, -45 }, { 219, 260, -45 }, { 219, 197, -45 }, { 219, 195, -45 },
+  { 220, 65, -45 }, { 220, 193, -45 }, { 220, 258, -45 }, { 220, 194, -45 },
+  { 220, 196, -45 }, { 220, 192, -45 }, { 220, 256, -45 }, { 220, 260, -45 },
+  { 220, 197, -45 }, { 220, 195, -45 }, { 217, 65, -45 }, { 217, 193, -45 },
+  { 217, 258, -45 }, { 217, 194, -45 }, { 217, 196, -45 }, { 217, 192, -45 },
+  { 217, 256, -45 }, { 217, 260, -45 }, { 217, 197, -45 }, { 217, 195, -45 },
+  { 368, 65, -45 }, { 368, 193, -45 }, { 368, 258, -45 }, { 368, 194, -45 },
+  { 368, 196, -45 }, { 368, 192, -45 }, { 368, 256, -45 }, { 368, 260, -45 },
+  { 368, 197, -45 }, { 368, 195, -45 }, { 362, 65, -45 }, { 362, 193, -45 },
+  { 362, 258, -45 }, { 362, 194, -45 }, { 362, 196, -45 }, { 362, 192, -45 },
+  { 362, 256, -45 }, { 362, 260, -45 }, { 362, 197, -45 }, { 362, 195, -45 },
+  { 370, 65, -45 }, { 370, 193, -45 }, { 370, 258, -45 }, { 370, 194, -45 },
+  { 370, 196, -45 }, { 370, 192, -45 }, { 370, 256, -45 }, { 370, 260, -45 },
+  { 370, 197, -45 }, { 370, 195, -45 }, { 366, 65, -45 }, { 366, 193, -45 },
+  { 366, 258, -45 }, { 366, 194, -45 }, { 366, 196, -45 }, { 366, 192, -45 },
+  { 366, 256, -45 }, { 366, 260, -45 }, { 366, 197, -45 }, { 366, 195, -45 },
+  { 86, 65, -85 }, { 86, 193, -85 }, { 86, 258, -85 }, { 86, 194, -85 },
+  { 86, 196, -85 }, { 86, 192, -85 }, { 86, 256, -85 }, { 86, 260, -85 },
+  { 86, 197, -85 }, { 86, 195, -85 }, { 86, 71, -10 }, { 86, 286, -10 },
+  { 86, 290, -10 }, { 86, 79, -30 }, { 86, 211, -30 }, { 86, 212, -30 },
+  { 86, 214, -30 }, { 86, 210, -30 }, { 86, 336, -30 }, { 86, 332, -30 },
+  { 86, 216, -30 }, { 86, 213, -30 }, { 86, 97, -111 }, { 86, 225, -111 },
+  { 86, 259, -111 }, { 86, 226, -111 }, { 86, 228, -111 }, { 86, 224, -111 },
+  { 86, 257, -111 }, { 86, 261, -111 }, { 86, 229, -111 }, { 86, 227, -111 },
+  { 86, 58, -74 }, { 86, 44, -129 }, { 86, 101, -111 }, { 86, 233, -111 },
+  { 86, 283, -111 }, { 86, 234, -111 }, { 86, 235, -71 }, { 86, 279, -111 },
+  { 86, 232, -71 }, { 86, 275, -71 }, { 86, 281, -111 }, { 86, 45, -70 },
+  { 86, 105, -55 }, { 86, 237, -55 }, { 86, 303, -55 }, { 86, 111, -111 },
+  { 86, 243, -111 }, { 86, 244, -111 }, { 86, 246, -111 }, { 86, 242, -111 },
+  { 86, 337, -111 }, { 86, 333, -111 }, { 86, 248, -111 }, { 86, 245, -111 },
+  { 86, 46, -129 }, { 86, 59, -74 }, { 86, 117, -55 }, { 86, 250, -55 },
+  { 86, 251, -55 }, { 86, 252, -55 }, { 86, 249, -55 }, { 86, 369, -55 },
+  { 86, 363, -55 }, { 86, 371, -55 }, { 86, 367, -55 }, { 87, 65, -74 },
+  { 87, 193, -74 }, { 87, 258, -74 }, { 87, 194, -74 }, { 87, 196, -74 },
+  { 87, 192, -74 }, { 87, 256, -74 }, { 87, 260, -74 }, { 87, 197, -74 },
+  { 87, 195, -74 }, { 87, 79, -15 }, { 87, 211, -15 }, { 87, 212, -15 },
+  { 87, 214, -15 }, { 87, 210, -15 }, { 87, 336, -15 }, { 87, 332, -15 },
+  { 87, 216, -15 }, { 87, 213, -15 }, { 87, 97, -85 }, { 87, 225, -85 },
+  { 87, 259, -85 }, { 87, 226, -85 }, { 87, 228, -85 }, { 87, 224, -85 },
+  { 87, 257, -85 }, { 87, 261, -85 }, { 87, 229, -85 }, { 87, 227, -85 },
+  { 87, 58, -55 }, { 87, 44, -74 }, { 87, 101, -90 }, { 87, 233, -90 },
+  { 87, 283, -90 }, { 87, 234, -90 }, { 87, 235, -50 }, { 87, 279, -90 },
+  { 87, 232, -50 }, { 87, 275, -50 }, { 87, 281, -90 }, { 87, 45, -50 },
+  { 87, 105, -37 }, { 87, 237, -37 }, { 87, 303, -37 }, { 87, 111, -80 },
+  { 87, 243, -80 }, { 87, 244, -80 }, { 87, 246, -80 }, { 87, 242, -80 },
+  { 87, 337, -80 }, { 87, 333, -80 }, { 87, 248, -80 }, { 87, 245, -80 },
+  { 87, 46, -74 }, { 87, 59, -55 }, { 87, 117, -55 }, { 87, 250, -55 },
+  { 87, 251, -55 }, { 87, 252, -55 }, { 87, 249, -55 }, { 87, 369, -55 },
+  { 87, 363, -55 }, { 87, 371, -55 }, { 87, 367, -55 }, { 87, 121, -55 },
+  { 87, 253, -55 }, { 87, 255, -55 }, { 89, 65, -74 }, { 89, 193, -74 },
+  { 89, 258, -74 }, { 89, 194, -74 }, { 89, 196, -74 }, { 89, 192, -74 },
+  { 89, 256, -74 }, { 89, 260, -74 }, { 89, 197, -74 }, { 89, 195, -74 },
+  { 89, 79, -25 }, { 89, 211, -25 }, { 89, 212, -25 }, { 89, 214, -25 },
+  { 89, 210, -25 }, { 89, 336, -25 }, { 89, 332, -25 }, { 89, 216, -25 },
+  { 89, 213, -25 }, { 89, 97, -92 }, { 89, 225, -92 }, { 89, 259, -92 },
+  { 89, 226, -92 }, { 89, 228, -92 }, { 89, 224, -92 }, { 89, 257, -92 },
+  { 89, 261, -92 }, { 89, 229, -92 }, { 89, 227, -92 }, { 89, 58, -92 },
+  { 89, 44, -92 }, { 89, 101, -111 }, { 89, 233, -111 }, { 89, 283, -111 },
+  { 89, 234, -71 }, { 89, 235, -71 }, { 89, 279, -111 }, { 89, 232, -71 },
+  { 89, 275, -71 }, { 89, 281, -111 }, { 89, 45, -92 }, { 89, 105, -55 },
+  { 89, 237, -55 }, { 89, 303, -55 }, { 89, 111, -111 }, { 89, 243, -111 },
+  { 89, 244, -111 }, { 89, 246, -111 }, { 89, 242, -111 }, { 89, 337, -111 },
+  { 89, 333, -111 }, { 89, 248, -111 }, { 89, 245, -111 }, { 89, 46, -74 },
+  { 89, 59, -92 }, { 89, 117, -92 }, { 89, 250, -92 }, { 89, 251, -92 },
+  { 89, 252, -92 }, { 89, 249, -92 }, { 89, 369, -92 }, { 89, 363, -92 },
+  { 89, 371, -92 }, { 89, 367, -92 }, { 221, 65, -74 }, { 221, 193, -74 },
+  { 221, 258, -74 }, { 221, 194, -74 }, { 221, 196, -74 }, { 221, 192, -74 },
+  { 221, 256, -74 }, { 221, 260, -74 }, { 221, 197, -74 }, { 221, 195, -74 },
+  { 221, 79, -25 }, { 221, 211, -25 }, { 221, 212, -25 }, { 221, 214, -25 },
+  { 221, 210, -25 }, { 221, 336, -25 }, { 221, 332, -25 }, { 221, 216, -25 },
+  { 221, 213, -25 }, { 221, 97, -92 }, { 221, 225, -92 }, { 221, 259, -92 },
+  { 221, 226, -92 }, { 221, 228, -92 }, { 221, 224, -92 }, { 221, 257, -92 },
+  { 221, 261, -92 }, { 221, 229, -92 }, { 221, 227, -92 }, { 221, 58, -92 },
+  { 221, 44, -92 }, { 221, 101, -111 }, { 221, 233, -111 }, { 221, 283, -111 },
+  { 221, 234, -71 }, { 221, 235, -71 }, { 221, 279, -111 }, { 221, 232, -71 },
+  { 221, 275, -71 }, { 221, 281, -111 }, { 221, 45, -92 }, { 221, 105, -55 },
+  { 221, 237, -55 }, { 221, 303, -55 }, { 221, 111, -111 }, { 221, 243, -111 },
+  { 221, 244, -111 }, { 221, 246, -111 }, { 221, 242, -111 }, { 221, 337, -111 },
+  { 221, 333, -111 }, { 221, 248, -111 }, { 221, 245, -111 }, { 221, 46, -74 },
+  { 221, 59, -92 }, { 221, 117, -92 }, { 221, 250, -92 }, { 221, 251, -92 },
+  { 221, 252, -92 }, { 221, 249, -92 }, { 221, 369, -92 }, { 221, 363, -92 },
+  { 221, 371, -92 }, { 221, 367, -92 }, { 376, 65, -74 }, { 376, 193, -74 },
+  { 376, 258, -74 }, { 376, 194, -74 }, { 376, 196, -74 }, { 376, 192, -74 },
+  { 376, 256, -74 }, { 376, 260, -74 }, { 376, 197, -74 }, { 376, 195, -74 },
+  { 376, 79, -25 }, { 376, 211, -25 }, { 376, 212, -25 }, { 376, 214, -25 },
+  { 376, 210, -25 }, { 376, 336, -25 }, { 376, 332, -25 }, { 376, 216, -25 },
+  { 376, 213, -25 }, { 376, 97, -92 }, { 376, 225, -92 }, { 376, 259, -92 },
+  { 376, 226, -92 }, { 376, 228, -92 }, { 376, 224, -92 }, { 376, 257, -92 },
+  { 376, 261, -92 }, { 376, 229, -92 }, { 376, 227, -92 }, { 376, 58, -92 },
+  { 376, 44, -92 }, { 376, 101, -111 }, { 376, 233, -111 }, { 376, 283, -111 },
+  { 376, 234, -71 }, { 376, 235, -71 }, { 376, 279, -111 }, { 376, 232, -71 },
+  { 376, 275, -71 }, { 376, 281, -111 }, { 376, 45, -92 }, { 376, 105, -55 },
+  { 376, 237, -55 }, { 376, 303, -55 }, { 376, 111, -111 }, { 376, 243, -111 },
+  { 376, 244, -111 }, { 376, 246, -111 }, { 376, 242, -111 }, { 376, 337, -111 },
+  { 376, 333, -111 }, { 376, 248, -111 }, { 376, 245, -111 }, { 376, 46, -74 },
+  { 376, 59, -92 }, { 376, 117, -92 }, { 376, 250, -92 }, { 376, 251, -92 },
+  { 376, 252, -92 }, { 376, 249, -92 }, { 376, 369, -92 }, { 376, 363, -92 },
+  { 376, 371, -92 }, { 376, 367, -92 }, { 98, 98, -10 }, { 98, 46, -40 },
+  { 98, 117, -20 }, { 98, 250, -20 }, { 98, 251, -20 }, { 98, 252, -20 },
+  { 98, 249, -20 }, { 98, 369, -20 }, { 98, 363, -20 }, { 98, 371, -20 },
+  { 98, 367, -20 }, { 99, 104, -10 }, { 99, 107, -10 }, { 99, 311, -10 },
+  { 263, 104, -10 }, { 263, 107, -10 }, { 263, 311, -10 }, { 269, 104, -10 },
+  { 269, 107, -10 }, { 269, 311, -10 }, { 231, 104, -10 }, { 231, 107, -10 },
+  { 231, 311, -10 }, { 44, 416, -95 }, { 44, 418, -95 }, { 101, 98, -10 },
+  { 233, 98, -10 }, { 283, 98, -10 }, { 234, 98, -10 }, { 235, 98, -10 },
+  { 279, 98, -10 }, { 232, 98, -10 }, { 275, 98, -10 }, { 281, 98, -10 },
+  { 102, 44, -10 }, { 102, 305, -30 }, { 102, 101, -10 }, { 102, 233, -10 },
+  { 102, 279, -10 }, { 102, 281, -10 }, { 102, 102, -18 }, { 102, 111, -10 },
+  { 102, 243, -10 }, { 102, 244, -10 }, { 102, 242, -10 }, { 102, 337, -10 },
+  { 102, 248, -10 }, { 102, 245, -10 }, { 102, 46, -10 }, { 102, 418, 55 },
+  { 107, 101, -30 }, { 107, 233, -30 }, { 107, 283, -30 }, { 107, 234, -30 },
+  { 107, 235, -30 }, { 107, 279, -30 }, { 107, 232, -30 }, { 107, 275, -30 },
+  { 107, 281, -30 }, { 107, 111, -10 }, { 107, 243, -10 }, { 107, 244, -10 },
+  { 107, 246, -10 }, { 107, 242, -10 }, { 107, 337, -10 }, { 107, 333, -10 },
+  { 107, 248, -10 }, { 107, 245, -10 }, { 311, 101, -30 }, { 311, 233, -30 },
+  { 311, 283, -30 }, { 311, 234, -30 }, { 311, 235, -30 }, { 311, 279, -30 },
+  { 311, 232, -30 }, { 311, 275, -30 }, { 311, 281, -30 }, { 311, 111, -10 },
+  { 311, 243, -10 }, { 311, 244, -10 }, { 311, 246, -10 }, { 311, 242, -10 },
+  { 311, 337, -10 }, { 311, 333, -10 }, { 311, 248, -10 }, { 311, 245, -10 },
+  { 110, 118, -40 }, { 324, 118, -40 }, { 328, 118, -40 }, { 326, 118, -40 },
+  { 241, 118, -40 }, { 111, 118, -15 }, { 111, 119, -25 }, { 111, 120, -10 },
+  { 111, 121, -10 }, { 111, 253, -10 }, { 111, 255, -10 }, { 243, 118, -15 },
+  { 243, 119, -25 }, { 243, 120, -10 }, { 243, 121, -10 }, { 243, 253, -10 },
+  { 243, 255, -10 }, { 244, 118, -15 }, { 244, 119, -25 }, { 244, 120, -10 },
+  { 244, 121, -10 }, { 244, 253, -10 }, { 244, 255, -10 }, { 246, 118, -15 },
+  { 246, 119, -25 }, { 246, 120, -10 }, { 246, 121, -10 }, { 246, 253, -10 },
+  { 246, 255, -10 }, { 242, 118, -15 }, { 242, 119, -25 }, { 242, 120, -10 },
+  { 242, 121, -10 }, { 242, 253, -10 }, { 242, 255, -10 }, { 337, 118, -15 },
+  { 337, 119, -25 }, { 337, 120, -10 }, { 337, 121, -10 }, { 337, 253, -10 },
+  { 337, 255, -10 }, { 333, 118, -15 }, { 333, 119, -25 }, { 333, 120, -10 },
+  { 333, 121, -10 }, { 333, 253, -10 }, { 333, 255, -10 }, { 248, 118, -15 },
+  { 248, 119, -25 }, { 248, 120, -10 }, { 248, 121, -10 }, { 248, 253, -10 },
+  { 248, 255, -10 }, { 245, 118, -15 }, { 245, 119, -25 }, { 245, 120, -10 },
+  { 245, 121, -10 }, { 245, 253, -10 }, { 245, 255, -10 }, { 46, 416, -95 },
+  { 46, 418, -95 }, { 417, 417, -74 }, { 418, 100, -15 }, { 418, 273, -15 },
+  { 418, 418, -74 }, { 418, 114, -15 }, { 418, 341, -15 }, { 418, 345, -15 },
+  { 418, 343, -15 }, { 418, 115, -74 }, { 418, 347, -74 }, { 418, 353, -74 },
+  { 418, 351, -74 }, { 418, 422, -74 }, { 418, 32, -74 }, { 418, 116, -37 },
+  { 418, 424, -37 }, { 418, 118, -15 }, { 114, 44, -65 }, { 114, 46, -65 },
+  { 341, 44, -65 }, { 341, 46, -65 }, { 345, 44, -65 }, { 345, 46, -65 },
+  { 343, 44, -65 }, { 343, 46, -65 }, { 32, 65, -37 }, { 32, 193, -37 },
+  { 32, 258, -37 }, { 32, 194, -37 }, { 32, 196, -37 }, { 32, 192, -37 },
+  { 32, 256, -37 }, { 32, 260, -37 }, { 32, 197, -37 }, { 32, 195, -37 },
+  { 32, 86, -70 }, { 32, 87, -70 }, { 32, 89, -70 }, { 32, 221, -70 },
+  { 32, 376, -70 }, { 118, 44, -37 }, { 118, 101, -15 }, { 118, 233, -15 },
+  { 118, 283, -15 }, { 118, 234, -15 }, { 118, 235, -15 }, { 118, 279, -15 },
+  { 118, 232, -15 }, { 118, 275, -15 }, { 118, 281, -15 }, { 118, 111, -15 },
+  { 118, 243, -15 }, { 118, 244, -15 }, { 118, 246, -15 }, { 118, 242, -15 },
+  { 118, 337, -15 }, { 118, 333, -15 }, { 118, 248, -15 }, { 118, 245, -15 },
+  { 118, 46, -37 }, { 119, 97, -10 }, { 119, 225, -10 }, { 119, 259, -10 },
+  { 119, 226, -10 }, { 119, 228, -10 }, { 119, 224, -10 }, { 119, 257, -10 },
+  { 119, 261, -10 }, { 119, 229, -10 }, { 119, 227, -10 }, { 119, 44, -37 },
+  { 119, 101, -10 }, { 119, 233, -10 }, { 119, 283, -10 }, { 119, 234, -10 },
+  { 119, 235, -10 }, { 119, 279, -10 }, { 119, 232, -10 }, { 119, 275, -10 },
+  { 119, 281, -10 }, { 119, 111, -15 }, { 119, 243, -15 }, { 119, 244, -15 },
+  { 119, 246, -15 }, { 119, 242, -15 }, { 119, 337, -15 }, { 119, 333, -15 },
+  { 119, 248, -15 }, { 119, 245, -15 }, { 119, 46, -37 }, { 120, 101, -10 },
+  { 120, 233, -10 }, { 120, 283, -10 }, { 120, 234, -10 }, { 120, 235, -10 },
+  { 120, 279, -10 }, { 120, 232, -10 }, { 120, 275, -10 }, { 120, 281, -10 },
+  { 121, 44, -37 }, { 121, 46, -37 }, { 253, 44, -37 }, { 253, 46, -37 },
+  { 255, 44, -37 }, { 255, 46, -37 } };
+
+static const fontbuilthighstr high_4[] = {
+  { "\306\222", 16 },
+  { "\310\230", 2 },
+  { "\310\231", 38 },
+  { "\310\232", 3 },
+  { "\310\233", 40 },
+  { "\314\202", 6 },
+  { "\314\203", 41 },
+  { "\314\206", 4 },
+  { "\314\207", 10 },
+  { "\314\212", 37 },
+  { "\314\213", 21 },
+  { "\314\214", 5 },
+  { "\314\246", 7 },
+  { "\314\250", 26 },
+  { "\316\224", 0 },
+  { "\342\200\223", 13 },
+  { "\342\200\224", 12 },
+  { "\342\200\230", 33 },
+  { "\342\200\231", 34 },
+  { "\342\200\232", 35 },
+  { "\342\200\234", 31 },
+  { "\342\200\235", 32 },
+  { "\342\200\236", 30 },
+  { "\342\200\240", 8 },
+  { "\342\200\241", 9 },
+  { "\342\200\246", 11 },
+  { "\342\200\247", 28 },
+  { "\342\200\261", 29 },
+  { "\342\200\271", 19 },
+  { "\342\200\272", 20 },
+  { "\342\201\204", 17 },
+  { "\342\202\254", 1 },
+  { "\342\204\242", 42 },
+  { "\342\210\202", 27 },
+  { "\342\210\221", 39 },
+  { "\342\210\222", 24 },
+  { "\342\210\232", 36 },
+  { "\342\210\236", 43 },
+  { "\342\211\240", 25 },
+  { "\342\211\244", 22 },
+  { "\342\211\245", 18 },
+  { "\342\227\212", 23 },
+  { "\357\254\201", 14 },
+  { "\357\254\202", 15 },
+  };
+
+/* Times-Italic */
+
+static const int32_t widths_5[] = {
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 250, 333, 420, 500, 500, 833, 778, 214,
+  333, 333, 500, 675, 250, 333, 250, 278, 500, 500,
+  500, 500, 500, 500, 500, 500, 500, 500, 333, 333,
+  675, 675, 675, 500, 920, 611, 611, 667, 722, 611,
+  611, 722, 722, 333, 444, 667, 556, 833, 667, 722,
+  611, 722, 611, 500, 556, 722, 611, 833, 611, 556,
+  556, 389, 278, 389, 422, 500, 333, 500, 500, 444,
+  500, 444, 278, 500, 500, 278, 278, 444, 278, 722,
+  500, 500, 500, 500, 389, 389, 278, 500, 444, 667,
+  444, 444, 389, 400, 275, 400, 541, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  250, 389, 500, 500, 500, 500, 275, 500, 333, 760,
+  276, 500, 675, 333, 760, 333, 400, 675, 300, 300,
+  333, 500, 523, 350, 333, 300, 310, 500, 750, 750,
+  750, 500, 611, 611, 611, 611, 611, 611, 889, 667,
+  611, 611, 611, 611, 333, 333, 333, 333, 722, 667,
+  722, 722, 722, 722, 722, 675, 722, 722, 722, 722,
+  722, 556, 611, 500, 500, 500, 500, 500, 500, 500,
+  667, 444, 444, 444, 444, 444, 278, 278, 278, 278,
+  500, 500, 500, 500, 500, 500, 500, 675, 500, 500,
+  500, 500, 500, 444, 500, 444, 611, 500, 611, 500,
+  611, 500, 667, 444, 667, 444, 667, 444, 667, 444,
+  722, 544, 722, 500, 611, 444, 611, 444, 611, 444,
+  611, 444, 611, 444, 722, 500, 722, 500, 722, 500,
+  722, 500, 722, 500, 722, 500, 333, 278, 333, 278,
+  333, 278, 333, 278, 333, 278, 707, 474, 444, 278,
+  667, 444, 491, 556, 278, 556, 278, 611, 300, 556,
+  528, 556, 278, 667, 500, 667, 500, 667, 500, 500,
+  -1, -1, 722, 500, 722, 500, 722, 500, 944, 667,
+  611, 389, 611, 389, 611, 389, 500, 389, 500, 389,
+  500, 389, 500, 389, 556, 278, 556, 300, 556, 278,
+  722, 500, 722, 500, 722, 500, 722, 500, 722, 500,
+  722, 500, 833, 667, 556, 444, 556, 556, 389, 556,
+  389, 556, 389, 278, 612, 500, 500, 556, 333, 333,
+  333, 250, 500, 500, 333, 889, 889, 500, 500, 500,
+  500, 167, 549, 333, 333, 333, 549, 471, 675, 549,
+  333, 476, 250, 1000, 556, 556, 556, 333, 333, 333,
+  453, 333, 389, 600, 278, 333, 980, 677, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1 };
+
+static const int32_t r2ladjusts_5[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 341, 576, 542, 528, 869, 799, 373,
+  357, 305, 620, 676, 131, 331, 165, 321, 529, 458,
+  464, 480, 480, 506, 551, 612, 523, 515, 311, 288,
+  676, 676, 676, 604, 924, 513, 580, 755, 692, 633,
+  653, 774, 759, 376, 485, 729, 551, 855, 707, 759,
+  605, 758, 575, 525, 692, 867, 764, 977, 626, 711,
+  600, 412, 278, 394, 422, 500, 432, 493, 496, 455,
+  542, 443, 277, 480, 497, 313, 152, 475, 320, 716,
+  488, 495, 394, 508, 457, 382, 333, 517, 447, 664,
+  420, 402, 378, 458, 276, 342, 542, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 381, 549, 527, 500, 630, 276, 514, 512, 760,
+  394, 498, 676, 0, 760, 510, 488, 676, 357, 382,
+  583, 467, 671, 350, 152, 327, 429, 502, 769, 783,
+  759, 396, 513, 513, 513, 515, 513, 513, 884, 755,
+  633, 633, 633, 633, 376, 425, 417, 427, 692, 707,
+  759, 759, 759, 759, 759, 675, 759, 867, 867, 867,
+  867, 711, 569, 325, 493, 504, 493, 528, 506, 493,
+  663, 455, 443, 490, 472, 482, 333, 404, 360, 401,
+  509, 490, 495, 514, 495, 523, 516, 676, 497, 517,
+  519, 517, 521, 435, 394, 417, 513, 512, 513, 519,
+  515, 493, 756, 489, 755, 479, 755, 455, 755, 512,
+  692, 673, 692, 587, 633, 488, 619, 531, 633, 443,
+  633, 443, 633, 513, 774, 503, 774, 495, 774, 480,
+  774, 480, 759, 497, 759, 497, 462, 442, 433, 357,
+  477, 458, 376, 313, 376, 284, 746, 511, 485, 233,
+  729, 475, 517, 551, 436, 551, 301, 578, 448, 551,
+  499, 551, 353, 707, 491, 707, 488, 707, 524, 488,
+  0, 0, 759, 522, 760, 546, 759, 617, 1013, 666,
+  575, 476, 575, 409, 575, 479, 525, 447, 546, 433,
+  525, 382, 537, 470, 692, 298, 692, 444, 692, 309,
+  867, 551, 867, 527, 867, 567, 867, 517, 867, 622,
+  867, 519, 977, 664, 711, 402, 711, 600, 429, 600,
+  378, 600, 432, 277, 614, 0, 525, 692, 535, 547,
+  476, 141, 589, 513, 512, 819, 888, 499, 340, 377,
+  532, 168, 549, 332, 334, 579, 549, 472, 676, 549,
+  223, 476, 251, 1035, 462, 680, 650, 481, 441, 227,
+  454, 510, 382, 600, 298, 527, 987, 680, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0 };
+
+static const kerntablestr kerns_5[] = {
+  { 65, 67, -30 }, { 65, 262, -30 }, { 65, 268, -30 }, { 65, 199, -30 },
+  { 65, 71, -35 }, { 65, 286, -35 }, { 65, 290, -35 }, { 65, 79, -40 },
+  { 65, 211, -40 }, { 65, 212, -40 }, { 65, 214, -40 }, { 65, 210, -40 },
+  { 65, 336, -40 }, { 65, 332, -40 }, { 65, 216, -40 }, { 65, 213, -40 },
+  { 65, 81, -40 }, { 65, 84, -37 }, { 65, 356, -37 }, { 65, 387, -37 },
+  { 65, 85, -50 }, { 65, 218, -50 }, { 65, 219, -50 }, { 65, 220, -50 },
+  { 65, 217, -50 }, { 65, 368, -50 }, { 65, 362, -50 }, { 65, 370, -50 },
+  { 65, 366, -50 }, { 65, 86, -105 }, { 65, 87, -95 }, { 65, 89, -55 },
+  { 65, 221, -55 }, { 65, 376, -55 }, { 65, 418, -37 }, { 65, 117, -20 },
+  { 65, 250, -20 }, { 65, 251, -20 }, { 65, 252, -20 }, { 65, 249, -20 },
+  { 65, 369, -20 }, { 65, 363, -20 }, { 65, 371, -20 }, { 65, 367, -20 },
+  { 65, 118, -55 }, { 65, 119, -55 }, { 65, 121, -55 }, { 65, 253, -55 },
+  { 65, 255, -55 }, { 193, 67, -30 }, { 193, 262, -30 }, { 193, 268, -30 },
+  { 193, 199, -30 }, { 193, 71, -35 }, { 193, 286, -35 }, { 193, 290, -35 },
+  { 193, 79, -40 }, { 193, 211, -40 }, { 193, 212, -40 }, { 193, 214, -40 },
+  { 193, 210, -40 }, { 193, 336, -40 }, { 193, 332, -40 }, { 193, 216, -40 },
+  { 193, 213, -40 }, { 193, 81, -40 }, { 193, 84, -37 }, { 193, 356, -37 },
+  { 193, 387, -37 }, { 193, 85, -50 }, { 193, 218, -50 }, { 193, 219, -50 },
+  { 193, 220, -50 }, { 193, 217, -50 }, { 193, 368, -50 }, { 193, 362, -50 },
+  { 193, 370, -50 }, { 193, 366, -50 }, { 193, 86, -105 }, { 193, 87, -95 },
+  { 193, 89, -55 }, { 193, 221, -55 }, { 193, 376, -55 }, { 193, 418, -37 },
+  { 193, 117, -20 }, { 193, 250, -20 }, { 193, 251, -20 }, { 193, 252, -20 },
+  { 193, 249, -20 }, { 193, 369, -20 }, { 193, 363, -20 }, { 193, 371, -20 },
+  { 193, 367, -20 }, { 193, 118, -55 }, { 193, 119, -55 }, { 193, 121, -55 },
+  { 193, 253, -55 }, { 193, 255, -55 }, { 258, 67, -30 }, { 258, 262, -30 },
+  { 258, 268, -30 }, { 258, 199, -30 }, { 258, 71, -35 }, { 258, 286, -35 },
+  { 258, 290, -35 }, { 258, 79, -40 }, { 258, 211, -40 }, { 258, 212, -40 },
+  { 258, 214, -40 }, { 258, 210, -40 }, { 258, 336, -40 }, { 258, 332, -40 },
+  { 258, 216, -40 }, { 258, 213, -40 }, { 258, 81, -40 }, { 258, 84, -37 },
+  { 258, 356, -37 }, { 258, 387, -37 }, { 258, 85, -50 }, { 258, 218, -50 },
+  { 258, 219, -50 }, { 258, 220, -50 }, { 258, 217, -50 }, { 258, 368, -50 },
+  { 258, 362, -50 }, { 258, 370, -50 }, { 258, 366, -50 }, { 258, 86, -105 },
+  { 258, 87, -95 }, { 258, 89, -55 }, { 258, 221, -55 }, { 258, 376, -55 },
+  { 258, 418, -37 }, { 258, 117, -20 }, { 258, 250, -20 }, { 258, 251, -20 },
+  { 258, 252, -20 }, { 258, 249, -20 }, { 258, 369, -20 }, { 258, 363, -20 },
+  { 258, 371, -20 }, { 258, 367, -20 }, { 258, 118, -55 }, { 258, 119, -55 },
+  { 258, 121, -55 }, { 258, 253, -55 }, { 258, 255, -55 }, { 194, 67, -30 },
+  { 194, 262, -30 }, { 194, 268, -30 }, { 194, 199, -30 }, { 194, 71, -35 },
+  { 194, 286, -35 }, { 194, 290, -35 }, { 194, 79, -40 }, { 194, 211, -40 },
+  { 194, 212, -40 }, { 194, 214, -40 }, { 194, 210, -40 }, { 194, 336, -40 },
+  { 194, 332, -40 }, { 194, 216, -40 }, { 194, 213, -40 }, { 194, 81, -40 },
+  { 194, 84, -37 }, { 194, 356, -37 }, { 194, 387, -37 }, { 194, 85, -50 },
+  { 194, 218, -50 }, { 194, 219, -50 }, { 194, 220, -50 }, { 194, 217, -50 },
+  { 194, 368, -50 }, { 194, 362, -50 }, { 194, 370, -50 }, { 194, 366, -50 },
+  { 194, 86, -105 }, { 194, 87, -95 }, { 194, 89, -55 }, { 194, 221, -55 },
+  { 194, 376, -55 }, { 194, 418, -37 }, { 194, 117, -20 }, { 194, 250, -20 },
+  { 194, 251, -20 }, { 194, 252, -20 }, { 194, 249, -20 }, { 194, 369, -20 },
+  { 194, 363, -20 }, { 194, 371, -20 }, { 194, 367, -20 }, { 194, 118, -55 },
+  { 194, 119, -55 }, { 194, 121, -55 }, { 194, 253, -55 }, { 194, 255, -55 },
+  { 196, 67, -30 }, { 196, 262, -30 }, { 196, 268, -30 }, { 196, 199, -30 },
+  { 196, 71, -35 }, { 196, 286, -35 }, { 196, 290, -35 }, { 196, 79, -40 },
+  { 196, 211, -40 }, { 196, 212, -40 }, { 196, 214, -40 }, { 196, 210, -40 },
+  { 196, 336, -40 }, { 196, 332, -40 }, { 196, 216, -40 }, { 196, 213, -40 },
+  { 196, 81, -40 }, { 196, 84, -37 }, { 196, 356, -37 }, { 196, 387, -37 },
+  { 196, 85, -50 }, { 196, 218, -50 }, { 196, 219, -50 }, { 196, 220, -50 },
+  { 196, 217, -50 }, { 196, 368, -50 }, { 196, 362, -50 }, { 196, 370, -50 },
+  { 196, 366, -50 }, { 196, 86, -105 }, { 196, 87, -95 }, { 196, 89, -55 },
+  { 196, 221, -55 }, { 196, 376, -55 }, { 196, 418, -37 }, { 196, 117, -20 },
+  { 196, 250, -20 }, { 196, 251, -20 }, { 196, 252, -20 }, { 196, 249, -20 },
+  { 196, 369, -20 }, { 196, 363, -20 }, { 196, 371, -20 }, { 196, 367, -20 },
+  { 196, 118, -55 }, { 196, 119, -55 }, { 196, 121, -55 }, { 196, 253, -55 },
+  { 196, 255, -55 }, { 192, 67, -30 }, { 192, 262, -30 }, { 192, 268, -30 },
+  { 192, 199, -30 }, { 192, 71, -35 }, { 192, 286, -35 }, { 192, 290, -35 },
+  { 192, 79, -40 }, { 192, 211, -40 }, { 192, 212, -40 }, { 192, 214, -40 },
+  { 192, 210, -40 }, { 192, 336, -40 }, { 192, 332, -40 }, { 192, 216, -40 },
+  { 192, 213, -40 }, { 192, 81, -40 }, { 192, 84, -37 }, { 192, 356, -37 },
+  { 192, 387, -37 }, { 192, 85, -50 }, { 192, 218, -50 }, { 192, 219, -50 },
+  { 192, 220, -50 }, { 192, 217, -50 }, { 192, 368, -50 }, { 192, 362, -50 },
+  { 192, 370, -50 }, { 192, 366, -50 }, { 192, 86, -105 }, { 192, 87, -95 },
+  { 192, 89, -55 }, { 192, 221, -55 }, { 192, 376, -55 }, { 192, 418, -37 },
+  { 192, 117, -20 }, { 192, 250, -20 }, { 192, 251, -20 }, { 192, 252, -20 },
+  { 192, 249, -20 }, { 192, 369, -20 }, { 192, 363, -20 }, { 192, 371, -20 },
+  { 192, 367, -20 }, { 192, 118, -55 }, { 192, 119, -55 }, { 192, 121, -55 },
+  { 192, 253, -55 }, { 192, 255, -55 }, { 256, 67, -30 }, { 256, 262, -30 },
+  { 256, 268, -30 }, { 256, 199, -30 }, { 256, 71, -35 }, { 256, 286, -35 },
+  { 256, 290, -35 }, { 256, 79, -40 }, { 256, 211, -40 }, { 256, 212, -40 },
+  { 256, 214, -40 }, { 256, 210, -40 }, { 256, 336, -40 }, { 256, 332, -40 },
+  { 256, 216, -40 }, { 256, 213, -40 }, { 256, 81, -40 }, { 256, 84, -37 },
+  { 256, 356, -37 }, { 256, 387, -37 }, { 256, 85, -50 }, { 256, 218, -50 },
+  { 256, 219, -50 }, { 256, 220, -50 }, { 256, 217, -50 }, { 256, 368, -50 },
+  { 256, 362, -50 }, { 256, 370, -50 }, { 256, 366, -50 }, { 256, 86, -105 },
+  { 256, 87, -95 }, { 256, 89, -55 }, { 256, 221, -55 }, { 256, 376, -55 },
+  { 256, 418, -37 }, { 256, 117, -20 }, { 256, 250, -20 }, { 256, 251, -20 },
+  { 256, 252, -20 }, { 256, 249, -20 }, { 256, 369, -20 }, { 256, 363, -20 },
+  { 256, 371, -20 }, { 256, 367, -20 }, { 256, 118, -55 }, { 256, 119, -55 },
+  { 256, 121, -55 }, { 256, 253, -55 }, { 256, 255, -55 }, { 260, 67, -30 },
+  { 260, 262, -30 }, { 260, 268, -30 }, { 260, 199, -30 }, { 260, 71, -35 },
+  { 260, 286, -35 }, { 260, 290, -35 }, { 260, 79, -40 }, { 260, 211, -40 },
+  { 260, 212, -40 }, { 260, 214, -40 }, { 260, 210, -40 }, { 260, 336, -40 },
+  { 260, 332, -40 }, { 260, 216, -40 }, { 260, 213, -40 }, { 260, 81, -40 },
+  { 260, 84, -37 }, { 260, 356, -37 }, { 260, 387, -37 }, { 260, 85, -50 },
+  { 260, 218, -50 }, { 260, 219, -50 }, { 260, 220, -50 }, { 260, 217, -50 },
+  { 260, 368, -50 }, { 260, 362, -50 }, { 260, 370, -50 }, { 260, 366, -50 },
+  { 260, 86, -105 }, { 260, 87, -95 }, { 260, 89, -55 }, { 260, 221, -55 },
+  { 260, 376, -55 }, { 260, 418, -37 }, { 260, 117, -20 }, { 260, 250, -20 },
+  { 260, 251, -20 }, { 260, 252, -20 }, { 260, 249, -20 }, { 260, 369, -20 },
+  { 260, 363, -20 }, { 260, 371, -20 }, { 260, 367, -20 }, { 260, 118, -55 },
+  { 260, 119, -55 }, { 260, 121, -55 }, { 260, 253, -55 }, { 260, 255, -55 },
+  { 197, 67, -30 }, { 197, 262, -30 }, { 197, 268, -30 }, { 197, 199, -30 },
+  { 197, 71, -35 }, { 197, 286, -35 }, { 197, 290, -35 }, { 197, 79, -40 },
+  { 197, 211, -40 }, { 197, 212, -40 }, { 197, 214, -40 }, { 197, 210, -40 },
+  { 197, 336, -40 }, { 197, 332, -40 }, { 197, 216, -40 }, { 197, 213, -40 },
+  { 197, 81, -40 }, { 197, 84, -37 }, { 197, 356, -37 }, { 197, 387, -37 },
+  { 197, 85, -50 }, { 197, 218, -50 }, { 197, 219, -50 }, { 197, 220, -50 },
+  { 197, 217, -50 }, { 197, 368, -50 }, { 197, 362, -50 }, { 197, 370, -50 },
+  { 197, 366, -50 }, { 197, 86, -105 }, { 197, 87, -95 }, { 197, 89, -55 },
+  { 197, 221, -55 }, { 197, 376, -55 }, { 197, 418, -37 }, { 197, 117, -20 },
+  { 197, 250, -20 }, { 197, 251, -20 }, { 197, 252, -20 }, { 197, 249, -20 },
+  { 197, 369, -20 }, { 197, 363, -20 }, { 197, 371, -20 }, { 197, 367, -20 },
+  { 197, 118, -55 }, { 197, 119, -55 }, { 197, 121, -55 }, { 197, 253, -55 },
+  { 197, 255, -55 }, { 195, 67, -30 }, { 195, 262, -30 }, { 195, 268, -30 },
+  { 195, 199, -30 }, { 195, 71, -35 }, { 195, 286, -35 }, { 195, 290, -35 },
+  { 195, 79, -40 }, { 195, 211, -40 }, { 195, 212, -40 }, { 195, 214, -40 },
+  { 195, 210, -40 }, { 195, 336, -40 }, { 195, 332, -40 }, { 195, 216, -40 },
+  { 195, 213, -40 }, { 195, 81, -40 }, { 195, 84, -37 }, { 195, 356, -37 },
+  { 195, 387, -37 }, { 195, 85, -50 }, { 195, 218, -50 }, { 195, 219, -50 },
+  { 195, 220, -50 }, { 195, 217, -50 }, { 195, 368, -50 }, { 195, 362, -50 },
+  { 195, 370, -50 }, { 195, 366, -50 }, { 195, 86, -105 }, { 195, 87, -95 },
+  { 195, 89, -55 }, { 195, 221, -55 }, { 195, 376, -55 }, { 195, 418, -37 },
+  { 195, 117, -20 }, { 195, 250, -20 }, { 195, 251, -20 }, { 195, 252, -20 },
+  { 195, 249, -20 }, { 195, 369, -20 }, { 195, 363, -20 }, { 195, 371, -20 },
+  { 195, 367, -20 }, { 195, 118, -55 }, { 195, 119, -55 }, { 195, 121, -55 },
+  { 195, 253, -55 }, { 195, 255, -55 }, { 66, 65, -25 }, { 66, 193, -25 },
+  { 66, 258, -25 }, { 66, 194, -25 }, { 66, 196, -25 }, { 66, 192, -25 },
+  { 66, 256, -25 }, { 66, 260, -25 }, { 66, 197, -25 }, { 66, 195, -25 },
+  { 66, 85, -10 }, { 66, 218, -10 }, { 66, 219, -10 }, { 66, 220, -10 },
+  { 66, 217, -10 }, { 66, 368, -10 }, { 66, 362, -10 }, { 66, 370, -10 },
+  { 66, 366, -10 }, { 68, 65, -35 }, { 68, 193, -35 }, { 68, 258, -35 },
+  { 68, 194, -35 }, { 68, 196, -35 }, { 68, 192, -35 }, { 68, 256, -35 },
+  { 68, 260, -35 }, { 68, 197, -35 }, { 68, 195, -35 }, { 68, 86, -40 },
+  { 68, 87, -40 }, { 68, 89, -40 }, { 68, 221, -40 }, { 68, 376, -40 },
+  { 270, 65, -35 }, { 270, 193, -35 }, { 270, 258, -35 }, { 270, 194, -35 },
+  { 270, 196, -35 }, { 270, 192, -35 }, { 270, 256, -35 }, { 270, 260, -35 },
+  { 270, 197, -35 }, { 270, 195, -35 }, { 270, 86, -40 }, { 270, 87, -40 },
+  { 270, 89, -40 }, { 270, 221, -40 }, { 270, 376, -40 }, { 272, 65, -35 },
+  { 272, 193, -35 }, { 272, 258, -35 }, { 272, 194, -35 }, { 272, 196, -35 },
+  { 272, 192, -35 }, { 272, 256, -35 }, { 272, 260, -35 }, { 272, 197, -35 },
+  { 272, 195, -35 }, { 272, 86, -40 }, { 272, 87, -40 }, { 272, 89, -40 },
+  { 272, 221, -40 }, { 272, 376, -40 }, { 70, 65, -115 }, { 70, 193, -115 },
+  { 70, 258, -115 }, { 70, 194, -115 }, { 70, 196, -115 }, { 70, 192, -115 },
+  { 70, 256, -115 }, { 70, 260, -115 }, { 70, 197, -115 }, { 70, 195, -115 },
+  { 70, 97, -75 }, { 70, 225, -75 }, { 70, 259, -75 }, { 70, 226, -75 },
+  { 70, 228, -75 }, { 70, 224, -75 }, { 70, 257, -75 }, { 70, 261, -75 },
+  { 70, 229, -75 }, { 70, 227, -75 }, { 70, 44, -135 }, { 70, 101, -75 },
+  { 70, 233, -75 }, { 70, 283, -75 }, { 70, 234, -75 }, { 70, 235, -75 },
+  { 70, 279, -75 }, { 70, 232, -75 }, { 70, 275, -75 }, { 70, 281, -75 },
+  { 70, 105, -45 }, { 70, 237, -45 }, { 70, 238, -45 }, { 70, 239, -45 },
+  { 70, 236, -45 }, { 70, 299, -45 }, { 70, 303, -45 }, { 70, 111, -105 },
+  { 70, 243, -105 }, { 70, 244, -105 }, { 70, 246, -105 }, { 70, 242, -105 },
+  { 70, 337, -105 }, { 70, 333, -105 }, { 70, 248, -105 }, { 70, 245, -105 },
+  { 70, 46, -135 }, { 70, 114, -55 }, { 70, 341, -55 }, { 70, 345, -55 },
+  { 70, 343, -55 }, { 74, 65, -40 }, { 74, 193, -40 }, { 74, 258, -40 },
+  { 74, 194, -40 }, { 74, 196, -40 }, { 74, 192, -40 }, { 74, 256, -40 },
+  { 74, 260, -40 }, { 74, 197, -40 }, { 74, 195, -40 }, { 74, 97, -35 },
+  { 74, 225, -35 }, { 74, 259, -35 }, { 74, 226, -35 }, { 74, 228, -35 },
+  { 74, 224, -35 }, { 74, 257, -35 }, { 74, 261, -35 }, { 74, 229, -35 },
+  { 74, 227, -35 }, { 74, 44, -25 }, { 74, 101, -25 }, { 74, 233, -25 },
+  { 74, 283, -25 }, { 74, 234, -25 }, { 74, 235, -25 }, { 74, 279, -25 },
+  { 74, 232, -25 }, { 74, 275, -25 }, { 74, 281, -25 }, { 74, 111, -25 },
+  { 74, 243, -25 }, { 74, 244, -25 }, { 74, 246, -25 }, { 74, 242, -25 },
+  { 74, 337, -25 }, { 74, 333, -25 }, { 74, 248, -25 }, { 74, 245, -25 },
+  { 74, 46, -25 }, { 74, 117, -35 }, { 74, 250, -35 }, { 74, 251, -35 },
+  { 74, 252, -35 }, { 74, 249, -35 }, { 74, 369, -35 }, { 74, 363, -35 },
+  { 74, 371, -35 }, { 74, 367, -35 }, { 75, 79, -50 }, { 75, 211, -50 },
+  { 75, 212, -50 }, { 75, 214, -50 }, { 75, 210, -50 }, { 75, 336, -50 },
+  { 75, 332, -50 }, { 75, 216, -50 }, { 75, 213, -50 }, { 75, 101, -35 },
+  { 75, 233, -35 }, { 75, 283, -35 }, { 75, 234, -35 }, { 75, 235, -35 },
+  { 75, 279, -35 }, { 75, 232, -35 }, { 75, 275, -35 }, { 75, 281, -35 },
+  { 75, 111, -40 }, { 75, 243, -40 }, { 75, 244, -40 }, { 75, 246, -40 },
+  { 75, 242, -40 }, { 75, 337, -40 }, { 75, 333, -40 }, { 75, 248, -40 },
+  { 75, 245, -40 }, { 75, 117, -40 }, { 75, 250, -40 }, { 75, 251, -40 },
+  { 75, 252, -40 }, { 75, 249, -40 }, { 75, 369, -40 }, { 75, 363, -40 },
+  { 75, 371, -40 }, { 75, 367, -40 }, { 75, 121, -40 }, { 75, 253, -40 },
+  { 75, 255, -40 }, { 310, 79, -50 }, { 310, 211, -50 }, { 310, 212, -50 },
+  { 310, 214, -50 }, { 310, 210, -50 }, { 310, 336, -50 }, { 310, 332, -50 },
+  { 310, 216, -50 }, { 310, 213, -50 }, { 310, 101, -35 }, { 310, 233, -35 },
+  { 310, 283, -35 }, { 310, 234, -35 }, { 310, 235, -35 }, { 310, 279, -35 },
+  { 310, 232, -35 }, { 310, 275, -35 }, { 310, 281, -35 }, { 310, 111, -40 },
+  { 310, 243, -40 }, { 310, 244, -40 }, { 310, 246, -40 }, { 310, 242, -40 },
+  { 310, 337, -40 }, { 310, 333, -40 }, { 310, 248, -40 }, { 310, 245, -40 },
+  { 310, 117, -40 }, { 310, 250, -40 }, { 310, 251, -40 }, { 310, 252, -40 },
+  { 310, 249, -40 }, { 310, 369, -40 }, { 310, 363, -40 }, { 310, 371, -40 },
+  { 310, 367, -40 }, { 310, 121, -40 }, { 310, 253, -40 }, { 310, 255, -40 },
+  { 76, 84, -20 }, { 76, 356, -20 }, { 76, 387, -20 }, { 76, 86, -55 },
+  { 76, 87, -55 }, { 76, 89, -20 }, { 76, 221, -20 }, { 76, 376, -20 },
+  { 76, 418, -37 }, { 76, 121, -30 }, { 76, 253, -30 }, { 76, 255, -30 },
+  { 313, 84, -20 }, { 313, 356, -20 }, { 313, 387, -20 }, { 313, 86, -55 },
+  { 313, 87, -55 }, { 313, 89, -20 }, { 313, 221, -20 }, { 313, 376, -20 },
+  { 313, 418, -37 }, { 313, 121, -30 }, { 313, 253, -30 }, { 313, 255, -30 },
+  { 315, 84, -20 }, { 315, 356, -20 }, { 315, 387, -20 }, { 315, 86, -55 },
+  { 315, 87, -55 }, { 315, 89, -20 }, { 315, 221, -20 }, { 315, 376, -20 },
+  { 315, 418, -37 }, { 315, 121, -30 }, { 315, 253, -30 }, { 315, 255, -30 },
+  { 321, 84, -20 }, { 321, 356, -20 }, { 321, 387, -20 }, { 321, 86, -55 },
+  { 321, 87, -55 }, { 321, 89, -20 }, { 321, 221, -20 }, { 321, 376, -20 },
+  { 321, 418, -37 }, { 321, 121, -30 }, { 321, 253, -30 }, { 321, 255, -30 },
+  { 78, 65, -27 }, { 78, 193, -27 }, { 78, 258, -27 }, { 78, 194, -27 },
+  { 78, 196, -27 }, { 78, 192, -27 }, { 78, 256, -27 }, { 78, 260, -27 },
+  { 78, 197, -27 }, { 78, 195, -27 }, { 323, 65, -27 }, { 323, 193, -27 },
+  { 323, 258, -27 }, { 323, 194, -27 }, { 323, 196, -27 }, { 323, 192, -27 },
+  { 323, 256, -27 }, { 323, 260, -27 }, { 323, 197, -27 }, { 323, 195, -27 },
+  { 327, 65, -27 }, { 327, 193, -27 }, { 327, 258, -27 }, { 327, 194, -27 },
+  { 327, 196, -27 }, { 327, 192, -27 }, { 327, 256, -27 }, { 327, 260, -27 },
+  { 327, 197, -27 }, { 327, 195, -27 }, { 325, 65, -27 }, { 325, 193, -27 },
+  { 325, 258, -27 }, { 325, 194, -27 }, { 325, 196, -27 }, { 325, 192, -27 },
+  { 325, 256, -27 }, { 325, 260, -27 }, { 325, 197, -27 }, { 325, 195, -27 },
+  { 209, 65, -27 }, { 209, 193, -27 }, { 209, 258, -27 }, { 209, 194, -27 },
+  { 209, 196, -27 }, { 209, 192, -27 }, { 209, 256, -27 }, { 209, 260, -27 },
+  { 209, 197, -27 }, { 209, 195, -27 }, { 79, 65, -55 }, { 79, 193, -55 },
+  { 79, 258, -55 }, { 79, 194, -55 }, { 79, 196, -55 }, { 79, 192, -55 },
+  { 79, 256, -55 }, { 79, 260, -55 }, { 79, 197, -55 }, { 79, 195, -55 },
+  { 79, 84, -40 }, { 79, 356, -40 }, { 79, 387, -40 }, { 79, 86, -50 },
+  { 79, 87, -50 }, { 79, 88, -40 }, { 79, 89, -50 }, { 79, 221, -50 },
+  { 79, 376, -50 }, { 211, 65, -55 }, { 211, 193, -55 }, { 211, 258, -55 },
+  { 211, 194, -55 }, { 211, 196, -55 }, { 211, 192, -55 }, { 211, 256, -55 },
+  { 211, 260, -55 }, { 211, 197, -55 }, { 211, 195, -55 }, { 211, 84, -40 },
+  { 211, 356, -40 }, { 211, 387, -40 }, { 211, 86, -50 }, { 211, 87, -50 },
+  { 211, 88, -40 }, { 211, 89, -50 }, { 211, 221, -50 }, { 211, 376, -50 },
+  { 212, 65, -55 }, { 212, 193, -55 }, { 212, 258, -55 }, { 212, 194, -55 },
+  { 212, 196, -55 }, { 212, 192, -55 }, { 212, 256, -55 }, { 212, 260, -55 },
+  { 212, 197, -55 }, { 212, 195, -55 }, { 212, 84, -40 }, { 212, 356, -40 },
+  { 212, 387, -40 }, { 212, 86, -50 }, { 212, 87, -50 }, { 212, 88, -40 },
+  { 212, 89, -50 }, { 212, 221, -50 }, { 212, 376, -50 }, { 214, 65, -55 },
+  { 214, 193, -55 }, { 214, 258, -55 }, { 214, 194, -55 }, { 214, 196, -55 },
+  { 214, 192, -55 }, { 214, 256, -55 }, { 214, 260, -55 }, { 214, 197, -55 },
+  { 214, 195, -55 }, { 214, 84, -40 }, { 214, 356, -40 }, { 214, 387, -40 },
+  { 214, 86, -50 }, { 214, 87, -50 }, { 214, 88, -40 }, { 214, 89, -50 },
+  { 214, 221, -50 }, { 214, 376, -50 }, { 210, 65, -55 }, { 210, 193, -55 },
+  { 210, 258, -55 }, { 210, 194, -55 }, { 210, 196, -55 }, { 210, 192, -55 },
+  { 210, 256, -55 }, { 210, 260, -55 }, { 210, 197, -55 }, { 210, 195, -55 },
+  { 210, 84, -40 }, { 210, 356, -40 }, { 210, 387, -40 }, { 210, 86, -50 },
+  { 210, 87, -50 }, { 210, 88, -40 }, { 210, 89, -50 }, { 210, 221, -50 },
+  { 210, 376, -50 }, { 336, 65, -55 }, { 336, 193, -55 }, { 336, 258, -55 },
+  { 336, 194, -55 }, { 336, 196, -55 }, { 336, 192, -55 }, { 336, 256, -55 },
+  { 336, 260, -55 }, { 336, 197, -55 }, { 336, 195, -55 }, { 336, 84, -40 },
+  { 336, 356, -40 }, { 336, 387, -40 }, { 336, 86, -50 }, { 336, 87, -50 },
+  { 336, 88, -40 }, { 336, 89, -50 }, { 336, 221, -50 }, { 336, 376, -50 },
+  { 332, 65, -55 }, { 332, 193, -55 }, { 332, 258, -55 }, { 332, 194, -55 },
+  { 332, 196, -55 }, { 332, 192, -55 }, { 332, 256, -55 }, { 332, 260, -55 },
+  { 332, 197, -55 }, { 332, 195, -55 }, { 332, 84, -40 }, { 332, 356, -40 },
+  { 332, 387, -40 }, { 332, 86, -50 }, { 332, 87, -50 }, { 332, 88, -40 },
+  { 332, 89, -50 }, { 332, 221, -50 }, { 332, 376, -50 }, { 216, 65, -55 },
+  { 216, 193, -55 }, { 216, 258, -55 }, { 216, 194, -55 }, { 216, 196, -55 },
+  { 216, 192, -55 }, { 216, 256, -55 }, { 216, 260, -55 }, { 216, 197, -55 },
+  { 216, 195, -55 }, { 216, 84, -40 }, { 216, 356, -40 }, { 216, 387, -40 },
+  { 216, 86, -50 }, { 216, 87, -50 }, { 216, 88, -40 }, { 216, 89, -50 },
+  { 216, 221, -50 }, { 216, 376, -50 }, { 213, 65, -55 }, { 213, 193, -55 },
+  { 213, 258, -55 }, { 213, 194, -55 }, { 213, 196, -55 }, { 213, 192, -55 },
+  { 213, 256, -55 }, { 213, 260, -55 }, { 213, 197, -55 }, { 213, 195, -55 },
+  { 213, 84, -40 }, { 213, 356, -40 }, { 213, 387, -40 }, { 213, 86, -50 },
+  { 213, 87, -50 }, { 213, 88, -40 }, { 213, 89, -50 }, { 213, 221, -50 },
+  { 213, 376, -50 }, { 80, 65, -90 }, { 80, 193, -90 }, { 80, 258, -90 },
+  { 80, 194, -90 }, { 80, 196, -90 }, { 80, 192, -90 }, { 80, 256, -90 },
+  { 80, 260, -90 }, { 80, 197, -90 }, { 80, 195, -90 }, { 80, 97, -80 },
+  { 80, 225, -80 }, { 80, 259, -80 }, { 80, 226, -80 }, { 80, 228, -80 },
+  { 80, 224, -80 }, { 80, 257, -80 }, { 80, 261, -80 }, { 80, 229, -80 },
+  { 80, 227, -80 }, { 80, 44, -135 }, { 80, 101, -80 }, { 80, 233, -80 },
+  { 80, 283, -80 }, { 80, 234, -80 }, { 80, 235, -80 }, { 80, 279, -80 },
+  { 80, 232, -80 }, { 80, 275, -80 }, { 80, 281, -80 }, { 80, 111, -80 },
+  { 80, 243, -80 }, { 80, 244, -80 }, { 80, 246, -80 }, { 80, 242, -80 },
+  { 80, 337, -80 }, { 80, 333, -80 }, { 80, 248, -80 }, { 80, 245, -80 },
+  { 80, 46, -135 }, { 81, 85, -10 }, { 81, 218, -10 }, { 81, 219, -10 },
+  { 81, 220, -10 }, { 81, 217, -10 }, { 81, 368, -10 }, { 81, 362, -10 },
+  { 81, 370, -10 }, { 81, 366, -10 }, { 82, 79, -40 }, { 82, 211, -40 },
+  { 82, 212, -40 }, { 82, 214, -40 }, { 82, 210, -40 }, { 82, 336, -40 },
+  { 82, 332, -40 }, { 82, 216, -40 }, { 82, 213, -40 }, { 82, 85, -40 },
+  { 82, 218, -40 }, { 82, 219, -40 }, { 82, 220, -40 }, { 82, 217, -40 },
+  { 82, 368, -40 }, { 82, 362, -40 }, { 82, 370, -40 }, { 82, 366, -40 },
+  { 82, 86, -18 }, { 82, 87, -18 }, { 82, 89, -18 }, { 82, 221, -18 },
+  { 82, 376, -18 }, { 340, 79, -40 }, { 340, 211, -40 }, { 340, 212, -40 },
+  { 340, 214, -40 }, { 340, 210, -40 }, { 340, 336, -40 }, { 340, 332, -40 },
+  { 340, 216, -40 }, { 340, 213, -40 }, { 340, 85, -40 }, { 340, 218, -40 },
+  { 340, 219, -40 }, { 340, 220, -40 }, { 340, 217, -40 }, { 340, 368, -40 },
+  { 340, 362, -40 }, { 340, 370, -40 }, { 340, 366, -40 }, { 340, 86, -18 },
+  { 340, 87, -18 }, { 340, 89, -18 }, { 340, 221, -18 }, { 340, 376, -18 },
+  { 344, 79, -40 }, { 344, 211, -40 }, { 344, 212, -40 }, { 344, 214, -40 },
+  { 344, 210, -40 }, { 344, 336, -40 }, { 344, 332, -40 }, { 344, 216, -40 },
+  { 344, 213, -40 }, { 344, 85, -40 }, { 344, 218, -40 }, { 344, 219, -40 },
+  { 344, 220, -40 }, { 344, 217, -40 }, { 344, 368, -40 }, { 344, 362, -40 },
+  { 344, 370, -40 }, { 344, 366, -40 }, { 344, 86, -18 }, { 344, 87, -18 },
+  { 344, 89, -18 }, { 344, 221, -18 }, { 344, 376, -18 }, { 342, 79, -40 },
+  { 342, 211, -40 }, { 342, 212, -40 }, { 342, 214, -40 }, { 342, 210, -40 },
+  { 342, 336, -40 }, { 342, 332, -40 }, { 342, 216, -40 }, { 342, 213, -40 },
+  { 342, 85, -40 }, { 342, 218, -40 }, { 342, 219, -40 }, { 342, 220, -40 },
+  { 342, 217, -40 }, { 342, 368, -40 }, { 342, 362, -40 }, { 342, 370, -40 },
+  { 342, 366, -40 }, { 342, 86, -18 }, { 342, 87, -18 }, { 342, 89, -18 },
+  { 342, 221, -18 }, { 342, 376, -18 }, { 84, 65, -50 }, { 84, 193, -50 },
+  { 84, 258, -50 }, { 84, 194, -50 }, { 84, 196, -50 }, { 84, 192, -50 },
+  { 84, 256, -50 }, { 84, 260, -50 }, { 84, 197, -50 }, { 84, 195, -50 },
+  { 84, 79, -18 }, { 84, 211, -18 }, { 84, 212, -18 }, { 84, 214, -18 },
+  { 84, 210, -18 }, { 84, 336, -18 }, { 84, 332, -18 }, { 84, 216, -18 },
+  { 84, 213, -18 }, { 84, 97, -92 }, { 84, 225, -92 }, { 84, 259, -92 },
+  { 84, 226, -92 }, { 84, 228, -92 }, { 84, 224, -92 }, { 84, 257, -92 },
+  { 84, 261, -92 }, { 84, 229, -92 }, { 84, 227, -92 }, { 84, 58, -55 },
+  { 84, 44, -74 }, { 84, 101, -92 }, { 84, 233, -92 }, { 84, 283, -92 },
+  { 84, 234, -52 }, { 84, 235, -52 }, { 84, 279, -92 }, { 84, 232, -52 },
+  { 84, 275, -52 }, { 84, 281, -92 }, { 84, 45, -74 }, { 84, 105, -55 },
+  { 84, 237, -55 }, { 84, 303, -55 }, { 84, 111, -92 }, { 84, 243, -92 },
+  { 84, 244, -92 }, { 84, 246, -92 }, { 84, 242, -92 }, { 84, 337, -92 },
+  { 84, 333, -92 }, { 84, 248, -92 }, { 84, 245, -92 }, { 84, 46, -74 },
+  { 84, 114, -55 }, { 84, 341, -55 }, { 84, 345, -55 }, { 84, 343, -55 },
+  { 84, 59, -65 }, { 84, 117, -55 }, { 84, 250, -55 }, { 84, 251, -55 },
+  { 84, 252, -55 }, { 84, 249, -55 }, { 84, 369, -55 }, { 84, 363, -55 },
+  { 84, 371, -55 }, { 84, 367, -55 }, { 84, 119, -74 }, { 84, 121, -74 },
+  { 84, 253, -74 }, { 84, 255, -34 }, { 356, 65, -50 }, { 356, 193, -50 },
+  { 356, 258, -50 }, { 356, 194, -50 }, { 356, 196, -50 }, { 356, 192, -50 },
+  { 356, 256, -50 }, { 356, 260, -50 }, { 356, 197, -50 }, { 356, 195, -50 },
+  { 356, 79, -18 }, { 356, 211, -18 }, { 356, 212, -18 }, { 356, 214, -18 },
+  { 356, 210, -18 }, { 356, 336, -18 }, { 356, 332, -18 }, { 356, 216, -18 },
+  { 356, 213, -18 }, { 356, 97, -92 }, { 356, 225, -92 }, { 356, 259, -92 },
+  { 356, 226, -92 }, { 356, 228, -92 }, { 356, 224, -92 }, { 356, 257, -92 },
+  { 356, 261, -92 }, { 356, 229, -92 }, { 356, 227, -92 }, { 356, 58, -55 },
+  { 356, 44, -74 }, { 356, 101, -92 }, { 356, 233, -92 }, { 356, 283, -92 },
+  { 356, 234, -52 }, { 356, 235, -52 }, { 356, 279, -92 }, { 356, 232, -52 },
+  { 356, 275, -52 }, { 356, 281, -92 }, { 356, 45, -74 }, { 356, 105, -55 },
+  { 356, 237, -55 }, { 356, 303, -55 }, { 356, 111, -92 }, { 356, 243, -92 },
+  { 356, 244, -92 }, { 356, 246, -92 }, { 356, 242, -92 }, { 356, 337, -92 },
+  { 356, 333, -92 }, { 356, 248, -92 }, { 356, 245, -92 }, { 356, 46, -74 },
+  { 356, 114, -55 }, { 356, 341, -55 }, { 356, 345, -55 }, { 356, 343, -55 },
+  { 356, 59, -65 }, { 356, 117, -55 }, { 356, 250, -55 }, { 356, 251, -55 },
+  { 356, 252, -55 }, { 356, 249, -55 }, { 356, 369, -55 }, { 356, 363, -55 },
+  { 356, 371, -55 }, { 356, 367, -55 }, { 356, 119, -74 }, { 356, 121, -74 },
+  { 356, 253, -74 }, { 356, 255, -34 }, { 387, 65, -50 }, { 387, 193, -50 },
+  { 387, 258, -50 }, { 387, 194, -50 }, { 387, 196, -50 }, { 387, 192, -50 },
+  { 387, 256, -50 }, { 387, 260, -50 }, { 387, 197, -50 }, { 387, 195, -50 },
+  { 387, 79, -18 }, { 387, 211, -18 }, { 387, 212, -18 }, { 387, 214, -18 },
+  { 387, 210, -18 }, { 387, 336, -18 }, { 387, 332, -18 }, { 387, 216, -18 },
+  { 387, 213, -18 }, { 387, 97, -92 }, { 387, 225, -92 }, { 387, 259, -92 },
+  { 387, 226, -92 }, { 387, 228, -92 }, { 387, 224, -92 }, { 387, 257, -92 },
+  { 387, 261, -92 }, { 387, 229, -92 }, { 387, 227, -92 }, { 387, 58, -55 },
+  { 387, 44, -74 }, { 387, 101, -92 }, { 387, 233, -92 }, { 387, 283, -92 },
+  { 387, 234, -52 }, { 387, 235, -52 }, { 387, 279, -92 }, { 387, 232, -52 },
+  { 387, 275, -52 }, { 387, 281, -92 }, { 387, 45, -74 }, { 387, 105, -55 },
+  { 387, 237, -55 }, { 387, 303, -55 }, { 387, 111, -92 }, { 387, 243, -92 },
+  { 387, 244, -92 }, { 387, 246, -92 }, { 387, 242, -92 }, { 387, 337, -92 },
+  { 387, 333, -92 }, { 387, 248, -92 }, { 387, 245, -92 }, { 387, 46, -74 },
+  { 387, 114, -55 }, { 387, 341, -55 }, { 387, 345, -55 }, { 387, 343, -55 },
+  { 387, 59, -65 }, { 387, 117, -55 }, { 387, 250, -55 }, { 387, 251, -55 },
+  { 387, 252, -55 }, { 387, 249, -55 }, { 387, 369, -55 }, { 387, 363, -55 },
+  { 387, 371, -55 }, { 387, 367, -55 }, { 387, 119, -74 }, { 387, 121, -74 },
+  { 387, 253, -74 }, { 387, 255, -34 }, { 85, 65, -40 }, { 85, 193, -40 },
+  { 85, 258, -40 }, { 85, 194, -40 }, { 85, 196, -40 }, { 85, 192, -40 },
+  { 85, 256, -40 }, { 85, 260, -40 }, { 85, 197, -40 }, { 85, 195, -40 },
+  { 85, 44, -25 }, { 85, 46, -25 }, { 218, 65, -40 }, { 218, 193, -40 },
+  { 218, 258, -40 }, { 218, 194, -40 }, { 218, 196, -40 }, { 218, 192, -40 },
+  { 218, 256, -40 }, { 218, 260, -40 }, { 218, 197, -40 }, { 218, 195, -40 },
+  { 218, 44, -25 }, { 218, 46, -25 }, { 219, 65, -40 }, { 219, 193, -40 },
+  { 219, 258, -40 }, { 219, 194, -40 }, { 219, 196, -40 }, { 219, 192, -40 },
+  { 219, 256, -40 }, { 219, 260, -40 }, { 219, 197, -40 }, { 219, 195, -40 },
+  { 219, 44, -25 }, { 219, 46, -25 }, { 220, 65, -40 }, { 220, 193, -40 },
+  { 220, 258, -40 }, { 220, 194, -40 }, { 220, 196, -40 }, { 220, 192, -40 },
+  { 220, 256, -40 }, { 220, 260, -40 }, { 220, 197, -40 }, { 220, 195, -40 },
+  { 220, 44, -25 }, { 220, 46, -25 }, { 217, 65, -40 }, { 217, 193, -40 },
+  { 217, 258, -40 }, { 217, 194, -40 }, { 217, 196, -40 }, { 217, 192, -40 },
+  { 217, 256, -40 }, { 217, 260, -40 }, { 217, 197, -40 }, { 217, 195, -40 },
+  { 217, 44, -25 }, { 217, 46, -25 }, { 368, 65, -40 }, { 368, 193, -40 },
+  { 368, 258, -40 }, { 368, 194, -40 }, { 368, 196, -40 }, { 368, 192, -40 },
+  { 368, 256, -40 }, { 368, 260, -40 }, { 368, 197, -40 }, { 368, 195, -40 },
+  { 368, 44, -25 }, { 368, 46, -25 }, { 362, 65, -40 }, { 362, 193, -40 },
+  { 362, 258, -40 }, { 362, 194, -40 }, { 362, 196, -40 }, { 362, 192, -40 },
+  { 362, 256, -40 }, { 362, 260, -40 }, { 362, 197, -40 }, { 362, 195, -40 },
+  { 362, 44, -25 }, { 362, 46, -25 }, { 370, 65, -40 }, { 370, 193, -40 },
+  { 370, 258, -40 }, { 370, 194, -40 }, { 370, 196, -40 }, { 370, 192, -40 },
+  { 370, 256, -40 }, { 370, 260, -40 }, { 370, 197, -40 }, { 370, 195, -40 },
+  { 370, 44, -25 }, { 370, 46, -25 }, { 366, 65, -40 }, { 366, 193, -40 },
+  { 366, 258, -40 }, { 366, 194, -40 }, { 366, 196, -40 }, { 366, 192, -40 },
+  { 366, 256, -40 }, { 366, 260, -40 }, { 366, 197, -40 }, { 366, 195, -40 },
+  { 366, 44, -25 }, { 366, 46, -25 }, { 86, 65, -60 }, { 86, 193, -60 },
+  { 86, 258, -60 }, { 86, 194, -60 }, { 86, 196, -60 }, { 86, 192, -60 },
+  { 86, 256, -60 }, { 86, 260, -60 }, { 86, 197, -60 }, { 86, 195, -60 },
+  { 86, 79, -30 }, { 86, 211, -30 }, { 86, 212, -30 }, { 86, 214, -30 },
+  { 86, 210, -30 }, { 86, 336, -30 }, { 86, 332, -30 }, { 86, 216, -30 },
+  { 86, 213, -30 }, { 86, 97, -111 }, { 86, 225, -111 }, { 86, 259, -111 },
+  { 86, 226, -111 }, { 86, 228, -111 }, { 86, 224, -111 }, { 86, 257, -111 },
+  { 86, 261, -111 }, { 86, 229, -111 }, { 86, 227, -111 }, { 86, 58, -65 },
+  { 86, 44, -129 }, { 86, 101, -111 }, { 86, 233, -111 }, { 86, 283, -111 },
+  { 86, 234, -111 }, { 86, 235, -71 }, { 86, 279, -111 }, { 86, 232, -71 },
+  { 86, 275, -71 }, { 86, 281, -111 }, { 86, 45, -55 }, { 86, 105, -74 },
+  { 86, 237, -74 }, { 86, 238, -34 }, { 86, 239, -34 }, { 86, 236, -34 },
+  { 86, 299, -34 }, { 86, 303, -74 }, { 86, 111, -111 }, { 86, 243, -111 },
+  { 86, 244, -111 }, { 86, 246, -111 }, { 86, 242, -111 }, { 86, 337, -111 },
+  { 86, 333, -111 }, { 86, 248, -111 }, { 86, 245, -111 }, { 86, 46, -129 },
+  { 86, 59, -74 }, { 86, 117, -74 }, { 86, 250, -74 }, { 86, 251, -74 },
+  { 86, 252, -74 }, { 86, 249, -74 }, { 86, 369, -74 }, { 86, 363, -74 },
+  { 86, 371, -74 }, { 86, 367, -74 }, { 87, 65, -60 }, { 87, 193, -60 },
+  { 87, 258, -60 }, { 87, 194, -60 }, { 87, 196, -60 }, { 87, 192, -60 },
+  { 87, 256, -60 }, { 87, 260, -60 }, { 87, 197, -60 }, { 87, 195, -60 },
+  { 87, 79, -25 }, { 87, 211, -25 }, { 87, 212, -25 }, { 87, 214, -25 },
+  { 87, 210, -25 }, { 87, 336, -25 }, { 87, 332, -25 }, { 87, 216, -25 },
+  { 87, 213, -25 }, { 87, 97, -92 }, { 87, 225, -92 }, { 87, 259, -92 },
+  { 87, 226, -92 }, { 87, 228, -92 }, { 87, 224, -92 }, { 87, 257, -92 },
+  { 87, 261, -92 }, { 87, 229, -92 }, { 87, 227, -92 }, { 87, 58, -65 },
+  { 87, 44, -92 }, { 87, 101, -92 }, { 87, 233, -92 }, { 87, 283, -92 },
+  { 87, 234, -92 }, { 87, 235, -52 }, { 87, 279, -92 }, { 87, 232, -52 },
+  { 87, 275, -52 }, { 87, 281, -92 }, { 87, 45, -37 }, { 87, 105, -55 },
+  { 87, 237, -55 }, { 87, 303, -55 }, { 87, 111, -92 }, { 87, 243, -92 },
+  { 87, 244, -92 }, { 87, 246, -92 }, { 87, 242, -92 }, { 87, 337, -92 },
+  { 87, 333, -92 }, { 87, 248, -92 }, { 87, 245, -92 }, { 87, 46, -92 },
+  { 87, 59, -65 }, { 87, 117, -55 }, { 87, 250, -55 }, { 87, 251, -55 },
+  { 87, 252, -55 }, { 87, 249, -55 }, { 87, 369, -55 }, { 87, 363, -55 },
+  { 87, 371, -55 }, { 87, 367, -55 }, { 87, 121, -70 }, { 87, 253, -70 },
+  { 87, 255, -70 }, { 89, 65, -50 }, { 89, 193, -50 }, { 89, 258, -50 },
+  { 89, 194, -50 }, { 89, 196, -50 }, { 89, 192, -50 }, { 89, 256, -50 },
+  { 89, 260, -50 }, { 89, 197, -50 }, { 89, 195, -50 }, { 89, 79, -15 },
+  { 89, 211, -15 }, { 89, 212, -15 }, { 89, 214, -15 }, { 89, 210, -15 },
+  { 89, 336, -15 }, { 89, 332, -15 }, { 89, 216, -15 }, { 89, 213, -15 },
+  { 89, 97, -92 }, { 89, 225, -92 }, { 89, 259, -92 }, { 89, 226, -92 },
+  { 89, 228, -92 }, { 89, 224, -92 }, { 89, 257, -92 }, { 89, 261, -92 },
+  { 89, 229, -92 }, { 89, 227, -92 }, { 89, 58, -65 }, { 89, 44, -92 },
+  { 89, 101, -92 }, { 89, 233, -92 }, { 89, 283, -92 }, { 89, 234, -92 },
+  { 89, 235, -52 }, { 89, 279, -92 }, { 89, 232, -52 }, { 89, 275, -52 },
+  { 89, 281, -92 }, { 89, 45, -74 }, { 89, 105, -74 }, { 89, 237, -74 },
+  { 89, 238, -34 }, { 89, 239, -34 }, { 89, 236, -34 }, { 89, 299, -34 },
+  { 89, 303, -74 }, { 89, 111, -92 }, { 89, 243, -92 }, { 89, 244, -92 },
+  { 89, 246, -92 }, { 89, 242, -92 }, { 89, 337, -92 }, { 89, 333, -92 },
+  { 89, 248, -92 }, { 89, 245, -92 }, { 89, 46, -92 }, { 89, 59, -65 },
+  { 89, 117, -92 }, { 89, 250, -92 }, { 89, 251, -92 }, { 89, 252, -92 },
+  { 89, 249, -92 }, { 89, 369, -92 }, { 89, 363, -92 }, { 89, 371, -92 },
+  { 89, 367, -92 }, { 221, 65, -50 }, { 221, 193, -50 }, { 221, 258, -50 },
+  { 221, 194, -50 }, { 221, 196, -50 }, { 221, 192, -50 }, { 221, 256, -50 },
+  { 221, 260, -50 }, { 221, 197, -50 }, { 221, 195, -50 }, { 221, 79, -15 },
+  { 221, 211, -15 }, { 221, 212, -15 }, { 221, 214, -15 }, { 221, 210, -15 },
+  { 221, 336, -15 }, { 221, 332, -15 }, { 221, 216, -15 }, { 221, 213, -15 },
+  { 221, 97, -92 }, { 221, 225, -92 }, { 221, 259, -92 }, { 221, 226, -92 },
+  { 221, 228, -92 }, { 221, 224, -92 }, { 221, 257, -92 }, { 221, 261, -92 },
+  { 221, 229, -92 }, { 221, 227, -92 }, { 221, 58, -65 }, { 221, 44, -92 },
+  { 221, 101, -92 }, { 221, 233, -92 }, { 221, 283, -92 }, { 221, 234, -92 },
+  { 221, 235, -52 }, { 221, 279, -92 }, { 221, 232, -52 }, { 221, 275, -52 },
+  { 221, 281, -92 }, { 221, 45, -74 }, { 221, 105, -74 }, { 221, 237, -74 },
+  { 221, 238, -34 }, { 221, 239, -34 }, { 221, 236, -34 }, { 221, 299, -34 },
+  { 221, 303, -74 }, { 221, 111, -92 }, { 221, 243, -92 }, { 221, 244, -92 },
+  { 221, 246, -92 }, { 221, 242, -92 }, { 221, 337, -92 }, { 221, 333, -92 },
+  { 221, 248, -92 }, { 221, 245, -92 }, { 221, 46, -92 }, { 221, 59, -65 },
+  { 221, 117, -92 }, { 221, 250, -92 }, { 221, 251, -92 }, { 221, 252, -92 },
+  { 221, 249, -92 }, { 221, 369, -92 }, { 221, 363, -92 }, { 221, 371, -92 },
+  { 221, 367, -92 }, { 376, 65, -50 }, { 376, 193, -50 }, { 376, 258, -50 },
+  { 376, 194, -50 }, { 376, 196, -50 }, { 376, 192, -50 }, { 376, 256, -50 },
+  { 376, 260, -50 }, { 376, 197, -50 }, { 376, 195, -50 }, { 376, 79, -15 },
+  { 376, 211, -15 }, { 376, 212, -15 }, { 376, 214, -15 }, { 376, 210, -15 },
+  { 376, 336, -15 }, { 376, 332, -15 }, { 376, 216, -15 }, { 376, 213, -15 },
+  { 376, 97, -92 }, { 376, 225, -92 }, { 376, 259, -92 }, { 376, 226, -92 },
+  { 376, 228, -92 }, { 376, 224, -92 }, { 376, 257, -92 }, { 376, 261, -92 },
+  { 376, 229, -92 }, { 376, 227, -92 }, { 376, 58, -65 }, { 376, 44, -92 },
+  { 376, 101, -92 }, { 376, 233, -92 }, { 376, 283, -92 }, { 376, 234, -92 },
+  { 376, 235, -52 }, { 376, 279, -92 }, { 376, 232, -52 }, { 376, 275, -52 },
+  { 376, 281, -92 }, { 376, 45, -74 }, { 376, 105, -74 }, { 376, 237, -74 },
+  { 376, 238, -34 }, { 376, 239, -34 }, { 376, 236, -34 }, { 376, 299, -34 },
+  { 376, 303, -74 }, { 376, 111, -92 }, { 376, 243, -92 }, { 376, 244, -92 },
+  { 376, 246, -92 }, { 376, 242, -92 }, { 376, 337, -92 }, { 376, 333, -92 },
+  { 376, 248, -92 }, { 376, 245, -92 }, { 376, 46, -92 }, { 376, 59, -65 },
+  { 376, 117, -92 }, { 376, 250, -92 }, { 376, 251, -92 }, { 376, 252, -92 },
+  { 376, 249, -92 }, { 376, 369, -92 }, { 376, 363, -92 }, { 376, 371, -92 },
+  { 376, 367, -92 }, { 97, 103, -10 }, { 97, 287, -10 }, { 97, 291, -10 },
+  { 225, 103, -10 }, { 225, 287, -10 }, { 225, 291, -10 }, { 259, 103, -10 },
+  { 259, 287, -10 }, { 259, 291, -10 }, { 226, 103, -10 }, { 226, 287, -10 },
+  { 226, 291, -10 }, { 228, 103, -10 }, { 228, 287, -10 }, { 228, 291, -10 },
+  { 224, 103, -10 }, { 224, 287, -10 }, { 224, 291, -10 }, { 257, 103, -10 },
+  { 257, 287, -10 }, { 257, 291, -10 }, { 261, 103, -10 }, { 261, 287, -10 },
+  { 261, 291, -10 }, { 229, 103, -10 }, { 229, 287, -10 }, { 229, 291, -10 },
+  { 227, 103, -10 }, { 227, 287, -10 }, { 227, 291, -10 }, { 98, 46, -40 },
+  { 98, 117, -20 }, { 98, 250, -20 }, { 98, 251, -20 }, { 98, 252, -20 },
+  { 98, 249, -20 }, { 98, 369, -20 }, { 98, 363, -20 }, { 98, 371, -20 },
+  { 98, 367, -20 }, { 99, 104, -15 }, { 99, 107, -20 }, { 99, 311, -20 },
+  { 263, 104, -15 }, { 263, 107, -20 }, { 263, 311, -20 }, { 269, 104, -15 },
+  { 269, 107, -20 }, { 269, 311, -20 }, { 231, 104, -15 }, { 231, 107, -20 },
+  { 231, 311, -20 }, { 44, 416, -140 }, { 44, 418, -140 }, { 101, 44, -10 },
+  { 101, 103, -40 }, { 101, 287, -40 }, { 101, 291, -40 }, { 101, 46, -15 },
+  { 101, 118, -15 }, { 101, 119, -15 }, { 101, 120, -20 }, { 101, 121, -30 },
+  { 101, 253, -30 }, { 101, 255, -30 }, { 233, 44, -10 }, { 233, 103, -40 },
+  { 233, 287, -40 }, { 233, 291, -40 }, { 233, 46, -15 }, { 233, 118, -15 },
+  { 233, 119, -15 }, { 233, 120, -20 }, { 233, 121, -30 }, { 233, 253, -30 },
+  { 233, 255, -30 }, { 283, 44, -10 }, { 283, 103, -40 }, { 283, 287, -40 },
+  { 283, 291, -40 }, { 283, 46, -15 }, { 283, 118, -15 }, { 283, 119, -15 },
+  { 283, 120, -20 }, { 283, 121, -30 }, { 283, 253, -30 }, { 283, 255, -30 },
+  { 234, 44, -10 }, { 234, 103, -40 }, { 234, 287, -40 }, { 234, 291, -40 },
+  { 234, 46, -15 }, { 234, 118, -15 }, { 234, 119, -15 }, { 234, 120, -20 },
+  { 234, 121, -30 }, { 234, 253, -30 }, { 234, 255, -30 }, { 235, 44, -10 },
+  { 235, 103, -40 }, { 235, 287, -40 }, { 235, 291, -40 }, { 235, 46, -15 },
+  { 235, 118, -15 }, { 235, 119, -15 }, { 235, 120, -20 }, { 235, 121, -30 },
+  { 235, 253, -30 }, { 235, 255, -30 }, { 279, 44, -10 }, { 279, 103, -40 },
+  { 279, 287, -40 }, { 279, 291, -40 }, { 279, 46, -15 }, { 279, 118, -15 },
+  { 279, 119, -15 }, { 279, 120, -20 }, { 279, 121, -30 }, { 279, 253, -30 },
+  { 279, 255, -30 }, { 232, 44, -10 }, { 232, 103, -40 }, { 232, 287, -40 },
+  { 232, 291, -40 }, { 232, 46, -15 }, { 232, 118, -15 }, { 232, 119, -15 },
+  { 232, 120, -20 }, { 232, 121, -30 }, { 232, 253, -30 }, { 232, 255, -30 },
+  { 275, 44, -10 }, { 275, 103, -40 }, { 275, 287, -40 }, { 275, 291, -40 },
+  { 275, 46, -15 }, { 275, 118, -15 }, { 275, 119, -15 }, { 275, 120, -20 },
+  { 275, 121, -30 }, { 275, 253, -30 }, { 275, 255, -30 }, { 281, 44, -10 },
+  { 281, 103, -40 }, { 281, 287, -40 }, { 281, 291, -40 }, { 281, 46, -15 },
+  { 281, 118, -15 }, { 281, 119, -15 }, { 281, 120, -20 }, { 281, 121, -30 },
+  { 281, 253, -30 }, { 281, 255, -30 }, { 102, 44, -10 }, { 102, 305, -60 },
+  { 102, 102, -18 }, { 102, 105, -20 }, { 102, 303, -20 }, { 102, 46, -15 },
+  { 102, 418, 92 }, { 103, 44, -10 }, { 103, 101, -10 }, { 103, 233, -10 },
+  { 103, 283, -10 }, { 103, 234, -10 }, { 103, 235, -10 }, { 103, 279, -10 },
+  { 103, 232, -10 }, { 103, 275, -10 }, { 103, 281, -10 }, { 103, 103, -10 },
+  { 103, 287, -10 }, { 103, 291, -10 }, { 103, 46, -15 }, { 287, 44, -10 },
+  { 287, 101, -10 }, { 287, 233, -10 }, { 287, 283, -10 }, { 287, 234, -10 },
+  { 287, 235, -10 }, { 287, 279, -10 }, { 287, 232, -10 }, { 287, 275, -10 },
+  { 287, 281, -10 }, { 287, 103, -10 }, { 287, 287, -10 }, { 287, 291, -10 },
+  { 287, 46, -15 }, { 291, 44, -10 }, { 291, 101, -10 }, { 291, 233, -10 },
+  { 291, 283, -10 }, { 291, 234, -10 }, { 291, 235, -10 }, { 291, 279, -10 },
+  { 291, 232, -10 }, { 291, 275, -10 }, { 291, 281, -10 }, { 291, 103, -10 },
+  { 291, 287, -10 }, { 291, 291, -10 }, { 291, 46, -15 }, { 107, 101, -10 },
+  { 107, 233, -10 }, { 107, 283, -10 }, { 107, 234, -10 }, { 107, 235, -10 },
+  { 107, 279, -10 }, { 107, 232, -10 }, { 107, 275, -10 }, { 107, 281, -10 },
+  { 107, 111, -10 }, { 107, 243, -10 }, { 107, 244, -10 }, { 107, 246, -10 },
+  { 107, 242, -10 }, { 107, 337, -10 }, { 107, 333, -10 }, { 107, 248, -10 },
+  { 107, 245, -10 }, { 107, 121, -10 }, { 107, 253, -10 }, { 107, 255, -10 },
+  { 311, 101, -10 }, { 311, 233, -10 }, { 311, 283, -10 }, { 311, 234, -10 },
+  { 311, 235, -10 }, { 311, 279, -10 }, { 311, 232, -10 }, { 311, 275, -10 },
+  { 311, 281, -10 }, { 311, 111, -10 }, { 311, 243, -10 }, { 311, 244, -10 },
+  { 311, 246, -10 }, { 311, 242, -10 }, { 311, 337, -10 }, { 311, 333, -10 },
+  { 311, 248, -10 }, { 311, 245, -10 }, { 311, 121, -10 }, { 311, 253, -10 },
+  { 311, 255, -10 }, { 110, 118, -40 }, { 324, 118, -40 }, { 328, 118, -40 },
+  { 326, 118, -40 }, { 241, 118, -40 }, { 111, 103, -10 }, { 111, 287, -10 },
+  { 111, 291, -10 }, { 111, 118, -10 }, { 243, 103, -10 }, { 243, 287, -10 },
+  { 243, 291, -10 }, { 243, 118, -10 }, { 244, 103, -10 }, { 244, 287, -10 },
+  { 244, 291, -10 }, { 244, 118, -10 }, { 246, 103, -10 }, { 246, 287, -10 },
+  { 246, 291, -10 }, { 246, 118, -10 }, { 242, 103, -10 }, { 242, 287, -10 },
+  { 242, 291, -10 }, { 242, 118, -10 }, { 337, 103, -10 }, { 337, 287, -10 },
+  { 337, 291, -10 }, { 337, 118, -10 }, { 333, 103, -10 }, { 333, 287, -10 },
+  { 333, 291, -10 }, { 333, 118, -10 }, { 248, 103, -10 }, { 248, 287, -10 },
+  { 248, 291, -10 }, { 248, 118, -10 }, { 245, 103, -10 }, { 245, 287, -10 },
+  { 245, 291, -10 }, { 245, 118, -10 }, { 46, 416, -140 }, { 46, 418, -140 },
+  { 417, 417, -111 }, { 418, 100, -25 }, { 418, 273, -25 }, { 418, 418, -111 },
+  { 418, 114, -25 }, { 418, 341, -25 }, { 418, 345, -25 }, { 418, 343, -25 },
+  { 418, 115, -40 }, { 418, 347, -40 }, { 418, 353, -40 }, { 418, 351, -40 },
+  { 418, 422, -40 }, { 418, 32, -111 }, { 418, 116, -30 }, { 418, 424, -30 },
+  { 418, 118, -10 }, { 114, 97, -15 }, { 114, 225, -15 }, { 114, 259, -15 },
+  { 114, 226, -15 }, { 114, 228, -15 }, { 114, 224, -15 }, { 114, 257, -15 },
+  { 114, 261, -15 }, { 114, 229, -15 }, { 114, 227, -15 }, { 114, 99, -37 },
+  { 114, 263, -37 }, { 114, 269, -37 }, { 114, 231, -37 }, { 114, 44, -111 },
+  { 114, 100, -37 }, { 114, 273, -37 }, { 114, 101, -37 }, { 114, 233, -37 },
+  { 114, 283, -37 }, { 114, 234, -37 }, { 114, 235, -37 }, { 114, 279, -37 },
+  { 114, 232, -37 }, { 114, 275, -37 }, { 114, 281, -37 }, { 114, 103, -37 },
+  { 114, 287, -37 }, { 114, 291, -37 }, { 114, 45, -20 }, { 114, 111, -45 },
+  { 114, 243, -45 }, { 114, 244, -45 }, { 114, 246, -45 }, { 114, 242, -45 },
+  { 114, 337, -45 }, { 114, 333, -45 }, { 114, 248, -45 }, { 114, 245, -45 },
+  { 114, 46, -111 }, { 114, 113, -37 }, { 114, 115, -10 }, { 114, 347, -10 },
+  { 114, 353, -10 }, { 114, 351, -10 }, { 114, 422, -10 }, { 341, 97, -15 },
+  { 341, 225, -15 }, { 341, 259, -15 }, { 341, 226, -15 }, { 341, 228, -15 },
+  { 341, 224, -15 }, { 341, 257, -15 }, { 341, 261, -15 }, { 341, 229, -15 },
+  { 341, 227, -15 }, { 341, 99, -37 }, { 341, 263, -37 }, { 341, 269, -37 },
+  { 341, 231, -37 }, { 341, 44, -111 }, { 341, 100, -37 }, { 341, 273, -37 },
+  { 341, 101, -37 }, { 341, 233, -37 }, { 341, 283, -37 }, { 341, 234, -37 },
+  { 341, 235, -37 }, { 341, 279, -37 }, { 341, 232, -37 }, { 341, 275, -37 },
+  { 341, 281, -37 }, { 341, 103, -37 }, { 341, 287, -37 }, { 341, 291, -37 },
+  { 341, 45, -20 }, { 341, 111, -45 }, { 341, 243, -45 }, { 341, 244, -45 },
+  { 341, 246, -45 }, { 341, 242, -45 }, { 341, 337, -45 }, { 341, 333, -45 },
+  { 341, 248, -45 }, { 341, 245, -45 }, { 341, 46, -111 }, { 341, 113, -37 },
+  { 341, 115, -10 }, { 341, 347, -10 }, { 341, 353, -10 }, { 341, 351, -10 },
+  { 341, 422, -10 }, { 345, 97, -15 }, { 345, 225, -15 }, { 345, 259, -15 },
+  { 345, 226, -15 }, { 345, 228, -15 }, { 345, 224, -15 }, { 345, 257, -15 },
+  { 345, 261, -15 }, { 345, 229, -15 }, { 345, 227, -15 }, { 345, 99, -37 },
+  { 345, 263, -37 }, { 345, 269, -37 }, { 345, 231, -37 }, { 345, 44, -111 },
+  { 345, 100, -37 }, { 345, 273, -37 }, { 345, 101, -37 }, { 345, 233, -37 },
+  { 345, 283, -37 }, { 345, 234, -37 }, { 345, 235, -37 }, { 345, 279, -37 },
+  { 345, 232, -37 }, { 345, 275, -37 }, { 345, 281, -37 }, { 345, 103, -37 },
+  { 345, 287, -37 }, { 345, 291, -37 }, { 345, 45, -20 }, { 345, 111, -45 },
+  { 345, 243, -45 }, { 345, 244, -45 }, { 345, 246, -45 }, { 345, 242, -45 },
+  { 345, 337, -45 }, { 345, 333, -45 }, { 345, 248, -45 }, { 345, 245, -45 },
+  { 345, 46, -111 }, { 345, 113, -37 }, { 345, 115, -10 }, { 345, 347, -10 },
+  { 345, 353, -10 }, { 345, 351, -10 }, { 345, 422, -10 }, { 343, 97, -15 },
+  { 343, 225, -15 }, { 343, 259, -15 }, { 343, 226, -15 }, { 343, 228, -15 },
+  { 343, 224, -15 }, { 343, 257, -15 }, { 343, 261, -15 }, { 343, 229, -15 },
+  { 343, 227, -15 }, { 343, 99, -37 }, { 343, 263, -37 }, { 343, 269, -37 },
+  { 343, 231, -37 }, { 343, 44, -111 }, { 343, 100, -37 }, { 343, 273, -37 },
+  { 343, 101, -37 }, { 343, 233, -37 }, { 343, 283, -37 }, { 343, 234, -37 },
+  { 343, 235, -37 }, { 343, 279, -37 }, { 343, 232, -37 }, { 343, 275, -37 },
+  { 343, 281, -37 }, { 343, 103, -37 }, { 343, 287, -37 }, { 343, 291, -37 },
+  { 343, 45, -20 }, { 343, 111, -45 }, { 343, 243, -45 }, { 343, 244, -45 },
+  { 343, 246, -45 }, { 343, 242, -45 }, { 343, 337, -45 }, { 343, 333, -45 },
+  { 343, 248, -45 }, { 343, 245, -45 }, { 343, 46, -111 }, { 343, 113, -37 },
+  { 343, 115, -10 }, { 343, 347, -10 }, { 343, 353, -10 }, { 343, 351, -10 },
+  { 343, 422, -10 }, { 32, 65, -18 }, { 32, 193, -18 }, { 32, 258, -18 },
+  { 32, 194, -18 }, { 32, 196, -18 }, { 32, 192, -18 }, { 32, 256, -18 },
+  { 32, 260, -18 }, { 32, 197, -18 }, { 32, 195, -18 }, { 32, 84, -18 },
+  { 32, 356, -18 }, { 32, 387, -18 }, { 32, 86, -35 }, { 32, 87, -40 },
+  { 32, 89, -75 }, { 32, 221, -75 }, { 32, 376, -75 }, { 118, 44, -74 },
+  { 118, 46, -74 }, { 119, 44, -74 }, { 119, 46, -74 }, { 121, 44, -55 },
+  { 121, 46, -55 }, { 253, 44, -55 }, { 253, 46, -55 }, { 255, 44, -55 },
+  { 255, 46, -55 } };
+
+static const fontbuilthighstr high_5[] = {
+  { "\306\222", 16 },
+  { "\310\230", 2 },
+  { "\310\231", 38 },
+  { "\310\232", 3 },
+  { "\310\233", 40 },
+  { "\314\202", 6 },
+  { "\314\203", 41 },
+  { "\314\206", 4 },
+  { "\314\207", 10 },
+  { "\314\212", 37 },
+  { "\314\213", 21 },
+  { "\314\214", 5 },
+  { "\314\246", 7 },
+  { "\314\250", 26 },
+  { "\316\224", 0 },
+  { "\342\200\223", 13 },
+  { "\342\200\224", 12 },
+  { "\342\200\230", 33 },
+  { "\342\200\231", 34 },
+  { "\342\200\232", 35 },
+  { "\342\200\234", 31 },
+  { "\342\200\235", 32 },
+  { "\342\200\236", 30 },
+  { "\342\200\240", 8 },
+  { "\342\200\241", 9 },
+  { "\342\200\246", 11 },
+  { "\342\200\247", 28 },
+  { "\342\200\261", 29 },
+  { "\342\200\271", 19 },
+  { "\342\200\272", 20 },
+  { "\342\201\204", 17 },
+  { "\342\202\254", 1 },
+  { "\342\204\242", 42 },
+  { "\342\210\202", 27 },
+  { "\342\210\221", 39 },
+  { "\342\210\222", 24 },
+  { "\342\210\232", 36 },
+  { "\342\210\236", 43 },
+  { "\342\211\240", 25 },
+  { "\342\211\244", 22 },
+  { "\342\211\245", 18 },
+  { "\342\227\212", 23 },
+  { "\357\254\201", 14 },
+  { "\357\254\202", 15 },
+  };
+
+/* Times-Roman */
+
+static const int32_t widths_6[] = {
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 250, 333, 408, 500, 500, 833, 778, 180,
+  333, 333, 500, 564, 250, 333, 250, 278, 500, 500,
+  500, 500, 500, 500, 500, 500, 500, 500, 278, 278,
+  564, 564, 564, 444, 921, 722, 667, 667, 722, 611,
+  556, 722, 722, 333, 389, 722, 611, 889, 722, 722,
+  556, 722, 667, 556, 611, 722, 722, 944, 722, 722,
+  611, 333, 278, 333, 469, 500, 333, 444, 500, 444,
+  500, 444, 333, 500, 500, 278, 278, 500, 278, 778,
+  500, 500, 500, 500, 333, 389, 278, 500, 500, 722,
+  500, 500, 444, 480, 200, 480, 541, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  250, 333, 500, 500, 500, 500, 200, 500, 333, 760,
+  276, 500, 564, 333, 760, 333, 400, 564, 300, 300,
+  333, 500, 453, 350, 333, 300, 310, 500, 750, 750,
+  750, 444, 722, 722, 722, 722, 722, 722, 889, 667,
+  611, 611, 611, 611, 333, 333, 333, 333, 722, 722,
+  722, 722, 722, 722, 722, 564, 722, 722, 722, 722,
+  722, 722, 556, 500, 444, 444, 444, 444, 444, 444,
+  667, 444, 444, 444, 444, 444, 278, 278, 278, 278,
+  500, 500, 500, 500, 500, 500, 500, 564, 500, 500,
+  500, 500, 500, 500, 500, 500, 722, 444, 722, 444,
+  722, 444, 667, 444, 667, 444, 667, 444, 667, 444,
+  722, 608, 722, 500, 611, 444, 611, 444, 611, 444,
+  611, 444, 611, 444, 722, 500, 722, 500, 722, 500,
+  722, 500, 722, 500, 722, 500, 333, 278, 333, 278,
+  333, 278, 333, 278, 333, 278, 727, 552, 389, 278,
+  722, 500, 500, 611, 278, 611, 278, 611, 378, 611,
+  344, 611, 278, 722, 500, 722, 500, 722, 500, 604,
+  722, 500, 722, 500, 722, 500, 722, 500, 889, 722,
+  667, 333, 667, 333, 667, 333, 556, 389, 556, 389,
+  556, 389, 556, 389, 611, 278, 611, 389, 611, 278,
+  722, 500, 722, 500, 722, 500, 722, 500, 722, 500,
+  722, 500, 944, 722, 722, 500, 722, 611, 444, 611,
+  444, 611, 444, 278, 667, 500, 556, 611, 333, 333,
+  333, 250, 500, 500, 333, 1000, 1000, 500, 556, 556,
+  500, 167, 1000, 333, 333, 333, 1000, 574, 564, 1000,
+  333, 500, 250, 1000, 444, 444, 444, 333, 333, 333,
+  722, 333, 389, 1000, 278, 333, 980, 1000, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1 };
+
+static const int32_t r2ladjusts_6[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 368, 408, 501, 501, 833, 792, 181,
+  352, 314, 501, 564, 251, 324, 251, 278, 500, 505,
+  505, 474, 484, 470, 502, 469, 501, 489, 273, 299,
+  564, 564, 564, 482, 925, 721, 610, 661, 701, 609,
+  558, 741, 721, 333, 380, 757, 610, 875, 719, 722,
+  558, 735, 676, 533, 610, 719, 713, 937, 714, 725,
+  606, 387, 278, 279, 470, 500, 261, 479, 471, 437,
+  518, 449, 403, 498, 496, 269, 124, 512, 276, 791,
+  501, 499, 475, 512, 340, 399, 292, 488, 496, 715,
+  496, 489, 445, 450, 200, 510, 542, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 302, 501, 502, 500, 459, 200, 496, 333, 760,
+  274, 498, 564, 0, 760, 333, 400, 564, 297, 306,
+  410, 548, 428, 350, 313, 305, 310, 502, 755, 777,
+  733, 406, 721, 721, 721, 721, 721, 721, 863, 661,
+  609, 609, 609, 609, 333, 335, 333, 333, 701, 719,
+  722, 722, 722, 722, 722, 565, 722, 719, 719, 719,
+  719, 725, 558, 480, 479, 479, 479, 479, 479, 479,
+  670, 437, 449, 449, 449, 449, 245, 306, 279, 279,
+  500, 501, 499, 499, 499, 499, 499, 564, 499, 488,
+  488, 488, 488, 489, 475, 489, 721, 479, 721, 479,
+  753, 506, 661, 438, 661, 437, 661, 437, 661, 437,
+  701, 616, 701, 527, 609, 449, 609, 449, 609, 449,
+  609, 449, 609, 449, 741, 498, 741, 498, 741, 498,
+  741, 498, 707, 495, 721, 544, 322, 270, 333, 277,
+  321, 269, 333, 281, 333, 269, 685, 396, 380, 225,
+  757, 512, 497, 610, 309, 610, 276, 610, 366, 610,
+  384, 610, 278, 719, 501, 719, 501, 719, 501, 605,
+  719, 440, 722, 499, 722, 499, 722, 520, 915, 720,
+  676, 340, 676, 340, 676, 340, 533, 399, 533, 399,
+  533, 399, 533, 389, 610, 292, 610, 331, 610, 282,
+  719, 488, 719, 488, 719, 488, 719, 488, 719, 510,
+  719, 496, 937, 715, 725, 489, 725, 606, 445, 606,
+  445, 606, 445, 403, 614, 0, 533, 610, 333, 333,
+  333, 243, 501, 500, 334, 999, 1000, 500, 552, 553,
+  497, 163, 549, 348, 318, 374, 549, 472, 564, 549,
+  305, 476, 251, 1001, 461, 457, 431, 369, 297, 297,
+  454, 333, 399, 600, 292, 332, 987, 678, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0 };
+
+static const kerntablestr kerns_6[] = {
+  { 65, 67, -40 }, { 65, 262, -40 }, { 65, 268, -40 }, { 65, 199, -40 },
+  { 65, 71, -40 }, { 65, 286, -40 }, { 65, 290, -40 }, { 65, 79, -55 },
+  { 65, 211, -55 }, { 65, 212, -55 }, { 65, 214, -55 }, { 65, 210, -55 },
+  { 65, 336, -55 }, { 65, 332, -55 }, { 65, 216, -55 }, { 65, 213, -55 },
+  { 65, 81, -55 }, { 65, 84, -111 }, { 65, 356, -111 }, { 65, 387, -111 },
+  { 65, 85, -55 }, { 65, 218, -55 }, { 65, 219, -55 }, { 65, 220, -55 },
+  { 65, 217, -55 }, { 65, 368, -55 }, { 65, 362, -55 }, { 65, 370, -55 },
+  { 65, 366, -55 }, { 65, 86, -135 }, { 65, 87, -90 }, { 65, 89, -105 },
+  { 65, 221, -105 }, { 65, 376, -105 }, { 65, 418, -111 }, { 65, 118, -74 },
+  { 65, 119, -92 }, { 65, 121, -92 }, { 65, 253, -92 }, { 65, 255, -92 },
+  { 193, 67, -40 }, { 193, 262, -40 }, { 193, 268, -40 }, { 193, 199, -40 },
+  { 193, 71, -40 }, { 193, 286, -40 }, { 193, 290, -40 }, { 193, 79, -55 },
+  { 193, 211, -55 }, { 193, 212, -55 }, { 193, 214, -55 }, { 193, 210, -55 },
+  { 193, 336, -55 }, { 193, 332, -55 }, { 193, 216, -55 }, { 193, 213, -55 },
+  { 193, 81, -55 }, { 193, 84, -111 }, { 193, 356, -111 }, { 193, 387, -111 },
+  { 193, 85, -55 }, { 193, 218, -55 }, { 193, 219, -55 }, { 193, 220, -55 },
+  { 193, 217, -55 }, { 193, 368, -55 }, { 193, 362, -55 }, { 193, 370, -55 },
+  { 193, 366, -55 }, { 193, 86, -135 }, { 193, 87, -90 }, { 193, 89, -105 },
+  { 193, 221, -105 }, { 193, 376, -105 }, { 193, 418, -111 }, { 193, 118, -74 },
+  { 193, 119, -92 }, { 193, 121, -92 }, { 193, 253, -92 }, { 193, 255, -92 },
+  { 258, 67, -40 }, { 258, 262, -40 }, { 258, 268, -40 }, { 258, 199, -40 },
+  { 258, 71, -40 }, { 258, 286, -40 }, { 258, 290, -40 }, { 258, 79, -55 },
+  { 258, 211, -55 }, { 258, 212, -55 }, { 258, 214, -55 }, { 258, 210, -55 },
+  { 258, 336, -55 }, { 258, 332, -55 }, { 258, 216, -55 }, { 258, 213, -55 },
+  { 258, 81, -55 }, { 258, 84, -111 }, { 258, 356, -111 }, { 258, 387, -111 },
+  { 258, 85, -55 }, { 258, 218, -55 }, { 258, 219, -55 }, { 258, 220, -55 },
+  { 258, 217, -55 }, { 258, 368, -55 }, { 258, 362, -55 }, { 258, 370, -55 },
+  { 258, 366, -55 }, { 258, 86, -135 }, { 258, 87, -90 }, { 258, 89, -105 },
+  { 258, 221, -105 }, { 258, 376, -105 }, { 258, 418, -111 }, { 258, 118, -74 },
+  { 258, 119, -92 }, { 258, 121, -92 }, { 258, 253, -92 }, { 258, 255, -92 },
+  { 194, 67, -40 }, { 194, 262, -40 }, { 194, 268, -40 }, { 194, 199, -40 },
+  { 194, 71, -40 }, { 194, 286, -40 }, { 194, 290, -40 }, { 194, 79, -55 },
+  { 194, 211, -55 }, { 194, 212, -55 }, { 194, 214, -55 }, { 194, 210, -55 },
+  { 194, 336, -55 }, { 194, 332, -55 }, { 194, 216, -55 }, { 194, 213, -55 },
+  { 194, 81, -55 }, { 194, 84, -111 }, { 194, 356, -111 }, { 194, 387, -111 },
+  { 194, 85, -55 }, { 194, 218, -55 }, { 194, 219, -55 }, { 194, 220, -55 },
+  { 194, 217, -55 }, { 194, 368, -55 }, { 194, 362, -55 }, { 194, 370, -55 },
+  { 194, 366, -55 }, { 194, 86, -135 }, { 194, 87, -90 }, { 194, 89, -105 },
+  { 194, 221, -105 }, { 194, 376, -105 }, { 194, 418, -111 }, { 194, 118, -74 },
+  { 194, 119, -92 }, { 194, 121, -92 }, { 194, 253, -92 }, { 194, 255, -92 },
+  { 196, 67, -40 }, { 196, 262, -40 }, { 196, 268, -40 }, { 196, 199, -40 },
+  { 196, 71, -40 }, { 196, 286, -40 }, { 196, 290, -40 }, { 196, 79, -55 },
+  { 196, 211, -55 }, { 196, 212, -55 }, { 196, 214, -55 }, { 196, 210, -55 },
+  { 196, 336, -55 }, { 196, 332, -55 }, { 196, 216, -55 }, { 196, 213, -55 },
+  { 196, 81, -55 }, { 196, 84, -111 }, { 196, 356, -111 }, { 196, 387, -111 },
+  { 196, 85, -55 }, { 196, 218, -55 }, { 196, 219, -55 }, { 196, 220, -55 },
+  { 196, 217, -55 }, { 196, 368, -55 }, { 196, 362, -55 }, { 196, 370, -55 },
+  { 196, 366, -55 }, { 196, 86, -135 }, { 196, 87, -90 }, { 196, 89, -105 },
+  { 196, 221, -105 }, { 196, 376, -105 }, { 196, 418, -111 }, { 196, 118, -74 },
+  { 196, 119, -92 }, { 196, 121, -92 }, { 196, 253, -92 }, { 196, 255, -92 },
+  { 192, 67, -40 }, { 192, 262, -40 }, { 192, 268, -40 }, { 192, 199, -40 },
+  { 192, 71, -40 }, { 192, 286, -40 }, { 192, 290, -40 }, { 192, 79, -55 },
+  { 192, 211, -55 }, { 192, 212, -55 }, { 192, 214, -55 }, { 192, 210, -55 },
+  { 192, 336, -55 }, { 192, 332, -55 }, { 192, 216, -55 }, { 192, 213, -55 },
+  { 192, 81, -55 }, { 192, 84, -111 }, { 192, 356, -111 }, { 192, 387, -111 },
+  { 192, 85, -55 }, { 192, 218, -55 }, { 192, 219, -55 }, { 192, 220, -55 },
+  { 192, 217, -55 }, { 192, 368, -55 }, { 192, 362, -55 }, { 192, 370, -55 },
+  { 192, 366, -55 }, { 192, 86, -135 }, { 192, 87, -90 }, { 192, 89, -105 },
+  { 192, 221, -105 }, { 192, 376, -105 }, { 192, 418, -111 }, { 192, 118, -74 },
+  { 192, 119, -92 }, { 192, 121, -92 }, { 192, 253, -92 }, { 192, 255, -92 },
+  { 256, 67, -40 }, { 256, 262, -40 }, { 256, 268, -40 }, { 256, 199, -40 },
+  { 256, 71, -40 }, { 256, 286, -40 }, { 256, 290, -40 }, { 256, 79, -55 },
+  { 256, 211, -55 }, { 256, 212, -55 }, { 256, 214, -55 }, { 256, 210, -55 },
+  { 256, 336, -55 }, { 256, 332, -55 }, { 256, 216, -55 }, { 256, 213, -55 },
+  { 256, 81, -55 }, { 256, 84, -111 }, { 256, 356, -111 }, { 256, 387, -111 },
+  { 256, 85, -55 }, { 256, 218, -55 }, { 256, 219, -55 }, { 256, 220, -55 },
+  { 256, 217, -55 }, { 256, 368, -55 }, { 256, 362, -55 }, { 256, 370, -55 },
+  { 256, 366, -55 }, { 256, 86, -135 }, { 256, 87, -90 }, { 256, 89, -105 },
+  { 256, 221, -105 }, { 256, 376, -105 }, { 256, 418, -111 }, { 256, 118, -74 },
+  { 256, 119, -92 }, { 256, 121, -92 }, { 256, 253, -92 }, { 256, 255, -92 },
+  { 260, 67, -40 }, { 260, 262, -40 }, { 260, 268, -40 }, { 260, 199, -40 },
+  { 260, 71, -40 }, { 260, 286, -40 }, { 260, 290, -40 }, { 260, 79, -55 },
+  { 260, 211, -55 }, { 260, 212, -55 }, { 260, 214, -55 }, { 260, 210, -55 },
+  { 260, 336, -55 }, { 260, 332, -55 }, { 260, 216, -55 }, { 260, 213, -55 },
+  { 260, 81, -55 }, { 260, 84, -111 }, { 260, 356, -111 }, { 260, 387, -111 },
+  { 260, 85, -55 }, { 260, 218, -55 }, { 260, 219, -55 }, { 260, 220, -55 },
+  { 260, 217, -55 }, { 260, 368, -55 }, { 260, 362, -55 }, { 260, 370, -55 },
+  { 260, 366, -55 }, { 260, 86, -135 }, { 260, 87, -90 }, { 260, 89, -105 },
+  { 260, 221, -105 }, { 260, 376, -105 }, { 260, 418, -111 }, { 260, 118, -74 },
+  { 260, 119, -52 }, { 260, 121, -52 }, { 260, 253, -52 }, { 260, 255, -52 },
+  { 197, 67, -40 }, { 197, 262, -40 }, { 197, 268, -40 }, { 197, 199, -40 },
+  { 197, 71, -40 }, { 197, 286, -40 }, { 197, 290, -40 }, { 197, 79, -55 },
+  { 197, 211, -55 }, { 197, 212, -55 }, { 197, 214, -55 }, { 197, 210, -55 },
+  { 197, 336, -55 }, { 197, 332, -55 }, { 197, 216, -55 }, { 197, 213, -55 },
+  { 197, 81, -55 }, { 197, 84, -111 }, { 197, 356, -111 }, { 197, 387, -111 },
+  { 197, 85, -55 }, { 197, 218, -55 }, { 197, 219, -55 }, { 197, 220, -55 },
+  { 197, 217, -55 }, { 197, 368, -55 }, { 197, 362, -55 }, { 197, 370, -55 },
+  { 197, 366, -55 }, { 197, 86, -135 }, { 197, 87, -90 }, { 197, 89, -105 },
+  { 197, 221, -105 }, { 197, 376, -105 }, { 197, 418, -111 }, { 197, 118, -74 },
+  { 197, 119, -92 }, { 197, 121, -92 }, { 197, 253, -92 }, { 197, 255, -92 },
+  { 195, 67, -40 }, { 195, 262, -40 }, { 195, 268, -40 }, { 195, 199, -40 },
+  { 195, 71, -40 }, { 195, 286, -40 }, { 195, 290, -40 }, { 195, 79, -55 },
+  { 195, 211, -55 }, { 195, 212, -55 }, { 195, 214, -55 }, { 195, 210, -55 },
+  { 195, 336, -55 }, { 195, 332, -55 }, { 195, 216, -55 }, { 195, 213, -55 },
+  { 195, 81, -55 }, { 195, 84, -111 }, { 195, 356, -111 }, { 195, 387, -111 },
+  { 195, 85, -55 }, { 195, 218, -55 }, { 195, 219, -55 }, { 195, 220, -55 },
+  { 195, 217, -55 }, { 195, 368, -55 }, { 195, 362, -55 }, { 195, 370, -55 },
+  { 195, 366, -55 }, { 195, 86, -135 }, { 195, 87, -90 }, { 195, 89, -105 },
+  { 195, 221, -105 }, { 195, 376, -105 }, { 195, 418, -111 }, { 195, 118, -74 },
+  { 195, 119, -92 }, { 195, 121, -92 }, { 195, 253, -92 }, { 195, 255, -92 },
+  { 66, 65, -35 }, { 66, 193, -35 }, { 66, 258, -35 }, { 66, 194, -35 },
+  { 66, 196, -35 }, { 66, 192, -35 }, { 66, 256, -35 }, { 66, 260, -35 },
+  { 66, 197, -35 }, { 66, 195, -35 }, { 66, 85, -10 }, { 66, 218, -10 },
+  { 66, 219, -10 }, { 66, 220, -10 }, { 66, 217, -10 }, { 66, 368, -10 },
+  { 66, 362, -10 }, { 66, 370, -10 }, { 66, 366, -10 }, { 68, 65, -40 },
+  { 68, 193, -40 }, { 68, 258, -40 }, { 68, 194, -40 }, { 68, 196, -40 },
+  { 68, 192, -40 }, { 68, 256, -40 }, { 68, 260, -40 }, { 68, 197, -40 },
+  { 68, 195, -40 }, { 68, 86, -40 }, { 68, 87, -30 }, { 68, 89, -55 },
+  { 68, 221, -55 }, { 68, 376, -55 }, { 270, 65, -40 }, { 270, 193, -40 },
+  { 270, 258, -40 }, { 270, 194, -40 }, { 270, 196, -40 }, { 270, 192, -40 },
+  { 270, 256, -40 }, { 270, 260, -40 }, { 270, 197, -40 }, { 270, 195, -40 },
+  { 270, 86, -40 }, { 270, 87, -30 }, { 270, 89, -55 }, { 270, 221, -55 },
+  { 270, 376, -55 }, { 272, 65, -40 }, { 272, 193, -40 }, { 272, 258, -40 },
+  { 272, 194, -40 }, { 272, 196, -40 }, { 272, 192, -40 }, { 272, 256, -40 },
+  { 272, 260, -40 }, { 272, 197, -40 }, { 272, 195, -40 }, { 272, 86, -40 },
+  { 272, 87, -30 }, { 272, 89, -55 }, { 272, 221, -55 }, { 272, 376, -55 },
+  { 70, 65, -74 }, { 70, 193, -74 }, { 70, 258, -74 }, { 70, 194, -74 },
+  { 70, 196, -74 }, { 70, 192, -74 }, { 70, 256, -74 }, { 70, 260, -74 },
+  { 70, 197, -74 }, { 70, 195, -74 }, { 70, 97, -15 }, { 70, 225, -15 },
+  { 70, 259, -15 }, { 70, 226, -15 }, { 70, 228, -15 }, { 70, 224, -15 },
+  { 70, 257, -15 }, { 70, 261, -15 }, { 70, 229, -15 }, { 70, 227, -15 },
+  { 70, 44, -80 }, { 70, 111, -15 }, { 70, 243, -15 }, { 70, 244, -15 },
+  { 70, 246, -15 }, { 70, 242, -15 }, { 70, 337, -15 }, { 70, 333, -15 },
+  { 70, 248, -15 }, { 70, 245, -15 }, { 70, 46, -80 }, { 74, 65, -60 },
+  { 74, 193, -60 }, { 74, 258, -60 }, { 74, 194, -60 }, { 74, 196, -60 },
+  { 74, 192, -60 }, { 74, 256, -60 }, { 74, 260, -60 }, { 74, 197, -60 },
+  { 74, 195, -60 }, { 75, 79, -30 }, { 75, 211, -30 }, { 75, 212, -30 },
+  { 75, 214, -30 }, { 75, 210, -30 }, { 75, 336, -30 }, { 75, 332, -30 },
+  { 75, 216, -30 }, { 75, 213, -30 }, { 75, 101, -25 }, { 75, 233, -25 },
+  { 75, 283, -25 }, { 75, 234, -25 }, { 75, 235, -25 }, { 75, 279, -25 },
+  { 75, 232, -25 }, { 75, 275, -25 }, { 75, 281, -25 }, { 75, 111, -35 },
+  { 75, 243, -35 }, { 75, 244, -35 }, { 75, 246, -35 }, { 75, 242, -35 },
+  { 75, 337, -35 }, { 75, 333, -35 }, { 75, 248, -35 }, { 75, 245, -35 },
+  { 75, 117, -15 }, { 75, 250, -15 }, { 75, 251, -15 }, { 75, 252, -15 },
+  { 75, 249, -15 }, { 75, 369, -15 }, { 75, 363, -15 }, { 75, 371, -15 },
+  { 75, 367, -15 }, { 75, 121, -25 }, { 75, 253, -25 }, { 75, 255, -25 },
+  { 310, 79, -30 }, { 310, 211, -30 }, { 310, 212, -30 }, { 310, 214, -30 },
+  { 310, 210, -30 }, { 310, 336, -30 }, { 310, 332, -30 }, { 310, 216, -30 },
+  { 310, 213, -30 }, { 310, 101, -25 }, { 310, 233, -25 }, { 310, 283, -25 },
+  { 310, 234, -25 }, { 310, 235, -25 }, { 310, 279, -25 }, { 310, 232, -25 },
+  { 310, 275, -25 }, { 310, 281, -25 }, { 310, 111, -35 }, { 310, 243, -35 },
+  { 310, 244, -35 }, { 310, 246, -35 }, { 310, 242, -35 }, { 310, 337, -35 },
+  { 310, 333, -35 }, { 310, 248, -35 }, { 310, 245, -35 }, { 310, 117, -15 },
+  { 310, 250, -15 }, { 310, 251, -15 }, { 310, 252, -15 }, { 310, 249, -15 },
+  { 310, 369, -15 }, { 310, 363, -15 }, { 310, 371, -15 }, { 310, 367, -15 },
+  { 310, 121, -25 }, { 310, 253, -25 }, { 310, 255, -25 }, { 76, 84, -92 },
+  { 76, 356, -92 }, { 76, 387, -92 }, { 76, 86, -100 }, { 76, 87, -74 },
+  { 76, 89, -100 }, { 76, 221, -100 }, { 76, 376, -100 }, { 76, 418, -92 },
+  { 76, 121, -55 }, { 76, 253, -55 }, { 76, 255, -55 }, { 313, 84, -92 },
+  { 313, 356, -92 }, { 313, 387, -92 }, { 313, 86, -100 }, { 313, 87, -74 },
+  { 313, 89, -100 }, { 313, 221, -100 }, { 313, 376, -100 }, { 313, 418, -92 },
+  { 313, 121, -55 }, { 313, 253, -55 }, { 313, 255, -55 }, { 317, 418, -92 },
+  { 317, 121, -55 }, { 317, 253, -55 }, { 317, 255, -55 }, { 315, 84, -92 },
+  { 315, 356, -92 }, { 315, 387, -92 }, { 315, 86, -100 }, { 315, 87, -74 },
+  { 315, 89, -100 }, { 315, 221, -100 }, { 315, 376, -100 }, { 315, 418, -92 },
+  { 315, 121, -55 }, { 315, 253, -55 }, { 315, 255, -55 }, { 321, 84, -92 },
+  { 321, 356, -92 }, { 321, 387, -92 }, { 321, 86, -100 }, { 321, 87, -74 },
+  { 321, 89, -100 }, { 321, 221, -100 }, { 321, 376, -100 }, { 321, 418, -92 },
+  { 321, 121, -55 }, { 321, 253, -55 }, { 321, 255, -55 }, { 78, 65, -35 },
+  { 78, 193, -35 }, { 78, 258, -35 }, { 78, 194, -35 }, { 78, 196, -35 },
+  { 78, 192, -35 }, { 78, 256, -35 }, { 78, 260, -35 }, { 78, 197, -35 },
+  { 78, 195, -35 }, { 323, 65, -35 }, { 323, 193, -35 }, { 323, 258, -35 },
+  { 323, 194, -35 }, { 323, 196, -35 }, { 323, 192, -35 }, { 323, 256, -35 },
+  { 323, 260, -35 }, { 323, 197, -35 }, { 323, 195, -35 }, { 327, 65, -35 },
+  { 327, 193, -35 }, { 327, 258, -35 }, { 327, 194, -35 }, { 327, 196, -35 },
+  { 327, 192, -35 }, { 327, 256, -35 }, { 327, 260, -35 }, { 327, 197, -35 },
+  { 327, 195, -35 }, { 325, 65, -35 }, { 325, 193, -35 }, { 325, 258, -35 },
+  { 325, 194, -35 }, { 325, 196, -35 }, { 325, 192, -35 }, { 325, 256, -35 },
+  { 325, 260, -35 }, { 325, 197, -35 }, { 325, 195, -35 }, { 209, 65, -35 },
+  { 209, 193, -35 }, { 209, 258, -35 }, { 209, 194, -35 }, { 209, 196, -35 },
+  { 209, 192, -35 }, { 209, 256, -35 }, { 209, 260, -35 }, { 209, 197, -35 },
+  { 209, 195, -35 }, { 79, 65, -35 }, { 79, 193, -35 }, { 79, 258, -35 },
+  { 79, 194, -35 }, { 79, 196, -35 }, { 79, 192, -35 }, { 79, 256, -35 },
+  { 79, 260, -35 }, { 79, 197, -35 }, { 79, 195, -35 }, { 79, 84, -40 },
+  { 79, 356, -40 }, { 79, 387, -40 }, { 79, 86, -50 }, { 79, 87, -35 },
+  { 79, 88, -40 }, { 79, 89, -50 }, { 79, 221, -50 }, { 79, 376, -50 },
+  { 211, 65, -35 }, { 211, 193, -35 }, { 211, 258, -35 }, { 211, 194, -35 },
+  { 211, 196, -35 }, { 211, 192, -35 }, { 211, 256, -35 }, { 211, 260, -35 },
+  { 211, 197, -35 }, { 211, 195, -35 }, { 211, 84, -40 }, { 211, 356, -40 },
+  { 211, 387, -40 }, { 211, 86, -50 }, { 211, 87, -35 }, { 211, 88, -40 },
+  { 211, 89, -50 }, { 211, 221, -50 }, { 211, 376, -50 }, { 212, 65, -35 },
+  { 212, 193, -35 }, { 212, 258, -35 }, { 212, 194, -35 }, { 212, 196, -35 },
+  { 212, 192, -35 }, { 212, 256, -35 }, { 212, 260, -35 }, { 212, 197, -35 },
+  { 212, 195, -35 }, { 212, 84, -40 }, { 212, 356, -40 }, { 212, 387, -40 },
+  { 212, 86, -50 }, { 212, 87, -35 }, { 212, 88, -40 }, { 212, 89, -50 },
+  { 212, 221, -50 }, { 212, 376, -50 }, { 214, 65, -35 }, { 214, 193, -35 },
+  { 214, 258, -35 }, { 214, 194, -35 }, { 214, 196, -35 }, { 214, 192, -35 },
+  { 214, 256, -35 }, { 214, 260, -35 }, { 214, 197, -35 }, { 214, 195, -35 },
+  { 214, 84, -40 }, { 214, 356, -40 }, { 214, 387, -40 }, { 214, 86, -50 },
+  { 214, 87, -35 }, { 214, 88, -40 }, { 214, 89, -50 }, { 214, 221, -50 },
+  { 214, 376, -50 }, { 210, 65, -35 }, { 210, 193, -35 }, { 210, 258, -35 },
+  { 210, 194, -35 }, { 210, 196, -35 }, { 210, 192, -35 }, { 210, 256, -35 },
+  { 210, 260, -35 }, { 210, 197, -35 }, { 210, 195, -35 }, { 210, 84, -40 },
+  { 210, 356, -40 }, { 210, 387, -40 }, { 210, 86, -50 }, { 210, 87, -35 },
+  { 210, 88, -40 }, { 210, 89, -50 }, { 210, 221, -50 }, { 210, 376, -50 },
+  { 336, 65, -35 }, { 336, 193, -35 }, { 336, 258, -35 }, { 336, 194, -35 },
+  { 336, 196, -35 }, { 336, 192, -35 }, { 336, 256, -35 }, { 336, 260, -35 },
+  { 336, 197, -35 }, { 336, 195, -35 }, { 336, 84, -40 }, { 336, 356, -40 },
+  { 336, 387, -40 }, { 336, 86, -50 }, { 336, 87, -35 }, { 336, 88, -40 },
+  { 336, 89, -50 }, { 336, 221, -50 }, { 336, 376, -50 }, { 332, 65, -35 },
+  { 332, 193, -35 }, { 332, 258, -35 }, { 332, 194, -35 }, { 332, 196, -35 },
+  { 332, 192, -35 }, { 332, 256, -35 }, { 332, 260, -35 }, { 332, 197, -35 },
+  { 332, 195, -35 }, { 332, 84, -40 }, { 332, 356, -40 }, { 332, 387, -40 },
+  { 332, 86, -50 }, { 332, 87, -35 }, { 332, 88, -40 }, { 332, 89, -50 },
+  { 332, 221, -50 }, { 332, 376, -50 }, { 216, 65, -35 }, { 216, 193, -35 },
+  { 216, 258, -35 }, { 216, 194, -35 }, { 216, 196, -35 }, { 216, 192, -35 },
+  { 216, 256, -35 }, { 216, 260, -35 }, { 216, 197, -35 }, { 216, 195, -35 },
+  { 216, 84, -40 }, { 216, 356, -40 }, { 216, 387, -40 }, { 216, 86, -50 },
+  { 216, 87, -35 }, { 216, 88, -40 }, { 216, 89, -50 }, { 216, 221, -50 },
+  { 216, 376, -50 }, { 213, 65, -35 }, { 213, 193, -35 }, { 213, 258, -35 },
+  { 213, 194, -35 }, { 213, 196, -35 }, { 213, 192, -35 }, { 213, 256, -35 },
+  { 213, 260, -35 }, { 213, 197, -35 }, { 213, 195, -35 }, { 213, 84, -40 },
+  { 213, 356, -40 }, { 213, 387, -40 }, { 213, 86, -50 }, { 213, 87, -35 },
+  { 213, 88, -40 }, { 213, 89, -50 }, { 213, 221, -50 }, { 213, 376, -50 },
+  { 80, 65, -92 }, { 80, 193, -92 }, { 80, 258, -92 }, { 80, 194, -92 },
+  { 80, 196, -92 }, { 80, 192, -92 }, { 80, 256, -92 }, { 80, 260, -92 },
+  { 80, 197, -92 }, { 80, 195, -92 }, { 80, 97, -15 }, { 80, 225, -15 },
+  { 80, 259, -15 }, { 80, 226, -15 }, { 80, 228, -15 }, { 80, 224, -15 },
+  { 80, 257, -15 }, { 80, 261, -15 }, { 80, 229, -15 }, { 80, 227, -15 },
+  { 80, 44, -111 }, { 80, 46, -111 }, { 81, 85, -10 }, { 81, 218, -10 },
+  { 81, 219, -10 }, { 81, 220, -10 }, { 81, 217, -10 }, { 81, 368, -10 },
+  { 81, 362, -10 }, { 81, 370, -10 }, { 81, 366, -10 }, { 82, 79, -40 },
+  { 82, 211, -40 }, { 82, 212, -40 }, { 82, 214, -40 }, { 82, 210, -40 },
+  { 82, 336, -40 }, { 82, 332, -40 }, { 82, 216, -40 }, { 82, 213, -40 },
+  { 82, 84, -60 }, { 82, 356, -60 }, { 82, 387, -60 }, { 82, 85, -40 },
+  { 82, 218, -40 }, { 82, 219, -40 }, { 82, 220, -40 }, { 82, 217, -40 },
+  { 82, 368, -40 }, { 82, 362, -40 }, { 82, 370, -40 }, { 82, 366, -40 },
+  { 82, 86, -80 }, { 82, 87, -55 }, { 82, 89, -65 }, { 82, 221, -65 },
+  { 82, 376, -65 }, { 340, 79, -40 }, { 340, 211, -40 }, { 340, 212, -40 },
+  { 340, 214, -40 }, { 340, 210, -40 }, { 340, 336, -40 }, { 340, 332, -40 },
+  { 340, 216, -40 }, { 340, 213, -40 }, { 340, 84, -60 }, { 340, 356, -60 },
+  { 340, 387, -60 }, { 340, 85, -40 }, { 340, 218, -40 }, { 340, 219, -40 },
+  { 340, 220, -40 }, { 340, 217, -40 }, { 340, 368, -40 }, { 340, 362, -40 },
+  { 340, 370, -40 }, { 340, 366, -40 }, { 340, 86, -80 }, { 340, 87, -55 },
+  { 340, 89, -65 }, { 340, 221, -65 }, { 340, 376, -65 }, { 344, 79, -40 },
+  { 344, 211, -40 }, { 344, 212, -40 }, { 344, 214, -40 }, { 344, 210, -40 },
+  { 344, 336, -40 }, { 344, 332, -40 }, { 344, 216, -40 }, { 344, 213, -40 },
+  { 344, 84, -60 }, { 344, 356, -60 }, { 344, 387, -60 }, { 344, 85, -40 },
+  { 344, 218, -40 }, { 344, 219, -40 }, { 344, 220, -40 }, { 344, 217, -40 },
+  { 344, 368, -40 }, { 344, 362, -40 }, { 344, 370, -40 }, { 344, 366, -40 },
+  { 344, 86, -80 }, { 344, 87, -55 }, { 344, 89, -65 }, { 344, 221, -65 },
+  { 344, 376, -65 }, { 342, 79, -40 }, { 342, 211, -40 }, { 342, 212, -40 },
+  { 342, 214, -40 }, { 342, 210, -40 }, { 342, 336, -40 }, { 342, 332, -40 },
+  { 342, 216, -40 }, { 342, 213, -40 }, { 342, 84, -60 }, { 342, 356, -60 },
+  { 342, 387, -60 }, { 342, 85, -40 }, { 342, 218, -40 }, { 342, 219, -40 },
+  { 342, 220, -40 }, { 342, 217, -40 }, { 342, 368, -40 }, { 342, 362, -40 },
+  { 342, 370, -40 }, { 342, 366, -40 }, { 342, 86, -80 }, { 342, 87, -55 },
+  { 342, 89, -65 }, { 342, 221, -65 }, { 342, 376, -65 }, { 84, 65, -93 },
+  { 84, 193, -93 }, { 84, 258, -93 }, { 84, 194, -93 }, { 84, 196, -93 },
+  { 84, 192, -93 }, { 84, 256, -93 }, { 84, 260, -93 }, { 84, 197, -93 },
+  { 84, 195, -93 }, { 84, 79, -18 }, { 84, 211, -18 }, { 84, 212, -18 },
+  { 84, 214, -18 }, { 84, 210, -18 }, { 84, 336, -18 }, { 84, 332, -18 },
+  { 84, 216, -18 }, { 84, 213, -18 }, { 84, 97, -80 }, { 84, 225, -80 },
+  { 84, 259, -80 }, { 84, 226, -80 }, { 84, 228, -40 }, { 84, 224, -40 },
+  { 84, 257, -40 }, { 84, 261, -80 }, { 84, 229, -80 }, { 84, 227, -40 },
+  { 84, 58, -50 }, { 84, 44, -74 }, { 84, 101, -70 }, { 84, 233, -70 },
+  { 84, 283, -70 }, { 84, 234, -70 }, { 84, 235, -30 }, { 84, 279, -70 },
+  { 84, 232, -70 }, { 84, 275, -30 }, { 84, 281, -70 }, { 84, 45, -92 },
+  { 84, 105, -35 }, { 84, 237, -35 }, { 84, 303, -35 }, { 84, 111, -80 },
+  { 84, 243, -80 }, { 84, 244, -80 }, { 84, 246, -80 }, { 84, 242, -80 },
+  { 84, 337, -80 }, { 84, 333, -80 }, { 84, 248, -80 }, { 84, 245, -80 },
+  { 84, 46, -74 }, { 84, 114, -35 }, { 84, 341, -35 }, { 84, 345, -35 },
+  { 84, 343, -35 }, { 84, 59, -55 }, { 84, 117, -45 }, { 84, 250, -45 },
+  { 84, 251, -45 }, { 84, 252, -45 }, { 84, 249, -45 }, { 84, 369, -45 },
+  { 84, 363, -45 }, { 84, 371, -45 }, { 84, 367, -45 }, { 84, 119, -80 },
+  { 84, 121, -80 }, { 84, 253, -80 }, { 84, 255, -80 }, { 356, 65, -93 },
+  { 356, 193, -93 }, { 356, 258, -93 }, { 356, 194, -93 }, { 356, 196, -93 },
+  { 356, 192, -93 }, { 356, 256, -93 }, { 356, 260, -93 }, { 356, 197, -93 },
+  { 356, 195, -93 }, { 356, 79, -18 }, { 356, 211, -18 }, { 356, 212, -18 },
+  { 356, 214, -18 }, { 356, 210, -18 }, { 356, 336, -18 }, { 356, 332, -18 },
+  { 356, 216, -18 }, { 356, 213, -18 }, { 356, 97, -80 }, { 356, 225, -80 },
+  { 356, 259, -80 }, { 356, 226, -80 }, { 356, 228, -40 }, { 356, 224, -40 },
+  { 356, 257, -40 }, { 356, 261, -80 }, { 356, 229, -80 }, { 356, 227, -40 },
+  { 356, 58, -50 }, { 356, 44, -74 }, { 356, 101, -70 }, { 356, 233, -70 },
+  { 356, 283, -70 }, { 356, 234, -30 }, { 356, 235, -30 }, { 356, 279, -70 },
+  { 356, 232, -70 }, { 356, 275, -30 }, { 356, 281, -70 }, { 356, 45, -92 },
+  { 356, 105, -35 }, { 356, 237, -35 }, { 356, 303, -35 }, { 356, 111, -80 },
+  { 356, 243, -80 }, { 356, 244, -80 }, { 356, 246, -80 }, { 356, 242, -80 },
+  { 356, 337, -80 }, { 356, 333, -80 }, { 356, 248, -80 }, { 356, 245, -80 },
+  { 356, 46, -74 }, { 356, 114, -35 }, { 356, 341, -35 }, { 356, 345, -35 },
+  { 356, 343, -35 }, { 356, 59, -55 }, { 356, 117, -45 }, { 356, 250, -45 },
+  { 356, 251, -45 }, { 356, 252, -45 }, { 356, 249, -45 }, { 356, 369, -45 },
+  { 356, 363, -45 }, { 356, 371, -45 }, { 356, 367, -45 }, { 356, 119, -80 },
+  { 356, 121, -80 }, { 356, 253, -80 }, { 356, 255, -80 }, { 387, 65, -93 },
+  { 387, 193, -93 }, { 387, 258, -93 }, { 387, 194, -93 }, { 387, 196, -93 },
+  { 387, 192, -93 }, { 387, 256, -93 }, { 387, 260, -93 }, { 387, 197, -93 },
+  { 387, 195, -93 }, { 387, 79, -18 }, { 387, 211, -18 }, { 387, 212, -18 },
+  { 387, 214, -18 }, { 387, 210, -18 }, { 387, 336, -18 }, { 387, 332, -18 },
+  { 387, 216, -18 }, { 387, 213, -18 }, { 387, 97, -80 }, { 387, 225, -80 },
+  { 387, 259, -80 }, { 387, 226, -80 }, { 387, 228, -40 }, { 387, 224, -40 },
+  { 387, 257, -40 }, { 387, 261, -80 }, { 387, 229, -80 }, { 387, 227, -40 },
+  { 387, 58, -50 }, { 387, 44, -74 }, { 387, 101, -70 }, { 387, 233, -70 },
+  { 387, 283, -70 }, { 387, 234, -30 }, { 387, 235, -30 }, { 387, 279, -70 },
+  { 387, 232, -30 }, { 387, 275, -70 }, { 387, 281, -70 }, { 387, 45, -92 },
+  { 387, 105, -35 }, { 387, 237, -35 }, { 387, 303, -35 }, { 387, 111, -80 },
+  { 387, 243, -80 }, { 387, 244, -80 }, { 387, 246, -80 }, { 387, 242, -80 },
+  { 387, 337, -80 }, { 387, 333, -80 }, { 387, 248, -80 }, { 387, 245, -80 },
+  { 387, 46, -74 }, { 387, 114, -35 }, { 387, 341, -35 }, { 387, 345, -35 },
+  { 387, 343, -35 }, { 387, 59, -55 }, { 387, 117, -45 }, { 387, 250, -45 },
+  { 387, 251, -45 }, { 387, 252, -45 }, { 387, 249, -45 }, { 387, 369, -45 },
+  { 387, 363, -45 }, { 387, 371, -45 }, { 387, 367, -45 }, { 387, 119, -80 },
+  { 387, 121, -80 }, { 387, 253, -80 }, { 387, 255, -80 }, { 85, 65, -40 },
+  { 85, 193, -40 }, { 85, 258, -40 }, { 85, 194, -40 }, { 85, 196, -40 },
+  { 85, 192, -40 }, { 85, 256, -40 }, { 85, 260, -40 }, { 85, 197, -40 },
+  { 85, 195, -40 }, { 218, 65, -40 }, { 218, 193, -40 }, { 218, 258, -40 },
+  { 218, 194, -40 }, { 218, 196, -40 }, { 218, 192, -40 }, { 218, 256, -40 },
+  { 218, 260, -40 }, { 218, 197, -40 }, { 218, 195, -40 }, { 219, 65, -40 },
+  { 219, 193, -40 }, { 219, 258, -40 }, { 219, 194, -40 }, { 219, 196, -40 },
+  { 219, 192, -40 }, { 219, 256, -40 }, { 219, 260, -40 }, { 219, 197, -40 },
+  { 219, 195, -40 }, { 220, 65, -40 }, { 220, 193, -40 }, { 220, 258, -40 },
+  { 220, 194, -40 }, { 220, 196, -40 }, { 220, 192, -40 }, { 220, 256, -40 },
+  { 220, 260, -40 }, { 220, 197, -40 }, { 220, 195, -40 }, { 217, 65, -40 },
+  { 217, 193, -40 }, { 217, 258, -40 }, { 217, 194, -40 }, { 217, 196, -40 },
+  { 217, 192, -40 }, { 217, 256, -40 }, { 217, 260, -40 }, { 217, 197, -40 },
+  { 217, 195, -40 }, { 368, 65, -40 }, { 368, 193, -40 }, { 368, 258, -40 },
+  { 368, 194, -40 }, { 368, 196, -40 }, { 368, 192, -40 }, { 368, 256, -40 },
+  { 368, 260, -40 }, { 368, 197, -40 }, { 368, 195, -40 }, { 362, 65, -40 },
+  { 362, 193, -40 }, { 362, 258, -40 }, { 362, 194, -40 }, { 362, 196, -40 },
+  { 362, 192, -40 }, { 362, 256, -40 }, { 362, 260, -40 }, { 362, 197, -40 },
+  { 362, 195, -40 }, { 370, 65, -40 }, { 370, 193, -40 }, { 370, 258, -40 },
+  { 370, 194, -40 }, { 370, 196, -40 }, { 370, 192, -40 }, { 370, 256, -40 },
+  { 370, 260, -40 }, { 370, 197, -40 }, { 370, 195, -40 }, { 366, 65, -40 },
+  { 366, 193, -40 }, { 366, 258, -40 }, { 366, 194, -40 }, { 366, 196, -40 },
+  { 366, 192, -40 }, { 366, 256, -40 }, { 366, 260, -40 }, { 366, 197, -40 },
+  { 366, 195, -40 }, { 86, 65, -135 }, { 86, 193, -135 }, { 86, 258, -135 },
+  { 86, 194, -135 }, { 86, 196, -135 }, { 86, 192, -135 }, { 86, 256, -135 },
+  { 86, 260, -135 }, { 86, 197, -135 }, { 86, 195, -135 }, { 86, 71, -15 },
+  { 86, 286, -15 }, { 86, 290, -15 }, { 86, 79, -40 }, { 86, 211, -40 },
+  { 86, 212, -40 }, { 86, 214, -40 }, { 86, 210, -40 }, { 86, 336, -40 },
+  { 86, 332, -40 }, { 86, 216, -40 }, { 86, 213, -40 }, { 86, 97, -111 },
+  { 86, 225, -111 }, { 86, 259, -111 }, { 86, 226, -71 }, { 86, 228, -71 },
+  { 86, 224, -71 }, { 86, 257, -71 }, { 86, 261, -111 }, { 86, 229, -111 },
+  { 86, 227, -71 }, { 86, 58, -74 }, { 86, 44, -129 }, { 86, 101, -111 },
+  { 86, 233, -111 }, { 86, 283, -71 }, { 86, 234, -71 }, { 86, 235, -71 },
+  { 86, 279, -111 }, { 86, 232, -71 }, { 86, 275, -71 }, { 86, 281, -111 },
+  { 86, 45, -100 }, { 86, 105, -60 }, { 86, 237, -60 }, { 86, 238, -20 },
+  { 86, 239, -20 }, { 86, 236, -20 }, { 86, 299, -20 }, { 86, 303, -60 },
+  { 86, 111, -129 }, { 86, 243, -129 }, { 86, 244, -129 }, { 86, 246, -89 },
+  { 86, 242, -89 }, { 86, 337, -129 }, { 86, 333, -89 }, { 86, 248, -129 },
+  { 86, 245, -89 }, { 86, 46, -129 }, { 86, 59, -74 }, { 86, 117, -75 },
+  { 86, 250, -75 }, { 86, 251, -75 }, { 86, 252, -75 }, { 86, 249, -75 },
+  { 86, 369, -75 }, { 86, 363, -75 }, { 86, 371, -75 }, { 86, 367, -75 },
+  { 87, 65, -120 }, { 87, 193, -120 }, { 87, 258, -120 }, { 87, 194, -120 },
+  { 87, 196, -120 }, { 87, 192, -120 }, { 87, 256, -120 }, { 87, 260, -120 },
+  { 87, 197, -120 }, { 87, 195, -120 }, { 87, 79, -10 }, { 87, 211, -10 },
+  { 87, 212, -10 }, { 87, 214, -10 }, { 87, 210, -10 }, { 87, 336, -10 },
+  { 87, 332, -10 }, { 87, 216, -10 }, { 87, 213, -10 }, { 87, 97, -80 },
+  { 87, 225, -80 }, { 87, 259, -80 }, { 87, 226, -80 }, { 87, 228, -80 },
+  { 87, 224, -80 }, { 87, 257, -80 }, { 87, 261, -80 }, { 87, 229, -80 },
+  { 87, 227, -80 }, { 87, 58, -37 }, { 87, 44, -92 }, { 87, 101, -80 },
+  { 87, 233, -80 }, { 87, 283, -80 }, { 87, 234, -80 }, { 87, 235, -40 },
+  { 87, 279, -80 }, { 87, 232, -40 }, { 87, 275, -40 }, { 87, 281, -80 },
+  { 87, 45, -65 }, { 87, 105, -40 }, { 87, 237, -40 }, { 87, 303, -40 },
+  { 87, 111, -80 }, { 87, 243, -80 }, { 87, 244, -80 }, { 87, 246, -80 },
+  { 87, 242, -80 }, { 87, 337, -80 }, { 87, 333, -80 }, { 87, 248, -80 },
+  { 87, 245, -80 }, { 87, 46, -92 }, { 87, 59, -37 }, { 87, 117, -50 },
+  { 87, 250, -50 }, { 87, 251, -50 }, { 87, 252, -50 }, { 87, 249, -50 },
+  { 87, 369, -50 }, { 87, 363, -50 }, { 87, 371, -50 }, { 87, 367, -50 },
+  { 87, 121, -73 }, { 87, 253, -73 }, { 87, 255, -73 }, { 89, 65, -120 },
+  { 89, 193, -120 }, { 89, 258, -120 }, { 89, 194, -120 }, { 89, 196, -120 },
+  { 89, 192, -120 }, { 89, 256, -120 }, { 89, 260, -120 }, { 89, 197, -120 },
+  { 89, 195, -120 }, { 89, 79, -30 }, { 89, 211, -30 }, { 89, 212, -30 },
+  { 89, 214, -30 }, { 89, 210, -30 }, { 89, 336, -30 }, { 89, 332, -30 },
+  { 89, 216, -30 }, { 89, 213, -30 }, { 89, 97, -100 }, { 89, 225, -100 },
+  { 89, 259, -100 }, { 89, 226, -100 }, { 89, 228, -60 }, { 89, 224, -60 },
+  { 89, 257, -60 }, { 89, 261, -100 }, { 89, 229, -100 }, { 89, 227, -60 },
+  { 89, 58, -92 }, { 89, 44, -129 }, { 89, 101, -100 }, { 89, 233, -100 },
+  { 89, 283, -100 }, { 89, 234, -100 }, { 89, 235, -60 }, { 89, 279, -100 },
+  { 89, 232, -60 }, { 89, 275, -60 }, { 89, 281, -100 }, { 89, 45, -111 },
+  { 89, 105, -55 }, { 89, 237, -55 }, { 89, 303, -55 }, { 89, 111, -110 },
+  { 89, 243, -110 }, { 89, 244, -110 }, { 89, 246, -70 }, { 89, 242, -70 },
+  { 89, 337, -110 }, { 89, 333, -70 }, { 89, 248, -110 }, { 89, 245, -70 },
+  { 89, 46, -129 }, { 89, 59, -92 }, { 89, 117, -111 }, { 89, 250, -111 },
+  { 89, 251, -111 }, { 89, 252, -71 }, { 89, 249, -71 }, { 89, 369, -111 },
+  { 89, 363, -71 }, { 89, 371, -111 }, { 89, 367, -111 }, { 221, 65, -120 },
+  { 221, 193, -120 }, { 221, 258, -120 }, { 221, 194, -120 }, { 221, 196, -120 },
+  { 221, 192, -120 }, { 221, 256, -120 }, { 221, 260, -120 }, { 221, 197, -120 },
+  { 221, 195, -120 }, { 221, 79, -30 }, { 221, 211, -30 }, { 221, 212, -30 },
+  { 221, 214, -30 }, { 221, 210, -30 }, { 221, 336, -30 }, { 221, 332, -30 },
+  { 221, 216, -30 }, { 221, 213, -30 }, { 221, 97, -100 }, { 221, 225, -100 },
+  { 221, 259, -100 }, { 221, 226, -100 }, { 221, 228, -60 }, { 221, 224, -60 },
+  { 221, 257, -60 }, { 221, 261, -100 }, { 221, 229, -100 }, { 221, 227, -60 },
+  { 221, 58, -92 }, { 221, 44, -129 }, { 221, 101, -100 }, { 221, 233, -100 },
+  { 221, 283, -100 }, { 221, 234, -100 }, { 221, 235, -60 }, { 221, 279, -100 },
+  { 221, 232, -60 }, { 221, 275, -60 }, { 221, 281, -100 }, { 221, 45, -111 },
+  { 221, 105, -55 }, { 221, 237, -55 }, { 221, 303, -55 }, { 221, 111, -110 },
+  { 221, 243, -110 }, { 221, 244, -110 }, { 221, 246, -70 }, { 221, 242, -70 },
+  { 221, 337, -110 }, { 221, 333, -70 }, { 221, 248, -110 }, { 221, 245, -70 },
+  { 221, 46, -129 }, { 221, 59, -92 }, { 221, 117, -111 }, { 221, 250, -111 },
+  { 221, 251, -111 }, { 221, 252, -71 }, { 221, 249, -71 }, { 221, 369, -111 },
+  { 221, 363, -71 }, { 221, 371, -111 }, { 221, 367, -111 }, { 376, 65, -120 },
+  { 376, 193, -120 }, { 376, 258, -120 }, { 376, 194, -120 }, { 376, 196, -120 },
+  { 376, 192, -120 }, { 376, 256, -120 }, { 376, 260, -120 }, { 376, 197, -120 },
+  { 376, 195, -120 }, { 376, 79, -30 }, { 376, 211, -30 }, { 376, 212, -30 },
+  { 376, 214, -30 }, { 376, 210, -30 }, { 376, 336, -30 }, { 376, 332, -30 },
+  { 376, 216, -30 }, { 376, 213, -30 }, { 376, 97, -100 }, { 376, 225, -100 },
+  { 376, 259, -100 }, { 376, 226, -100 }, { 376, 228, -60 }, { 376, 224, -60 },
+  { 376, 257, -60 }, { 376, 261, -100 }, { 376, 229, -100 }, { 376, 227, -100 },
+  { 376, 58, -92 }, { 376, 44, -129 }, { 376, 101, -100 }, { 376, 233, -100 },
+  { 376, 283, -100 }, { 376, 234, -100 }, { 376, 235, -60 }, { 376, 279, -100 },
+  { 376, 232, -60 }, { 376, 275, -60 }, { 376, 281, -100 }, { 376, 45, -111 },
+  { 376, 105, -55 }, { 376, 237, -55 }, { 376, 303, -55 }, { 376, 111, -110 },
+  { 376, 243, -110 }, { 376, 244, -110 }, { 376, 246, -70 }, { 376, 242, -70 },
+  { 376, 337, -110 }, { 376, 333, -70 }, { 376, 248, -110 }, { 376, 245, -70 },
+  { 376, 46, -129 }, { 376, 59, -92 }, { 376, 117, -111 }, { 376, 250, -111 },
+  { 376, 251, -111 }, { 376, 252, -71 }, { 376, 249, -71 }, { 376, 369, -111 },
+  { 376, 363, -71 }, { 376, 371, -111 }, { 376, 367, -111 }, { 97, 118, -20 },
+  { 97, 119, -15 }, { 225, 118, -20 }, { 225, 119, -15 }, { 259, 118, -20 },
+  { 259, 119, -15 }, { 226, 118, -20 }, { 226, 119, -15 }, { 228, 118, -20 },
+  { 228, 119, -15 }, { 224, 118, -20 }, { 224, 119, -15 }, { 257, 118, -20 },
+  { 257, 119, -15 }, { 261, 118, -20 }, { 261, 119, -15 }, { 229, 118, -20 },
+  { 229, 119, -15 }, { 227, 118, -20 }, { 227, 119, -15 }, { 98, 46, -40 },
+  { 98, 117, -20 }, { 98, 250, -20 }, { 98, 251, -20 }, { 98, 252, -20 },
+  { 98, 249, -20 }, { 98, 369, -20 }, { 98, 363, -20 }, { 98, 371, -20 },
+  { 98, 367, -20 }, { 98, 118, -15 }, { 99, 121, -15 }, { 99, 253, -15 },
+  { 99, 255, -15 }, { 263, 121, -15 }, { 263, 253, -15 }, { 263, 255, -15 },
+  { 269, 121, -15 }, { 269, 253, -15 }, { 269, 255, -15 }, { 231, 121, -15 },
+  { 231, 253, -15 }, { 231, 255, -15 }, { 44, 416, -70 }, { 44, 418, -70 },
+  { 101, 103, -15 }, { 101, 287, -15 }, { 101, 291, -15 }, { 101, 118, -25 },
+  { 101, 119, -25 }, { 101, 120, -15 }, { 101, 121, -15 }, { 101, 253, -15 },
+  { 101, 255, -15 }, { 233, 103, -15 }, { 233, 287, -15 }, { 233, 291, -15 },
+  { 233, 118, -25 }, { 233, 119, -25 }, { 233, 120, -15 }, { 233, 121, -15 },
+  { 233, 253, -15 }, { 233, 255, -15 }, { 283, 103, -15 }, { 283, 287, -15 },
+  { 283, 291, -15 }, { 283, 118, -25 }, { 283, 119, -25 }, { 283, 120, -15 },
+  { 283, 121, -15 }, { 283, 253, -15 }, { 283, 255, -15 }, { 234, 103, -15 },
+  { 234, 287, -15 }, { 234, 291, -15 }, { 234, 118, -25 }, { 234, 119, -25 },
+  { 234, 120, -15 }, { 234, 121, -15 }, { 234, 253, -15 }, { 234, 255, -15 },
+  { 235, 103, -15 }, { 235, 287, -15 }, { 235, 291, -15 }, { 235, 118, -25 },
+  { 235, 119, -25 }, { 235, 120, -15 }, { 235, 121, -15 }, { 235, 253, -15 },
+  { 235, 255, -15 }, { 279, 103, -15 }, { 279, 287, -15 }, { 279, 291, -15 },
+  { 279, 118, -25 }, { 279, 119, -25 }, { 279, 120, -15 }, { 279, 121, -15 },
+  { 279, 253, -15 }, { 279, 255, -15 }, { 232, 103, -15 }, { 232, 287, -15 },
+  { 232, 291, -15 }, { 232, 118, -25 }, { 232, 119, -25 }, { 232, 120, -15 },
+  { 232, 121, -15 }, { 232, 253, -15 }, { 232, 255, -15 }, { 275, 103, -15 },
+  { 275, 287, -15 }, { 275, 291, -15 }, { 275, 118, -25 }, { 275, 119, -25 },
+  { 275, 120, -15 }, { 275, 121, -15 }, { 275, 253, -15 }, { 275, 255, -15 },
+  { 281, 103, -15 }, { 281, 287, -15 }, { 281, 291, -15 }, { 281, 118, -25 },
+  { 281, 119, -25 }, { 281, 120, -15 }, { 281, 121, -15 }, { 281, 253, -15 },
+  { 281, 255, -15 }, { 102, 97, -10 }, { 102, 225, -10 }, { 102, 259, -10 },
+  { 102, 226, -10 }, { 102, 228, -10 }, { 102, 224, -10 }, { 102, 257, -10 },
+  { 102, 261, -10 }, { 102, 229, -10 }, { 102, 227, -10 }, { 102, 305, -50 },
+  { 102, 102, -25 }, { 102, 105, -20 }, { 102, 237, -20 }, { 102, 418, 55 },
+  { 103, 97, -5 }, { 103, 225, -5 }, { 103, 259, -5 }, { 103, 226, -5 },
+  { 103, 228, -5 }, { 103, 224, -5 }, { 103, 257, -5 }, { 103, 261, -5 },
+  { 103, 229, -5 }, { 103, 227, -5 }, { 287, 97, -5 }, { 287, 225, -5 },
+  { 287, 259, -5 }, { 287, 226, -5 }, { 287, 228, -5 }, { 287, 224, -5 },
+  { 287, 257, -5 }, { 287, 261, -5 }, { 287, 229, -5 }, { 287, 227, -5 },
+  { 291, 97, -5 }, { 291, 225, -5 }, { 291, 259, -5 }, { 291, 226, -5 },
+  { 291, 228, -5 }, { 291, 224, -5 }, { 291, 257, -5 }, { 291, 261, -5 },
+  { 291, 229, -5 }, { 291, 227, -5 }, { 104, 121, -5 }, { 104, 253, -5 },
+  { 104, 255, -5 }, { 105, 118, -25 }, { 237, 118, -25 }, { 238, 118, -25 },
+  { 239, 118, -25 }, { 236, 118, -25 }, { 299, 118, -25 }, { 303, 118, -25 },
+  { 107, 101, -10 }, { 107, 233, -10 }, { 107, 283, -10 }, { 107, 234, -10 },
+  { 107, 235, -10 }, { 107, 279, -10 }, { 107, 232, -10 }, { 107, 275, -10 },
+  { 107, 281, -10 }, { 107, 111, -10 }, { 107, 243, -10 }, { 107, 244, -10 },
+  { 107, 246, -10 }, { 107, 242, -10 }, { 107, 337, -10 }, { 107, 333, -10 },
+  { 107, 248, -10 }, { 107, 245, -10 }, { 107, 121, -15 }, { 107, 253, -15 },
+  { 107, 255, -15 }, { 311, 101, -10 }, { 311, 233, -10 }, { 311, 283, -10 },
+  { 311, 234, -10 }, { 311, 235, -10 }, { 311, 279, -10 }, { 311, 232, -10 },
+  { 311, 275, -10 }, { 311, 281, -10 }, { 311, 111, -10 }, { 311, 243, -10 },
+  { 311, 244, -10 }, { 311, 246, -10 }, { 311, 242, -10 }, { 311, 337, -10 },
+  { 311, 333, -10 }, { 311, 248, -10 }, { 311, 245, -10 }, { 311, 121, -15 },
+  { 311, 253, -15 }, { 311, 255, -15 }, { 108, 119, -10 }, { 314, 119, -10 },
+  { 316, 119, -10 }, { 322, 119, -10 }, { 110, 118, -40 }, { 110, 121, -15 },
+  { 110, 253, -15 }, { 110, 255, -15 }, { 324, 118, -40 }, { 324, 121, -15 },
+  { 324, 253, -15 }, { 324, 255, -15 }, { 328, 118, -40 }, { 328, 121, -15 },
+  { 328, 253, -15 }, { 328, 255, -15 }, { 326, 118, -40 }, { 326, 121, -15 },
+  { 326, 253, -15 }, { 326, 255, -15 }, { 241, 118, -40 }, { 241, 121, -15 },
+  { 241, 253, -15 }, { 241, 255, -15 }, { 111, 118, -15 }, { 111, 119, -25 },
+  { 111, 121, -10 }, { 111, 253, -10 }, { 111, 255, -10 }, { 243, 118, -15 },
+  { 243, 119, -25 }, { 243, 121, -10 }, { 243, 253, -10 }, { 243, 255, -10 },
+  { 244, 118, -15 }, { 244, 119, -25 }, { 244, 121, -10 }, { 244, 253, -10 },
+  { 244, 255, -10 }, { 246, 118, -15 }, { 246, 119, -25 }, { 246, 121, -10 },
+  { 246, 253, -10 }, { 246, 255, -10 }, { 242, 118, -15 }, { 242, 119, -25 },
+  { 242, 121, -10 }, { 242, 253, -10 }, { 242, 255, -10 }, { 337, 118, -15 },
+  { 337, 119, -25 }, { 337, 121, -10 }, { 337, 253, -10 }, { 337, 255, -10 },
+  { 333, 118, -15 }, { 333, 119, -25 }, { 333, 121, -10 }, { 333, 253, -10 },
+  { 333, 255, -10 }, { 248, 118, -15 }, { 248, 119, -25 }, { 248, 121, -10 },
+  { 248, 253, -10 }, { 248, 255, -10 }, { 245, 118, -15 }, { 245, 119, -25 },
+  { 245, 121, -10 }, { 245, 253, -10 }, { 245, 255, -10 }, { 112, 121, -10 },
+  { 112, 253, -10 }, { 112, 255, -10 }, { 46, 416, -70 }, { 46, 418, -70 },
+  { 415, 65, -80 }, { 415, 193, -80 }, { 415, 258, -80 }, { 415, 194, -80 },
+  { 415, 196, -80 }, { 415, 192, -80 }, { 415, 256, -80 }, { 415, 260, -80 },
+  { 415, 197, -80 }, { 415, 195, -80 }, { 417, 65, -80 }, { 417, 193, -80 },
+  { 417, 258, -80 }, { 417, 194, -80 }, { 417, 196, -80 }, { 417, 192, -80 },
+  { 417, 256, -80 }, { 417, 260, -80 }, { 417, 197, -80 }, { 417, 195, -80 },
+  { 417, 417, -74 }, { 418, 100, -50 }, { 418, 273, -50 }, { 418, 108, -10 },
+  { 418, 314, -10 }, { 418, 316, -10 }, { 418, 322, -10 }, { 418, 418, -74 },
+  { 418, 114, -50 }, { 418, 341, -50 }, { 418, 345, -50 }, { 418, 343, -50 },
+  { 418, 115, -55 }, { 418, 347, -55 }, { 418, 353, -55 }, { 418, 351, -55 },
+  { 418, 422, -55 }, { 418, 32, -74 }, { 418, 116, -18 }, { 418, 424, -18 },
+  { 418, 118, -50 }, { 114, 44, -40 }, { 114, 103, -18 }, { 114, 287, -18 },
+  { 114, 291, -18 }, { 114, 45, -20 }, { 114, 46, -55 }, { 341, 44, -40 },
+  { 341, 103, -18 }, { 341, 287, -18 }, { 341, 291, -18 }, { 341, 45, -20 },
+  { 341, 46, -55 }, { 345, 44, -40 }, { 345, 103, -18 }, { 345, 287, -18 },
+  { 345, 291, -18 }, { 345, 45, -20 }, { 345, 46, -55 }, { 343, 44, -40 },
+  { 343, 103, -18 }, { 343, 287, -18 }, { 343, 291, -18 }, { 343, 45, -20 },
+  { 343, 46, -55 }, { 32, 65, -55 }, { 32, 193, -55 }, { 32, 258, -55 },
+  { 32, 194, -55 }, { 32, 196, -55 }, { 32, 192, -55 }, { 32, 256, -55 },
+  { 32, 260, -55 }, { 32, 197, -55 }, { 32, 195, -55 }, { 32, 84, -18 },
+  { 32, 356, -18 }, { 32, 387, -18 }, { 32, 86, -50 }, { 32, 87, -30 },
+  { 32, 89, -90 }, { 32, 221, -90 }, { 32, 376, -90 }, { 118, 97, -25 },
+  { 118, 225, -25 }, { 118, 259, -25 }, { 118, 226, -25 }, { 118, 228, -25 },
+  { 118, 224, -25 }, { 118, 257, -25 }, { 118, 261, -25 }, { 118, 229, -25 },
+  { 118, 227, -25 }, { 118, 44, -65 }, { 118, 101, -15 }, { 118, 233, -15 },
+  { 118, 283, -15 }, { 118, 234, -15 }, { 118, 235, -15 }, { 118, 279, -15 },
+  { 118, 232, -15 }, { 118, 275, -15 }, { 118, 281, -15 }, { 118, 111, -20 },
+  { 118, 243, -20 }, { 118, 244, -20 }, { 118, 246, -20 }, { 118, 242, -20 },
+  { 118, 337, -20 }, { 118, 333, -20 }, { 118, 248, -20 }, { 118, 245, -20 },
+  { 118, 46, -65 }, { 119, 97, -10 }, { 119, 225, -10 }, { 119, 259, -10 },
+  { 119, 226, -10 }, { 119, 228, -10 }, { 119, 224, -10 }, { 119, 257, -10 },
+  { 119, 261, -10 }, { 119, 229, -10 }, { 119, 227, -10 }, { 119, 44, -65 },
+  { 119, 111, -10 }, { 119, 243, -10 }, { 119, 244, -10 }, { 119, 246, -10 },
+  { 119, 242, -10 }, { 119, 337, -10 }, { 119, 333, -10 }, { 119, 248, -10 },
+  { 119, 245, -10 }, { 119, 46, -65 }, { 120, 101, -15 }, { 120, 233, -15 },
+  { 120, 283, -15 }, { 120, 234, -15 }, { 120, 235, -15 }, { 120, 279, -15 },
+  { 120, 232, -15 }, { 120, 275, -15 }, { 120, 281, -15 }, { 121, 44, -65 },
+  { 121, 46, -65 }, { 253, 44, -65 }, { 253, 46, -65 }, { 255, 44, -65 },
+  { 255, 46, -65 } };
+
+static const fontbuilthighstr high_6[] = {
+  { "\306\222", 16 },
+  { "\310\230", 2 },
+  { "\310\231", 38 },
+  { "\310\232", 3 },
+  { "\310\233", 40 },
+  { "\314\202", 6 },
+  { "\314\203", 41 },
+  { "\314\206", 4 },
+  { "\314\207", 10 },
+  { "\314\212", 37 },
+  { "\314\213", 21 },
+  { "\314\214", 5 },
+  { "\314\246", 7 },
+  { "\314\250", 26 },
+  { "\316\224", 0 },
+  { "\342\200\223", 13 },
+  { "\342\200\224", 12 },
+  { "\342\200\230", 33 },
+  { "\342\200\231", 34 },
+  { "\342\200\232", 35 },
+  { "\342\200\234", 31 },
+  { "\342\200\235", 32 },
+  { "\342\200\236", 30 },
+  { "\342\200\240", 8 },
+  { "\342\200\241", 9 },
+  { "\342\200\246", 11 },
+  { "\342\200\247", 28 },
+  { "\342\200\261", 29 },
+  { "\342\200\271", 19 },
+  { "\342\200\272", 20 },
+  { "\342\201\204", 17 },
+  { "\342\202\254", 1 },
+  { "\342\204\242", 42 },
+  { "\342\210\202", 27 },
+  { "\342\210\221", 39 },
+  { "\342\210\222", 24 },
+  { "\342\210\232", 36 },
+  { "\342\210\236", 43 },
+  { "\342\211\240", 25 },
+  { "\342\211\244", 22 },
+  { "\342\211\245", 18 },
+  { "\342\227\212", 23 },
+  { "\357\254\201", 14 },
+  { "\357\254\202", 15 },
+  };
+
+const fontbuiltinstr font_builtin_fonts[] = {
+  { "PMW-Alpha", widths_0, r2ladjusts_0, NULL, NULL, NULL, NULL,
+    NULL, pdfencoding_0, 0, 0, 0, 0x00000000u, 0x05000024u,
+    0, 0, 0, 0, 0, { -360, -326, 1324, 838 } },
+  { "PMW-Music", widths_1, r2ladjusts_1, heights_1, NULL, utr_1, NULL,
+    NULL, pdfencoding_1, 0, 61, 0, 0x00000000u, 0x05000024u,
+    0, 0, 0, 0, 0, { -150, -1400, 50000, 2300 } },
+  { "Symbol", widths_2, r2ladjusts_2, NULL, NULL, utr_2, NULL,
+    NULL, pdfencoding_2, 0, 185, 0, 0x00000000u, 0x05000024u,
+    0, 0, 0, 0, 85, { -180, -293, 1090, 1010 } },
+  { "Times-Bold", widths_3, r2ladjusts_3, NULL, kerns_3, NULL, high_3,
+    NULL, NULL, 2242, 0, 44, 0x00000001u, 0x7f0000a4u,
+    683, -217, 676, 0, 139, { -168, -218, 1000, 935 } },
+  { "Times-BoldItalic", widths_4, r2ladjusts_4, NULL, kerns_4, NULL, high_4,
+    NULL, NULL, 2038, 0, 44, 0x00000001u, 0x7f0000a4u,
+    683, -217, 669, -15, 121, { -200, -218, 996, 921 } },
+  { "Times-Italic", widths_5, r2ladjusts_5, NULL, kerns_5, NULL, high_5,
+    NULL, NULL, 2321, 0, 44, 0x00000001u, 0x7f0000a4u,
+    683, -217, 653, -15, 76, { -169, -217, 1010, 883 } },
+  { "Times-Roman", widths_6, r2ladjusts_6, NULL, kerns_6, NULL, high_6,
+    NULL, NULL, 2073, 0, 44, 0x00000001u, 0x7f0000a4u,
+    683, -217, 662, 0, 84, { -168, -218, 1000, 898 } }
+};
+
+usint font_builtin_count = 7;
+
+/* End of fonttab.c */
@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: December 2020 */
-/* This file last modified: April 2026 */
+/* This file last modified: October 2026 */
 
 /* -------- General functions -------- */
 
@@ -16,7 +16,12 @@ extern void         debug_header(void);
 extern void         debug_memory_usage(void);
 extern void         debug_string(uint32_t *);
 
+extern uschar      *deflate_compress(const uschar *, size_t, int, size_t *);
+
+extern void         draw_cache_program(drawitem *);
+
 extern BOOL         error(enum error_number, ...);
+extern usint        error_get_count(void);
 extern BOOL         error_skip(enum error_number, uint32_t, ...);
 
 extern void         font_addfont(uschar *, uint32_t, uint32_t);
@@ -24,24 +29,37 @@ extern int32_t      font_charwidth(uint32_t, uint32_t, uint32_t, int32_t,
                       int32_t *);
 extern FILE        *font_finddata(uschar *, const char *, uschar *, uschar *,
                       uschar *, BOOL);
+extern int32_t      font_kern(fontstr *, uint32_t, uint32_t);
+extern fontstr     *font_load(uint32_t);
+extern FILE        *font_open_music(const char *, uschar *);
+extern void         font_preload_music(void);
 extern uint32_t     font_readtype(BOOL);
 extern fontinststr *font_rotate(fontinststr *, int32_t);
 extern uint32_t     font_search(uschar *);
+extern void         font_server_add(uschar *, size_t);
 extern uint32_t     font_utranslate(uint32_t, fontstr *);
+extern uschar      *fontsubset_otf(const uschar *, size_t, const uschar **, int,
+                      size_t *);
 
+extern void         mem_arena_free(usint);
+extern void        *mem_arena_get(usint, size_t, usint);
+extern void        *mem_arena_get_independent(usint, size_t, usint);
+extern void         mem_compact_bars(void);
 extern void         mem_connect_item(bstr *);
 extern uschar      *mem_copystring(uschar *);
 extern void        *mem_duplicate_item(void *, size_t);
 extern void         mem_free(void);
 extern void         mem_free_cached(void **, void *);
-extern void        *mem_get(size_t);
-extern void        *mem_get_cached(void **, size_t);
-extern void        *mem_get_independent(size_t);
+extern void        *mem_get(size_t, usint);
+extern void        *mem_get_cached(void **, size_t, usint);
+extern void        *mem_get_independent(size_t, usint);
+extern usint        mem_get_blocks(memblockstr **);
 extern usint        mem_get_info(size_t *, size_t *);
 extern void        *mem_get_insert_item(size_t, usint, bstr *);
 extern void        *mem_get_item(size_t, usint);
 extern void         mem_record_next_item(bstr **);
-extern void         mem_register(void *, size_t);
+extern void         mem_register(void *, size_t, usint);
+extern void         mem_statistics(void);
 
 extern void         midi_write(void);
 
@@ -49,6 +67,8 @@ extern void         misc_commoncont(bstr *);
 extern void         misc_copycontstr(contstr *, contstr *, int, BOOL);
 extern void         misc_freenbar(void);
 extern BOOL         misc_get_range(uint64_t, usint, usint *, usint *);
+extern void         misc_keyhash_build(keyhashstr *, const void *, usint, size_t);
+extern int          misc_keyhash_find(keyhashstr *, uschar *);
 extern int32_t      misc_keywidth(uint32_t, uint16_t);
 extern b_notestr   *misc_nextnote(void *);
 extern int          misc_ord2utf8(uint32_t, uschar *);
@@ -109,10 +129,13 @@ extern void         pmw_read(void);
 extern void         pmw_read_header(void);
 extern void         pmw_read_stave(void);
 
+extern macrostr    *preprocess_findmacro(uschar *);
 extern void         preprocess_line(void);
 
 extern uint32_t     read_accororn(uint32_t);
 extern uint32_t     read_barnumber(void);
+extern void         read_cache_include(void);
+extern int          read_close_file(void);
 extern uint32_t     read_compute_barlength(uint32_t);
 extern BOOL         read_do_stavedirective(void);
 extern void         read_draw(tree_node **, drawitem **, uint32_t);
@@ -124,18 +147,22 @@ extern void         read_extend_buffers(void);
 extern void         read_file(enum filetype);
 extern uint32_t     read_fixed(void);
 extern void         read_fontsize(fontinststr *, BOOL);
+extern void         read_free_include_cache(void);
 extern int          read_getmidinumber(uschar *, uschar *, uschar *);
 extern void         read_headfootingtext(headstr *, uint32_t, uint32_t);
+extern BOOL         read_include_cached(void);
 extern void         read_init_baraccs(int8_t *, uint32_t);
 extern void         read_init_movement(movtstr *, uint32_t, uint32_t);
 extern stavestr    *read_init_stave(int32_t, BOOL);
 extern uint32_t     read_key(void);
+extern void         read_map_file(void);
 extern int32_t      read_movevalue(void);
 extern void         read_nextc(void);
 extern void         read_nextword(void);
 extern void         read_note(void);
 extern BOOL         read_physical_line(size_t);
 extern uint32_t     read_scaletime(uint32_t);
+extern void         read_server_include(uschar *);
 extern void         read_setbeamstems(void);
 extern void         read_sortchord(b_notestr *, uint32_t);
 extern int          read_stavelist(uschar *, uschar **, uint64_t *,
@@ -147,6 +174,16 @@ extern void         read_tidy_staves(BOOL);
 extern uint32_t     read_time(void);
 extern uint32_t     read_usint(void);
 
+extern void         scorecache_add_input(uschar *, size_t);
+extern BOOL         scorecache_load(void);
+extern void         scorecache_nosave(const char *);
+extern void         scorecache_pointer(void **, usint);
+extern void         scorecache_save(void);
+
+extern void         server_check_job(void);
+extern void         server_passback_write(int, const void *, size_t);
+extern int          server_run(int, char **, char ***);
+
 extern void         slur_drawslur(slurstr *, int32_t, int, BOOL);
 extern slurstr     *slur_endslur(b_endslurstr *);
 extern slurstr     *slur_startslur(b_slurstr *);
@@ -169,17 +206,25 @@ extern BOOL         string_read_plain(void);
 extern void         string_relativize(void);
 extern void         string_stavestring(BOOL);
 extern int32_t      string_width(uint32_t *, fontinststr *, int32_t *);
+extern void         string_widthcache_add(uschar *, size_t);
+extern void         string_widthcache_flush(void);
+extern void         string_widthcache_passback(void);
+extern void         string_widthcache_statistics(void);
 extern int          strncmpic(const unsigned char*, const unsigned char *, int);
 
 extern uint32_t     transpose_key(uint32_t);
 extern int16_t      transpose_note(int16_t, int16_t *, uint8_t *, uint8_t,
                       BOOL, BOOL, BOOL, BOOL, int);
 
+extern void         tree_free_index(void);
 extern BOOL         tree_insert(tree_node **, tree_node *);
+extern void         tree_rehash(tree_node *);
 extern tree_node   *tree_search(tree_node *, uschar *);
+extern void         tree_statistics(void);
 
 #if SUPPORT_XML
 extern void         outxml_check_directive(const char *, BOOL);
+extern void         outxml_free(void);
 extern void         outxml_write(BOOL);
 extern void         outxml_write_ignored(void);
 extern void         xml_read(void);
@@ -195,6 +240,7 @@ extern void         ps_brace(int32_t, int32_t, int32_t, int32_t);
 extern void         ps_bracket(int32_t, int32_t, int32_t, int32_t);
 extern void         ps_getcolour(int32_t *);
 extern void         ps_go(void);
+extern void         ps_preload_header(void);
 extern void         ps_grestore(void);
 extern void         ps_gsave(void);
 extern void         ps_line(int32_t, int32_t, int32_t, int32_t, int32_t,
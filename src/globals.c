@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2025 */
 /* This file created: December 2020 */
-/* This file last modified: Decenber 2025 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -70,6 +70,7 @@ BOOL         font_call_b2pf = FALSE;
 
 int32_t      font_cosr = 1000;
 uint32_t     font_count = 0;
+uschar      *font_cache_dir = NULL;
 uschar      *font_data_default = US FONTMETRICS ":" FONTDIR;
 uschar      *font_data_extra = NULL;
 fontstr     *font_list = NULL;
@@ -82,10 +83,11 @@ int32_t      font_transform[6];
 
 BOOL         macro_expanding = FALSE;
 size_t       macro_in = 0;
-tree_node   *macro_tree = NULL;
+macrostr    *macro_table[MACRO_HASHSIZE];
 
 uschar      *main_argbuffer[MAX_MACRODEPTH] = { NULL };
 size_t       main_argbuffer_size[MAX_MACRODEPTH];
+uschar      *main_batch_file = NULL;
 BOOL         main_error_136 = FALSE;
 uschar      *main_filename = NULL;
 uschar      *main_format = NULL;
@@ -106,6 +108,7 @@ uint32_t     main_lastpagenumber = 0;
 uint32_t     main_magnification = 1000;
 int32_t      main_maxstave = -1;
 int32_t      main_maxvertjustify = 60000;
+BOOL         main_memstats = FALSE;
 BOOL         main_midifornotesoff = FALSE;
 b_ornamentstr *main_nextnoteornament = NULL;
 pagestr     *main_pageanchor;
@@ -120,6 +123,8 @@ size_t       main_readbuffer_threshold = MAIN_READBUFFER_CHUNKSIZE - 2;
 size_t       main_readlength = 0;
 BOOL         main_righttoleft = FALSE;
 uint64_t     main_selectedstaves = ~0uL;
+BOOL         main_server = FALSE;
+uschar      *main_server_socket = NULL;
 uint32_t     main_sheetdepth = 842000;
 uint32_t     main_sheetsize = sheet_A4;
 uint32_t     main_sheetwidth = 595000;
@@ -279,6 +284,10 @@ BOOL         PDFforced = FALSE;
 BOOL         PSforced = FALSE;
 BOOL         EPSforced = FALSE;
 
+int          pdf_compress = -1;
+BOOL         pdf_linearize = FALSE;
+uint32_t     pdf_options = 0;
+
 uint32_t     pletstack[MAX_PLETNEST - 1];
 uint32_t     pletstackcount;
 
@@ -344,6 +353,10 @@ size_t       read_i = 0;
 uint32_t     read_invalid_unicode[UUSIZE];
 bstr        *read_lastitem = NULL;
 usint        read_linenumber = 0;
+BOOL         read_mapcached = FALSE;
+uschar      *read_mapend = NULL;
+uschar      *read_mapptr = NULL;
+uschar      *read_mapstart = NULL;
 usint        read_nextheadsize = 0;
 usint        read_okdepth = 0;
 usint        read_skipdepth = 0;
@@ -358,6 +371,9 @@ int32_t      read_uunext = 0;
 BOOL         read_uuoverflow = FALSE;
 uschar       read_wordbuffer[WORDBUFFER_SIZE];
 
+uschar      *scorecache_dir = NULL;
+FILE        *server_passback = NULL;
+
 sreadstr     srs;
 stavestr    *st = NULL;
 int          stave_use_draw = 0;
@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2025 */
 /* This file created: December 2020 */
-/* This file last modified: December 2025 */
+/* This file last modified: October 2026 */
 
 
 /*************************************************
@@ -15,6 +15,8 @@ extern accent        accent_chars[];
 extern an2uencod     an2ulist[];
 extern size_t        an2ucount;
 
+extern const char   *bar_item_names[];
+extern const size_t  bar_item_sizes[];
 extern const char   *clef_names[];
 
 extern uint32_t      default_hyphen[];
@@ -118,8 +120,11 @@ extern b2pf_context **font_b2pf_contexts;
 extern uint32_t    *font_b2pf_options;
 extern BOOL         font_call_b2pf;
 #endif
+extern usint        font_builtin_count;          /* Compiled-in fonts */
+extern const fontbuiltinstr font_builtin_fonts[];
 extern int32_t      font_cosr;                   /* Cosine for rotations */
 extern uint32_t     font_count;                  /* Number of typefaces */
+extern uschar      *font_cache_dir;              /* -fontcache argument */
 extern uschar      *font_data_default;           /* For AFM files, etc */
 extern uschar      *font_data_extra;             /* -F argument */
 extern fontstr     *font_list;                   /* List of typefaces */
@@ -131,10 +136,11 @@ extern uint32_t     font_table[];                /* Fonts by type, e.g. font_rm
 
 extern BOOL         macro_expanding;
 extern size_t       macro_in;
-extern tree_node   *macro_tree;
+extern macrostr    *macro_table[];
 
 extern uschar      *main_argbuffer[];
 extern size_t       main_argbuffer_size[];
+extern uschar      *main_batch_file;             /* -batch argument */
 extern BOOL         main_error_136;
 extern uschar      *main_filename;
 extern uschar      *main_format;
@@ -155,6 +161,7 @@ extern uint32_t     main_lastpagenumber;
 extern uint32_t     main_magnification;
 extern int32_t      main_maxstave;
 extern int32_t      main_maxvertjustify;
+extern BOOL         main_memstats;
 extern BOOL         main_midifornotesoff;
 extern b_ornamentstr *main_nextnoteornament;
 extern pagestr     *main_pageanchor;
@@ -169,6 +176,8 @@ extern size_t       main_readbuffer_threshold;
 extern size_t       main_readlength;
 extern BOOL         main_righttoleft;
 extern uint64_t     main_selectedstaves;
+extern BOOL         main_server;                 /* -server */
+extern uschar      *main_server_socket;          /* -socket argument */
 extern uint32_t     main_sheetdepth;
 extern uint32_t     main_sheetsize;
 extern uint32_t     main_sheetwidth;
@@ -328,6 +337,10 @@ extern BOOL         PDFforced;
 extern BOOL         PSforced;
 extern BOOL         EPSforced;
 
+extern int          pdf_compress;
+extern BOOL         pdf_linearize;
+extern uint32_t     pdf_options;
+
 extern uint32_t     pletstack[MAX_PLETNEST - 1];
 extern uint32_t     pletstackcount;
 
@@ -382,6 +395,10 @@ extern size_t       read_i;
 extern uint32_t     read_invalid_unicode[];
 extern bstr        *read_lastitem;
 extern usint        read_linenumber;
+extern BOOL         read_mapcached;
+extern uschar      *read_mapend;
+extern uschar      *read_mapptr;
+extern uschar      *read_mapstart;
 extern usint        read_nextheadsize;
 extern usint        read_okdepth;
 extern usint        read_skipdepth;
@@ -396,6 +413,9 @@ extern int32_t      read_uunext;
 extern BOOL         read_uuoverflow;
 extern uschar       read_wordbuffer[];
 
+extern uschar      *scorecache_dir;              /* -scorecache argument */
+extern FILE        *server_passback;             /* Pipe to server from a job */
+
 extern sreadstr     srs;
 extern stavestr    *st;
 extern int          stave_use_draw;
@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: December 2020 */
-/* This file last modified: January 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 #include "rdargs.h"
@@ -30,6 +30,7 @@ static const char *arg_pattern =
   "a4ona3/s,"
   "a4sideways/s,"
   "a5ona4/s,"
+  "batch/k,"
   "C/k,"
   "c/k/n,"
   "dbd/k,"
@@ -42,14 +43,17 @@ static const char *arg_pattern =
   "eps/s,"
   "F/k,"
   "f/k,"
+  "fontcache/k,"
   "H/k,"
   "-help=help/s,"
   "incPMWfont=includePMWfont=incpmwfont=includepmwfont=ipf/s,"
+  "linearize/s,"
   "MacOSapp/k,"
   "MF/k,"
   "MP/k,"
   "MV/k,"
   "manualfeed/s,"
+  "memstats/s,"
   "midi/k,"
   "mb=midibars/k,"
   "mm=midimovement/k/n,"
@@ -62,6 +66,8 @@ static const char *arg_pattern =
   "p/k,"
   "pamphlet/s,"
   "pdf/s,"
+  "pdfcompress/k/n,"
+  "?pdfopt,"             /* Matches any other key starting with "pdfopt" */
   "printadjust/k/2/m,"
   "printgutter/k,"
   "printscale/k,"
@@ -70,6 +76,9 @@ static const char *arg_pattern =
   "reverse/s,"
   "SM/k,"
   "s/k,"
+  "scorecache/k,"
+  "server/s,"
+  "socket/k,"
   "t/k/n,"
   "testing/n=2,"
   "tumble/s,"
@@ -84,6 +93,7 @@ enum {
   arg_a4ona3,
   arg_a4sideways,
   arg_a5ona4,
+  arg_batch,
   arg_C,
   arg_c,
   arg_dbd,
@@ -96,14 +106,17 @@ enum {
   arg_eps,
   arg_F,
   arg_f,
+  arg_fontcache,
   arg_H,
   arg_help,
   arg_incPMWfont,
+  arg_linearize,
   arg_MacOSapp,
   arg_MF,
   arg_MP,
   arg_MV,
   arg_manualfeed,
+  arg_memstats,
   arg_midi,
   arg_midibars,
   arg_midimovement,
@@ -116,6 +129,8 @@ enum {
   arg_p,
   arg_pamphlet,
   arg_pdf,
+  arg_pdfcompress,
+  arg_pdfopt,
   arg_printadjustx,
   arg_printadjusty,
   arg_printgutter,
@@ -125,6 +140,9 @@ enum {
   arg_reverse,
   arg_SM,
   arg_s,
+  arg_scorecache,
+  arg_server,
+  arg_socket,
   arg_t,
   arg_testing,
   arg_tumble,
@@ -163,10 +181,13 @@ static bit_table debug_options[] = {
   { US"memory",          D_memory },
   { US"memorydetail",    D_memorydetail },
   { US"movtflags",       D_movtflags },
+  { US"peephole",        D_peephole },
   { US"preprocess",      D_preprocess },
   { US"sortchord",       D_sortchord },
+  { US"stringcache",     D_stringcache },
   { US"stringwidth",     D_stringwidth },
   { US"trace",           D_trace },
+  { US"treehash",        D_treehash },
   { US"xmlanalyze",      D_xmlanalyze },
   { US"xmlgroups",       D_xmlgroups },
   { US"xmlread",         D_xmlread },
@@ -188,22 +209,19 @@ static bit_table xout_options[] = {
 #define XOUT_OPTIONS_COUNT (sizeof(xout_options)/sizeof(bit_table))
 #endif
 
+/* Likewise, this table of PDF output options must be in alphabetical order. */
 
-/*************************************************
-*     Provide case-independent string match      *
-*************************************************/
-
-int
-strncmpic(const unsigned char *s, const unsigned char *t, int n)
-{
-while (n--)
-  {
-  int c = tolower(*s++) - tolower(*t++);
-  if (c != 0) return c;
-  }
-return 0;
-}
+static bit_table pdf_options_table[] = {
+  { US"all",             pdfopt_all },
+  { US"binaryfonts",     pdfopt_binaryfonts },
+  { US"objstreams",      pdfopt_objstreams },
+  { US"peephole",        pdfopt_peephole },
+  { US"streaming",       pdfopt_streaming },
+  { US"subset",          pdfopt_subset },
+  { US"xobjects",        pdfopt_xobjects }
+};
 
+#define PDF_OPTIONS_COUNT (sizeof(pdf_options_table)/sizeof(bit_table))
 
 
 /*************************************************
@@ -441,7 +459,7 @@ if (length == 0) return;            /* No usable text in the file */
 /* We store the file in one long byte string. Each name is followed by a zero
 byte and then a binary byte containing its number. */
 
-*anchor = mem_get(length+1);
+*anchor = mem_get(length+1, mt_midi);
 p = *anchor;
 
 rewind(f);
@@ -503,6 +521,7 @@ PF("Default output is stdout if no input file name is given.\n");
 PF("\nGENERAL OPTIONS\n\n");
 PF("-a4ona3               arrange A4 images 2-up on A3\n");
 PF("-a5ona4               arrange A5 images 2-up on A4\n");
+PF("-batch <file>         run each job (input file and options) listed in file\n");
 PF("-C <arg>              show a compile-time option; exit with its value (0 or 1).\n");
 PF("    b2pf              support for B2PF processing\n");
 PF("    musicxml          support for MusicXML input and output\n");
@@ -512,6 +531,7 @@ PF("-dsl [<n>]            synonym for -drawstavelines\n");
 PF("-eps                  output encapsulated PostScript\n");
 PF("-F <directory-list>   specify fontmetrics, .utr, and font directories\n");
 PF("-f <name>             specify format name\n");
+PF("-fontcache <dir>      cache font metrics in the given directory\n");
 PF("-help or --help       output this information, then exit\n");
 PF("-MP <file>            specify MIDIperc file\n");
 PF("-MV <file>            specify MIDIvoices file\n");
@@ -536,6 +556,9 @@ PF("-printside <n>        output only odd or even sides\n");
 PF("-ps                   select PostScript output\n");
 PF("-reverse              output pages in reverse order\n");
 PF("-s <list>             select staves\n");
+PF("-scorecache <dir>     cache the parsed score in the given directory\n");
+PF("-server               read job descriptions from stdin and run each job\n");
+PF("-socket <path>        run as a server, reading jobs from a Unix socket\n");
 PF("-t <number>           set transposition\n");
 PF("-V or --version       output PMW version number, then exit\n");
 PF("-v                    output verification information\n");
@@ -549,6 +572,19 @@ PF("-incPMWfont or -ipf   include PMW font in the output\n");
 PF("-manualfeed           set manualfeed in the PostScript\n");
 PF("-tumble               set tumble for duplex printing\n");
 
+PF("\nPDF-SPECIFIC OPTIONS\n\n");
+PF("-linearize            arrange PDF for fast display of first page on the web\n");
+PF("-pdfcompress <n>      set PDF stream compression level (0-9, 0 = none)\n");
+PF("-pdfopt<selectors>    set option(s) for PDF output (see below)\n");
+
+PF("\nPDF option selectors (+ to add, - to subtract):");
+for (usint i = 0, j = 0; i < PDF_OPTIONS_COUNT; i++)
+  {
+  if ((j++ & 7) == 0) PF("\n ");
+  (void)printf(" %s", pdf_options_table[i].name);
+  }
+PF("\n");
+
 #if SUPPORT_XML
 PF("\nMUSICXML OUTPUT OPTIONS\n\n");
 PF("-musicxml <file>      specify MusicXML output file\n");
@@ -575,6 +611,7 @@ PF("-em <n>               synonym for -errormaximum\n");
 PF("-errormaximum <n>     set maximum number of errors (for testing)\n");
 PF("-MacOSapp <directory> resource directory when run from a MacOS app\n");
 PF("-MF <directory-list>  specify music font directories\n");
+PF("-memstats             show memory use by category at the end\n");
 PF("-SM <directory>       specify standard macros directory\n");
 PF("-testing [<n>]        run in testing mode\n");
 
@@ -686,13 +723,13 @@ if (results[arg_MacOSapp].text != NULL)
   font_music_default = resources;
   stdmacs_dir = resources;
 
-  midi_perc = mem_get(rlen + 9);
+  midi_perc = mem_get(rlen + 9, mt_string);
   sprintf(CS midi_perc, "%s/MIDIperc", resources);
 
-  midi_voices = mem_get(rlen + 11);
+  midi_voices = mem_get(rlen + 11, mt_string);
   sprintf(CS midi_voices, "%s/MIDIvoices", resources);
 
-  ps_header = mem_get(rlen + 9);
+  ps_header = mem_get(rlen + 9, mt_string);
   sprintf(CS ps_header, "%s/PSheader", resources);
   }
 
@@ -762,6 +799,24 @@ MIDIvoices, and StdMacs files */
 if (results[arg_F].text != NULL)
   font_data_extra = US results[arg_F].text;
 
+if (results[arg_fontcache].text != NULL)
+  font_cache_dir = US results[arg_fontcache].text;
+
+if (results[arg_scorecache].text != NULL)
+  scorecache_dir = US results[arg_scorecache].text;
+
+/* Deal with server and batch modes */
+
+if (results[arg_batch].text != NULL)
+  main_batch_file = US results[arg_batch].text;
+
+if (results[arg_server].number != 0) main_server = TRUE;
+if (results[arg_socket].text != NULL)
+  {
+  main_server_socket = US results[arg_socket].text;
+  main_server = TRUE;
+  }
+
 if (results[arg_H].text != NULL)
   ps_header = CUS results[arg_H].text;
 
@@ -848,6 +903,7 @@ if (results[arg_em].presence != arg_present_not)
 if (results[arg_nowidechars].number != 0) stave_use_widechars = FALSE;
 if (results[arg_drawbarlines].number != 0) bar_use_draw = TRUE;
 if (results[arg_norepeats].number != 0) midi_repeats = FALSE;
+if (results[arg_memstats].number != 0) main_memstats = TRUE;
 
 /* Draw stave lines instead of using font characters: the thickness can
 optionally be altered. */
@@ -951,6 +1007,30 @@ if (results[arg_printscale].text != NULL)
   if (print_magnification == 0) error(ERR140);  /* Hard */
   }
 
+/* Deal with PDF compression; the default depends on whether testing. */
+
+if (results[arg_pdfcompress].presence != arg_present_not)
+  {
+  pdf_compress = results[arg_pdfcompress].number;
+  if (pdf_compress < 0 || pdf_compress > 9)
+    error(ERR202, "pdfcompress", 0, 9);  /* Hard */
+  }
+else pdf_compress = (main_testing == 0)? 6 : 0;
+
+pdf_options = (main_testing == 0)? pdfopt_default : 0;
+if (results[arg_pdfopt].text != NULL)
+  decode_bitselector("-pdfopt", results[arg_pdfopt].text + 7,
+    pdf_options_table, PDF_OPTIONS_COUNT, &pdf_options);  /* Any errors are hard */
+
+/* Linearized PDF output requires all the objects to be available at the end,
+in the traditional form. */
+
+if (results[arg_linearize].number != 0)
+  {
+  pdf_linearize = TRUE;
+  pdf_options &= ~(pdfopt_objstreams | pdfopt_streaming);
+  }
+
 if (results[arg_printside].presence != arg_present_not)
   {
   int n = results[arg_printside].number;
@@ -1060,7 +1140,7 @@ else
           {
           uschar *pp = p;
           while (*p != 0 && !isspace(*p)) p++;
-          nargv[nargc] = mem_get(p - pp + 1);
+          nargv[nargc] = mem_get(p - pp + 1, mt_misc);
           Ustrncpy(nargv[nargc], pp, p - pp);
           nargv[nargc++][p-pp] = 0;
           while (isspace(*p)) p++;
@@ -1132,11 +1212,11 @@ for (i = 0; i < MAX_MACRODEPTH; i++)
 
 /* Get fixed-size memory blocks */
 
-read_baraccs = mem_get(BARACCS_LEN * sizeof(int8_t));
-read_baraccs_tp = mem_get(BARACCS_LEN * sizeof(int8_t));
+read_baraccs = mem_get(BARACCS_LEN * sizeof(int8_t), mt_misc);
+read_baraccs_tp = mem_get(BARACCS_LEN * sizeof(int8_t), mt_misc);
 
-read_beamstack = mem_get(BEAMSTACKSIZE * sizeof(b_notestr **));
-read_stemstack = mem_get(STEMSTACKSIZE * sizeof(b_notestr **));
+read_beamstack = mem_get(BEAMSTACKSIZE * sizeof(b_notestr **), mt_misc);
+read_stemstack = mem_get(STEMSTACKSIZE * sizeof(b_notestr **), mt_misc);
 
 /* Set up the default fonts */
 
@@ -1147,16 +1227,11 @@ font_addfont(US"Times-BoldItalic", font_bi, 0);
 font_addfont(US"Symbol", font_sy, 0);
 font_addfont(US"PMW-Music", font_mf, 0);
 
-/* Initialize MIDI data */
-
-midi_translate(&midi_voicenames, midi_voices);
-midi_translate(&midi_percnames, midi_perc);
-
 /* Initialize for B2PF if supported */
 
 #if defined SUPPORT_B2PF && SUPPORT_B2PF != 0
-font_b2pf_contexts = mem_get(font_tablen * sizeof(b2pf_context *));
-font_b2pf_options = mem_get(font_tablen * sizeof(uint32_t));
+font_b2pf_contexts = mem_get(font_tablen * sizeof(b2pf_context *), mt_font);
+font_b2pf_options = mem_get(font_tablen * sizeof(uint32_t), mt_font);
 for (i = 0; i < font_tablen; i++)
   {
   font_b2pf_contexts[i] = NULL;
@@ -1183,7 +1258,9 @@ Returns:   nothing
 static void
 tidy_up(void)
 {
-if (read_filehandle != NULL) (void)fclose(read_filehandle);
+if (read_filehandle != NULL) (void)read_close_file();
+read_free_include_cache();
+tree_free_index();
 free(font_list);
 
 #if defined SUPPORT_B2PF && SUPPORT_B2PF != 0
@@ -1247,15 +1324,35 @@ int
 main(int argc, char **argv)
 {
 int maxfootingdepth = 0;
+int newargc;
 (void) argc;
 
 if (atexit(tidy_up) != 0) error(ERR25);  /* Hard */
 
-newargv = mem_get(MAX_COMMANDARGS * sizeof(char *));
-decode_command(init_command(argv, newargv), newargv);
+newargv = mem_get(MAX_COMMANDARGS * sizeof(char *), mt_misc);
+newargc = init_command(argv, newargv);
+decode_command(newargc, newargv);
 
 if (!initialize()) exit(EXIT_FAILURE);
 
+/* In server or batch mode, server_run() returns only in a new process that is
+to run a job. The job's arguments are added to the server's, and decoded
+again. */
+
+if (main_server || main_batch_file != NULL)
+  {
+  char **jobargv;
+  int jobargc = server_run(newargc, newargv, &jobargv);
+  decode_command(jobargc, jobargv);
+  server_check_job();
+  }
+
+/* Initialize MIDI data. This is not done in initialize(), because a server or
+batch job may specify its own MIDI translation files. */
+
+midi_translate(&midi_voicenames, midi_voices);
+midi_translate(&midi_percnames, midi_perc);
+
 /* If there is a file name, open it. If no output file is specified, default it
 to the input name with a .ps extension. */
 
@@ -1270,7 +1367,7 @@ if (main_filename != NULL)
     {
     uschar *p, *q;
     size_t len = Ustrlen(main_filename);
-    out_filename = mem_get(len + 5);
+    out_filename = mem_get(len + 5, mt_string);
     Ustrcpy(out_filename, main_filename);
     if ((p = Ustrrchr(out_filename, '.')) != NULL &&
         ((q = Ustrrchr(out_filename, '/')) == NULL || q < p))
@@ -1279,17 +1376,30 @@ if (main_filename != NULL)
     }
   }
 
-else
+else if (read_filehandle == NULL)
   {
   read_filehandle = stdin;
   read_filename = US "<stdin>";
   }
 
+read_map_file();
+
 /* Read the input file */
 
 main_state = STATE_READ;
 if (main_verify) eprintf( "Reading input file\n");
-read_file(FT_AUTO);
+if (!scorecache_load())
+  {
+  read_file(FT_AUTO);
+  mem_compact_bars();
+  scorecache_save();
+  }
+
+/* Macro definitions, the MusicXML input items, and the original copies of
+the bar items are no longer needed. */
+
+memset(macro_table, 0, MACRO_HASHSIZE * sizeof(macrostr *));
+mem_arena_free(arena_read);
 main_truepagelength = main_pagelength;  /* Save unscaled value */
 
 /* Give up if no data was supplied */
@@ -1306,9 +1416,10 @@ pagination. */
 if (!main_suppress_output)
   {
   main_state = STATE_PAGINATE;
-  wk_cont = mem_get_independent((main_maxstave+1)*sizeof(contstr));
+  wk_cont = mem_get_independent((main_maxstave+1)*sizeof(contstr), mt_cont);
   if (main_verify) eprintf( "Paginating\n");
   paginate();
+  mem_arena_free(arena_paginate);
   }
 
 /* Give up after a serious error. */
@@ -1391,6 +1502,7 @@ main_state = STATE_WRITE;
 if (PDF) pdf_go(); else ps_go();
 if (out_file != stdout && fclose(out_file) != 0) error(ERR200,
   PDF? "PDF file" : "PostScript file", strerror(errno));
+if (PDF) pdf_free_data();
 main_state = STATE_ENDING;
 
 DEBUG(D_barO) debug_bar("After writing main output");
@@ -1405,6 +1517,7 @@ if (midi_filename != NULL)
   {
   if (main_verify) eprintf("Writing MIDI file \"%s\"\n", midi_filename);
   midi_write();
+  mem_arena_free(arena_midi);
   }
 
 /* Write MusicXML output if required. MusicXML supports only one movement per
@@ -1460,11 +1573,15 @@ if (outxml_filename != NULL)
   }
 
 outxml_write_ignored();
+outxml_free();
 #endif
 
 if (main_verify) eprintf( "PMW done\n"); else TRACE("Done\n");
 
+DEBUG(D_stringcache) string_widthcache_statistics();
+DEBUG(D_treehash) tree_statistics();
 DEBUG(D_memory) debug_memory_usage();
+if (main_memstats) mem_statistics();
 exit(EXIT_SUCCESS);
 }
 
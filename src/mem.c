@@ -4,22 +4,140 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: December 2020 */
-/* This file last modified: January 2026 */
+/* This file last modified: October 2026 */
 
 /* This module handles two types of memory management. "Independent" blocks are
 used for large items such as font tables. Smaller blocks are doled out from
 large chunks as required. The chain of chunks can then easily be freed on exit.
-*/
+A table of all the blocks and their sizes is also kept, so that the score cache
+functions can find the block that contains any given address.
+
+There are several arenas, each with its own chain of chunks and independent
+blocks. Most memory comes from the main arena, which lasts for the whole run.
+The others hold data that is needed only during one phase of processing, such
+as macro definitions and the MusicXML input tree while reading, or the PDF
+object list while writing. An arena can be freed as soon as its phase is
+finished, which reduces the peak memory use for large scores.
+
+Every request is tagged with a category, and the number of requests and bytes
+in each category is counted separately for each processing phase, for output
+by the -memstats option. Bar items are also counted by type.
+
+After reading, the items in each bar are copied into a single block so that
+they lie contiguously in memory. */
 
 #include "pmw.h"
+#include <sys/resource.h>
+
+
+/* The state of one arena */
+
+typedef struct arenastr {
+  void   *anchor;                /* chain of chunks and independent blocks */
+  void   *current;               /* current chunk for small blocks */
+  size_t  top;                   /* offset of free space in current chunk */
+  size_t  independent_total;
+  usint   chunk_count;
+} arenastr;
+
+static arenastr arenas[ARENA_COUNT];
+
+static const char *arena_names[] = {
+  "main", "read", "paginate", "output", "midi", "xmlout" };
 
+static const char *tag_names[] = {
+  "miscellaneous", "bar items", "bar headers", "caches", "continuations",
+  "drawings", "fonts", "headings", "macros", "MIDI", "movements", "pages",
+  "PDF objects", "position vectors", "staves", "strings", "trees",
+  "MusicXML input" };
+
+static const char *phase_names[] = {
+  "init", "read", "paginate", "write", "ending" };
+
+#define PHASE_COUNT (STATE_ENDING + 1)
+
+static uint64_t tag_bytes[MT_COUNT][PHASE_COUNT];
+static uint64_t tag_counts[MT_COUNT][PHASE_COUNT];
+static uint64_t item_bytes[b_baditem];
+static uint64_t item_counts[b_baditem];
 
-static void *anchor = NULL;
-static void *current = NULL;
 static bstr **record = NULL;
-static size_t top = MEMORY_CHUNKSIZE;
-static size_t independent_total = 0;
-static usint chunk_count = 0;
+
+static memblockstr *block_table = NULL;
+static usint block_count = 0;
+static usint block_table_size = 0;
+
+
+
+/*************************************************
+*           Count a request for memory           *
+*************************************************/
+
+/*
+Arguments:
+  size        the size of the request
+  tag         its category
+
+Returns:      nothing
+*/
+
+static void
+count_request(size_t size, usint tag)
+{
+int phase = (main_state < 0 || main_state >= PHASE_COUNT)? 0 : main_state;
+tag_bytes[tag][phase] += size;
+tag_counts[tag][phase]++;
+}
+
+
+
+/*************************************************
+*         Remember a block in the table          *
+*************************************************/
+
+/* The table is expanded as necessary.
+
+Arguments:
+  block       the start of the block
+  size        its size
+  arena       the arena it belongs to
+
+Returns:      nothing
+*/
+
+static void
+remember_block(void *block, size_t size, usint arena)
+{
+if (block_count >= block_table_size)
+  {
+  block_table_size += MEMORY_BLOCKTABLE_CHUNKSIZE;
+  block_table = realloc(block_table, block_table_size * sizeof(memblockstr));
+  if (block_table == NULL) error(ERR0, "re-", "memory block table",
+    block_table_size * sizeof(memblockstr));  /* Hard */
+  }
+block_table[block_count].start = block;
+block_table[block_count].arena = arena;
+block_table[block_count++].size = size;
+}
+
+
+
+/*************************************************
+*           Return the table of blocks           *
+*************************************************/
+
+/* Each block starts with the pointer that chains the blocks together.
+
+Argument:   where to return a pointer to the table
+Returns:    the number of blocks
+*/
+
+usint
+mem_get_blocks(memblockstr **table)
+{
+*table = block_table;
+return block_count;
+}
 
 
 
@@ -27,30 +145,79 @@ static usint chunk_count = 0;
 *                Return info                     *
 *************************************************/
 
+/* The values are totals for all the arenas. */
+
 usint
 mem_get_info(size_t *available, size_t *independent)
 {
-*independent = independent_total;
-*available = MEMORY_CHUNKSIZE - top;
-return chunk_count;
+usint chunks = 0;
+*available = *independent = 0;
+for (int i = 0; i < ARENA_COUNT; i++)
+  {
+  arenastr *a = arenas + i;
+  chunks += a->chunk_count;
+  *independent += a->independent_total;
+  if (a->current != NULL) *available += MEMORY_CHUNKSIZE - a->top;
+  }
+return chunks;
 }
 
 
+
 /*************************************************
-*                    Free all                    *
+*                Free one arena                  *
 *************************************************/
 
-void
-mem_free(void)
+/* All the chunks and independent blocks of the arena are freed, and removed
+from the table of blocks. The arena can then be used again.
+
+Argument:   the arena number
+Returns:    nothing
+*/
+
+static void
+free_chain(arenastr *a)
 {
-void *p = anchor;
+void *p = a->anchor;
 while (p != NULL)
   {
   void *q = p;
   p = (void *)(*((char **)p));
   free(q);
   }
-anchor = current = NULL;  /*Tidiness */
+memset(a, 0, sizeof(arenastr));
+}
+
+void
+mem_arena_free(usint arena)
+{
+arenastr *a = arenas + arena;
+usint j = 0;
+
+if (a->anchor == NULL) return;
+DEBUG(D_memory) eprintf("Freeing %s arena: %d chunk%s, %zd independent\n",
+  arena_names[arena], a->chunk_count, (a->chunk_count == 1)? "" : "s",
+  a->independent_total);
+
+free_chain(a);
+for (usint i = 0; i < block_count; i++)
+  if (block_table[i].arena != arena) block_table[j++] = block_table[i];
+block_count = j;
+}
+
+
+
+/*************************************************
+*                    Free all                    *
+*************************************************/
+
+void
+mem_free(void)
+{
+for (int i = 0; i < ARENA_COUNT; i++) free_chain(arenas + i);
+free(block_table);
+block_table = NULL;
+block_count = block_table_size = 0;
 }
 
 
@@ -64,11 +231,14 @@ PMW strings. By registering each block here, it ensures freeing happens at the
 end. */
 
 void
-mem_register(void *block, size_t size)
+mem_register(void *block, size_t size, usint tag)
 {
-*((void **)block) = anchor;
-anchor = block;
-independent_total += size;
+arenastr *a = arenas + arena_main;
+count_request(size, tag);
+*((void **)block) = a->anchor;
+a->anchor = block;
+a->independent_total += size;
+remember_block(block, size, arena_main);
 }
 
 
@@ -77,23 +247,32 @@ independent_total += size;
 *           Get a new independent block          *
 *************************************************/
 
-/* Each independent block is separate but hung on the chain so it gets freed at
-the end. */
+/* Each independent block is separate but hung on its arena's chain so it gets
+freed with the arena. */
 
 void *
-mem_get_independent(size_t size)
+mem_arena_get_independent(usint arena, size_t size, usint tag)
 {
+arenastr *a = arenas + arena;
 void *new;
 DEBUG(D_memorydetail) (void)fprintf(stderr, "Get independent %zd\n", size);
+count_request(size, tag);
 size += sizeof(char *);
 new = malloc(size);
 if (new == NULL) error(ERR0, "", "mem_get_independent()", size);  /* Hard */
-*((void **)new) = anchor;
-anchor = new;
-independent_total += size;
+*((void **)new) = a->anchor;
+a->anchor = new;
+a->independent_total += size;
+remember_block(new, size, arena);
 return (void *)((char *)new + sizeof(char *));
 }
 
+void *
+mem_get_independent(size_t size, usint tag)
+{
+return mem_arena_get_independent(arena_main, size, tag);
+}
+
 
 
 /*************************************************
@@ -105,9 +284,10 @@ multiple of the pointer size, which hopefully means that each block is aligned
 for any data type. */
 
 void *
-mem_get(size_t size)
+mem_arena_get(usint arena, size_t size, usint tag)
 {
-size_t available = MEMORY_CHUNKSIZE - top;
+arenastr *a = arenas + arena;
+size_t available = (a->current == NULL)? 0 : MEMORY_CHUNKSIZE - a->top;
 void *yield;
 
 size = (size + sizeof(char *) - 1);
@@ -121,6 +301,7 @@ Get a new chunk if the request won't fit in the current one. Since all blocks
 are relatively small compared to the chunk size, the wastage is unimportant. */
 
 if (size > MEMORY_MAXBLOCK) error(ERR1, size, MEMORY_MAXBLOCK);  /* Hard */
+count_request(size, tag);
 
 if (available < size)
   {
@@ -128,19 +309,26 @@ if (available < size)
   DEBUG(D_memorydetail) (void)fprintf(stderr, "\nNew small chunk 0x%p - 0x%p\n",
     (void *)newblock, (void *)(newblock + MEMORY_CHUNKSIZE));
   if (newblock == NULL) error(ERR0, "", "mem_get()", MEMORY_CHUNKSIZE); /* Hard */
-  chunk_count++;
-  *((void **)newblock) = anchor;
-  anchor = newblock;
-  current = newblock;
-  top = sizeof(char *);
+  a->chunk_count++;
+  *((void **)newblock) = a->anchor;
+  a->anchor = newblock;
+  a->current = newblock;
+  a->top = sizeof(char *);
+  remember_block(newblock, MEMORY_CHUNKSIZE, arena);
   }
 
-yield = (char *)current + top;
-top += size;
+yield = (char *)a->current + a->top;
+a->top += size;
 
 return yield;
 }
 
+void *
+mem_get(size_t size, usint tag)
+{
+return mem_arena_get(arena_main, size, tag);
+}
+
 
 
 /*************************************************
@@ -188,13 +376,33 @@ if (record != NULL)
 *    Get a new bar item block at end of chain    *
 *************************************************/
 
-/* These blocks are held in a two-way chain. */
+/* These blocks are held in a two-way chain. They are counted by type as well
+as in the bar items category. While reading, items are taken from the read
+arena, because they are copied into contiguous per-bar blocks at the end of
+reading (see mem_compact_bars() below). Any that are created later, for example
+while generating MusicXML, come from the main arena. The compaction relies on
+each type of item always having the same size. */
+
+static bstr *
+get_item(size_t size, usint type)
+{
+bstr *yield = mem_arena_get((main_state == STATE_READ)? arena_read :
+  arena_main, size, mt_baritem);
+yield->type = type;
+if (type < b_baditem)
+  {
+  if (size != bar_item_sizes[type])
+    error(ERR203, bar_item_names[type], size, bar_item_sizes[type]);  /* Hard */
+  item_bytes[type] += size;
+  item_counts[type]++;
+  }
+return yield;
+}
 
 void *
 mem_get_item(size_t size, usint type)
 {
-bstr *yield = mem_get(size);
-yield->type = type;
+bstr *yield = get_item(size, type);
 mem_connect_item(yield);
 return yield;
 }
@@ -211,8 +419,7 @@ existing block. */
 void *
 mem_get_insert_item(size_t size, usint type, bstr *next)
 {
-bstr *yield = mem_get(size);
-yield->type = type;
+bstr *yield = get_item(size, type);
 yield->next = next;
 yield->prev = next->prev;
 yield->prev->next = yield;
@@ -239,13 +446,136 @@ void *
 mem_duplicate_item(void *p, size_t size)
 {
 size_t offset = offsetof(bstr, type);
-void *new = mem_get_item(size, 0);
+void *new = mem_get_item(size, ((bstr *)p)->type);
 memcpy((char *)new + offset, (char *)p + offset, size - offset);
 return new;
 }
 
 
 
+/*************************************************
+*          Compact the bars after reading        *
+*************************************************/
+
+/* While reading, each bar's items are obtained one at a time as they are read,
+interleaved with strings, slur modifications, and other data, and some are
+inserted out of order. This function copies each bar, starting with its barstr
+header, into a single block, in chain order, so that the many scans of each bar
+during pagination and output run through contiguous memory. The next and prev
+pointers are retained and reset, so nothing else needs to change.
+
+Once an item has been copied, its old copy is marked with the type b_baditem,
+and its prev field is set to point to the new copy. This makes it easy to
+update the pointers that refer to items: the bar index, repeated bars, which
+have their own barstr that points into the chain of the first of them, and the
+two types of item that point to other items (overbeam and tie). The old copies
+of most items are in the read arena, which is freed after this is done.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+static void *
+forward(void *p)
+{
+bstr *b = (bstr *)p;
+return (b != NULL && b->type == b_baditem)? b->prev : p;
+}
+
+void
+mem_compact_bars(void)
+{
+usint barcount = 0;
+size_t total = 0;
+
+/* Copy each bar that has not already been done. */
+
+for (usint m = 0; m < movement_count; m++)
+  {
+  movtstr *mv = movements[m];
+  for (int s = 0; s <= mv->laststave; s++)
+    {
+    stavestr *st = mv->stavetable[s];
+    if (st == NULL || st->barindex == NULL) continue;
+
+    for (int b = 0; b < mv->barcount; b++)
+      {
+      bstr *p = (bstr *)(st->barindex[b]);
+      bstr *last = NULL;
+      size_t size = 0;
+      char *block;
+
+      /* Skip bars that have been copied; a bar that repeats an earlier one
+      just has its pointer updated. */
+
+      if (p == NULL || p->type == b_baditem) continue;
+      if (p->next != NULL && p->next->type == b_baditem)
+        {
+        p->next = p->next->prev;
+        continue;
+        }
+
+      for (bstr *q = p; q != NULL; q = q->next)
+        size += bar_item_sizes[q->type];
+
+      block = (size > MEMORY_MAXBLOCK)? mem_get_independent(size, mt_baritem) :
+        mem_get(size, mt_baritem);
+      barcount++;
+      total += size;
+
+      for (bstr *q = p; q != NULL; q = q->next)
+        {
+        bstr *new = (bstr *)block;
+        block += bar_item_sizes[q->type];
+        memcpy(new, q, bar_item_sizes[q->type]);
+        new->prev = last;
+        if (last != NULL) last->next = new;
+        last = new;
+        q->type = b_baditem;
+        q->prev = new;
+        }
+      last->next = NULL;
+      }
+    }
+  }
+
+/* Now update the bar indexes and any pointers between items. */
+
+for (usint m = 0; m < movement_count; m++)
+  {
+  movtstr *mv = movements[m];
+  for (int s = 0; s <= mv->laststave; s++)
+    {
+    stavestr *st = mv->stavetable[s];
+    if (st == NULL || st->barindex == NULL) continue;
+
+    for (int b = 0; b < mv->barcount; b++)
+      {
+      st->barindex[b] = forward(st->barindex[b]);
+      if (st->barindex[b] == NULL) continue;
+      for (bstr *p = st->barindex[b]->next; p != NULL; p = p->next)
+        {
+        if (p->type == b_tie)
+          {
+          b_tiestr *t = (b_tiestr *)p;
+          t->noteprev = forward(t->noteprev);
+          }
+        else if (p->type == b_overbeam)
+          {
+          b_overbeamstr *ob = (b_overbeamstr *)p;
+          ob->nextbar = forward(ob->nextbar);
+          }
+        }
+      }
+    }
+  }
+
+DEBUG(D_memory) eprintf("Compacted %d bar%s into %zd bytes\n", barcount,
+  (barcount == 1)? "" : "s", total);
+}
+
+
+
 /*************************************************
 *         Copy a C string into a new block       *
 *************************************************/
@@ -254,7 +584,7 @@ uschar *
 mem_copystring(uschar *s)
 {
 size_t len = Ustrlen(s) + 1;
-uschar *yield = mem_get(len);
+uschar *yield = mem_get(len, mt_string);
 memcpy(yield, s, len);
 return yield;
 }
@@ -268,17 +598,17 @@ return yield;
 /* A number of types of small block that are used and re-used are put on free
 chains in between. This function gets a block off such a chain, or gets a new
 one if the chain is empty. These blocks all have a "next" pointer at their
-start. */
+start. Only new blocks are counted for statistics. */
 
 typedef struct cached_block {
   struct cached_block *next;
 } cached_block;
 
 void *
-mem_get_cached(void **anchorptr, size_t size)
+mem_get_cached(void **anchorptr, size_t size, usint tag)
 {
 void *yield = *anchorptr;
-if (yield == NULL) yield = mem_get(size);
+if (yield == NULL) yield = mem_get(size, tag);
   else *anchorptr = ((cached_block *)yield)->next;
 return yield;
 }
@@ -297,4 +627,80 @@ mem_free_cached(void **anchorptr, void *p)
 }
 
 
+
+/*************************************************
+*           Output memory statistics             *
+*************************************************/
+
+/* This is called at the end of a run when -memstats is set. The figures are
+the sizes that were requested, rounded up for alignment, so they do not include
+unused space at the ends of chunks. The peak resident set size comes from the
+operating system.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+mem_statistics(void)
+{
+struct rusage ru;
+uint64_t phase_total[PHASE_COUNT];
+uint64_t grand_total = 0;
+size_t available, independent;
+usint chunks;
+
+memset(phase_total, 0, sizeof(phase_total));
+
+eprintf("\nMEMORY STATISTICS (bytes requested, with counts)\n");
+eprintf("%-18s", "Category");
+for (int j = 0; j < PHASE_COUNT; j++) eprintf("%20s", phase_names[j]);
+eprintf("%20s\n", "total");
+
+for (int i = 0; i < MT_COUNT; i++)
+  {
+  uint64_t bytes = 0, count = 0;
+  for (int j = 0; j < PHASE_COUNT; j++)
+    {
+    bytes += tag_bytes[i][j];
+    count += tag_counts[i][j];
+    }
+  if (count == 0) continue;
+  eprintf("%-18s", tag_names[i]);
+  for (int j = 0; j < PHASE_COUNT; j++)
+    {
+    if (tag_counts[i][j] == 0) eprintf("%20s", "-"); else
+      eprintf("%11" PRIu64 " (%6" PRIu64 ")", tag_bytes[i][j],
+        tag_counts[i][j]);
+    phase_total[j] += tag_bytes[i][j];
+    }
+  eprintf("%11" PRIu64 " (%6" PRIu64 ")\n", bytes, count);
+  grand_total += bytes;
+  }
+
+eprintf("%-18s", "Total");
+for (int j = 0; j < PHASE_COUNT; j++) eprintf("%20" PRIu64, phase_total[j]);
+eprintf("%20" PRIu64 "\n", grand_total);
+
+eprintf("\nBar items by type (bytes, count)\n");
+for (int i = 0; i < b_baditem; i++)
+  if (item_counts[i] != 0) eprintf("  %-16s %11" PRIu64 " %8" PRIu64 "\n",
+    bar_item_names[i], item_bytes[i], item_counts[i]);
+
+chunks = mem_get_info(&available, &independent);
+eprintf("\nCurrently held: %d chunk%s of %d bytes (%zd unused), %zd bytes in "
+  "independent blocks\n", chunks, (chunks == 1)? "" : "s", MEMORY_CHUNKSIZE,
+  available, independent);
+
+if (getrusage(RUSAGE_SELF, &ru) == 0)
+  {
+#ifdef __APPLE__
+  uint64_t peak = (uint64_t)ru.ru_maxrss;          /* Bytes on macOS */
+#else
+  uint64_t peak = (uint64_t)ru.ru_maxrss * 1024;   /* Kilobytes elsewhere */
+#endif
+  eprintf("Peak resident set size: %" PRIu64 " bytes\n", peak);
+  }
+}
+
 /* End of mem.c */
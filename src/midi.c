@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: August 2021 */
-/* This file last modified: January 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -930,9 +930,11 @@ last_written_time = 0;
 running_status = 0;
 
 /* Get store in which to hold a bar's events before sorting. For the
-first bar, it is empty at the start. */
+first bar, it is empty at the start. The midi arena is freed after the MIDI
+file has been written. */
 
-events = mem_get_independent(sizeof(midi_event) * 1000);
+events = mem_arena_get_independent(arena_midi, sizeof(midi_event) * 1000,
+  mt_midi);
 next_event = events;
 next_event_seq = 0;
 
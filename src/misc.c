@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: January 2021 */
-/* This file last modified: January 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -59,6 +59,23 @@ return rc;
 
 
 
+/*************************************************
+*     Provide case-independent string match      *
+*************************************************/
+
+int
+strncmpic(const unsigned char *s, const unsigned char *t, int n)
+{
+while (n--)
+  {
+  int c = tolower(*s++) - tolower(*t++);
+  if (c != 0) return c;
+  }
+return 0;
+}
+
+
+
 /*************************************************
 *           Get range from bit map               *
 *************************************************/
@@ -386,7 +403,7 @@ for (int i = 0; i <= count; i++)
   if (p->hairpin != NULL)
     {
     q->hairpin = mem_get_cached((void **)(&main_freehairpinstr),
-      sizeof(hairpinstr));
+      sizeof(hairpinstr), mt_cont);
     *(q->hairpin) = *(p->hairpin);
     }
 
@@ -395,7 +412,7 @@ for (int i = 0; i <= count; i++)
   if (p->overbeam != NULL)
     {
     q->overbeam = mem_get_cached((void **)(&main_freeobeamstr),
-      sizeof(obeamstr));
+      sizeof(obeamstr), mt_cont);
     *(q->overbeam) = *(p->overbeam);
     }
 
@@ -404,7 +421,7 @@ for (int i = 0; i <= count; i++)
   while (nb != NULL)
     {
     nbarstr *nbb = mem_get_cached((void **)(&main_freenbarblocks),
-      sizeof(nbarstr));
+      sizeof(nbarstr), mt_cont);
     *nbb = *nb;
     *nbprev = nbb;
     nbprev = &(nbb->next);
@@ -419,7 +436,7 @@ for (int i = 0; i <= count; i++)
   while (s != NULL)
     {
     slurstr *ss = mem_get_cached((void **)(&main_freeslurblocks),
-      sizeof(slurstr));
+      sizeof(slurstr), mt_cont);
     gapstr *g = s->gaps;
     gapstr **gprev = &(ss->gaps);
     if (incslur) s->section += 1;
@@ -428,7 +445,7 @@ for (int i = 0; i <= count; i++)
     while (g != NULL)
       {
       gapstr *gg = mem_get_cached((void **)(&main_freegapblocks),
-        sizeof(gapstr));
+        sizeof(gapstr), mt_cont);
       *gg = *g;
       *gprev = gg;
       gprev = &(gg->next);
@@ -446,7 +463,7 @@ for (int i = 0; i <= count; i++)
   while (u != NULL)
     {
     uolaystr *uu = mem_get_cached((void **)(&main_freeuolayblocks),
-      sizeof(uolaystr));
+      sizeof(uolaystr), mt_cont);
     *uu = *u;
     *uoprev = uu;
     uoprev = &(uu->next);
@@ -537,7 +554,8 @@ Returns:       nothing
 void
 misc_startnbar(b_nbarstr *nb, int32_t x, int32_t miny)
 {
-nbarstr *nbb = mem_get_cached((void **)(&main_freenbarblocks), sizeof(nbarstr));
+nbarstr *nbb = mem_get_cached((void **)(&main_freenbarblocks), sizeof(nbarstr),
+  mt_cont);
 nbb->next = NULL;
 nbb->nbar = nb;
 nbb->x = x;
@@ -795,4 +813,198 @@ return yield;
 }
 
 
+
+/*************************************************
+*          Hash functions for keywords           *
+*************************************************/
+
+/* The first is the 32-bit FNV-1a hash of a keyword. The second mixes this
+with a bucket's displacement to give a slot number.
+
+Arguments:
+  s          the keyword
+  h          the keyword's hash
+  d          a displacement
+
+Returns:     a hash value
+*/
+
+static uint32_t
+keyhash_name(const uschar *s)
+{
+uint32_t h = 2166136261u;
+while (*s != 0) h = (h ^ *s++) * 16777619u;
+return h;
+}
+
+static uint32_t
+keyhash_slot(uint32_t h, uint32_t d)
+{
+h ^= d * 0x85ebca6bu;
+h ^= h >> 13;
+h *= 0xc2b2ae35u;
+return h ^ (h >> 16);
+}
+
+/* Find the keyword in an item of a table. */
+
+static const char *
+keyhash_key(keyhashstr *kh, usint i)
+{
+return *((const char **)((const char *)(kh->table) + i * kh->itemsize));
+}
+
+
+
+/*************************************************
+*       Build a perfect hash for a keyword table *
+*************************************************/
+
+/* The table must consist of structures whose first field is the keyword, and
+be sorted by keyword. The method is "hash and displace": the keywords are
+divided into buckets by their hashes, and then, starting with the largest
+bucket, a displacement is found for each bucket that puts all its keywords
+into unused slots. A lookup then needs just one hash computation and one string
+comparison. If no set of displacements can be found (which should not happen)
+the slot vector is left NULL, and misc_keyhash_find() uses a binary search.
+
+Arguments:
+  kh         the keyhash structure to set up
+  table      the keyword table
+  count      the number of items in the table
+  itemsize   the size of each item
+
+Returns:     nothing
+*/
+
+void
+misc_keyhash_build(keyhashstr *kh, const void *table, usint count,
+  size_t itemsize)
+{
+usint nbuckets = 1;
+usint nslots = 1;
+uint32_t *hashes = mem_get(count * sizeof(uint32_t), mt_cache);
+usint *order;
+
+kh->table = table;
+kh->itemsize = itemsize;
+kh->count = count;
+kh->slots = NULL;
+
+while (nbuckets < (count + 3)/4) nbuckets <<= 1;
+while (nslots < count + count/4 + 1) nslots <<= 1;
+
+kh->bucketmask = nbuckets - 1;
+kh->displacements = mem_get(nbuckets * sizeof(uint32_t), mt_cache);
+order = mem_get(nbuckets * sizeof(usint), mt_cache);
+
+for (usint i = 0; i < count; i++)
+  hashes[i] = keyhash_name(US keyhash_key(kh, i));
+
+/* Sort the buckets by decreasing size (a simple insertion sort is fine for
+these small tables). */
+
+for (usint b = 0; b < nbuckets; b++)
+  {
+  usint j, size = 0;
+  for (usint i = 0; i < count; i++)
+    if ((hashes[i] & kh->bucketmask) == b) size++;
+  kh->displacements[b] = size;   /* Temporary use */
+  for (j = b; j > 0 && kh->displacements[order[j-1]] < size; j--)
+    order[j] = order[j-1];
+  order[j] = b;
+  }
+
+/* Try increasingly large slot vectors until all buckets have been placed. */
+
+for (; nslots <= 64 * count; nslots <<= 1)
+  {
+  int16_t *slots = mem_get(nslots * sizeof(int16_t), mt_cache);
+  usint b;
+
+  for (usint i = 0; i < nslots; i++) slots[i] = -1;
+
+  for (b = 0; b < nbuckets; b++)
+    {
+    uint32_t bucket = order[b];
+    uint32_t d;
+
+    for (d = 0; d < 4 * nslots; d++)
+      {
+      usint i;
+      for (i = 0; i < count; i++)
+        {
+        usint s;
+        if ((hashes[i] & kh->bucketmask) != bucket) continue;
+        s = keyhash_slot(hashes[i], d) & (nslots - 1);
+        if (slots[s] >= 0) break;
+        slots[s] = i;
+        }
+
+      if (i >= count) break;   /* All placed */
+
+      /* Undo any placements for this displacement and try the next. */
+
+      for (usint k = 0; k < i; k++)
+        {
+        if ((hashes[k] & kh->bucketmask) != bucket) continue;
+        slots[keyhash_slot(hashes[k], d) & (nslots - 1)] = -1;
+        }
+      }
+
+    if (d >= 4 * nslots) break;   /* Failed */
+    kh->displacements[bucket] = d;
+    }
+
+  if (b >= nbuckets)
+    {
+    kh->slotmask = nslots - 1;
+    kh->slots = slots;
+    break;
+    }
+  }
+}
+
+
+
+/*************************************************
+*        Look up a keyword in a hashed table     *
+*************************************************/
+
+/* The table is set up by misc_keyhash_build().
+
+Arguments:
+  kh         the keyhash structure
+  name       the keyword to look up
+
+Returns:     the index of the keyword in the table, or -1 if not found
+*/
+
+int
+misc_keyhash_find(keyhashstr *kh, uschar *name)
+{
+int bot, top;
+
+if (kh->slots != NULL)
+  {
+  uint32_t h = keyhash_name(name);
+  int i = kh->slots[keyhash_slot(h, kh->displacements[h & kh->bucketmask]) &
+    kh->slotmask];
+  return (i >= 0 && Ustrcmp(name, keyhash_key(kh, i)) == 0)? i : -1;
+  }
+
+bot = 0;
+top = kh->count;
+while (top > bot)
+  {
+  int mid = (bot + top)/2;
+  int c = Ustrcmp(name, keyhash_key(kh, mid));
+  if (c == 0) return mid;
+  if (c > 0) bot = mid + 1; else top = mid;
+  }
+
+return -1;
+}
+
+
 /* End of misc.c */
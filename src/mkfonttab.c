@@ -0,0 +1,315 @@
+/*************************************************
+*     PMW: generate built-in font metrics        *
+*************************************************/
+
+/* Copyright Philip Hazel 2026 */
+/* This file created: October 2026 */
+/* This file last modified: October 2026 */
+
+/* This program is run at build time. It is linked with all of PMW's modules
+except main.c, so that the fontmetrics (.afm) and Unicode translation (.utr)
+files that are named as its arguments are read by exactly the same code that
+PMW uses at run time. Each font is loaded twice, once for PostScript and once
+for PDF output, because the encoding of a font that is not standardly encoded
+depends on the output format. The resulting tables are written to stdout as a C
+source file, so that the fonts that PMW always uses can be set up without
+searching for or parsing any files. Only .afm arguments are processed; the
+.utr file for a font is looked for in the same directory. */
+
+#include "pmw.h"
+
+/* PMW's font code looks for compiled-in fonts, so there must be an empty table
+of them here. */
+
+const fontbuiltinstr font_builtin_fonts[] = {
+  { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, { 0, 0, 0, 0 } } };
+usint font_builtin_count = 0;
+
+/* What is remembered about each font, for writing the table at the end */
+
+typedef struct {
+  uschar  name[256];
+  fontstr fs;
+  int     highcount;
+  BOOL    pdfencoding;
+} fontitem;
+
+
+
+/*************************************************
+*           Write a string literal               *
+*************************************************/
+
+/* Characters other than letters, digits, and a few punctuation characters are
+written as three-digit octal escapes.
+
+Argument:  the string
+Returns:   nothing
+*/
+
+static void
+write_string(const uschar *s)
+{
+(void)putchar('"');
+for (; *s != 0; s++)
+  {
+  if (isalnum(*s) || *s == '.' || *s == '_' || *s == '-') (void)putchar(*s);
+    else (void)printf("\\%03o", *s);
+  }
+(void)putchar('"');
+}
+
+
+
+/*************************************************
+*          Write a vector of integers            *
+*************************************************/
+
+/*
+Arguments:
+  type       the name of the type
+  name       the name of the vector
+  n          the font's number
+  v          the values
+  count      the number of values
+
+Returns:     nothing
+*/
+
+static void
+write_vector(const char *type, const char *name, int n, int32_t *v, int count)
+{
+(void)printf("static const %s %s_%d[] = {", type, name, n);
+for (int i = 0; i < count; i++)
+  {
+  if (i % 10 == 0) (void)printf("\n ");
+  (void)printf(" %d%s", v[i], (i == count - 1)? "" : ",");
+  }
+(void)printf(" };\n\n");
+}
+
+
+
+/*************************************************
+*         Write the items in a tree              *
+*************************************************/
+
+/* The items of the high character tree are written in order.
+
+Argument:  the tree node
+Returns:   the number of items
+*/
+
+static int
+write_tree(tree_node *t)
+{
+int count;
+if (t == NULL) return 0;
+count = write_tree(t->left);
+(void)printf("  { ");
+write_string(t->name);
+(void)printf(", %d },\n", t->value);
+return count + 1 + write_tree(t->right);
+}
+
+
+
+/*************************************************
+*              Write an encoding                 *
+*************************************************/
+
+/* Only the encoded characters are written, using designated initializers.
+
+Arguments:
+  name       the name of the vector
+  n          the font's number
+  encoding   the encoding
+
+Returns:     nothing
+*/
+
+static void
+write_encoding(const char *name, int n, uschar **encoding)
+{
+(void)printf("static const char *const %s_%d[FONTWIDTHS_SIZE] = {\n", name, n);
+for (int i = 0; i < FONTWIDTHS_SIZE; i++)
+  {
+  if (encoding[i] == NULL) continue;
+  (void)printf("  [%d] = ", i);
+  write_string(encoding[i]);
+  (void)printf(",\n");
+  }
+(void)printf("  };\n\n");
+}
+
+
+
+/*************************************************
+*               Load one font                    *
+*************************************************/
+
+/* The font is added to PMW's font list and loaded. A copy of its structure is
+returned, because adding another font may move the list.
+
+Arguments:
+  name       the font's name
+  fontid     the font id to use
+  pdf        TRUE to load for PDF output
+
+Returns:     a copy of the font structure
+*/
+
+static fontstr
+load_font(uschar *name, uint32_t fontid, BOOL pdf)
+{
+PDF = pdf;
+font_addfont(name, fontid, 0);
+return *font_load(font_table[fontid]);
+}
+
+
+
+/*************************************************
+*                 Entry point                    *
+*************************************************/
+
+int
+main(int argc, char **argv)
+{
+int n = 0;
+fontitem *items = malloc(argc * sizeof(fontitem));
+
+if (items == NULL)
+  {
+  (void)fprintf(stderr, "mkfonttab: malloc() failed\n");
+  return EXIT_FAILURE;
+  }
+
+(void)printf("/* This file was generated by mkfonttab from the PMW fontmetrics "
+  "files. */\n/* Do not edit it; edit the original files instead. */\n\n"
+  "#include \"pmw.h\"\n\n");
+
+for (int i = 1; i < argc; i++)
+  {
+  fontitem *fi = items + n;
+  fontstr ps, pdf;
+  uschar dir[256];
+  char *p = strrchr(argv[i], '/');
+  size_t len = strlen(argv[i]);
+
+  if (len < 4 || strcmp(argv[i] + len - 4, ".afm") != 0) continue;
+  if (len >= sizeof(dir))
+    {
+    (void)fprintf(stderr, "mkfonttab: %s: name too long\n", argv[i]);
+    return EXIT_FAILURE;
+    }
+
+  if (p == NULL) Ustrcpy(dir, "."); else
+    {
+    memcpy(dir, argv[i], p - argv[i]);
+    dir[p - argv[i]] = 0;
+    }
+  Ustrcpy(fi->name, (p == NULL)? argv[i] : p + 1);
+  fi->name[Ustrlen(fi->name) - 4] = 0;
+
+  font_data_default = dir;
+  font_data_extra = NULL;
+  ps = load_font(fi->name, font_xx, FALSE);
+  pdf = load_font(fi->name, font_xx + 1, TRUE);
+
+  /* Only the encoding may differ between the two output formats. */
+
+  if (error_get_count() != 0 ||
+      memcmp(ps.widths, pdf.widths, FONTWIDTHS_SIZE * sizeof(int32_t)) != 0 ||
+      ps.kerncount != pdf.kerncount ||
+      ps.utrcount != pdf.utrcount ||
+      ps.invalid != pdf.invalid)
+    {
+    (void)fprintf(stderr, "mkfonttab: failed to load %s consistently\n",
+      argv[i]);
+    return EXIT_FAILURE;
+    }
+
+  (void)printf("/* %s */\n\n", fi->name);
+  write_vector("int32_t", "widths", n, ps.widths, FONTWIDTHS_SIZE);
+  write_vector("int32_t", "r2ladjusts", n, ps.r2ladjusts, FONTWIDTHS_SIZE);
+  if (ps.heights != NULL)
+    write_vector("int32_t", "heights", n, ps.heights, 256);
+
+  if (ps.kerncount > 0)
+    {
+    (void)printf("static const kerntablestr kerns_%d[] = {", n);
+    for (int k = 0; k < ps.kerncount; k++)
+      {
+      if (k % 4 == 0) (void)printf("\n ");
+      (void)printf(" { %u, %u, %d }%s", ps.kerns[k].left, ps.kerns[k].right,
+        ps.kerns[k].kwidth, (k == ps.kerncount - 1)? "" : ",");
+      }
+    (void)printf(" };\n\n");
+    }
+
+  if (ps.utrcount > 0)
+    {
+    (void)printf("static const utrtablestr utr_%d[] = {", n);
+    for (int k = 0; k < ps.utrcount; k++)
+      {
+      if (k % 4 == 0) (void)printf("\n ");
+      (void)printf(" { 0x%04x, %u }%s", ps.utr[k].unicode, ps.utr[k].pscode,
+        (k == ps.utrcount - 1)? "" : ",");
+      }
+    (void)printf(" };\n\n");
+    }
+
+  fi->highcount = 0;
+  if (ps.high_tree != NULL)
+    {
+    (void)printf("static const fontbuilthighstr high_%d[] = {\n", n);
+    fi->highcount = write_tree(ps.high_tree);
+    (void)printf("  };\n\n");
+    }
+
+  if (ps.encoding != NULL) write_encoding("psencoding", n, ps.encoding);
+  if (pdf.encoding != NULL) write_encoding("pdfencoding", n, pdf.encoding);
+
+  fi->fs = ps;
+  fi->pdfencoding = pdf.encoding != NULL;
+  n++;
+  }
+
+/* Write the table of fonts. */
+
+(void)printf("const fontbuiltinstr font_builtin_fonts[] = {\n");
+for (int i = 0; i < n; i++)
+  {
+  fontitem *fi = items + i;
+  fontstr *fs = &(fi->fs);
+
+  (void)printf("  { \"%s\", widths_%d, r2ladjusts_%d, ", fi->name, i, i);
+  if (fs->heights != NULL) (void)printf("heights_%d, ", i);
+    else (void)printf("NULL, ");
+  if (fs->kerncount > 0) (void)printf("kerns_%d, ", i);
+    else (void)printf("NULL, ");
+  if (fs->utrcount > 0) (void)printf("utr_%d, ", i);
+    else (void)printf("NULL, ");
+  if (fi->highcount > 0) (void)printf("high_%d,\n    ", i);
+    else (void)printf("NULL,\n    ");
+  if (fs->encoding != NULL) (void)printf("psencoding_%d, ", i);
+    else (void)printf("NULL, ");
+  if (fi->pdfencoding) (void)printf("pdfencoding_%d, ", i);
+    else (void)printf("NULL, ");
+  (void)printf("%d, %d, %d, 0x%08xu, 0x%08xu,\n    %d, %d, %d, %d, %d, "
+    "{ %d, %d, %d, %d } }%s\n", fs->kerncount, fs->utrcount, fi->highcount,
+    fs->flags & (ff_stdencoding|ff_fixedpitch), fs->invalid, fs->ascent,
+    fs->descent, fs->capheight, fs->italicangle, fs->stemv, fs->bbox[0],
+    fs->bbox[1], fs->bbox[2], fs->bbox[3], (i == n - 1)? "" : ",");
+  }
+(void)printf("};\n\nusint font_builtin_count = %d;\n\n/* End of fonttab.c */\n",
+  n);
+
+free(items);
+return (ferror(stdout) == 0 && fflush(stdout) == 0)? EXIT_SUCCESS :
+  EXIT_FAILURE;
+}
+
+/* End of mkfonttab.c */
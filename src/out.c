@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: May 2021 */
-/* This file last modified: April 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -620,7 +620,8 @@ if ((flags & text_ul) != 0)
 
   if (PCHAR(*pp) == '=' || PCHAR(*pp) == '-')
     {
-    u = mem_get_cached((void **)&main_freeuolayblocks, sizeof(uolaystr));
+    u = mem_get_cached((void **)&main_freeuolayblocks, sizeof(uolaystr),
+      mt_cont);
     u->next = bar_cont->uolay;
     bar_cont->uolay = u;
 
@@ -2402,7 +2403,7 @@ if (zerocopycount > 1)
     if (zerocopy->level >= 0)
       {
       zerocopy->cont = mem_get_cached((void **)(&main_freezerocontblocks),
-        sizeof(contstr));
+        sizeof(contstr), mt_cont);
 
       /* The cast of the first argument here avoids the silly compiler error
       message "expected 'contstr *' {aka 'struct constr *'} but argument is of
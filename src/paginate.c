@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: April 2021 */
-/* This file last modified: March 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -825,7 +825,7 @@ static void
 do_pageheading(headstr *page_heading)
 {
 int32_t used = 0;
-headblock *h = mem_get(sizeof(headblock));
+headblock *h = mem_get(sizeof(headblock), mt_heading);
 
 h->is_sysblock = FALSE;
 h->pageheading = (page_heading != curmovt->heading);  /* Not a movt heading */
@@ -933,7 +933,7 @@ for (; h != NULL; h = h->next)
     /* Set up a new headstr for the next line, copying the middle and right
     parts of the heading. */
 
-    new = mem_get(sizeof(headstr));
+    new = mem_get(sizeof(headstr), mt_heading);
     memcpy(new, h, sizeof(headstr));
     new->spaceabove = 0;
     new->fdata.spacestretch = 0;
@@ -971,7 +971,7 @@ Returns:         nothing; curpage is updated
 static void
 do_newpage(headstr *heading, headstr *page_heading)
 {
-pagestr *newpage = mem_get(sizeof(pagestr));
+pagestr *newpage = mem_get(sizeof(pagestr), mt_page);
 curpage->next = newpage;
 newpage->number = main_lastpagenumber = curpage->number + page_increment;
 
@@ -1023,7 +1023,7 @@ spaceleft to allow for footnotes when justifying. */
 
 if (pl_pagefootnotes != NULL)
   {
-  headblock *h = mem_get(sizeof(headblock));
+  headblock *h = mem_get(sizeof(headblock), mt_heading);
   h->is_sysblock = FALSE;
   h->pageheading = FALSE;
   h->next = NULL;
@@ -1106,7 +1106,7 @@ else
 
 if (footing != NULL)
   {
-  headblock *f = mem_get(sizeof(headblock));
+  headblock *f = mem_get(sizeof(headblock), mt_heading);
   f->next = NULL;
   f->movt = curmovt;
   f->headings = footing;
@@ -1532,7 +1532,7 @@ for (curstave = 0; curstave <= curmovt->laststave; curstave++)
       else
         {
         hairpinstr *hs = mem_get_cached((void **)(&main_freehairpinstr),
-         sizeof(hairpinstr));
+         sizeof(hairpinstr), mt_cont);
 
         hs->hairpin = (b_hairpinstr *)p;
         hs->x = 0;
@@ -1636,7 +1636,7 @@ for (curstave = 0; curstave <= curmovt->laststave; curstave++)
 
         if (!hadsshere)
           {
-          int32_t *new = mem_get((MAX_STAVE+1)*sizeof(int32_t));
+          int32_t *new = mem_get((MAX_STAVE+1)*sizeof(int32_t), mt_page);
           memcpy(new, pl_sysblock->stavespacing,
             (curmovt->laststave+1)*sizeof(int32_t));
           pl_sysblock->stavespacing = new;
@@ -1682,7 +1682,7 @@ for (curstave = 0; curstave <= curmovt->laststave; curstave++)
 
         if (!hadssnext)
           {
-          int32_t *new = mem_get((MAX_STAVE+1)*sizeof(int32_t));
+          int32_t *new = mem_get((MAX_STAVE+1)*sizeof(int32_t), mt_page);
           memcpy(new, pl_ssnext, (curmovt->laststave+1)*sizeof(int32_t));
           pl_ssnext = new;
           hadssnext = TRUE;
@@ -1808,7 +1808,7 @@ for (curstave = 0; curstave <= curmovt->laststave; curstave++)
           if (u == NULL)
             {
             u = mem_get_cached((void **)(&main_freeuolayblocks),
-              sizeof(uolaystr));
+              sizeof(uolaystr), mt_cont);
             u->next = NULL;
             u->x = u->y = 0;
             u->level = t->laylevel;
@@ -2385,7 +2385,8 @@ for (curstave = 0; curstave <= curmovt->laststave; curstave++)
 
       if (accepteddata->stavenames == nextdata->stavenames)
         {
-        nextdata->stavenames = mem_get((curmovt->laststave+1)*sizeof(snamestr *));
+        nextdata->stavenames = mem_get((curmovt->laststave+1)*sizeof(snamestr *),
+          mt_page);
         memcpy(nextdata->stavenames, accepteddata->stavenames,
           (curmovt->laststave+1)*sizeof(snamestr *));
         }
@@ -3546,7 +3547,7 @@ stretching or squashing, the vector will already exist. */
 left = pl_postable;
 pl_bp->count = pl_posptr - pl_postable + 1;
 if (pl_bp->vector == NULL)
-  pl_bp->vector = mem_get(pl_bp->count * sizeof(posstr));
+  pl_bp->vector = mem_get(pl_bp->count * sizeof(posstr), mt_posvector);
 outptr = pl_bp->vector;
 while (left <= pl_posptr)
   {
@@ -3606,9 +3607,11 @@ BOOL page_done = FALSE;
 
 TRACE("\npaginate() start\n");
 
-/* Get memory for the working position table. */
+/* Get memory for the working position table. It is not needed after
+pagination, so it is taken from the paginate arena. */
 
-pl_postable = mem_get_independent(MAX_POSTABLESIZE * sizeof(workposstr));
+pl_postable = mem_arena_get_independent(arena_paginate,
+  MAX_POSTABLESIZE * sizeof(workposstr), mt_posvector);
 
 /* Set up page and line lengths in magnified units. Once we have the line
 length, we can split and justify heading and footing lines. */
@@ -3629,18 +3632,18 @@ curmovt = movements[0];  /* Sic: first movement */
 
 /* Set up various blocks of memory */
 
-accepteddata->stavenames = mem_get((MAX_STAVE+1) * sizeof(snamestr *));
+accepteddata->stavenames = mem_get((MAX_STAVE+1) * sizeof(snamestr *), mt_page);
 
-pl_ulevel = mem_get((MAX_STAVE+1)*sizeof(int32_t));
-pl_ulhere = mem_get((MAX_STAVE+1)*sizeof(int32_t));
-pl_olevel = mem_get((MAX_STAVE+1)*sizeof(int32_t));
-pl_olhere = mem_get((MAX_STAVE+1)*sizeof(int32_t));
+pl_ulevel = mem_get((MAX_STAVE+1)*sizeof(int32_t), mt_page);
+pl_ulhere = mem_get((MAX_STAVE+1)*sizeof(int32_t), mt_page);
+pl_olevel = mem_get((MAX_STAVE+1)*sizeof(int32_t), mt_page);
+pl_olhere = mem_get((MAX_STAVE+1)*sizeof(int32_t), mt_page);
 
-pl_ssehere = mem_get((MAX_STAVE+1)*sizeof(int32_t));
+pl_ssehere = mem_get((MAX_STAVE+1)*sizeof(int32_t), mt_page);
 
 /* Set up the first page block and associated variables. */
 
-curpage = main_pageanchor = mem_get(sizeof(pagestr));
+curpage = main_pageanchor = mem_get(sizeof(pagestr), mt_page);
 *curpage = init_curpage;
 curpage->number = main_lastpagenumber = page_firstnumber;
 curpage->spaceleft = main_pagelength;
@@ -3719,7 +3722,8 @@ while (!page_done) switch(page_state)
   /* Create vector of per-bar data structures. For movements with many bars
   this can be quite large, so get it as an independent block. */
 
-  curmovt->posvector = mem_get_independent(curmovt->barcount * sizeof(barposstr));
+  curmovt->posvector = mem_get_independent(curmovt->barcount * sizeof(barposstr),
+    mt_posvector);
 
   /* Now set up to process the bars. Cut back the working count of staves to
   those that have been selected. If no staves are present in the movement,
@@ -3743,7 +3747,8 @@ while (!page_done) switch(page_state)
   memcpy(accepteddata->note_spacing, curmovt->note_spacing,
     NOTETYPE_COUNT*sizeof(int));
 
-  accepteddata->stavenames = mem_get((curmovt->laststave+1)*sizeof(snamestr *));
+  accepteddata->stavenames = mem_get((curmovt->laststave+1)*sizeof(snamestr *),
+    mt_page);
   for (i = 1; i <= curmovt->laststave; i++)
     accepteddata->stavenames[i] = ((curmovt->stavetable)[i])->stave_name;
 
@@ -3829,22 +3834,24 @@ while (!page_done) switch(page_state)
   /* Get a new system block and initialize some of the fields. The remainder
   get set as the system is processed. */
 
-  pl_sysblock = mem_get(sizeof(sysblock));
+  pl_sysblock = mem_get(sizeof(sysblock), mt_page);
   pl_sysblock->next = NULL;
   pl_sysblock->movt = curmovt;
   pl_sysblock->is_sysblock = TRUE;
   pl_sysblock->flags = 0;
   pl_sysblock->stavenames = accepteddata->stavenames;
   pl_sysblock->stavespacing = pl_ssnext;
-  pl_sysblock->ulevel = mem_get((curmovt->laststave+1) * sizeof(uint32_t));
-  pl_sysblock->olevel = mem_get((curmovt->laststave+1) * sizeof(uint32_t));
+  pl_sysblock->ulevel = mem_get((curmovt->laststave+1) * sizeof(uint32_t),
+    mt_page);
+  pl_sysblock->olevel = mem_get((curmovt->laststave+1) * sizeof(uint32_t),
+    mt_page);
   pl_sysblock->systemgap = pl_sgnext;
   pl_sysblock->notsuspend = accepteddata->notsuspend;
   pl_sysblock->showtimes = 0;
   pl_sysblock->barstart = pl_barnumber;
   pl_sysblock->barend = pl_barnumber;
 
-  pl_sysblock->cont = mem_get((curmovt->laststave+1)*sizeof(contstr));
+  pl_sysblock->cont = mem_get((curmovt->laststave+1)*sizeof(contstr), mt_cont);
   misc_copycontstr(pl_sysblock->cont, wk_cont, curmovt->laststave, TRUE);
 
   /* Working clefs while measuring. The current clef is needed only for
@@ -4505,7 +4512,8 @@ while (!page_done) switch(page_state)
     int j;
     firstsystem = FALSE;
 
-    accepteddata->stavenames = mem_get((MAX_STAVE + 1) * sizeof(snamestr *));
+    accepteddata->stavenames = mem_get((MAX_STAVE + 1) * sizeof(snamestr *),
+      mt_page);
     for (j = 1; j <= curmovt->laststave; j++)
       {
       snamestr *sn = ((curmovt->stavetable)[j])->stave_name;
@@ -4555,7 +4563,8 @@ while (!page_done) switch(page_state)
           {
           if (pl_sysblock->stavespacing == pl_ssnext)
             {
-            pl_sysblock->stavespacing = mem_get((MAX_STAVE+1)*sizeof(int32_t));
+            pl_sysblock->stavespacing = mem_get((MAX_STAVE+1)*sizeof(int32_t),
+              mt_page);
             memcpy(pl_sysblock->stavespacing, pl_ssnext,
               (curmovt->laststave + 1) * sizeof(int32_t));
             }
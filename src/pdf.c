@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: December 2024 */
-/* This file last modified: January 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -28,8 +28,55 @@ typedef struct pdfobject {
   size_t data_size;      /* Current size of data block */
   size_t data_used;      /* Amount currently used in data block */
   uschar *data;          /* Points to data block */
+  int32_t objstream;     /* Containing object stream, 0 if none, -1 pending */
+  int32_t objindex;      /* Index within the object stream */
+  uschar *dict;          /* Extra stream dictionary entries, or NULL */
+  int32_t page;          /* Page number for page and contents objects, or 0 */
 } pdfobject;
 
+/* Repeated items such as staves of the same length and braces are output
+once as form XObjects, which are then referenced by name. Each is identified by
+a type and a vector of key values. An item that is used only once is not worth
+a form, so the first use is just remembered, and the form is created at the
+position of the second use. Later uses are translated relative to that. */
+
+enum { xo_stave, xo_brace };
+
+#define XO_KEYSIZE    5
+#define MAX_XOBJECTS  256
+
+typedef struct xobject {
+  int      type;                 /* Type of item */
+  int32_t  key[XO_KEYSIZE];      /* Identifying values */
+  int32_t  x;                    /* Position of first use */
+  int32_t  y;
+  int32_t  number;               /* Object number; 0 if not yet created */
+} xobject;
+
+/* Hint tables for linearized output are built up a bit at a time. */
+
+typedef struct hintbits {
+  uschar  *data;
+  size_t   size;
+  size_t   used;
+  int      bitcount;             /* Bits used in the last byte */
+} hintbits;
+
+/* The maximum number of objects in an object stream */
+
+#define OBJSTM_MAX 100
+
+/* Font files that are to be embedded are opened when their placeholder
+objects are created. If a font is subsetted, its data is read immediately and
+the subset is kept in memory; otherwise the file is read when the font is
+written out. */
+
+typedef struct fontfile {
+  FILE   *file;          /* The open font file, or NULL */
+  uschar *data;          /* Font data in memory, or NULL */
+  size_t  length;        /* Length of data in memory */
+} fontfile;
+
 
 
 /************************************************
@@ -121,15 +168,43 @@ static BOOL music_font_used = FALSE;
 
 static int32_t text_basex;
 static int32_t text_basey;
+static BOOL    text_righttoleft;
 
 static uschar  *pdf_IdStrings[font_tablen+1];
 
 static const char *font_extensions[] = { ".otf", ".pfb", ".pfa", ".ttf", "" };
 enum { fe_otf, fe_pfb, fe_pfa, fe_ttf, fe_none };
 
-static FILE *font_files[20];
+static fontfile font_files[20];
 static int nextfontfile = 0;
 
+static xobject  xobjects[MAX_XOBJECTS];
+static int      xobject_count = 0;
+static BOOL     xobjects_created = FALSE;
+static int32_t  resources_number;
+
+/* Saved state while an XObject is being created */
+
+static pdfobject *xo_saved_conts;
+static int32_t    xo_saved_linewidth;
+static int32_t    xo_saved_font;
+static int32_t    xo_saved_size;
+static BOOL       xo_saved_X;
+
+/* Peephole optimization. The position of the most recent ET or q operator is
+remembered, so that it can be removed if the next operator would have been BT
+or Q, respectively. The word spacing (Tw) is reset lazily. The numbers of
+removed operators are counted for -d peephole. */
+
+enum { peep_none, peep_ET, peep_q };
+enum { pc_textmerged, pc_emptygsave, pc_wordspace, pc_identity, pc_count };
+
+static pdfobject *peep_object = NULL;
+static int        peep_op = peep_none;
+static size_t     peep_start, peep_end;
+static double     settw = 0.0;
+static int        peep_removed[pc_count];
+
 
 
 /*************************************************
@@ -485,11 +560,14 @@ static pdfobject *
 new_fixed_object(const char *s)
 {
 size_t len = strlen(s);
-pdfobject *new = mem_get(sizeof(pdfobject));
+pdfobject *new = mem_arena_get(arena_output, sizeof(pdfobject), mt_pdf);
 obj_last->next = new;
 obj_last = new;
 new->next = NULL;
 new->file_offset = 0;  /* Will be updated later */
+new->objstream = 0;
+new->dict = NULL;
+new->page = 0;
 new->base_size = 0;    /* Will never be used */
 new->data_size = new->data_used = len;
 new->data = malloc(len);
@@ -506,8 +584,8 @@ return new;
 *  Add new extendable object block to the chain  *
 *************************************************/
 
-/* This gets a small header block from the memory that will get automatically
-freed when the program ends and adds it to the objects chain. No initial data
+/* This gets a small header block from the output arena, which is freed when
+the PDF has been written, and adds it to the objects chain. No initial data
 block is created.
 
 Argument:  minimum size to use for first data block
@@ -517,11 +595,14 @@ Returns:   pointer to the new object
 static pdfobject *
 new_object(size_t base_size)
 {
-pdfobject *new = mem_get(sizeof(pdfobject));
+pdfobject *new = mem_arena_get(arena_output, sizeof(pdfobject), mt_pdf);
 obj_last->next = new;
 obj_last = new;
 new->next = NULL;
 new->file_offset = 0;  /* Will be updated later */
+new->objstream = 0;
+new->dict = NULL;
+new->page = 0;
 new->base_size = base_size;
 new->data_size = new->data_used = 0;
 new->data = NULL;
@@ -531,6 +612,37 @@ return new;
 
 
 
+/*************************************************
+*        Make room in an object's data block     *
+*************************************************/
+
+/* This is used by extend_object() and the typed append functions below.
+
+Arguments:
+  p        pointer to the object
+  len      the number of bytes that are about to be added
+
+Returns:   nothing
+*/
+
+static void
+object_room(pdfobject *p, size_t len)
+{
+size_t newlen = p->data_used + len;
+if (newlen > p->data_size)
+  {
+  size_t newsize = (p->data_used == 0)? p->base_size : 2 * p->data_size;
+  if (newsize < newlen) newsize = 2 * newlen;
+  p->data = realloc(p->data, newsize);
+  if (p->data == NULL)
+    error(ERR0, (newsize == p->base_size)? "" : "re-", "PDF object data",
+      newsize); /* Hard */
+  p->data_size = newsize;
+  }
+}
+
+
+
 /*************************************************
 *             Add text to an object              *
 *************************************************/
@@ -556,7 +668,7 @@ static void
 extend_object(pdfobject *p, const char *format, ...)
 {
 int bump;
-size_t len, newlen;
+size_t len;
 char buff[256];
 
 va_list ap;
@@ -576,23 +688,131 @@ if (instringtype < 0 && p->data_used > 0 &&
   }
 else bump = 1;
 
-newlen = p->data_used + len;
-if (newlen > p->data_size)
-  {
-  size_t newsize = (p->data_used == 0)? p->base_size : 2 * p->data_size;
-  if (newsize < len) newsize = 2 * len;
-  p->data = realloc(p->data, newsize);
-  if (p->data == NULL)
-    error(ERR0, (newsize == p->base_size)? "" : "re-", "PDF object data",
-      newsize); /* Hard */
-  p->data_size = newsize;
-  }
+object_room(p, len);
 memcpy(p->data + p->data_used, buff + bump, len);
 p->data_used += len;
 }
 
 
 
+/*************************************************
+*       Typed appends to an object               *
+*************************************************/
+
+/* The drawing functions are called very many times, and formatting their
+output via extend_object() is costly. These functions add a single token
+straight into an object's data block. A separating space is inserted under the
+same conditions as in extend_object(), so the output is exactly the same as it
+would be from a format string with single spaces between items.
+
+Arguments:
+  p        pointer to the object
+  s        pointer to the token
+  len      length of the token
+
+Returns:   nothing
+*/
+
+static void
+append_token(pdfobject *p, const char *s, size_t len)
+{
+object_room(p, len + 1);
+if (instringtype < 0 && p->data_used > 0 &&
+    isalnum((int)p->data[p->data_used - 1]) &&
+    (isalnum((int)s[0]) || s[0] == '-'))
+  p->data[p->data_used++] = ' ';
+memcpy(p->data + p->data_used, s, len);
+p->data_used += len;
+}
+
+
+/* Add an operator or other literal text. */
+
+static void
+append_op(pdfobject *p, const char *s)
+{
+append_token(p, s, strlen(s));
+}
+
+
+/* Add a PDF name, with a leading slash. As the slash never needs a preceding
+space, the check is not needed. */
+
+static void
+append_name(pdfobject *p, const char *s)
+{
+size_t len = strlen(s);
+object_room(p, len + 1);
+p->data[p->data_used++] = '/';
+memcpy(p->data + p->data_used, s, len);
+p->data_used += len;
+}
+
+
+/* Add a character inside a string. The check for a space is never needed. */
+
+static void
+append_char(pdfobject *p, int c)
+{
+object_room(p, 1);
+p->data[p->data_used++] = c;
+}
+
+
+/* Add an integer. The digits are generated backwards into a local buffer. */
+
+static void
+append_int(pdfobject *p, int32_t n)
+{
+char buff[16];
+char *s = buff + sizeof(buff);
+uint32_t u = (n < 0)? -(uint32_t)n : (uint32_t)n;
+
+do { *(--s) = '0' + u % 10; u /= 10; } while (u != 0);
+if (n < 0) *(--s) = '-';
+append_token(p, s, buff + sizeof(buff) - s);
+}
+
+
+/* Add a fixed point number that is in thousandths of a unit (typically
+millipoints), formatted in the same way as by sff(), that is, with any trailing
+zeros in the fraction (and the decimal point if the fraction is zero)
+removed. */
+
+static void
+append_fixed(pdfobject *p, int32_t n)
+{
+char buff[24];
+char *s = buff + sizeof(buff);
+uint32_t u = (n < 0)? -(uint32_t)n : (uint32_t)n;
+uint32_t f = u % 1000;
+
+u /= 1000;
+if (f != 0)
+  {
+  int digits = 3;
+  while (f % 10 == 0) { f /= 10; digits--; }
+  while (digits-- > 0) { *(--s) = '0' + f % 10; f /= 10; }
+  *(--s) = '.';
+  }
+
+do { *(--s) = '0' + u % 10; u /= 10; } while (u != 0);
+if (n < 0) *(--s) = '-';
+append_token(p, s, buff + sizeof(buff) - s);
+}
+
+
+/* Add a pair of fixed point coordinates. */
+
+static void
+append_point(pdfobject *p, int32_t x, int32_t y)
+{
+append_fixed(p, x);
+append_fixed(p, y);
+}
+
+
+
 /*************************************************
 *       Detrail the data in an object            *
 *************************************************/
@@ -721,6 +941,137 @@ return objectcount;
 
 
 
+/*************************************************
+*          Read a font file into memory          *
+*************************************************/
+
+/* The file is closed after reading.
+
+Arguments:
+  f          the open file
+  lenptr     where to return the length
+
+Returns:     pointer to the data, in malloc'd memory
+*/
+
+static uschar *
+read_font_file(FILE *f, size_t *lenptr)
+{
+size_t size = 65536;
+size_t len = 0;
+uschar *data = malloc(size);
+
+for (;;)
+  {
+  size_t n;
+  if (data == NULL) error(ERR0, "", "font file data", size);  /* Hard */
+  n = fread(data + len, 1, size - len, f);
+  len += n;
+  if (len < size) break;
+  size *= 2;
+  data = realloc(data, size);
+  }
+
+if (fclose(f) != 0) error(ERR200, "font file", strerror(errno));
+*lenptr = len;
+return data;
+}
+
+
+
+/*************************************************
+*          Subset a font file if required        *
+*************************************************/
+
+/* When subsetting is enabled, the font file is read and a subset containing
+only the glyphs whose characters have been used is created. The glyph names
+are found in the same way as in make_encoding() above. If all is well, the
+subset replaces the open file, and a subset tag, derived from a hash of the
+font's name and the characters used, is added to the font's name, as required
+by the PDF standard. If the font cannot be subsetted (for example, it has
+TrueType outlines) the whole font is retained, and its name is unchanged.
+
+Arguments:
+  ff         the font file block
+  fs         the font
+
+Returns:     nothing
+*/
+
+static void
+subset_fontfile(fontfile *ff, fontstr *fs)
+{
+const uschar *names[FONTWIDTHS_SIZE + 1];
+uschar *font, *subset;
+size_t len, sublen;
+uint32_t hash = 2166136261u;
+int ncount = 0;
+
+if ((pdf_options & pdfopt_subset) == 0 ||
+    (main_testing & mtest_omitfont) != 0)
+  return;
+
+/* A font that is neither standardly encoded nor PMW-Music and has no
+encoding uses its own built-in encoding, so we do not know the names. */
+
+if ((fs->flags & ff_stdencoding) == 0 && fs->encoding == NULL) return;
+
+for (int c = 0; c < FONTWIDTHS_SIZE; c++)
+  {
+  uschar *name;
+  int cc = c & 255;
+  const char **stdnames = (c < 256)? lower_names : upper_names;
+
+  if ((fs->used[c/8] & (1 << c%8)) == 0) continue;
+
+  if ((fs->flags & ff_stdencoding) != 0)
+    {
+    name = (fs->encoding == NULL || fs->encoding[c] == NULL)?
+      (uschar *)stdnames[cc] : fs->encoding[c];
+    if (name == NULL) name = (uschar *)stdnames[fs->invalid & 255];
+    }
+  else
+    {
+    name = fs->encoding[c];
+    if (name == NULL && c >= 256) name = fs->encoding[cc];
+    if (name == NULL) name = fs->encoding[fs->invalid & 255];
+    }
+
+  if (name != NULL) names[ncount++] = name;
+  }
+
+font = read_font_file(ff->file, &len);
+ff->file = NULL;
+subset = fontsubset_otf(font, len, names, ncount, &sublen);
+
+if (subset == NULL)
+  {
+  ff->data = font;
+  ff->length = len;
+  return;
+  }
+
+free(font);
+ff->data = subset;
+ff->length = sublen;
+
+/* Compute a tag of six upper case letters. */
+
+for (uschar *p = fs->name; *p != 0; p++) hash = (hash ^ *p) * 16777619u;
+for (int i = 0; i < FONTWIDTHS_SIZE/8; i++)
+  hash = (hash ^ fs->used[i]) * 16777619u;
+
+fs->subsetname = mem_get(Ustrlen(fs->name) + 8, mt_font);
+for (int i = 0; i < 6; i++)
+  {
+  fs->subsetname[i] = 'A' + hash % 26;
+  hash /= 26;
+  }
+sprintf(CS fs->subsetname + 6, "+%s", fs->name);
+}
+
+
+
 /*************************************************
 *               Make a file object               *
 *************************************************/
@@ -792,9 +1143,12 @@ switch(i)
 /* For non-Type3 fonts, save the open file in the next open file slot and
 create two placeholder objects, one for the font, and one for the length.
 Return the number of the font object left shifted 8, with the ls byte
-containing the suffix character for the FontFile setting. */
+containing the suffix character for the FontFile setting. If subsetting is
+enabled, the subset is created now so that the font's name can be tagged. */
 
-font_files[nextfontfile] = f;
+font_files[nextfontfile].file = f;
+font_files[nextfontfile].data = NULL;
+subset_fontfile(font_files + nextfontfile, fs);
 d = new_object(150);
 yield = (objectcount << 8) | type;
 EO(d, "*Font%s %d\n", typename, nextfontfile++);
@@ -837,6 +1191,7 @@ pdfobject *fontobj;
 int firstX = first;
 int lastX = last;
 const char *subtype = "OpenType";
+uschar *fontname = (fs->subsetname != NULL)? fs->subsetname : fs->name;
 
 if (X[0] != 0)
   {
@@ -860,7 +1215,7 @@ if (descnum == 0)
   if (Ustrncmp(fs->name, "Helvetica", 9) != 0) flags |= 2;  /* Serifs */
   if (fs->italicangle != 0) flags |= 64;
 
-  EO(descobj, "<</Type/FontDescriptor\n/FontName/%s\n", fs->name);
+  EO(descobj, "<</Type/FontDescriptor\n/FontName/%s\n", fontname);
   EO(descobj, "/Flags %d\n", flags);
   EO(descobj, "/Ascent %d\n", (fs->ascent > 0)? fs->ascent : fs->bbox[3]);
   EO(descobj, "/Descent %d\n", (fs->descent < 0)? fs->descent : fs->bbox[1]);
@@ -884,7 +1239,7 @@ EO(resources, "/%s%s %d 0 R\n", ID, X, objectcount);
 EO(fontobj, "<</Type/Font/Subtype/%s\n/Name/%s%s", subtype, ID, X);
 if (descnum != 0)
   {
-  EO(fontobj, "/BaseFont/%s", fs->name);
+  EO(fontobj, "/BaseFont/%s", fontname);
   EO(fontobj, "/FontDescriptor %d 0 R\n", descnum);
   }
 
@@ -913,7 +1268,7 @@ static void
 adjust_wide_stave_table(void)
 {
 int lastwide, lastchar, offset;
-fontstr *fs = &(font_list[font_table[font_mf]]);
+fontstr *fs = font_load(font_table[font_mf]);
 int32_t *widths = fs->widths;
 uschar **encoding = fs->encoding;
 
@@ -940,6 +1295,10 @@ for (int i = lastchar + 1; i <= lastchar + 4; i++)
 
 for (int i = 0; i < 7; i++)
   if (pout_stavechar10[i] > lastchar) pout_stavechar10[i] -= offset;
+
+/* Any remembered string widths may now be wrong. */
+
+string_widthcache_flush();
 }
 
 
@@ -949,6 +1308,55 @@ for (int i = 0; i < 7; i++)
 ============================================================*/
 
 
+/*************************************************
+*       Remember a cancellable operator          *
+*************************************************/
+
+/* This is called just after an ET or q operator has been added to the current
+contents object.
+
+Arguments:
+  op         peep_ET or peep_q
+  start      the offset at which the operator started
+
+Returns:     nothing
+*/
+
+static void
+peep_mark(int op, size_t start)
+{
+peep_object = obj_conts;
+peep_op = op;
+peep_start = start;
+peep_end = obj_conts->data_used;
+}
+
+
+
+/*************************************************
+*        Cancel the previous operator            *
+*************************************************/
+
+/* If peephole optimization is enabled and the most recent output to the
+current contents object was the given operator, it is removed.
+
+Argument:  peep_ET or peep_q
+Returns:   TRUE if the operator has been removed
+*/
+
+static BOOL
+peep_cancel(int op)
+{
+if ((pdf_options & pdfopt_peephole) == 0 || peep_op != op ||
+    peep_object != obj_conts || obj_conts->data_used != peep_end)
+  return FALSE;
+obj_conts->data_used = peep_start;
+peep_op = peep_none;
+return TRUE;
+}
+
+
+
 /*************************************************
 *          Close incomplete text object          *
 *************************************************/
@@ -958,7 +1366,9 @@ check_ETpending(void)
 {
 if (ETpending)
   {
-  EO(obj_conts, "ET\n");
+  size_t start = obj_conts->data_used;
+  append_op(obj_conts, "ET\n");
+  peep_mark(peep_ET, start);
   ETpending = FALSE;
   }
 }
@@ -973,7 +1383,8 @@ check_linewidth(int32_t width)
 {
 if (width != setlinewidth)
   {
-  EO(obj_conts, "%s w", sff(width));
+  append_fixed(obj_conts, width);
+  append_op(obj_conts, "w");
   setlinewidth = width;
   }
 }
@@ -1016,77 +1427,225 @@ pout_changecolour = FALSE;
 
 
 /*************************************************
-*               Basic string output code         *
+*             Look up a form XObject             *
 *************************************************/
 
-/* This function outputs a PMW string, all of whose characters have the same
-font. The font is passed explicitly rather than taken from the characters so
-that font_mu can become font_mf at smaller size, and font_sc can have the small
-caps bit removed. All code points were translated earlier if necessary.
-
-Although the entire string is in one font, we have to deal with handling
-characters > 255 that must be output using the second binding of the font.
+/* If an item with the given type and key is not found, it is remembered (if
+there is room) so that a form is created if it is used again. The first key
+value may differ by a given tolerance. This allows for staves whose lengths
+differ by a millipoint or two because of rounding when systems are justified;
+this is far too small to be visible.
 
 Arguments:
-  s            the PMW string
-  f            the font
-  fdata        points to font instance size etc data
-  x            the x coordinate
-  y            the y coordinate
-  startadjust  TRUE in RTL mode if start needs adjusting
+  type       the type of item
+  key        vector of XO_KEYSIZE identifying values
+  tolerance  the allowed difference in the first key value
 
-Returns:       nothing
+Returns:     pointer to the XObject block, or NULL if this is the first use
 */
 
-static void
-pdf_basic_string(uint32_t *s, usint f, fontinststr *fdata, int32_t x, int32_t y,
-  BOOL startadjust)
+static xobject *
+xobject_lookup(int type, int32_t *key, int32_t tolerance)
 {
-fontstr *fs = &(font_list[font_table[f & ~font_small]]);
-kerntablestr *ktable = fs->kerns;
-fontinststr tfd = *fdata;
-int32_t kernx = 0;
-int32_t kerny = 0;
-int32_t *matrix = fdata->matrix;
-BOOL inkerningstring = FALSE;
-
-(void)kerny;   // Not currently used
+xobject *xo;
 
-/* Adjust the point size in the temporary font instance structure for small
-caps and the reduced music font. */
+for (int i = 0; i < xobject_count; i++)
+  {
+  xo = xobjects + i;
+  if (xo->type == type && abs(xo->key[0] - key[0]) <= tolerance &&
+      memcmp(xo->key + 1, key + 1, (XO_KEYSIZE - 1) * sizeof(int32_t)) == 0)
+    return xo;
+  }
 
-if (f >= font_small)
+if (xobject_count < MAX_XOBJECTS)
   {
-  f -= font_small;
-  if (f == font_mf) tfd.size = (tfd.size * 9) / 10;
-    else tfd.size = (tfd.size * curmovt->smallcapsize) / 1000;
+  xo = xobjects + xobject_count++;
+  xo->type = type;
+  memcpy(xo->key, key, XO_KEYSIZE * sizeof(int32_t));
+  xo->number = 0;
   }
 
-/* Note that the font is used. */
+return NULL;
+}
 
-fs->flags |= ff_used;
-if (f == font_mf) music_font_used = TRUE;
 
-/* When outputting right-to-left, we sometimes need to find the length of the
-string so that we can output it from the other end, because the fonts still
-work left-to-right. By this stage there are no special escape characters left
-in the string and we know that it's all in the same font. This is not needed
-when called from pout_string(), which does its own adjusting to account for
-leftwards and up/down moving characters. */
 
-if (startadjust)
-  {
-  int32_t last_width, last_r2ladjust;
-  int32_t swidth = pout_getswidth(s, f, fs, &last_width, &last_r2ladjust);
+/*************************************************
+*            Start a new form XObject            *
+*************************************************/
 
-  /* Adjust the printing position for the string by the length of the string,
-  adjusted for the actual bounding box of the final character, and scaled to
-  the font size. */
+/* A new stream object is created and made the current contents object, so
+that the normal drawing functions can be used to create the form's content.
+The remembered graphics state is reset so that everything that is needed is
+set explicitly within the form, and saved for restoring afterwards. The caller
+must ensure that no text item is pending.
 
-  x += mac_muldiv(swidth - last_width + last_r2ladjust, tfd.size, 1000);
-  }
+Arguments:
+  xo         the XObject block
+  x          the x coordinate of this use
+  y          the y coordinate of this use
 
-/* Handle transformed strings separately. First, non-transformed strings, which
+Returns:     nothing
+*/
+
+static void
+xobject_start(xobject *xo, int32_t x, int32_t y)
+{
+xo->x = x;
+xo->y = y;
+
+xo_saved_conts = obj_conts;
+xo_saved_linewidth = setlinewidth;
+xo_saved_font = setfont;
+xo_saved_size = setsize;
+xo_saved_X = setX;
+
+obj_conts = new_object(500);
+xo->number = objectcount;
+xobjects_created = TRUE;
+EO(obj_conts, "stream\n");
+
+setlinewidth = -1;
+setfont = -1;
+setsize = -1;
+}
+
+
+
+/*************************************************
+*          Finish creating a form XObject        *
+*************************************************/
+
+/* Any pending text item is closed, the stream's dictionary entries are set
+up, and the page's contents object and remembered state are restored.
+
+Argument:  vector of 4 values for the bounding box (fixed point)
+Returns:   nothing
+*/
+
+static void
+xobject_end(int32_t *bbox)
+{
+check_ETpending();
+obj_conts->dict = mem_arena_get(arena_output, 100, mt_pdf);
+sprintf(CS obj_conts->dict,
+  "/Type/XObject/Subtype/Form/BBox[%s]/Resources %d 0 R\n",
+  SFF("%f %f %f %f", bbox[0], bbox[1], bbox[2], bbox[3]), resources_number);
+
+obj_conts = xo_saved_conts;
+setlinewidth = xo_saved_linewidth;
+setfont = xo_saved_font;
+setsize = xo_saved_size;
+setX = xo_saved_X;
+}
+
+
+
+/*************************************************
+*             Use a form XObject                 *
+*************************************************/
+
+/* The form's content is drawn relative to the position of its first use, so
+a translation is needed if the current position is different.
+
+Arguments:
+  xo         the XObject
+  x          the x coordinate for this use
+  y          the y coordinate for this use
+
+Returns:     nothing
+*/
+
+static void
+xobject_use(xobject *xo, int32_t x, int32_t y)
+{
+char name[16];
+BOOL move = x != xo->x || y != xo->y;
+
+sprintf(name, "Fm%d", (int)(xo - xobjects));
+if (move)
+  {
+  append_op(obj_conts, "q 1 0 0 1");
+  append_point(obj_conts, x - xo->x, y - xo->y);
+  append_op(obj_conts, "cm");
+  }
+append_name(obj_conts, name);
+append_op(obj_conts, move? "Do Q\n" : "Do\n");
+}
+
+
+
+/*************************************************
+*               Basic string output code         *
+*************************************************/
+
+/* This function outputs a PMW string, all of whose characters have the same
+font. The font is passed explicitly rather than taken from the characters so
+that font_mu can become font_mf at smaller size, and font_sc can have the small
+caps bit removed. All code points were translated earlier if necessary.
+
+Although the entire string is in one font, we have to deal with handling
+characters > 255 that must be output using the second binding of the font.
+
+Arguments:
+  s            the PMW string
+  f            the font
+  fdata        points to font instance size etc data
+  x            the x coordinate
+  y            the y coordinate
+  startadjust  TRUE in RTL mode if start needs adjusting
+
+Returns:       nothing
+*/
+
+static void
+pdf_basic_string(uint32_t *s, usint f, fontinststr *fdata, int32_t x, int32_t y,
+  BOOL startadjust)
+{
+fontstr *fs = font_load(font_table[f & ~font_small]);
+fontinststr tfd = *fdata;
+int32_t kernx = 0;
+int32_t kerny = 0;
+int32_t *matrix = fdata->matrix;
+BOOL inkerningstring = FALSE;
+
+(void)kerny;   // Not currently used
+
+/* Adjust the point size in the temporary font instance structure for small
+caps and the reduced music font. */
+
+if (f >= font_small)
+  {
+  f -= font_small;
+  if (f == font_mf) tfd.size = (tfd.size * 9) / 10;
+    else tfd.size = (tfd.size * curmovt->smallcapsize) / 1000;
+  }
+
+/* Note that the font is used. */
+
+fs->flags |= ff_used;
+if (f == font_mf) music_font_used = TRUE;
+
+/* When outputting right-to-left, we sometimes need to find the length of the
+string so that we can output it from the other end, because the fonts still
+work left-to-right. By this stage there are no special escape characters left
+in the string and we know that it's all in the same font. This is not needed
+when called from pout_string(), which does its own adjusting to account for
+leftwards and up/down moving characters. */
+
+if (startadjust)
+  {
+  int32_t last_width, last_r2ladjust;
+  int32_t swidth = pout_getswidth(s, f, fs, &last_width, &last_r2ladjust);
+
+  /* Adjust the printing position for the string by the length of the string,
+  adjusted for the actual bounding box of the final character, and scaled to
+  the font size. */
+
+  x += mac_muldiv(swidth - last_width + last_r2ladjust, tfd.size, 1000);
+  }
+
+/* Handle transformed strings separately. First, non-transformed strings, which
 can be combined into a single text item.*/
 
 if (matrix == NULL)
@@ -1094,14 +1653,27 @@ if (matrix == NULL)
   int32_t xt, yt;
   int32_t xp = poutx(x);
   int32_t yp = pouty(y);
-  BOOL newBT = !ETpending;
+  BOOL newBT;
+
+  /* If the previous text item was closed and nothing else has been output
+  since, it can be re-opened, provided the text direction is unchanged, because
+  that affects the text matrix. The text position is unchanged. */
+
+  if (!ETpending && text_righttoleft == main_righttoleft &&
+      peep_cancel(peep_ET))
+    {
+    ETpending = TRUE;
+    peep_removed[pc_textmerged]++;
+    }
+  newBT = !ETpending;
 
   /* Start a new text item if necessary. */
 
   if (!ETpending)
     {
-    EO(obj_conts, "BT\n");
+    append_op(obj_conts, "BT\n");
     ETpending = TRUE;
+    text_righttoleft = main_righttoleft;
     xt = xp;
     yt = yp;
     }
@@ -1126,13 +1698,26 @@ if (matrix == NULL)
 
   if (main_righttoleft)
     {
-    if (newBT) EO(obj_conts, "-1 0 0 1 %s %s Tm\n", sff(xt), sff(yt));
-      else EO(obj_conts, "%s %s Td\n", sff(-xt), sff(yt));
+    if (newBT)
+      {
+      append_op(obj_conts, "-1 0 0 1");
+      append_point(obj_conts, xt, yt);
+      append_op(obj_conts, "Tm\n");
+      }
+    else
+      {
+      append_point(obj_conts, -xt, yt);
+      append_op(obj_conts, "Td\n");
+      }
     }
 
   /* In left-to-right mode all we need is Td. */
 
-  else EO(obj_conts, "%s", SFF("%f %f Td\n", xt, yt));
+  else
+    {
+    append_point(obj_conts, xt, yt);
+    append_op(obj_conts, "Td\n");
+    }
 
   /* Remember that a text origin has been set. */
 
@@ -1167,16 +1752,26 @@ else
 
 /* Deal with space stretching. This is used only for underlay hyphen strings
 and justified headings/footings. It is very unlikely that there will be several
-in a row with the same value, so we just reset it at the end. In a PDF the
-value is absolute, *not* in the text coordinate system, so if the text itself
-has been stretched or compressed, we have to adjust the value. */
+in a row with the same value, so we just reset it at the end, unless peephole
+optimization is enabled, in which case the reset is delayed until a string
+without stretching is output. In a PDF the value is absolute, *not* in the text
+coordinate system, so if the text itself has been stretched or compressed, we
+have to adjust the value. */
 
 if (fdata->spacestretch != 0)
   {
   double stretch = (double)fdata->spacestretch / 1000.0;
   if (fdata->matrix != NULL)
     stretch /= ((double)fdata->matrix[0])/65536.0;
-  EO(obj_conts, "%s Tw", sfd(stretch));
+  if (settw != 0.0) peep_removed[pc_wordspace]++;   /* Omitted reset */
+  if (stretch == settw) peep_removed[pc_wordspace]++; else
+    EO(obj_conts, "%s Tw", sfd(stretch));
+  if ((pdf_options & pdfopt_peephole) != 0) settw = stretch;
+  }
+else if (settw != 0.0)
+  {
+  EO(obj_conts, "0 Tw\n");
+  settw = 0.0;
   }
 
 /* Generate the text output. Values are always less than FONTWIDTHS_SIZE (512);
@@ -1214,8 +1809,7 @@ for (uint32_t *p = s; *p != 0; p++)
   if ((instringtype == 0 && c > 255) ||
       (instringtype > 0 && c <= 255))
     {
-    if (inkerningstring) EO(obj_conts, ")]TJ\n");
-      else EO(obj_conts, ")Tj\n");
+    append_op(obj_conts, inkerningstring? ")]TJ\n" : ")Tj\n");
     instringtype = -1;
     inkerningstring = FALSE;
     }
@@ -1227,8 +1821,10 @@ for (uint32_t *p = s; *p != 0; p++)
     BOOL X = c > 255;
     if ((int)f != setfont || tfd.size != setsize || X != setX)
       {
-      EO(obj_conts, "/%s%s %s Tf\n", pdf_IdStrings[f], X? "X" : "",
-        sff(tfd.size));
+      append_name(obj_conts, CS pdf_IdStrings[f]);
+      if (X) append_char(obj_conts, 'X');
+      append_fixed(obj_conts, tfd.size);
+      append_op(obj_conts, "Tf\n");
       setfont = f;
       setX = X;
       setsize = tfd.size;
@@ -1237,9 +1833,11 @@ for (uint32_t *p = s; *p != 0; p++)
     /* Kernx may be set if kerning from the previous character or if starting a
     new relative string. */
 
-    if (kernx == 0) EO(obj_conts, "("); else
+    if (kernx == 0) append_op(obj_conts, "("); else
       {
-      EO(obj_conts, "[%d(", -kernx);
+      append_op(obj_conts, "[");
+      append_int(obj_conts, -kernx);
+      append_op(obj_conts, "(");
       inkerningstring = TRUE;
       kernx = 0;
       }
@@ -1252,34 +1850,26 @@ for (uint32_t *p = s; *p != 0; p++)
   /* Output the character */
 
   if (pc == '(' || pc == ')' || pc == '\\')
-    EO(obj_conts, "\\%c", pc);
+    {
+    append_char(obj_conts, '\\');
+    append_char(obj_conts, pc);
+    }
   else if (pc >= 32 && pc <= 126)
-    EO(obj_conts, "%c", pc);
+    append_char(obj_conts, pc);
   else
-    EO(obj_conts, "\\%03o", pc);
+    {
+    append_char(obj_conts, '\\');
+    append_char(obj_conts, '0' + ((pc >> 6) & 7));
+    append_char(obj_conts, '0' + ((pc >> 3) & 7));
+    append_char(obj_conts, '0' + (pc & 7));
+    }
 
-  /* If there is another character, scan the kerning table */
+  /* If there is another character, look up the kern for the pair */
 
   if (main_kerning && fs->kerncount > 0 && p[1] != 0)
     {
-    int32_t xadjust = 0, yadjust = 0;
-    int bot = 0;
-    int top = fs->kerncount;
-    uint32_t cc = PCHAR(p[1]);
-    uint32_t pair;
-
-    pair = (c << 16) | cc;
-    while (bot < top)
-      {
-      int mid = (bot + top)/2;
-      kerntablestr *k = &(ktable[mid]);
-      if (pair == k->pair)
-        {
-        xadjust = k->kwidth;
-        break;
-        }
-      if (pair < k->pair) top = mid; else bot = mid + 1;
-      }
+    int32_t xadjust = font_kern(fs, c, PCHAR(p[1]));
+    int32_t yadjust = 0;
 
     /* If a kern was found, there is no need to scale the adjustment to the
     font size or the sign of kernx (as done for PostScript) because it operates
@@ -1292,12 +1882,14 @@ for (uint32_t *p = s; *p != 0; p++)
 
       if (inkerningstring)
         {
-        EO(obj_conts, ")%d(", -kernx);
+        append_op(obj_conts, ")");
+        append_int(obj_conts, -kernx);
+        append_op(obj_conts, "(");
         kernx = 0;
         }
       else
         {
-        EO(obj_conts, ")Tj\n");
+        append_op(obj_conts, ")Tj\n");
         instringtype = -1;
         }
       }
@@ -1309,15 +1901,15 @@ text strings follow. */
 
 if (instringtype >= 0)
   {
-  if (inkerningstring) EO(obj_conts, ")]TJ\n");
-    else EO(obj_conts, ")Tj\n");
+  append_op(obj_conts, inkerningstring? ")]TJ\n" : ")Tj\n");
   instringtype = -1;
   }
 
-/* Reset any stretching that was used. Note that this must happen even if we
-are going to close the text object because the setting persists. */
+/* Reset any stretching that was used, unless this is being delayed. Note that
+this must happen even if we are going to close the text object because the
+setting persists. */
 
-if (fdata->spacestretch != 0) EO(obj_conts, "0 Tw\n");
+if (fdata->spacestretch != 0 && settw == 0.0) EO(obj_conts, "0 Tw\n");
 
 /* If there was a text transformation matrix, terminate the item. ETpending was
 set false above. */
@@ -1429,9 +2021,10 @@ else
 
   for (int i = 0; i < 2; i++)
     {
-    EO(obj_conts, "%s", SFF("%f %f m %f %f l S\n", poutx(x),
-      pouty(ytop - 16*out_stavemagn - yadjust),
-        poutx(x), pouty(ybot - yadjust)));
+    append_point(obj_conts, poutx(x), pouty(ytop - 16*out_stavemagn - yadjust));
+    append_op(obj_conts, "m");
+    append_point(obj_conts, poutx(x), pouty(ybot - yadjust));
+    append_op(obj_conts, "l S\n");
     if (type != bar_double) break;
     x += 2*magn;
     }
@@ -1440,6 +2033,32 @@ else
 
 
 
+/*************************************************
+*           Output the path for a brace          *
+*************************************************/
+
+/* The coordinate system has been set up by the caller. There is only one
+alternative brace style at present.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+static void
+brace_path(void)
+{
+if (curmovt->bracestyle == 0)
+  EO(obj_conts, "0 0 m 100 20 -50 245 60 260 c -50 245 60 20 0 0 c f\n"
+                "1 0 0 -1 0 0 cm\n"
+                "0 0 m 100 20 -50 245 60 260 c -50 245 60 20 0 0 c f\n");
+else
+  EO(obj_conts, "0 0 m 95 40 -43 218 37 256 c -59 219 66 34 0 0 c f\n"
+                "1 0 0 -1 0 0 cm\n"
+                "0 0 m 95 40 -43 218 37 256 c -59 219 66 34 0 0 c f\n");
+}
+
+
+
 /*************************************************
 *             Output a brace                     *
 *************************************************/
@@ -1458,6 +2077,7 @@ void
 pdf_brace(int32_t x, int32_t ytop, int32_t ybot, int32_t magn)
 {
 int32_t scale = ((ybot-ytop+16*magn)*23)/12000;
+xobject *xo = NULL;
 
 check_ETpending();
 check_colour();
@@ -1468,17 +2088,23 @@ EO(obj_conts, "q %s", SFF("%f 0 0 %f %f %f cm\n",
   (scale > 110)? 110 : scale/2 + 55, scale,
   poutx(x) + 1500, pouty((ytop-16*magn+ybot)/2)));
 
-/* There is only one alternative brace style at present. */
+/* When XObjects are enabled, the brace's shape, which depends only on the
+style, is output once as a form. */
 
-if (curmovt->bracestyle == 0)
-  EO(obj_conts, "0 0 m 100 20 -50 245 60 260 c -50 245 60 20 0 0 c f\n"
-                "1 0 0 -1 0 0 cm\n"
-                "0 0 m 100 20 -50 245 60 260 c -50 245 60 20 0 0 c f\n");
-else
-  EO(obj_conts, "0 0 m 95 40 -43 218 37 256 c -59 219 66 34 0 0 c f\n"
-                "1 0 0 -1 0 0 cm\n"
-                "0 0 m 95 40 -43 218 37 256 c -59 219 66 34 0 0 c f\n");
+if ((pdf_options & pdfopt_xobjects) != 0)
+  {
+  int32_t key[XO_KEYSIZE] = { curmovt->bracestyle, 0, 0, 0, 0 };
+  xo = xobject_lookup(xo_brace, key, 0);
+  if (xo != NULL && xo->number == 0)
+    {
+    int32_t bbox[4] = { -70000, -270000, 110000, 270000 };
+    xobject_start(xo, 0, 0);
+    brace_path();
+    xobject_end(bbox);
+    }
+  }
 
+if (xo != NULL) xobject_use(xo, 0, 0); else brace_path();
 EO(obj_conts, "Q\n");
 }
 
@@ -1548,43 +2174,16 @@ if (save_righttoleft)
 
 
 /*************************************************
-*            Output a stave's lines              *
+*        Draw or print a stave's lines           *
 *************************************************/
 
-/* The stavelines parameter will always be > 0. There is now an option to
-draw the stave lines rather than using characters for them (the default). This
-helps with screen displays that are using anti-aliasing.
-
-It has been reported that some PostScript interpreters can't handle the
-100-point wide characters, so there is an option to use only the 10-point
-characters. Assume staves are always at least one character long.
-
-Arguments:
-  leftx        the x-coordinate of the stave start
-  y            the y-coordinate of the stave start
-  rightx       the x-coordinate of the stave end
-  stavelines   the number of stave lines
-
-Returns:       nothing
+/* This is called from pdf_stave() below to do the actual work, either
+directly, or when creating an XObject. The arguments are as for pdf_stave().
 */
 
-void
-pdf_stave(int32_t leftx, int32_t y, int32_t rightx, int stavelines)
+static void
+stave_lines(int32_t leftx, int32_t y, int32_t rightx, int stavelines)
 {
-int32_t save_colour[3];
-
-/* Save whatever colour is set and restore afterwards. Then normally set black,
-but use red if running in the special testing mode. */
-
-pout_getcolour(save_colour);
-if ((main_testing & mtest_forcered) != 0)
-  {
-  int32_t red[] = { 1000, 0, 0 };
-  pout_setcolour(red);
-  }
-else pout_setgray(0);
-check_colour();
-
 /* Output the stave using drawing primitives. */
 
 if (stave_use_draw > 0)
@@ -1608,8 +2207,10 @@ if (stave_use_draw > 0)
   check_linewidth(thickness);
   for (int i = 0; i < stavelines; i++)
     {
-    EO(obj_conts, "%s", SFF("%f %f m %f %f l S\n", poutx(leftx), pouty(y),
-    poutx(rightx), pouty(y)));
+    append_point(obj_conts, poutx(leftx), pouty(y));
+    append_op(obj_conts, "m");
+    append_point(obj_conts, poutx(rightx), pouty(y));
+    append_op(obj_conts, "l S\n");
     y -= gap;
     }
   }
@@ -1665,6 +2266,76 @@ else
     pdf_basic_string(string_pmw(sbuff, font_mf), font_mf, &pout_mfdata,
       rightx - chwidth, y, main_righttoleft);
   }
+}
+
+
+
+/*************************************************
+*            Output a stave's lines              *
+*************************************************/
+
+/* The stavelines parameter will always be > 0. There is now an option to
+draw the stave lines rather than using characters for them (the default). This
+helps with screen displays that are using anti-aliasing.
+
+It has been reported that some PostScript interpreters can't handle the
+100-point wide characters, so there is an option to use only the 10-point
+characters. Assume staves are always at least one character long.
+
+Arguments:
+  leftx        the x-coordinate of the stave start
+  y            the y-coordinate of the stave start
+  rightx       the x-coordinate of the stave end
+  stavelines   the number of stave lines
+
+Returns:       nothing
+*/
+
+void
+pdf_stave(int32_t leftx, int32_t y, int32_t rightx, int stavelines)
+{
+int32_t save_colour[3];
+xobject *xo = NULL;
+
+/* Save whatever colour is set and restore afterwards. Then normally set black,
+but use red if running in the special testing mode. */
+
+pout_getcolour(save_colour);
+if ((main_testing & mtest_forcered) != 0)
+  {
+  int32_t red[] = { 1000, 0, 0 };
+  pout_setcolour(red);
+  }
+else pout_setgray(0);
+check_colour();
+
+/* When XObjects are enabled, a drawn stave is output as a form, which can be
+reused for any stave of the same length and type. This is not done for staves
+that use music font characters, because the text for them is already compact,
+and it can usually be merged with surrounding text. */
+
+if ((pdf_options & pdfopt_xobjects) != 0 && stave_use_draw > 0)
+  {
+  int32_t key[XO_KEYSIZE] = { rightx - leftx, stavelines, out_stavemagn,
+    stave_use_draw, main_righttoleft };
+  int32_t x0 = poutx(leftx);
+  int32_t y0 = pouty(y);
+
+  check_ETpending();
+  xo = xobject_lookup(xo_stave, key, 5);
+  if (xo != NULL && xo->number == 0)
+    {
+    int32_t margin = 4 * out_stavemagn + 2000;
+    int32_t bbox[4] = { x0 - margin, y0 - margin, poutx(rightx) + margin,
+      y0 + 16 * out_stavemagn + margin };
+    xobject_start(xo, x0, y0);
+    stave_lines(leftx, y, rightx, stavelines);
+    xobject_end(bbox);
+    }
+  }
+
+if (xo != NULL) xobject_use(xo, poutx(leftx), pouty(y));
+  else stave_lines(leftx, y, rightx, stavelines);
 
 pout_setcolour(save_colour);
 }
@@ -1749,10 +2420,14 @@ check_ETpending();
 check_colour();
 
 pout_beam(&x0, &x1, &y0, &y1, &depth, level, levelchange);
-EO(obj_conts, "%s", SFF("%f %f m %f %f l", poutx(x0), pouty(y0),
-  poutx(x1), pouty(y1)));
-EO(obj_conts, "%s", SFF("%f %f l %f %f l f\n", poutx(x1), pouty(y1-depth),
-  poutx(x0), pouty(y0-depth)));
+append_point(obj_conts, poutx(x0), pouty(y0));
+append_op(obj_conts, "m");
+append_point(obj_conts, poutx(x1), pouty(y1));
+append_op(obj_conts, "l");
+append_point(obj_conts, poutx(x1), pouty(y1-depth));
+append_op(obj_conts, "l");
+append_point(obj_conts, poutx(x0), pouty(y0-depth));
+append_op(obj_conts, "l f\n");
 }
 
 
@@ -2021,9 +2696,10 @@ else if ((flags & tief_dotted) != 0)
 This is used while drawing jogs on line slurs. */
 
 check_linewidth(thickness);
-EO(obj_conts, "%s m %s l S\n",
-  SFF("%f %f", poutx(x1), pouty(out_ystave - y1)),
-  SFF("%f %f", poutx(x0), pouty(out_ystave - y0)));
+append_point(obj_conts, poutx(x1), pouty(out_ystave - y1));
+append_op(obj_conts, "m");
+append_point(obj_conts, poutx(x0), pouty(out_ystave - y0));
+append_op(obj_conts, "l S\n");
 
 if ((flags & tief_savedash) == 0) pdf_setdash(0, 0);
 }
@@ -2051,10 +2727,14 @@ pdf_lines(int32_t *x, int32_t *y, int count, int32_t thickness)
 check_ETpending();
 check_linewidth(thickness);
 check_colour();
-EO(obj_conts, "%s", SFF("%f %f m", poutx(x[0]), pouty(out_ystave - y[0])));
+append_point(obj_conts, poutx(x[0]), pouty(out_ystave - y[0]));
+append_op(obj_conts, "m");
 for (int i = 1; i < count; i++)
-  EO(obj_conts, "%s", SFF("%f %f l", poutx(x[i]), pouty(out_ystave - y[i])));
-EO(obj_conts, "S\n");
+  {
+  append_point(obj_conts, poutx(x[i]), pouty(out_ystave - y[i]));
+  append_op(obj_conts, "l");
+  }
+append_op(obj_conts, "S\n");
 }
 
 
@@ -2076,9 +2756,9 @@ check_colour();
 if (thickness >= 0)
   {
   check_linewidth(thickness);
-  EO(obj_conts, "S\n");
+  append_op(obj_conts, "S\n");
   }
-else EO(obj_conts, "f\n");
+else append_op(obj_conts, "f\n");
 }
 
 
@@ -2106,18 +2786,23 @@ check_ETpending();
 while (*c != path_end) switch(*c++)
   {
   case path_move:
-  EO(obj_conts, "%s", SFF("%f %f m", poutx(*x++), pouty(out_ystave - *y++)));
+  append_point(obj_conts, poutx(x[0]), pouty(out_ystave - y[0]));
+  append_op(obj_conts, "m");
+  x++;
+  y++;
   break;
 
   case path_line:
-  EO(obj_conts, "%s", SFF("%f %f l", poutx(*x++), pouty(out_ystave - *y++)));
+  append_point(obj_conts, poutx(x[0]), pouty(out_ystave - y[0]));
+  append_op(obj_conts, "l");
+  x++;
+  y++;
   break;
 
   case path_curve:
-  EO(obj_conts, "%s", SFF("%f %f %f %f %f %f c",
-    poutx(x[0]), pouty(out_ystave - y[0]),
-      poutx(x[1]), pouty(out_ystave - y[1]),
-        poutx(x[2]), pouty(out_ystave - y[2])));
+  for (int i = 0; i < 3; i++)
+    append_point(obj_conts, poutx(x[i]), pouty(out_ystave - y[i]));
+  append_op(obj_conts, "c");
   x += 3;
   y += 3;
   break;
@@ -2154,16 +2839,18 @@ check_ETpending();
 while (*c != path_end) switch(*c++)
   {
   case path_move:
-  EO(obj_conts, "%s", SFF("%f %f m", *x++, *y++));
+  append_point(obj_conts, *x++, *y++);
+  append_op(obj_conts, "m");
   break;
 
   case path_line:
-  EO(obj_conts, "%s", SFF("%f %f l", *x++, *y++));
+  append_point(obj_conts, *x++, *y++);
+  append_op(obj_conts, "l");
   break;
 
   case path_curve:
-  EO(obj_conts, "%s", SFF("%f %f %f %f %f %f c", x[0], y[0], x[1], y[1],
-    x[2], y[2]));
+  for (int i = 0; i < 3; i++) append_point(obj_conts, x[i], y[i]);
+  append_op(obj_conts, "c");
   x += 3;
   y += 3;
   break;
@@ -2191,8 +2878,12 @@ void
 pdf_setdash(int32_t dashlength, int32_t gaplength)
 {
 if (dashlength == out_dashlength && gaplength == out_dashgaplength) return;
-if ((dashlength | gaplength) == 0) EO(obj_conts, "[]0 d");
-  else EO(obj_conts, "%s", SFF("[%f %f]0 d", dashlength, gaplength));
+if ((dashlength | gaplength) == 0) append_op(obj_conts, "[]0 d"); else
+  {
+  append_op(obj_conts, "[");
+  append_point(obj_conts, dashlength, gaplength);
+  append_op(obj_conts, "]0 d");
+  }
 out_dashlength = dashlength;
 out_dashgaplength = gaplength;
 }
@@ -2213,13 +2904,19 @@ void
 pdf_setcapandjoin(uint32_t caj)
 {
 if ((caj & (caj_round | caj_square)) != (setcaj & (caj_round | caj_square)))
-  EO(obj_conts, "%d J\n", ((caj & caj_round) != 0)? 1 :
+  {
+  append_int(obj_conts, ((caj & caj_round) != 0)? 1 :
     ((caj & caj_square) != 0)? 2 : 0);
+  append_op(obj_conts, "J\n");
+  }
 
 if ((caj & (caj_round_join | caj_bevel_join)) !=
     (setcaj & (caj_round_join | caj_bevel_join)))
-  EO(obj_conts, "%d j\n", ((caj & caj_round_join) != 0)? 1 :
+  {
+  append_int(obj_conts, ((caj & caj_round_join) != 0)? 1 :
     ((caj & caj_bevel_join) != 0)? 2 : 0);
+  append_op(obj_conts, "j\n");
+  }
 
 setcaj = caj;
 }
@@ -2243,18 +2940,22 @@ Returns:    nothing
 void
 pdf_gsave(void)
 {
+size_t start;
 check_ETpending();
 savedcaj = setcaj;
 savedlinewidth = setlinewidth;
 saveddashlength = out_dashlength;
 saveddashgaplength = out_dashgaplength;
-EO(obj_conts, "q");
+start = obj_conts->data_used;
+append_op(obj_conts, "q");
+peep_mark(peep_q, start);
 }
 
 void
 pdf_grestore(void)
 {
-EO(obj_conts, "Q\n");
+if (peep_cancel(peep_q)) peep_removed[pc_emptygsave]++;
+  else append_op(obj_conts, "Q\n");
 setcaj = savedcaj;
 setlinewidth = savedlinewidth;
 out_dashlength = saveddashlength;
@@ -2300,8 +3001,17 @@ Returns:     nothing
 void
 pdf_translate(int32_t x, int32_t y)
 {
+int32_t xp = poutx(x);
+int32_t yp = pouty(out_ystave - y);
 check_ETpending();
-EO(obj_conts, "1 0 0 1 %s cm\n", SFF("%f %f", poutx(x), pouty(out_ystave - y)));
+if (xp == 0 && yp == 0 && (pdf_options & pdfopt_peephole) != 0)
+  {
+  peep_removed[pc_identity]++;
+  return;
+  }
+append_op(obj_conts, "1 0 0 1");
+append_point(obj_conts, xp, yp);
+append_op(obj_conts, "cm\n");
 }
 
 
@@ -2374,13 +3084,16 @@ mt[3] = r3;
 *************************************************/
 
 /* OTF fonts need an additional entry in the stream's dictionary, provided by
-the "subtype" argument. The font is encoded using the ASCII85 encoding, which
-encodes each 4 bytes as a 32-bit number to be encoded in base 85 using ASCII
-printable characters. There is special treatment of zero and for any trailing
-bytes.
+the "subtype" argument. The font data may already be in memory (a subsetted
+font); otherwise the file is read and closed. When binary fonts are enabled,
+the data is written as it stands, compressed using Flate if compression is
+enabled and it makes the data shorter. Otherwise the font is encoded using the
+ASCII85 encoding, which encodes each 4 bytes as a 32-bit number to be encoded
+in base 85 using ASCII printable characters. There is special treatment of zero
+and for any trailing bytes.
 
 Arguments:
-  f              the font file
+  ff             the font file block
   subtype        a subtype to be defined, or NULL
   length         the indirect object in which to put the length
   length_number  the number of the length object
@@ -2389,16 +3102,64 @@ Returns:   the number of characters written
 */
 
 static uint32_t
-write_font_stream(FILE *f, const char *subtype, pdfobject *length,
+write_font_stream(fontfile *ff, const char *subtype, pdfobject *length,
   uint32_t length_number)
 {
 char coded[6];
-int c, n;
+int n;
 uint32_t acc;
 uint32_t lenstart;
 uint32_t filecount = 0;
 uint32_t count = 0;
 
+if (ff->data == NULL)
+  {
+  ff->data = read_font_file(ff->file, &(ff->length));
+  ff->file = NULL;
+  }
+
+/* Binary output */
+
+if ((pdf_options & pdfopt_binaryfonts) != 0)
+  {
+  size_t clen = 0;
+  uschar *cdata = NULL;
+
+  if (pdf_compress > 0)
+    {
+    cdata = deflate_compress(ff->data, ff->length, pdf_compress, &clen);
+    if (clen >= ff->length)
+      {
+      free(cdata);
+      cdata = NULL;
+      }
+    }
+
+  filecount += Cfprintf(out_file, "<<");
+  if (cdata != NULL) filecount += Cfprintf(out_file, "/Filter/FlateDecode\n");
+  if (subtype != NULL) filecount += Cfprintf(out_file, "/Subtype/%s\n", subtype);
+  filecount += Cfprintf(out_file, "/Length %d 0 R>>\nstream\n", length_number);
+
+  if (cdata != NULL)
+    {
+    filecount += Cfwrite(cdata, 1, clen, out_file);
+    EO(length, "%lu\n", clen);
+    free(cdata);
+    }
+  else
+    {
+    filecount += Cfwrite(ff->data, 1, ff->length, out_file);
+    EO(length, "%lu\n", ff->length);
+    }
+
+  filecount += Cfprintf(out_file, "\nendstream\n");
+  free(ff->data);
+  ff->data = NULL;
+  return filecount;
+  }
+
+/* ASCII85 output */
+
 filecount += Cfprintf(out_file, "<</Filter/ASCII85Decode\n");
 if (subtype != NULL) filecount += Cfprintf(out_file, "/Subtype/%s\n", subtype);
 filecount += Cfprintf(out_file, "/Length %d 0 R>>\nstream\n", length_number);
@@ -2408,9 +3169,9 @@ n = 0;
 coded[5] = 0;
 lenstart = filecount;
 
-while ((c = fgetc(f)) != EOF)
+for (size_t i = 0; i < ff->length; i++)
   {
-  acc = (acc << 8) | c;
+  acc = (acc << 8) | ff->data[i];
   if (++n == 4)
     {
     if (acc == 0)
@@ -2460,24 +3221,961 @@ the stream. */
 filecount += Cfprintf(out_file, "~>");
 EO(length, "%d\n", filecount - lenstart);  /* Update the length object */
 filecount += Cfprintf(out_file, "\nendstream\n");
-if (fclose(f) != 0) error(ERR200, "font file", strerror(errno));
+free(ff->data);
+ff->data = NULL;
 return filecount;
 }
 
 
 
+/*************************************************
+*        Check for object stream packing         *
+*************************************************/
+
+/* When object streams are enabled, all objects that are not streams or
+placeholders, and are not empty, are packed into object streams.
+
+Argument:  the object
+Returns:   TRUE if the object is to be packed
+*/
+
+static BOOL
+is_packable(pdfobject *p)
+{
+return (pdf_options & pdfopt_objstreams) != 0 && p->data_used > 0 &&
+  p->data[0] != '*' &&
+  (p->data_used < 7 || Ustrncmp(p->data, "stream\n", 7) != 0);
+}
+
+
+
+/*************************************************
+*              Write one object                  *
+*************************************************/
+
+/* This writes a single object, remembering its offset in the file for the
+cross-reference data. Stream objects have their lengths set, and placeholders
+for fonts are replaced by the font data.
+
+Arguments:
+  p          the object
+  number     the object's number
+  filecount  the current file offset
+
+Returns:     the updated file offset
+*/
+
+static int32_t
+write_object(pdfobject *p, int32_t number, int32_t filecount)
+{
+p->file_offset = filecount;                    /* Save for index */
+filecount += Cfprintf(out_file, "%d 0 obj\n", number);
+
+/* If the object starts with the text "*Font PMW-Music" it is a placeholder
+for inserting the music font. There's a testing option for omitting this,
+because it's pointless having a copy in every test file output. */
+
+if (p->data_used >= 15 && Ustrncmp(p->data, "*Font PMW-Music", 15) == 0 &&
+      (main_testing & mtest_omitfont) == 0)
+  {
+  uschar buffer[256];
+  fontfile ff;
+  ff.file = font_open_music(".otf", buffer);
+  ff.data = NULL;
+  filecount += write_font_stream(&ff, "OpenType", p->next, number + 1);
+  }
+
+/* If the object starts with "*FontOTF" it is a placeholder for inserting an
+OTF font, whose open file is indexed by the number that follows. */
+
+else if (p->data_used >= 8 && Ustrncmp(p->data, "*FontOTF", 8) == 0)
+  {
+  fontfile *ff = font_files + atoi((char *)(p->data + 8));
+  if ((main_testing & mtest_omitfont) == 0)
+    filecount += write_font_stream(ff, "OpenType", p->next, number + 1);
+  else
+    {
+    filecount += Cfwrite(p->data, 1, p->data_used, out_file);
+    if (fclose(ff->file) != 0) error(ERR200, "font file", strerror(errno));
+    }
+  }
+
+/* For other objects, the data is in memory. In the case of an object that
+starts with "stream" we must add the length. If compression is enabled, the
+stream's data is compressed, but if this does not make it any shorter (which
+can happen for very short streams) it is output uncompressed. */
+
+else if (p->data_used >=7 && Ustrncmp(p->data, "stream\n", 7) == 0)
+  {
+  size_t clen = 0;
+  uschar *cdata = NULL;
+
+  if (pdf_compress > 0)
+    {
+    cdata = deflate_compress(p->data + 7, p->data_used - 7, pdf_compress,
+      &clen);
+    if (clen + 20 >= p->data_used - 7)
+      {
+      free(cdata);
+      cdata = NULL;
+      }
+    }
+
+  if (cdata != NULL)
+    {
+    filecount += Cfprintf(out_file, "<<%s/Filter/FlateDecode/Length %lu>>\n"
+      "stream\n", (p->dict == NULL)? "" : CS p->dict, clen);
+    filecount += Cfwrite(cdata, 1, clen, out_file);
+    filecount += Cfprintf(out_file, "\nendstream\n");
+    free(cdata);
+    }
+  else
+    {
+    filecount += Cfprintf(out_file, "<<%s/Length %lu>>\n",
+      (p->dict == NULL)? "" : CS p->dict, p->data_used - 7);
+    filecount += Cfwrite(p->data, 1, p->data_used, out_file);
+    filecount += Cfprintf(out_file, "endstream\n");
+    }
+  }
+
+/* Not a stream object. In testing mode there may be empty objects where font
+data has been omitted. */
+
+else if (p->data != NULL)
+  filecount += Cfwrite(p->data, 1, p->data_used, out_file);
+
+/* Terminate the object */
+
+filecount += Cfprintf(out_file, "endobj\n");
+return filecount;
+}
+
+
+
+/*************************************************
+*          Flush a completed page's objects      *
+*************************************************/
+
+/* When streaming is enabled, the objects for each page are written as soon as
+the page is complete, and their memory is freed, so that memory use does not
+grow with the length of the document. The document ID hash is updated with each
+object's data before it is written. An object that is to be packed into an
+object stream (the page dictionary when object streams are enabled) is
+retained, as it is small.
+
+Arguments:
+  p          the first object for the page
+  number     its object number
+  filecount  the current file offset
+  ctx        the MD5 context for the document ID
+
+Returns:     the updated file offset
+*/
+
+static int32_t
+flush_page_objects(pdfobject *p, int32_t number, int32_t filecount,
+  MD5Context *ctx)
+{
+for (; p != NULL; p = p->next, number++)
+  {
+  if (is_packable(p)) continue;
+  if (p->data_used > 0) md5Update(ctx, (uint8_t *)(p->data), p->data_used);
+  filecount = write_object(p, number, filecount);
+  free(p->data);
+  p->data = NULL;
+  p->data_used = 0;
+  }
+return filecount;
+}
+
+
+
+/*************************************************
+*          Write a packed stream object          *
+*************************************************/
+
+/* This is used for object streams and the cross-reference stream, whose data
+is constructed in memory. The data is compressed if compression is enabled and
+it makes the data shorter. The object header must already have been written.
+
+Arguments:
+  dict       the dictionary entries other than the filter and length
+  data       the stream data
+  len        the length of the data
+
+Returns:     the number of characters written
+*/
+
+static uint32_t
+write_packed_stream(const char *dict, uschar *data, size_t len)
+{
+size_t clen = 0;
+uschar *cdata = NULL;
+uint32_t filecount = 0;
+
+if (pdf_compress > 0)
+  {
+  cdata = deflate_compress(data, len, pdf_compress, &clen);
+  if (clen >= len)
+    {
+    free(cdata);
+    cdata = NULL;
+    }
+  }
+
+if (cdata != NULL)
+  {
+  filecount += Cfprintf(out_file, "<<%s/Filter/FlateDecode/Length %lu>>\n"
+    "stream\n", dict, clen);
+  filecount += Cfwrite(cdata, 1, clen, out_file);
+  free(cdata);
+  }
+else
+  {
+  filecount += Cfprintf(out_file, "<<%s/Length %lu>>\nstream\n", dict, len);
+  filecount += Cfwrite(data, 1, len, out_file);
+  }
+
+filecount += Cfprintf(out_file, "\nendstream\nendobj\n");
+return filecount;
+}
+
+
+
+/*************************************************
+*            Write object streams                *
+*************************************************/
+
+/* When object streams are enabled, the main output loop skips all objects
+that are not streams or placeholders, marking them with -1 in the objstream
+field. They are packed into object streams here, up to OBJSTM_MAX objects in
+each, preceded by the list of object numbers and offsets. Each object stream is
+added to the end of the object chain so that it gets an object number and is
+included in the cross-reference data.
+
+Argument:  the current file offset
+Returns:   the updated file offset
+*/
+
+static int32_t
+write_object_streams(int32_t filecount)
+{
+pdfobject *p = obj_anchor;
+int32_t number = 1;
+
+for (;;)
+  {
+  pdfobject *first, *stream;
+  size_t headlen = 0;
+  size_t datalen = 0;
+  size_t offset = 0;
+  int32_t firstnumber;
+  int32_t count = 0;
+  uschar *data, *dp;
+  char dict[64];
+
+  /* Find the first object to be packed. The chain is scanned only up to the
+  end of the original objects, as object streams are appended. */
+
+  while (p != NULL && p->objstream >= 0) { p = p->next; number++; }
+  if (p == NULL) break;
+
+  /* Find how many objects to put in this stream, and how much memory is
+  needed. Each header entry needs at most 24 characters. */
+
+  first = p;
+  firstnumber = number;
+  for (; p != NULL && count < OBJSTM_MAX; p = p->next, number++)
+    {
+    if (p->objstream >= 0) continue;
+    headlen += 24;
+    datalen += p->data_used + 1;
+    count++;
+    }
+
+  data = malloc(headlen + datalen);
+  if (data == NULL) error(ERR0, "", "PDF object stream", headlen + datalen);  /* Hard */
+
+  /* Create the header and the stream object, which gets the next object
+  number, then mark the packed objects with it. */
+
+  stream = new_object(0);
+  dp = data;
+  count = 0;
+  number = firstnumber;
+
+  for (pdfobject *q = first; q != p; q = q->next, number++)
+    {
+    if (q->objstream >= 0) continue;
+    dp += sprintf(CS dp, (count == 0)? "%d %lu" : " %d %lu", number, offset);
+    offset += q->data_used + (isspace(q->data[q->data_used - 1])? 0 : 1);
+    q->objstream = objectcount - 1;
+    q->objindex = count++;
+    }
+
+  *dp++ = '\n';
+  headlen = dp - data;
+
+  for (pdfobject *q = first; q != p; q = q->next)
+    {
+    if (q->objstream != objectcount - 1) continue;
+    memcpy(dp, q->data, q->data_used);
+    dp += q->data_used;
+    if (!isspace(dp[-1])) *dp++ = '\n';
+    }
+
+  /* Write the object stream */
+
+  sprintf(dict, "/Type/ObjStm/N %d/First %lu", count, headlen);
+  stream->file_offset = filecount;
+  filecount += Cfprintf(out_file, "%d 0 obj\n", objectcount - 1);
+  filecount += write_packed_stream(dict, data, dp - data);
+  free(data);
+  }
+
+return filecount;
+}
+
+
+
+/*************************************************
+*         Write cross-reference stream           *
+*************************************************/
+
+/* This replaces the xref table and trailer when object streams are used. Each
+entry has a type byte, a 4-byte offset or object stream number, and a 2-byte
+generation number or index within an object stream. The xref stream is itself
+an object, whose offset is the current file offset.
+
+Arguments:
+  filecount   the current file offset
+  md5ID       the document ID
+
+Returns:      nothing
+*/
+
+static void
+write_xref_stream(int32_t filecount, char *md5ID)
+{
+uschar *data, *dp;
+size_t len = (objectcount + 1) * 7;
+char dict[160];
+
+data = dp = malloc(len);
+if (data == NULL) error(ERR0, "", "PDF xref stream", len);  /* Hard */
+
+/* Object 0 is the head of the free list. */
+
+*dp++ = 0;
+for (int i = 0; i < 4; i++) *dp++ = 0;
+*dp++ = 0xff;
+*dp++ = 0xff;
+
+for (pdfobject *p = obj_anchor; p != NULL; p = p->next)
+  {
+  uint32_t field = (p->objstream > 0)? (uint32_t)p->objstream :
+    (uint32_t)p->file_offset;
+  *dp++ = (p->objstream > 0)? 2 : 1;
+  for (int i = 24; i >= 0; i -= 8) *dp++ = (field >> i) & 255;
+  *dp++ = (p->objstream > 0)? (p->objindex >> 8) & 255 : 0;
+  *dp++ = (p->objstream > 0)? p->objindex & 255 : 0;
+  }
+
+/* The xref stream's own entry */
+
+*dp++ = 1;
+for (int i = 24; i >= 0; i -= 8) *dp++ = (filecount >> i) & 255;
+*dp++ = 0;
+*dp++ = 0;
+
+sprintf(dict, "/Type/XRef/Size %d/W[1 4 2]/Root 1 0 R/Info 2 0 R\n"
+  "/ID[<%s><%s>]", objectcount + 1, md5ID, md5ID);
+(void)Cfprintf(out_file, "%d 0 obj\n", objectcount);
+(void)write_packed_stream(dict, data, len);
+free(data);
+
+Vfprintf(out_file, "startxref\n%u\n%%%%EOF\n", filecount);
+}
+
+
+
+/*************************************************
+*       Renumber references in object data       *
+*************************************************/
+
+/* When the output is linearized, objects are renumbered, so the "n 0 R"
+references that were put into the object data when it was created must be
+changed. References are never inside PDF strings, which are skipped because
+they could contain arbitrary text (in the information dictionary, for example).
+A new data block is created.
+
+Arguments:
+  s          the data
+  len        its length
+  map        vector mapping old object numbers to new
+  count      the number of objects
+  newlen     where to return the new length
+
+Returns:     the new data block, or NULL if nothing was changed
+*/
+
+static uschar *
+renumber_data(uschar *s, size_t len, int32_t *map, int32_t count,
+  size_t *newlen)
+{
+pdfobject temp;
+BOOL changed = FALSE;
+size_t i = 0;
+
+temp.base_size = len + 64;
+temp.data_size = temp.data_used = 0;
+temp.data = NULL;
+
+while (i < len)
+  {
+  size_t j, k;
+  int32_t n;
+
+  /* Copy a string, allowing for escapes and nested parentheses. */
+
+  if (s[i] == '(')
+    {
+    int depth = 0;
+    for (j = i; j < len; j++)
+      {
+      if (s[j] == '\\') j++;
+        else if (s[j] == '(') depth++;
+          else if (s[j] == ')' && --depth == 0) break;
+      }
+    if (j < len) j++;
+    object_room(&temp, j - i);
+    memcpy(temp.data + temp.data_used, s + i, j - i);
+    temp.data_used += j - i;
+    i = j;
+    continue;
+    }
+
+  /* Look for a number that starts a token and is followed by " 0 R" and a
+  delimiter. */
+
+  if (isdigit(s[i]) && (i == 0 || !isalnum(s[i-1])))
+    {
+    n = 0;
+    for (j = i; j < len && isdigit(s[j]); j++) n = n * 10 + s[j] - '0';
+    k = j;
+    if (k < len && isspace(s[k]))
+      {
+      while (k < len && isspace(s[k])) k++;
+      if (k + 1 < len && s[k] == '0' && isspace(s[k+1]))
+        {
+        k++;
+        while (k < len && isspace(s[k])) k++;
+        if (k < len && s[k] == 'R' && (k + 1 >= len || !isalnum(s[k+1])) &&
+            n > 0 && n <= count)
+          {
+          char buff[16];
+          int blen = sprintf(buff, "%d", map[n]);
+          object_room(&temp, blen);
+          memcpy(temp.data + temp.data_used, buff, blen);
+          temp.data_used += blen;
+          i = j;
+          changed = TRUE;
+          continue;
+          }
+        }
+      }
+    object_room(&temp, j - i);
+    memcpy(temp.data + temp.data_used, s + i, j - i);
+    temp.data_used += j - i;
+    i = j;
+    continue;
+    }
+
+  object_room(&temp, 1);
+  temp.data[temp.data_used++] = s[i++];
+  }
+
+if (!changed)
+  {
+  free(temp.data);
+  return NULL;
+  }
+
+*newlen = temp.data_used;
+return temp.data;
+}
+
+
+
+/*************************************************
+*       Renumber references in an object         *
+*************************************************/
+
+/* Stream contents and font placeholders contain no references, but stream
+objects may have extra dictionary entries that do.
+
+Arguments:
+  p          the object
+  map        vector mapping old object numbers to new
+  count      the number of objects
+
+Returns:     nothing
+*/
+
+static void
+renumber_object(pdfobject *p, int32_t *map, int32_t count)
+{
+size_t newlen;
+uschar *new;
+
+if (p->dict != NULL)
+  {
+  new = renumber_data(p->dict, Ustrlen(p->dict), map, count, &newlen);
+  if (new != NULL)
+    {
+    p->dict = mem_arena_get(arena_output, newlen + 1, mt_pdf);
+    memcpy(p->dict, new, newlen);
+    p->dict[newlen] = 0;
+    free(new);
+    }
+  }
+
+if (p->data_used == 0 || p->data[0] == '*' ||
+    (p->data_used >= 7 && Ustrncmp(p->data, "stream\n", 7) == 0))
+  return;
+
+new = renumber_data(p->data, p->data_used, map, count, &newlen);
+if (new != NULL)
+  {
+  free(p->data);
+  p->data = new;
+  p->data_used = p->data_size = newlen;
+  }
+}
+
+
+
+/*************************************************
+*          Write bits into a hint table          *
+*************************************************/
+
+/* Hint tables consist of fields of arbitrary numbers of bits, most
+significant bit first. A field of zero bits is allowed, and writes nothing.
+
+Arguments:
+  hb         the hint bits block
+  value      the value
+  nbits      the number of bits
+
+Returns:     nothing
+*/
+
+static void
+hint_bits(hintbits *hb, uint32_t value, int nbits)
+{
+while (nbits-- > 0)
+  {
+  if (hb->bitcount == 0)
+    {
+    if (hb->used >= hb->size)
+      {
+      hb->size = (hb->size == 0)? 256 : 2 * hb->size;
+      hb->data = realloc(hb->data, hb->size);
+      if (hb->data == NULL)
+        error(ERR0, "", "PDF hint stream", hb->size);  /* Hard */
+      }
+    hb->data[hb->used++] = 0;
+    }
+  if (((value >> nbits) & 1) != 0)
+    hb->data[hb->used - 1] |= 0x80 >> hb->bitcount;
+  hb->bitcount = (hb->bitcount + 1) & 7;
+  }
+}
+
+
+/* Each group of entries in a hint table starts on a byte boundary. */
+
+static void
+hint_flush(hintbits *hb)
+{
+hb->bitcount = 0;
+}
+
+
+/* Compute the number of bits needed to hold a value. */
+
+static int
+hint_nbits(uint32_t value)
+{
+int n = 0;
+while (value != 0) { n++; value >>= 1; }
+return n;
+}
+
+
+
+/* Find the least value in a vector of hint values, and the number of bits
+needed for the differences from it. */
+
+static size_t
+hint_range(size_t *v, int count, int *nbits)
+{
+size_t least = v[0];
+size_t greatest = v[0];
+for (int i = 1; i < count; i++)
+  {
+  if (v[i] < least) least = v[i];
+  if (v[i] > greatest) greatest = v[i];
+  }
+*nbits = hint_nbits(greatest - least);
+return least;
+}
+
+
+
+/*************************************************
+*       Copy part of the temporary file          *
+*************************************************/
+
+/* The objects of a linearized file are first written to a temporary file,
+because the file's initial items depend on their positions and lengths.
+
+Arguments:
+  tf         the temporary file
+  start      offset of the first byte to copy
+  len        the number of bytes
+
+Returns:     the number of bytes written
+*/
+
+static uint32_t
+copy_temp(FILE *tf, size_t start, size_t len)
+{
+uschar buffer[8192];
+size_t left = len;
+
+if (fseek(tf, (long)start, SEEK_SET) != 0)
+  error(ERR201, "fseek", strerror(errno));  /* Hard */
+
+while (left > 0)
+  {
+  size_t n = fread(buffer, 1, (left > sizeof(buffer))? sizeof(buffer) : left,
+    tf);
+  if (n == 0) error(ERR201, "fread", strerror(errno));  /* Hard */
+  (void)Cfwrite(buffer, 1, n, out_file);
+  left -= n;
+  }
+
+return len;
+}
+
+
+
+/*************************************************
+*          Write linearized output               *
+*************************************************/
+
+/* A linearized ("fast web view") file has its objects arranged so that the
+first page can be displayed before the rest of the file has arrived. The order
+in the file is:
+
+  header
+  linearization parameter dictionary
+  first-page cross-reference table and trailer
+  catalog and pages tree
+  primary hint stream
+  first page: page object, contents, and all shared resources
+  each remaining page: page object and contents
+  information dictionary
+  main cross-reference table and trailer
+
+The objects up to the end of the first page are numbered after all the others,
+so that each cross-reference table has a single subsection. Because the
+initial items depend on the offsets of what follows, all the objects are first
+written to a temporary file; the initial items have fixed-width numbers so that
+their lengths are known in advance. As required, the offsets in the hint tables
+are computed as if the hint stream were not present.
+
+Arguments:
+  filecount   the length of the header
+  pagecount   the number of pages
+  pages       the pages tree object
+  info        the information dictionary object
+  md5ID       the document ID
+
+Returns:      nothing
+*/
+
+static void
+write_linearized(int32_t filecount, int32_t pagecount, pdfobject *pages,
+  pdfobject *info, char *md5ID)
+{
+FILE *tf;
+FILE *save_out_file = out_file;
+pdfobject **order;
+int32_t *map;
+size_t *olen;
+int32_t total = objectcount;
+int32_t nmain = 2 * (pagecount - 1) + 1;
+int32_t firstnum = nmain + 1;
+int32_t nshared = total - 3 - 2 * pagecount;
+int32_t nfirstpage = 2 + nshared;
+int32_t nfirst = 4 + nfirstpage;
+int32_t dict1 = firstnum + 4;
+int32_t n, s;
+size_t part4len, part6end, tempend, hintlen;
+size_t base, linlen, xref1len, xrefmain, mainhead, maintrail, T;
+size_t *pv[4];
+size_t least[4];
+int nbits[4];
+char dict[32];
+char linbuff[200];
+char trailbuff[300];
+hintbits hb = { NULL, 0, 0, 0 };
+
+order = malloc((total + 3) * sizeof(pdfobject *));
+map = malloc((total + 1) * sizeof(int32_t));
+olen = malloc((total + 3) * sizeof(size_t));
+if (order == NULL || map == NULL || olen == NULL)
+  error(ERR0, "", "PDF linearization vectors", (total + 3) * 8);  /* Hard */
+
+/* Compute the new object numbers. Each page's object is followed by its
+contents object in the chain. All other objects are shared, and are placed
+with the first page. */
+
+n = 1;
+s = 0;
+for (pdfobject *p = obj_anchor; p != NULL; p = p->next, n++)
+  {
+  int32_t new;
+  BOOL contents = p->data_used >= 7 && Ustrncmp(p->data, "stream\n", 7) == 0;
+
+  if (p == obj_anchor) new = firstnum + 1;
+  else if (p == pages) new = firstnum + 2;
+  else if (p == info) new = nmain;
+  else if (p->page == 1) new = dict1 + (contents? 1 : 0);
+  else if (p->page > 1) new = 2 * (p->page - 2) + 1 + (contents? 1 : 0);
+  else new = dict1 + 2 + s++;
+
+  map[n] = new;
+  order[new] = p;
+  }
+
+for (pdfobject *p = obj_anchor; p != NULL; p = p->next)
+  renumber_object(p, map, total);
+
+/* Write the objects to a temporary file: the document-level objects, the first
+page section, the remaining pages, and the information dictionary. The hint
+stream is added at the end once its contents are known. */
+
+tf = tmpfile();
+if (tf == NULL) error(ERR201, "tmpfile", strerror(errno));  /* Hard */
+out_file = tf;
+
+tempend = 0;
+for (n = firstnum + 1; n <= firstnum + 2; n++)
+  {
+  size_t start = tempend;
+  tempend = write_object(order[n], n, tempend);
+  olen[n] = tempend - start;
+  }
+part4len = tempend;
+
+for (n = dict1; n < firstnum + nfirst; n++)
+  {
+  size_t start = tempend;
+  tempend = write_object(order[n], n, tempend);
+  olen[n] = tempend - start;
+  }
+part6end = tempend;
+
+for (n = 1; n <= nmain; n++)
+  {
+  size_t start = tempend;
+  tempend = write_object(order[n], n, tempend);
+  olen[n] = tempend - start;
+  }
+
+/* Compute the fixed lengths of the initial items. */
+
+base = filecount;
+linlen = sprintf(linbuff, "%d 0 obj\n<</Linearized 1/L %10lu/H[%10lu %10lu]"
+  "/O %d/E %10lu/N %d/T %10lu>>\nendobj\n", firstnum, 0ul, 0ul, 0ul, dict1,
+  0ul, pagecount, 0ul);
+xref1len = sprintf(trailbuff, "xref\n%d %d\n", firstnum, nfirst) + 20 * nfirst;
+xref1len += sprintf(trailbuff, "trailer\n<</Size %d/Root %d 0 R/Info %d 0 R"
+  "/Prev %10lu\n/ID[<%s><%s>]>>\nstartxref\n0\n%%%%EOF\n", firstnum + nfirst,
+  firstnum + 1, nmain, 0ul, md5ID, md5ID);
+base += linlen + xref1len;
+
+/* Build the page offset hint table, using offsets that exclude the hint
+stream. The first page consists of all the objects in the first page section;
+each other page has its page object and its contents, and refers to all the
+shared objects in the first page section, which are identified by their
+position in the shared object hint table. The per-page values are the number
+of objects, the length, the offset of the contents from the start of the page,
+and the length of the contents. */
+
+for (int i = 0; i < 4; i++)
+  {
+  pv[i] = malloc(pagecount * sizeof(size_t));
+  if (pv[i] == NULL)
+    error(ERR0, "", "PDF hint table", pagecount * sizeof(size_t));  /* Hard */
+  }
+
+pv[0][0] = nfirstpage;
+pv[1][0] = part6end - part4len;
+pv[2][0] = olen[dict1];
+pv[3][0] = olen[dict1 + 1];
+
+for (int i = 1; i < pagecount; i++)
+  {
+  pv[0][i] = 2;
+  pv[1][i] = olen[2*i - 1] + olen[2*i];
+  pv[2][i] = olen[2*i - 1];
+  pv[3][i] = olen[2*i];
+  }
+
+for (int i = 0; i < 4; i++) least[i] = hint_range(pv[i], pagecount, nbits + i);
+
+hint_bits(&hb, least[0], 32);
+hint_bits(&hb, base + part4len, 32);       /* First page object */
+hint_bits(&hb, nbits[0], 16);
+hint_bits(&hb, least[1], 32);
+hint_bits(&hb, nbits[1], 16);
+hint_bits(&hb, least[2], 32);
+hint_bits(&hb, nbits[2], 16);
+hint_bits(&hb, least[3], 32);
+hint_bits(&hb, nbits[3], 16);
+hint_bits(&hb, hint_nbits((pagecount > 1)? nshared : 0), 16);
+hint_bits(&hb, hint_nbits((pagecount > 1)? nshared + 1 : 0), 16);
+hint_bits(&hb, 0, 16);                     /* No fractional positions */
+hint_bits(&hb, 1, 16);
+
+for (int j = 0; j < 2; j++)
+  {
+  for (int i = 0; i < pagecount; i++)
+    hint_bits(&hb, pv[j][i] - least[j], nbits[j]);
+  hint_flush(&hb);
+  }
+
+for (int i = 0; i < pagecount; i++)
+  hint_bits(&hb, (i == 0)? 0 : nshared,
+    hint_nbits((pagecount > 1)? nshared : 0));
+hint_flush(&hb);
+
+for (int i = 1; i < pagecount; i++)
+  for (int j = 0; j < nshared; j++)
+    hint_bits(&hb, j + 2, hint_nbits(nshared + 1));
+hint_flush(&hb);
+
+for (int j = 2; j < 4; j++)
+  {
+  for (int i = 0; i < pagecount; i++)
+    hint_bits(&hb, pv[j][i] - least[j], nbits[j]);
+  hint_flush(&hb);
+  }
+
+for (int i = 0; i < 4; i++) free(pv[i]);
+
+/* The shared object hint table has an entry for each object in the first page
+section, and there is no separate shared objects section. */
+
+sprintf(dict, "/S %lu", hb.used);
+pv[0] = olen + dict1;
+least[0] = hint_range(pv[0], nfirstpage, nbits);
+
+hint_bits(&hb, 0, 32);                     /* No shared objects section */
+hint_bits(&hb, 0, 32);
+hint_bits(&hb, nfirstpage, 32);
+hint_bits(&hb, nfirstpage, 32);
+hint_bits(&hb, 0, 16);                     /* One object per group */
+hint_bits(&hb, least[0], 32);
+hint_bits(&hb, nbits[0], 16);
+
+for (int i = 0; i < nfirstpage; i++)
+  hint_bits(&hb, pv[0][i] - least[0], nbits[0]);
+hint_flush(&hb);
+for (int i = 0; i < nfirstpage; i++) hint_bits(&hb, 0, 1);
+hint_flush(&hb);
+
+/* Write the hint stream at the end of the temporary file. */
+
+hintlen = Cfprintf(out_file, "%d 0 obj\n", firstnum + 3);
+hintlen += write_packed_stream(dict, hb.data, hb.used);
+free(hb.data);
+out_file = save_out_file;
+
+/* Now the actual positions are known. The main cross-reference table follows
+the information dictionary. */
+
+xrefmain = base + hintlen + tempend;
+mainhead = sprintf(trailbuff, "xref\n0 %d\n", nmain + 1);
+T = xrefmain + mainhead - 1;
+maintrail = sprintf(trailbuff, "trailer\n<</Size %d>>\nstartxref\n%lu\n"
+  "%%%%EOF\n", nmain + 1, filecount + linlen);
+
+(void)Cfprintf(out_file, "%d 0 obj\n<</Linearized 1/L %10lu/H[%10lu %10lu]"
+  "/O %d/E %10lu/N %d/T %10lu>>\nendobj\n", firstnum,
+  xrefmain + mainhead + 20 * (nmain + 1) + maintrail, base + part4len, hintlen,
+  dict1, base + hintlen + part6end, pagecount, T);
+
+/* The first page cross-reference table and trailer */
+
+(void)Cfprintf(out_file, "xref\n%d %d\n", firstnum, nfirst);
+(void)Cfprintf(out_file, "%010lu 00000 n\r\n", (size_t)filecount);
+for (n = firstnum + 1; n <= firstnum + 2; n++)
+  (void)Cfprintf(out_file, "%010lu 00000 n\r\n", base + order[n]->file_offset);
+(void)Cfprintf(out_file, "%010lu 00000 n\r\n", base + part4len);
+for (n = dict1; n < firstnum + nfirst; n++)
+  (void)Cfprintf(out_file, "%010lu 00000 n\r\n",
+    base + hintlen + order[n]->file_offset);
+
+(void)Cfprintf(out_file, "trailer\n<</Size %d/Root %d 0 R/Info %d 0 R"
+  "/Prev %10lu\n/ID[<%s><%s>]>>\nstartxref\n0\n%%%%EOF\n", firstnum + nfirst,
+  firstnum + 1, nmain, xrefmain, md5ID, md5ID);
+
+/* Copy the objects from the temporary file, with the hint stream after the
+document-level objects. */
+
+(void)copy_temp(tf, 0, part4len);
+(void)copy_temp(tf, tempend, hintlen);
+(void)copy_temp(tf, part4len, tempend - part4len);
+if (fclose(tf) != 0) error(ERR200, "temporary file", strerror(errno));
+
+/* The main cross-reference table and trailer. The final startxref points to
+the first page cross-reference table. */
+
+Vfprintf(out_file, "xref\n0 %d\n", nmain + 1);
+Vfprintf(out_file, "0000000000 65535 f\r\n");
+for (n = 1; n <= nmain; n++)
+  Vfprintf(out_file, "%010lu 00000 n\r\n",
+    base + hintlen + order[n]->file_offset);
+Vfprintf(out_file, "trailer\n<</Size %d>>\nstartxref\n%lu\n%%%%EOF\n",
+  nmain + 1, filecount + linlen);
+
+free(order);
+free(map);
+free(olen);
+}
+
+
+
 /*************************************************
 *           Free expandable data blocks          *
 *************************************************/
 
-/* This is called from the exit function in main.c so that it is run however
-PMW exits. */
+/* This is called after the PDF has been written, and also from the exit
+function in main.c so that it is run however PMW exits. The object blocks are
+in the output arena, which is also freed. */
 
 void
 pdf_free_data(void)
 {
 for (pdfobject *p = obj_anchor; p != NULL; p = p->next)
   if (p->data != NULL) free(p->data);
+obj_anchor = obj_last = obj_conts = peep_object = NULL;
+mem_arena_free(arena_output);
 }
 
 
@@ -2499,7 +4197,6 @@ int32_t w = 0, d = 0;
 int32_t bboxx, bboxy;
 int32_t filecount = 0;
 int32_t pagecount = 0;
-int32_t resources_number;
 int32_t pages_number;
 int32_t upperencoding_number = 0;
 int32_t lowerencoding_number = 0;
@@ -2593,9 +4290,12 @@ filecount += Cfprintf(out_file, "%%PDF-2.0\n%c%c%c%c%c\n", 0x25, 0xb5, 0xb5,
 new_object() can always assume that obj_last is not NULL. */
 
 objectcount = 1;
-obj_anchor = obj_last = mem_get(sizeof(pdfobject));
+obj_anchor = obj_last = mem_arena_get(arena_output, sizeof(pdfobject), mt_pdf);
 obj_last->next = NULL;
 obj_last->file_offset = 0;  /* Will be updated later */
+obj_last->objstream = 0;
+obj_last->dict = NULL;
+obj_last->page = 0;
 obj_last->base_size = 10;   /* Can be small, as only one string added */
 obj_last->data_size = obj_last->data_used = 0;
 obj_last->data = NULL;
@@ -2650,6 +4350,11 @@ resources = new_object(100);
 resources_number = objectcount;
 EO(resources, "<</ProcSet[/PDF/Text]/Font<<\n");
 
+/* Initialize the hash for the document ID, which is computed incrementally
+when streaming. */
+
+md5Init(&ctx);
+
 /* Now the requested pages. We do this first so that a record can be kept of
 which fonts and which characters are actually used. The pout_get_pages()
 function returns one or two pages. When printing 2-up either one of them may be
@@ -2662,6 +4367,7 @@ for (;;)
   {
   pagestr *p_1stpage, *p_2ndpage;
   pdfobject *pagebase;
+  int32_t pagebase_number;
   double mt[6];
   int32_t scaled;
   BOOL recto;
@@ -2678,10 +4384,13 @@ for (;;)
   setlinewidth = -1;   /* Unset */
   setcaj = 0;
   setfont = -1;
+  peep_op = peep_none;
 
   /* Create a new page object and add it to the pages list. */
 
   pagebase = new_object(100);
+  pagebase_number = objectcount;
+  pagebase->page = pagecount + 1;
   EO(pagebase, "<</Type/Page/Parent %d 0 R\n", pages_number);
   EO(pagebase, "/MediaBox[0 0 %s %s]\n", sff(bboxx), sff(bboxy));
   if (main_landscape) EO(pagebase, "/Rotate 270\n");
@@ -2691,6 +4400,7 @@ for (;;)
   /* Create the contents object */
 
   obj_conts = new_object(1000);
+  obj_conts->page = pagecount + 1;
   EO(obj_conts, "stream\n");
 
   /* Output a comment when testing; check for recto. */
@@ -2830,6 +4540,32 @@ for (;;)
 
   EO(obj_conts, "Q\n");    /* Pops the graphics state */
   pagecount++;
+
+  /* A delayed word spacing reset is not needed at the end of a page. */
+
+  if (settw != 0.0)
+    {
+    peep_removed[pc_wordspace]++;
+    settw = 0.0;
+    }
+
+  /* When streaming, write out the page's objects now. */
+
+  if ((pdf_options & pdfopt_streaming) != 0)
+    filecount = flush_page_objects(pagebase, pagebase_number, filecount, &ctx);
+  }
+
+DEBUG(D_peephole)
+  {
+  eprintf("PDF peephole optimization removed:\n");
+  eprintf("  %d ET/BT pairs (merged text items)\n",
+    peep_removed[pc_textmerged]);
+  eprintf("  %d q/Q pairs (empty graphics state saves)\n",
+    peep_removed[pc_emptygsave]);
+  eprintf("  %d Tw operators (word spacing settings)\n",
+    peep_removed[pc_wordspace]);
+  eprintf("  %d cm operators (identity translations)\n",
+    peep_removed[pc_identity]);
   }
 
 /* Add closing text to Pages object */
@@ -2843,13 +4579,29 @@ be filled in. Then create a font descriptor for the music font. The "8" flag is
 
 if (music_font_used)
   {
-  (void)new_fixed_object("*Font PMW-Music\n");
+  fontstr *fs = font_load(font_search(US"PMW-Music"));
+
+  /* When subsetting, the font file is processed now, in order to get the
+  tagged name, and an OTF placeholder is used. */
+
+  if ((pdf_options & pdfopt_subset) != 0 &&
+      (main_testing & mtest_omitfont) == 0)
+    {
+    uschar buffer[256];
+    fontfile *ff = font_files + nextfontfile;
+    ff->file = font_open_music(".otf", buffer);
+    ff->data = NULL;
+    subset_fontfile(ff, fs);
+    EO(new_object(20), "*FontOTF %d\n", nextfontfile++);
+    }
+  else (void)new_fixed_object("*Font PMW-Music\n");
+
   musicbinary_number = objectcount;
   (void) new_object(10);   /* Length placeholder */
 
   EO(new_object(150),
      "<</Type/FontDescriptor\n"
-     "/FontName/PMW-Music\n"
+     "/FontName/%s\n"
      "/Flags 12\n"
      "/FontBBox[-70 -656 1176 2219]\n"
      "/Ascent 2219\n"
@@ -2857,7 +4609,9 @@ if (music_font_used)
      "/CapHeight 2219\n"
      "/ItalicAngle 0\n"
      "/StemV 176\n"
-     "/FontFile3 %d 0 R\n>>\n", musicbinary_number);
+     "/FontFile3 %d 0 R\n>>\n",
+     (fs->subsetname != NULL)? fs->subsetname : US"PMW-Music",
+     musicbinary_number);
 
   musicdescriptor_number = objectcount;
   }
@@ -2989,12 +4743,21 @@ for (int i = 0; i < font_tablen; i++)
 
 /* Add closing text to Resources object. */
 
-EO(resources, ">> >>\n");
+EO(resources, ">>");
+if (xobjects_created)
+  {
+  EO(resources, "\n/XObject<<");
+  for (int i = 0; i < xobject_count; i++)
+    if (xobjects[i].number != 0)
+      EO(resources, "/Fm%d %d 0 R\n", i, xobjects[i].number);
+  EO(resources, ">>");
+  }
+EO(resources, " >>\n");
 
 /* Compute an MD5 hash to act as an ID for the PDF, as required by ISO 32000-2
-for PDF 2.0. */
+for PDF 2.0. When streaming, the objects that have already been written have
+been included. */
 
-md5Init(&ctx);
 for (pdfobject *p = obj_anchor; p != NULL; p = p->next)
   {
   if (p->data_used > 0) md5Update(&ctx, (uint8_t *)(p->data), p->data_used);
@@ -3003,68 +4766,54 @@ md5Finalize(&ctx);
 for (int i = 0; i < 16; i++) sprintf(md5ID + 2*i, "%02x", ctx.digest[i]);
 md5ID[32] = 0;
 
+/* Linearized output is handled separately. It is organized round the first
+page, so if no pages were selected, a normal file is written. */
+
+if (pdf_linearize && pagecount > 0)
+  {
+  write_linearized(filecount, pagecount, pages, info, md5ID);
+  return;
+  }
+
 /* Write out the objects, setting the sizes of stream objects, and remembering
-the offsets of all objects. Free each object data memory after writing. */
+the offsets of all objects. Free each object data memory after writing. When
+object streams are enabled, only stream objects and placeholders are written
+at this point; other objects are written into object streams afterwards, when
+the lengths of the font streams are known. */
 
 objectcount = 1;
 for (pdfobject *p = obj_anchor; p != NULL; p = p->next)
   {
-  p->file_offset = filecount;                    /* Save for index */
-  filecount += Cfprintf(out_file, "%d 0 obj\n", objectcount++);
-
-  /* If the object starts with the text "*Font PMW-Music" it is a placeholder
-  for inserting the music font. There's a testing option for omitting this,
-  because it's pointless having a copy in every test file output. */
-
-  if (p->data_used >= 15 && Ustrncmp(p->data, "*Font PMW-Music", 15) == 0 &&
-        (main_testing & mtest_omitfont) == 0)
+  if (p->file_offset != 0)        /* Already written when streaming */
     {
-    uschar buffer[256];
-    FILE *f = font_finddata(US "PMW-Music", ".otf", font_music_extra,
-      font_music_default, buffer, TRUE);
-    filecount += write_font_stream(f, "OpenType", p->next, objectcount);
+    objectcount++;
+    continue;
     }
 
-  /* If the object starts with "*FontOTF" it is a placeholder for inserting an
-  OTF font, whose open file is indexed by the number that follows. */
-
-  else if (p->data_used >= 8 && Ustrncmp(p->data, "*FontOTF", 8) == 0)
+  if (is_packable(p))
     {
-    FILE *f = font_files[atoi((char *)(p->data + 8))];
-    if ((main_testing & mtest_omitfont) == 0)
-      filecount += write_font_stream(f, "OpenType", p->next, objectcount);
-    else
-      {
-      filecount += Cfwrite(p->data, 1, p->data_used, out_file);
-      if (fclose(f) != 0) error(ERR200, "font file", strerror(errno));
-      }
+    p->objstream = -1;            /* Pack later */
+    objectcount++;
+    continue;
     }
 
-  /* For other objects, the data is in memory. In the case of an object that
-  starts with "stream" we must add the length. */
-
-  else if (p->data_used >=7 && Ustrncmp(p->data, "stream\n", 7) == 0)
-    {
-    filecount += Cfprintf(out_file, "<</Length %lu>>\n", p->data_used - 7);
-    filecount += Cfwrite(p->data, 1, p->data_used, out_file);
-    filecount += Cfprintf(out_file, "endstream\n");
-    }
-
-  /* Not a stream object. In testing mode there may be empty objects where font
-  data has been omitted. */
-
-  else if (p->data != NULL)
-    filecount += Cfwrite(p->data, 1, p->data_used, out_file);
+  filecount = write_object(p, objectcount++, filecount);
+  }
 
-  /* Terminate the object */
+/* At this point, objectcount is one more than the number of objects, which is
+exactly the value we need for the xref and trailer items. When object streams
+are enabled, the remaining objects are now packed and written, and a
+cross-reference stream is used instead of an xref table and trailer. */
 
-  filecount += Cfprintf(out_file, "endobj\n");
+if ((pdf_options & pdfopt_objstreams) != 0)
+  {
+  filecount = write_object_streams(filecount);
+  write_xref_stream(filecount, md5ID);
+  return;
   }
 
-/* At this point, objectcount is one more than the number of objects, which is
-exactly the value we need for the xref and trailer items. The current value of
-filecount is the offset of the xref object. There is no need to increase it
-further. First write the xref table. */
+/* The current value of filecount is the offset of the xref object. There is no
+need to increase it further. First write the xref table. */
 
 Vfprintf(out_file, "xref\n0 %d\n", objectcount);
 Vfprintf(out_file, "0000000000 65535 f\r\n");
@@ -6,7 +6,7 @@
 
 /* PMW rewrite project started: December 2020 */
 /* This file created: December 2020 */
-/* This file last modified: April 2026 */
+/* This file last modified: October 2026 */
 
 /* This file is included by all the other sources except rdargs.c. */
 
@@ -53,7 +53,9 @@
 #define DRAW_STACKSIZE               100  /* Size of draw stack */
 #define FONTLIST_CHUNKSIZE            10  /* Start and increase by this */
 #define FONTWIDTHS_SIZE              512  /* 2 encoded fonts */
+#define KERN_DIRECT                  256  /* Size of direct kern index */
 #define LOWCHARLIMIT                 384  /* See below */
+#define MACRO_HASHSIZE               256  /* Must be a power of 2 */
 #define MAIN_READBUFFER_CHUNKSIZE    256  /* Start and increase by this */
 #define MAIN_READBUFFER_SIZELIMIT  10240  /* To stop mad runaway */
 #define MAX_BEAMNOTES                100  /* Hopefully overkill */
@@ -79,6 +81,7 @@
 #define MIDI_MAXTEMPOCHANGE           50  /* Max MIDI tempo changes */
 #define MIDI_START_CHUNKSIZE          50  /* Start and increase by this */
 #define MIN_STEMLENGTH_ADJUST      -8000  /* Minimum stem length adjustment */
+#define MEMORY_BLOCKTABLE_CHUNKSIZE  256  /* For the table of memory blocks */
 #define MEMORY_CHUNKSIZE            8192  /* For never-released memory */
 #define MEMORY_MAXBLOCK (MEMORY_CHUNKSIZE - sizeof(char *))
 #define MOVTVECTOR_CHUNKSIZE          10  /* For vector of movements */
@@ -116,6 +119,19 @@ testing mode. Only for PDF are there separate actions. */
 #define mtest_omitfont    0x04u   /* Omit font programs (PDF) */
 #define mtest_forcered    0x08u   /* For red output (PDF) */
 
+/* Bits in the pdf_options variable, which are set by the -pdfopt command line
+option. By default, all except xobjects are set, except when testing, when none
+are set. */
+
+#define pdfopt_subset      0x00000001u   /* Subset embedded fonts */
+#define pdfopt_binaryfonts 0x00000002u   /* Embed fonts in binary */
+#define pdfopt_objstreams  0x00000004u   /* Object and xref streams */
+#define pdfopt_streaming   0x00000008u   /* Write each page when complete */
+#define pdfopt_xobjects    0x00000010u   /* Use forms for repeated items */
+#define pdfopt_peephole    0x00000020u   /* Remove redundant operators */
+#define pdfopt_all         0x0000003fu
+#define pdfopt_default     0x0000002fu
+
 /* A maximum is set for transposition - 5 octaves should be ample - and a
 conventional value for "no transposition". */
 
@@ -194,6 +210,7 @@ vector as text sizes specified by the user and the fixed sizes. */
 #define ff_used         0x00000008u    /* font is used (for PDF output) */
 #define ff_usedlower    0x00000010u    /* lower half used (for std enc) */
 #define ff_usedupper    0x00000020u    /* upper half used (for std enc) */
+#define ff_loaded       0x00000040u    /* metrics have been loaded */
 
 /* Identifiers for each type of font. Any changes in this list must be kept in
 step with the list of font ids which is kept in Font_IdStrings. Font ids must
@@ -358,14 +375,17 @@ debug decoding. */
 #define D_memory       0x00000200u
 #define D_memorydetail 0x00000400u
 #define D_movtflags    0x00000800u
-#define D_preprocess   0x00001000u
-#define D_sortchord    0x00002000u
-#define D_stringwidth  0x00004000u
-#define D_trace        0x00008000u
-#define D_xmlanalyze   0x00010000u
-#define D_xmlgroups    0x00020000u
-#define D_xmlread      0x00040000u
-#define D_xmlstaves    0x00080000u
+#define D_peephole     0x00001000u
+#define D_preprocess   0x00002000u
+#define D_sortchord    0x00004000u
+#define D_stringcache  0x00008000u
+#define D_stringwidth  0x00010000u
+#define D_trace        0x00020000u
+#define D_treehash     0x00040000u
+#define D_xmlanalyze   0x00080000u
+#define D_xmlgroups    0x00100000u
+#define D_xmlread      0x00200000u
+#define D_xmlstaves    0x00400000u
 
 #define DEBUG(x)       if ((debug_selector & (x)) != 0)
 #define TRACE(...)     if ((debug_selector & D_trace) != 0) \
@@ -402,13 +422,37 @@ enum error_number {
   ERR170,ERR171,ERR172,ERR173,ERR174,ERR175,ERR176,ERR177,ERR178,ERR179,
   ERR180,ERR181,ERR182,ERR183,ERR184,ERR185,ERR186,ERR187,ERR188,ERR189,
   ERR190,ERR191,ERR192,ERR193,ERR194,ERR195,ERR196,ERR197,ERR198,ERR199,
-  ERR200,ERR201
+  ERR200,ERR201,ERR202,ERR203,ERR204,ERR205,ERR206,ERR207
 };
 
+/* Types of data structure that are recorded when a score is saved in a cache
+file. The sc_data type is used for anything that contains no pointers. */
+
+enum { sc_data, sc_drawargs, sc_drawnode, sc_drawprog, sc_drawtext,
+  sc_fontsizes, sc_head, sc_htype, sc_item, sc_keytrans, sc_movements, sc_movt,
+  sc_pkey, sc_ptime, sc_slurmod, sc_sname, sc_stave, sc_stavelist, sc_trkey,
+  sc_varnode, sc_zerocopy };
+
+/* Types of data that a job process passes back to the server; see server.c */
+
+enum { pb_font, pb_include, pb_width };
+
 /* Types of input file */
 
 enum filetype { FT_AUTO, FT_PMW, FT_ABC, FT_MXML };
 
+/* Memory arenas; see mem.c */
+
+enum { arena_main, arena_read, arena_paginate, arena_output, arena_midi,
+  arena_xmlout, ARENA_COUNT };
+
+/* Categories of memory request, for the -memstats statistics. Keep in step
+with the names in mem.c. */
+
+enum { mt_misc, mt_baritem, mt_bar, mt_cache, mt_cont, mt_draw, mt_font,
+  mt_heading, mt_macro, mt_midi, mt_movt, mt_page, mt_pdf, mt_posvector,
+  mt_stave, mt_string, mt_tree, mt_xml, MT_COUNT };
+
 /* Clef identifiers. Keep in step with the clef_names list in tables, and
 various data tables in out.c and xmlout.c. */
 
@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: December 2024 */
-/* This file last modified: January 2026 */
+/* This file last modified: October 2026 */
 
 /* This file contains the top-level function and character handling functions
 that are called from the modules that read headings and staves. */
@@ -14,7 +14,9 @@ that are called from the modules that read headings and staves. */
 
 /* Default "macro" for the &* replication feature */
 
-static macrostr replicate_macro = { 1, US"&1", { US"" } };
+static macrosegstr replicate_segment = { 0, 0, NULL };
+static macrostr replicate_macro =
+  { NULL, US"", 0, 1, 1, 2, US"&1", &replicate_segment, { US"" } };
 
 
 
@@ -431,7 +433,7 @@ if (read_c == '/')
 
 if (!stretchOK) error(ERR35, "allowed", "with this directive"); else
   {
-  int32_t *matrix = mem_get(6*sizeof(int32_t));
+  int32_t *matrix = mem_get(6*sizeof(int32_t), mt_font);
   fdata->matrix = matrix;
   matrix[0] = mac_muldiv(stretch, 65536, 1000);
   matrix[1] = 0;
@@ -479,7 +481,7 @@ while (isdigitorsign(read_c) || read_c == '\"')
 
 if (argcount > 0)
   {
-  drawargs = mem_get((argcount+1)*sizeof(drawitem));
+  drawargs = mem_get((argcount+1)*sizeof(drawitem), mt_draw);
   drawargs[0].dtype = dd_number;
   drawargs[0].d.val = argcount;
   memcpy(drawargs+1, args+1, argcount * sizeof(drawitem));
@@ -699,7 +701,8 @@ else
 
 /* This is called for input lines, and also for the arguments of nested macro
 calls. It copies the input string, expanding any macros encountered. Macro
-arguments are expanded recursively.
+arguments are expanded recursively. Literal text is found with memchr() and
+copied in one piece.
 
 Arguments:
   inbuffer      buffer containing the input
@@ -729,14 +732,29 @@ while (in <= inlen)  /* Include terminating zero to get buffer extension */
 
   if (nest < 0) macro_in = in;  /* For error messages */
 
-  /* Handle a literal character. */
+  /* Handle literal text up to the next ampersand or the terminating zero. */
 
-  if (ch != '&' || inbuffer[in] == '&')
+  if (ch != '&')
+    {
+    uschar *amp = memchr(inbuffer + in, '&', inlen - in + 1);
+    size_t end = (amp == NULL)? inlen + 1 : (size_t)(amp - inbuffer);
+    size_t len = end - in + 1;
+    while (outlen - out < len)
+      extend_expand_buffers(nest, &inbuffer, &outbuffer, &outlen);
+    memcpy(outbuffer + out, inbuffer + in - 1, len);
+    out += len;
+    in = end;
+    continue;
+    }
+
+  /* A doubled ampersand is a literal ampersand. */
+
+  if (inbuffer[in] == '&')
     {
     if (out >= outlen)
       extend_expand_buffers(nest, &inbuffer, &outbuffer, &outlen);
     outbuffer[out++] = ch;
-    if (ch == '&') in++;
+    in++;
     continue;
     }
 
@@ -753,7 +771,6 @@ while (in <= inlen)  /* Include terminating zero to get buffer extension */
   if (isalnum(inbuffer[in]))
     {
     usint i = 0;
-    tree_node *s;
 
     read_wordbuffer[i++] = inbuffer[in++];
     while (isalnum(inbuffer[in]))
@@ -770,12 +787,7 @@ while (in <= inlen)  /* Include terminating zero to get buffer extension */
       had_semicolon = TRUE;   /*   skipped, and no args allowed */
       }
 
-    if ((s = tree_search(macro_tree, read_wordbuffer)) != NULL)
-      {
-      mm = (macrostr *)s->data;
-      if (mm == NULL) continue;  /* NULL means no replacement */
-      }
-    else
+    if ((mm = preprocess_findmacro(read_wordbuffer)) == NULL)
       {
       error(ERR17, read_wordbuffer);  /* Couldn't find name */
       continue;
@@ -817,10 +829,10 @@ while (in <= inlen)  /* Include terminating zero to get buffer extension */
 
   if (mm->argcount == 0)
     {
-    size_t len = Ustrlen(mm->text);
+    size_t len = mm->textlen;
     while (outlen - out < len + inlen - in)
       extend_expand_buffers(nest, &inbuffer, &outbuffer, &outlen);
-    Ustrcpy(outbuffer + out, mm->text);
+    memcpy(outbuffer + out, mm->text, len + 1);
     out += len;
     }
 
@@ -948,40 +960,32 @@ while (in <= inlen)  /* Include terminating zero to get buffer extension */
       ap = new_ap + 1;  /* Final zero must remain */
       }
 
-    /* Now copy the replacement, inserting the args. For a replication we
-    repeat many times. For a macro, count is always 1. */
+    /* Now copy the compiled replacement, inserting the args. For a replication
+    we repeat many times. For a macro, count is always 1. An argument that is
+    not given in the call and has no default inserts nothing. */
 
     while (count-- > 0)
       {
-      uschar *pp = mm->text;
-      while (*pp != 0)
+      for (usint i = 0; i < mm->segcount; i++)
         {
-        if (*pp == '&' && isdigit(pp[1]))
-          {
-          int arg = 0;
-          while (isdigit(*(++pp))) arg = arg*10 + *pp - '0';
-          if (*pp == ';') pp++;
-          if (--arg < argcount)
-            {
-            uschar *ss = NULL;
-            if (args[arg] != SIZE_UNSET) ss = argbuff + args[arg];
-              else ss = mm->args[arg];
-            if (ss != NULL)
-              {
-              size_t ssl = Ustrlen(ss);
-              while (ssl + 1 > outlen - out)
-                extend_expand_buffers(nest, &inbuffer, &outbuffer, &outlen);
-              Ustrcpy(outbuffer + out, ss);
-              out += ssl;
-              }
-            }
-          }
-        else
+        macrosegstr *seg = mm->segments + i;
+        uschar *ss = seg->text;
+        size_t ssl = seg->length;
+
+        if (seg->arg >= 0)
           {
-          if (out >= outlen)
-            extend_expand_buffers(nest, &inbuffer, &outbuffer, &outlen);
-          outbuffer[out++] = *pp++;
+          int arg = seg->arg;
+          if (arg >= argcount) continue;
+          if (args[arg] != SIZE_UNSET) ss = argbuff + args[arg];
+            else if (arg < mm->argcount) ss = mm->args[arg];
+          if (ss == NULL) continue;
+          ssl = Ustrlen(ss);
           }
+
+        while (ssl + 1 > outlen - out)
+          extend_expand_buffers(nest, &inbuffer, &outbuffer, &outlen);
+        memcpy(outbuffer + out, ss, ssl);
+        out += ssl;
         }
       }
     outbuffer[out] = 0;
@@ -1001,28 +1005,32 @@ return out - 1;  /* Exclude terminating zero */
 
 /* First remove any trailing comment. Then, if the line contains at least one
 ampersand, swap the input buffer so it becomes the raw input buffer, then
-process it into the new buffer, expanding macros. */
+process it into the new buffer, expanding macros. Most lines contain neither
+'@' nor '&', and memchr() is used to find this out quickly. */
 
 static void
 expand_macros(void)
 {
 BOOL inquotes = FALSE;
 
-for (size_t i = 0; i < main_readlength; i++)
+if (memchr(main_readbuffer, '@', main_readlength) != NULL)
   {
-  usint c = main_readbuffer[i];
-  if (c == '\"') inquotes = !inquotes;
-  else if (!inquotes && c == '@')
+  for (size_t i = 0; i < main_readlength; i++)
     {
-    while (i > 0 && isspace(main_readbuffer[i-1])) i--;
-    main_readbuffer[i++] = '\n';
-    main_readbuffer[i] = 0;
-    main_readlength = i;
-    break;
+    usint c = main_readbuffer[i];
+    if (c == '\"') inquotes = !inquotes;
+    else if (!inquotes && c == '@')
+      {
+      while (i > 0 && isspace(main_readbuffer[i-1])) i--;
+      main_readbuffer[i++] = '\n';
+      main_readbuffer[i] = 0;
+      main_readlength = i;
+      break;
+      }
     }
   }
 
-if (Ustrchr(main_readbuffer, '&') != NULL)
+if (memchr(main_readbuffer, '&', main_readlength) != NULL)
   {
   uschar *temp = main_readbuffer;
   main_readbuffer = main_readbuffer_raw;
@@ -1109,10 +1117,9 @@ for (;;)   /* Loop until a character is obtained or very end is reached. */
     /* Handle reaching the end of an input file. Set up a suitable text for
     error reflection, but also set up as an empty line. */
 
-    if (fclose(read_filehandle) != 0) error(ERR200,
+    if (read_close_file() != 0) error(ERR200,
       (read_filestackptr != 0)? "included input file" : "input file",
       strerror(errno));
-    read_filehandle = NULL;
 
     Ustrcpy(main_readbuffer, "---- End of file ----\n");
     read_i = main_readlength = Ustrlen(main_readbuffer);
@@ -1132,6 +1139,10 @@ for (;;)   /* Loop until a character is obtained or very end is reached. */
 
     read_filename = read_filestack[--read_filestackptr].filename;
     read_filehandle = read_filestack[read_filestackptr].file;
+    read_mapstart = read_filestack[read_filestackptr].mapstart;
+    read_mapptr = read_filestack[read_filestackptr].mapptr;
+    read_mapend = read_filestack[read_filestackptr].mapend;
+    read_mapcached = read_filestack[read_filestackptr].mapcached;
     read_linenumber = read_filestack[read_filestackptr].linenumber;
     read_okdepth = read_filestack[read_filestackptr].okdepth;
     read_skipdepth = 0;
@@ -1188,7 +1199,7 @@ for (;;)
   pointer points to the default movement data. */
 
   premovt = (curmovt == NULL)? &default_movtstr : curmovt;
-  movements[movement_count++] = newmovt = mem_get(sizeof(movtstr));
+  movements[movement_count++] = newmovt = mem_get(sizeof(movtstr), mt_movt);
   read_init_movement(newmovt, 0, movtopts);
   curmovt = newmovt;
 
@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2025 */
 /* This file created: December 2020 */
-/* This file last modified: December 2025 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -21,10 +21,6 @@
 *                 Local data                     *
 *************************************************/
 
-/* An empty PMW string */
-
-static uint32_t empty_string[] = { 0 };
-
 /* The table of header directives contains integer parameters that index into
 this list when setting global values that apply to all movements. */
 
@@ -151,7 +147,7 @@ structure yet, set one up. */
 
 if (!MFLAG(mf_copiedfontsizes))
   {
-  fontsizestr *new = mem_get(sizeof(fontsizestr));
+  fontsizestr *new = mem_get(sizeof(fontsizestr), mt_movt);
   *new = *(curmovt->fontsizes);
   curmovt->fontsizes = new;
   curmovt->flags |= mf_copiedfontsizes;
@@ -370,7 +366,7 @@ static void
 movt_headfoot(void)
 {
 headstr **oldp = (headstr **)(((uschar *)curmovt) + dir->arg1);
-headstr *new = mem_get(sizeof(headstr));
+headstr *new = mem_get(sizeof(headstr), mt_heading);
 
 /* Start a new chain if this is the first occurrence this movement. */
 
@@ -400,7 +396,7 @@ static void
 accadjusts(void)
 {
 int i;
-int32_t *x = mem_get(NOTETYPE_COUNT*sizeof(int32_t));
+int32_t *x = mem_get(NOTETYPE_COUNT*sizeof(int32_t), mt_movt);
 for (i = 0; i < NOTETYPE_COUNT; i++)
   {
   if (read_c == ',') read_nextsigc();
@@ -428,7 +424,7 @@ static void
 accspacing(void)
 {
 int i;
-uint32_t *x = mem_get(ACCSPACE_COUNT*sizeof(uint32_t));
+uint32_t *x = mem_get(ACCSPACE_COUNT*sizeof(uint32_t), mt_movt);
 memcpy(x, curmovt->accspacing, ACCSPACE_COUNT*sizeof(uint32_t));
 curmovt->accspacing = x;
 
@@ -473,7 +469,7 @@ Returns:      0 this ligature is not acceptable
 static int
 callback(uint32_t codepoint, void *data)
 {
-fontstr *fs = &(font_list[font_table[(intptr_t)data]]);
+fontstr *fs = font_load(font_table[(intptr_t)data]);
 uint32_t c = font_utranslate(codepoint, fs);
 if (c == 0xffffffffu) c = codepoint;   /* No Unicode translation */
 return (c < 512)? 1 : 0;
@@ -782,10 +778,11 @@ if (!isdigit(read_c)) { error(ERR8, "stave number"); return; }
 
 while (isdigit(read_c))
   {
-  zerocopystr *p = mem_get(sizeof(zerocopystr));
+  zerocopystr *p = mem_get(sizeof(zerocopystr), mt_movt);
   *pp = p;
   pp = &(p->next);
   p->next = NULL;
+  p->cont = NULL;
   p->stavenumber = read_usint();
   if (read_c == '/')
     {
@@ -999,7 +996,7 @@ for (k = main_keytranspose; k != NULL; k = k->next)
 if (k == NULL)
   {
   int i;
-  k = mem_get(sizeof(keytransstr));
+  k = mem_get(sizeof(keytransstr), mt_movt);
   k->oldkey = oldkey;
   k->next = main_keytranspose;
   main_keytranspose = k;
@@ -1119,7 +1116,7 @@ for (;;)
 
     /* Save in correct size piece of store */
 
-    curmovt->layout = mem_get(ptr*sizeof(uint16_t));
+    curmovt->layout = mem_get(ptr*sizeof(uint16_t), mt_movt);
     memcpy(curmovt->layout, temp, ptr*sizeof(uint16_t));
     return;
     }
@@ -1499,7 +1496,7 @@ while (isdigit(read_c))
 
 if (i > 0)
   {
-  curmovt->miditempochanges = mem_get((i+1) * sizeof(uint32_t));
+  curmovt->miditempochanges = mem_get((i+1) * sizeof(uint32_t), mt_movt);
   memcpy(curmovt->miditempochanges, list, i * sizeof(uint32_t));
   curmovt->miditempochanges[i] = UINT32_MAX;
   }
@@ -1771,7 +1768,7 @@ static void
 printkey(void)
 {
 dirstr *d;
-pkeystr *p = mem_get(sizeof(pkeystr));
+pkeystr *p = mem_get(sizeof(pkeystr), mt_movt);
 p->next = main_printkey;
 p->movt_number = movement_count;
 main_printkey = p;
@@ -1788,7 +1785,12 @@ if (d == NULL)
 p->clef = d->arg1;
 p->string = string_read(font_mf, TRUE);
 read_sigc();
-p->cstring = (read_c == '"')? string_read(font_mf, TRUE) : empty_string;
+if (read_c == '"') p->cstring = string_read(font_mf, TRUE);
+else
+  {
+  p->cstring = mem_get(sizeof(uint32_t), mt_string);
+  p->cstring[0] = 0;
+  }
 }
 
 
@@ -1848,7 +1850,7 @@ return TRUE;
 static void
 printtime(void)
 {
-ptimestr *p = mem_get(sizeof(ptimestr));
+ptimestr *p = mem_get(sizeof(ptimestr), mt_movt);
 p->next = main_printtime;
 p->movt_number = movement_count;
 main_printtime = p;
@@ -2048,7 +2050,7 @@ subsequent movements. */
 static void
 stavesize(void)
 {
-int32_t *stavesizes = mem_get((MAX_STAVE+1)*sizeof(int32_t));
+int32_t *stavesizes = mem_get((MAX_STAVE+1)*sizeof(int32_t), mt_movt);
 memcpy(stavesizes, curmovt->stavesizes, (MAX_STAVE+1)*sizeof(int32_t));
 curmovt->stavesizes = stavesizes;
 
@@ -2313,6 +2315,7 @@ if (n != font_unknown)
   {
   font_table[fontid] = n;
   font_list[n].flags |= flags;
+  string_widthcache_flush();
   }
 else
   {
@@ -2412,7 +2415,7 @@ uint32_t oldkey = read_key();
 read_nextword();
 if (Ustrcmp(read_wordbuffer, "use") != 0) error(ERR8, "\"use\""); else
   {
-  trkeystr *k = mem_get(sizeof(trkeystr));
+  trkeystr *k = mem_get(sizeof(trkeystr), mt_movt);
   read_sigc();
   k->oldkey = oldkey;
   k->newkey = read_key();
@@ -2623,6 +2626,10 @@ static dirstr headlist[] = {
 
 static int headsize = sizeof(headlist)/sizeof(dirstr);
 
+/* Perfect hash for the list, set up when first needed */
+
+static keyhashstr headhash = { NULL, 0, 0, 0, 0, NULL, NULL };
+
 
 
 /*************************************************
@@ -2638,9 +2645,12 @@ pmw_read_header(void)
 {
 TRACE("Read header directives: movement %d\n", movement_count);
 
+if (headhash.table == NULL)
+  misc_keyhash_build(&headhash, headlist, headsize, sizeof(dirstr));
+
 for (;;)
   {
-  dirstr *first, *last;
+  int n;
 
   read_nextword();
   if (read_wordbuffer[0] == 0)
@@ -2660,24 +2670,13 @@ for (;;)
   /* Look up the word in the list of heading directives and if found, call the
   appropriate function. */
 
-  first = headlist;
-  last  = first + headsize;
-
-  while (last > first)
+  n = misc_keyhash_find(&headhash, read_wordbuffer);
+  if (n < 0) error_skip(ERR24, '\n', read_wordbuffer); else
     {
-    int c;
-    dir = first + (last - first)/2;
-    c = Ustrcmp(read_wordbuffer, dir->name);
-    if (c == 0)
-      {
-      read_sigc();
-      (dir->proc)();
-      break;
-      }
-    if (c > 0) first = dir + 1; else last = dir;
+    dir = headlist + n;
+    read_sigc();
+    (dir->proc)();
     }
-
-  if (last <= first) error_skip(ERR24, '\n', read_wordbuffer);
   }
 }
 
@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: December 2020 */
-/* This file last modified: January 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -295,7 +295,7 @@ read_init_baraccs(read_baraccs_tp, srs.key_tp);
 /* Initialize a new head of bar structure, passing it back to the caller, and
 making it available while reading the bar. */
 
-*barstrptr = bar = brs.bar = mem_get(sizeof(barstr));
+*barstrptr = bar = brs.bar = mem_get(sizeof(barstr), mt_bar);
 bar->next = bar->prev = NULL;
 bar->type = b_start;
 bar->repeatnumber = 0;
@@ -1049,8 +1049,8 @@ while (!endstave)
 
   if (lastnextbaroffset < nextbaroffset)
     {
-    barstr *bs = mem_get(sizeof(barstr));
-    b_barlinestr *bl = mem_get(sizeof(b_barlinestr));
+    barstr *bs = mem_get(sizeof(barstr), mt_bar);
+    b_barlinestr *bl = mem_get(sizeof(b_barlinestr), mt_baritem);
 
     bs->next = (bstr *)bl;
     bs->prev = NULL;
@@ -1079,7 +1079,7 @@ while (!endstave)
     st->barindex[nextbaroffset++] = bar;
     if (i++ == barrepeat) break;
 
-    newbar = mem_get(sizeof(barstr));
+    newbar = mem_get(sizeof(barstr), mt_bar);
     newbar->next = brs.repeatstart;
     newbar->prev = NULL;
     newbar->type = b_start;
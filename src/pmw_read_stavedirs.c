@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: February 2021 */
-/* This file last modified: April 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -968,7 +968,7 @@ while(read_c == '\"' ||
 
   if (read_c == '\"' || p == NULL || p->drawing != NULL)
     {
-    p = mem_get(sizeof(snamestr));
+    p = mem_get(sizeof(snamestr), mt_stave);
     *p = init_snamestr;
     *pp = p;
     pp = &(p->next);
@@ -985,7 +985,7 @@ while(read_c == '\"' ||
       snamestr **ppe = &(p->extra);
       for (;;)
         {
-        snamestr *pe = *ppe = mem_get(sizeof(snamestr));
+        snamestr *pe = *ppe = mem_get(sizeof(snamestr), mt_stave);
         *pe = init_snamestr;
         if (!read_name_string(pe)) break;
         ppe = &(pe->extra);
@@ -1357,7 +1357,7 @@ findmods(usint sequence, b_slurmodstr **anchor)
 b_slurmodstr *m;
 for (m = *anchor; m != NULL; m = m->next)
   if (m->sequence == sequence) return m;
-m = mem_get(sizeof(b_slurmodstr));
+m = mem_get(sizeof(b_slurmodstr), mt_baritem);
 memset(m, 0, sizeof(b_slurmodstr));
 m->next = *anchor;
 *anchor = m;
@@ -2391,6 +2391,10 @@ static dirstr read_stavedirlist[] = {
 
 static int read_stavedirsize = sizeof(read_stavedirlist)/sizeof(dirstr);
 
+/* Perfect hash for the list, set up when first needed */
+
+static keyhashstr read_stavedirhash = { NULL, 0, 0, 0, 0, NULL, NULL };
+
 
 
 /*************************************************
@@ -2404,23 +2408,17 @@ lists for clefs. The directive name is already in read_wordbuffer. */
 dirstr *
 read_stave_searchdirlist(BOOL justclef)
 {
-dirstr *first = read_stavedirlist;
-dirstr *last  = first + read_stavedirsize;
+int n;
+dirstr *d;
 
-while (last > first)
-  {
-  int c;
-  dirstr *d = first + (last-first)/2;
-  c = Ustrcmp(read_wordbuffer, d->name);
-  if (c == 0)
-    {
-    if (justclef && d->proc != p_clef) return NULL;
-    return d;
-    }
-  if (c > 0) first = d + 1; else last = d;
-  }
+if (read_stavedirhash.table == NULL)
+  misc_keyhash_build(&read_stavedirhash, read_stavedirlist, read_stavedirsize,
+    sizeof(dirstr));
 
-return NULL;
+n = misc_keyhash_find(&read_stavedirhash, read_wordbuffer);
+if (n < 0) return NULL;
+d = read_stavedirlist + n;
+return (justclef && d->proc != p_clef)? NULL : d;
 }
 
 
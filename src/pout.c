@@ -367,7 +367,6 @@ pout_getswidth(uint32_t *s, usint f, fontstr *fs, int32_t *plast_width,
 int32_t swidth = 0;
 int32_t last_width = 0;
 int32_t last_r2ladjust = 0;
-kerntablestr *ktable = fs->kerns;
 
 for (uint32_t *p = s; *p != 0; p++)
   {
@@ -424,32 +423,10 @@ for (uint32_t *p = s; *p != 0; p++)
 
   swidth += last_width;
 
-  /* If there is another character, scan the kerning table. At present,
-  kerning is supported only for characters whose code points are no greater
-  than 0xffff. */
+  /* If there is another character, look up the kern for the pair. */
 
-  if (main_kerning && fs->kerncount > 0 && p[1] != 0 && c <= 0xffffu)
-    {
-    uint32_t cc = PCHAR(p[1]);
-    if (cc <= 0xffffu)
-      {
-      int bot = 0;
-      int top = fs->kerncount;
-      uint32_t pair = (c << 16) | cc;
-
-      while (bot < top)
-        {
-        int mid = (bot + top)/2;
-        kerntablestr *k = &(ktable[mid]);
-        if (pair == k->pair)
-          {
-          swidth += k->kwidth;
-          break;
-          }
-        if (pair < k->pair) top = mid; else bot = mid + 1;
-        }
-      }
-    }
+  if (main_kerning && fs->kerncount > 0 && p[1] != 0)
+    swidth += font_kern(fs, c, PCHAR(p[1]));
   }
 
 *plast_width = last_width;
@@ -537,7 +514,7 @@ while (*s != 0)
 if (main_righttoleft)
   {
   int32_t last_width, last_r2ladjust;
-  fontstr *fs = &(font_list[font_table[f & ~font_small]]);
+  fontstr *fs = font_load(font_table[f & ~font_small]);
   int32_t swidth = pout_getswidth(p, f, fs, &last_width, &last_r2ladjust);
 
   /* Adjust the printing position for the string by the length of the string,
@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: December 2020 */
-/* This file last modified: March 2026 */
+/* This file last modified: October 2026 */
 
 /* This file contains code for handling pre-processing directives. */
 
@@ -12,6 +12,121 @@
 
 
 
+/*************************************************
+*             Hash a macro name                  *
+*************************************************/
+
+/* This is the 32-bit FNV-1a hash.
+
+Argument:  the name
+Returns:   the hash value
+*/
+
+static uint32_t
+macro_hash(uschar *name)
+{
+uint32_t hash = 2166136261u;
+while (*name != 0) hash = (hash ^ *name++) * 16777619u;
+return hash;
+}
+
+
+
+/*************************************************
+*               Find a macro                     *
+*************************************************/
+
+/*
+Argument:  the macro's name
+Returns:   pointer to the macro's data, or NULL if not found
+*/
+
+macrostr *
+preprocess_findmacro(uschar *name)
+{
+uint32_t hash = macro_hash(name);
+macrostr *mm = macro_table[hash & (MACRO_HASHSIZE - 1)];
+for (; mm != NULL; mm = mm->next)
+  if (mm->hash == hash && Ustrcmp(mm->name, name) == 0) break;
+return mm;
+}
+
+
+
+/*************************************************
+*       Compile a macro's replacement text       *
+*************************************************/
+
+/* The text is split into literal segments and insertions of arguments, which
+are written as & followed by a number, optionally followed by a semicolon. All
+other characters, including other ampersands, are literal. Argument numbers
+that can never be valid yield no segment. For a macro that is defined without
+arguments, the whole text is literal, because such a macro never takes
+arguments.
+
+Argument:  the macro
+Returns:   nothing
+*/
+
+static void
+macro_compile(macrostr *mm)
+{
+uschar *p = mm->text;
+uschar *lit = p;
+usint count = 1;
+
+/* Find the maximum number of segments that are needed. */
+
+if (mm->argcount > 0)
+  for (uschar *q = p; *q != 0; q++) if (*q == '&' && isdigit(q[1])) count += 2;
+
+mm->segments = mem_arena_get(arena_read, count * sizeof(macrosegstr), mt_macro);
+mm->segcount = 0;
+
+if (mm->argcount > 0) while (*p != 0)
+  {
+  int arg = 0;
+  macrosegstr *seg;
+
+  if (*p != '&' || !isdigit(p[1]))
+    {
+    p++;
+    continue;
+    }
+
+  if (p > lit)
+    {
+    seg = mm->segments + mm->segcount++;
+    seg->arg = -1;
+    seg->length = p - lit;
+    seg->text = lit;
+    }
+
+  while (isdigit(*(++p)))
+    if (arg <= MAX_MACROARGS) arg = arg*10 + *p - '0';
+  if (*p == ';') p++;
+  lit = p;
+
+  if (arg > 0 && arg <= MAX_MACROARGS)
+    {
+    seg = mm->segments + mm->segcount++;
+    seg->arg = arg - 1;
+    seg->length = 0;
+    seg->text = NULL;
+    }
+  }
+
+if (mm->text + mm->textlen > lit)
+  {
+  macrosegstr *seg = mm->segments + mm->segcount++;
+  seg->arg = -1;
+  seg->length = mm->text + mm->textlen - lit;
+  seg->text = lit;
+  }
+}
+
+
+
 /*************************************************
 *        Deal with pre-processing directive      *
 *************************************************/
@@ -134,7 +249,7 @@ if (Ustrcmp(read_wordbuffer, "if") == 0)
 
       if (read_wordbuffer[0] == 0) error_skip(ERR8, '\n', "macro name"); else
         {
-        if ((tree_search(macro_tree, read_wordbuffer) != NULL) == is_undef)
+        if ((preprocess_findmacro(read_wordbuffer) != NULL) == is_undef)
         OK = !OK;
         }
       }
@@ -267,9 +382,10 @@ if (Ustrcmp(read_wordbuffer, "define") == 0)
   uschar *rep;
   uschar *args[MAX_MACROARGS];
   uschar argbuffer[MAX_MACRODEFAULT + 1];
-  tree_node *p;
+  uschar *name;
   macrostr *mm;
   size_t replen;
+  uint32_t hash;
 
   read_sigcNL();
   if (isalnum(read_c))
@@ -291,10 +407,11 @@ if (Ustrcmp(read_wordbuffer, "define") == 0)
     return;
     }
 
-  p = mem_get(sizeof(tree_node));
-  p->name = mem_get(Ustrlen(read_wordbuffer) + 1);
-  Ustrcpy(p->name, read_wordbuffer);
-  p->data = NULL;  /* Default no arguments */
+  /* Macro definitions are needed only while reading, so they are put in the
+  read arena, which is freed when reading is complete. */
+
+  name = mem_arena_get(arena_read, i + 1, mt_macro);
+  memcpy(name, read_wordbuffer, i + 1);
 
   /* Handle macro optional default arguments. */
 
@@ -339,7 +456,7 @@ if (Ustrcmp(read_wordbuffer, "define") == 0)
 
       if (s > 0)
         {
-        uschar *ss = mem_get(s + 1);
+        uschar *ss = mem_arena_get(arena_read, s + 1, mt_macro);
         memcpy(ss, argbuffer, s);
         ss[s] = 0;
         args[argcount++] = ss;
@@ -357,7 +474,7 @@ if (Ustrcmp(read_wordbuffer, "define") == 0)
 
   read_sigcNL();
   replen = main_readlength - read_i;  /* Don't include the newline */
-  rep = mem_get(replen + 1);
+  rep = mem_arena_get(arena_read, replen + 1, mt_macro);
   memcpy(rep, main_readbuffer + read_i - 1, replen); /* Include current char */
   rep[replen] = 0;
 
@@ -365,21 +482,34 @@ if (Ustrcmp(read_wordbuffer, "define") == 0)
   memory for however many arguments there actually are. Note: we must not use
   (argcount-1) because argcount is unsigned and may be zero. */
 
-  p->data = mm =
-    mem_get(sizeof(macrostr) - sizeof(uschar *) + argcount*sizeof(uschar *));
+  mm = mem_arena_get(arena_read,
+    sizeof(macrostr) - sizeof(uschar *) + argcount*sizeof(uschar *), mt_macro);
+  mm->name = name;
   mm->argcount = argcount;
   mm->text = rep;
+  mm->textlen = replen;
   for (i = 0; i < argcount; i++) mm->args[i] = args[i];
+  macro_compile(mm);
 
   DEBUG(D_macro)
     {
-    (void)fprintf(stderr, "defined macro \"%s\" argcount=%d\n", p->name, argcount);
+    (void)fprintf(stderr, "defined macro \"%s\" argcount=%d\n", name, argcount);
     (void)fprintf(stderr, "  replacement: >%s<\n", rep);
     for (i = 0; i < argcount; i++)
       (void)fprintf(stderr, "  %d %s\n", i+1, mm->args[i]);
+    (void)fprintf(stderr, "  compiled into %d segment%s\n", mm->segcount,
+      (mm->segcount == 1)? "" : "s");
     }
 
-  if (!tree_insert(&macro_tree, p)) error(ERR16, read_wordbuffer);
+  /* Add to the hash table unless already defined. */
+
+  if (preprocess_findmacro(name) != NULL) error(ERR16, name); else
+    {
+    hash = macro_hash(name);
+    mm->hash = hash;
+    mm->next = macro_table[hash & (MACRO_HASHSIZE - 1)];
+    macro_table[hash & (MACRO_HASHSIZE - 1)] = mm;
+    }
   read_i = main_readlength;
   read_c = '\n';
   }
@@ -391,6 +521,7 @@ else if (Ustrcmp(read_wordbuffer, "include") == 0)
   {
   FILE *f;
   uschar buffer[256];
+  BOOL cached;
 
   if (read_filestackptr >= MAX_INCLUDE) error(ERR33, MAX_INCLUDE);  /* Hard */
   if (read_c == '\n' || !string_read_plain())
@@ -429,6 +560,10 @@ else if (Ustrcmp(read_wordbuffer, "include") == 0)
 
   read_filestack[read_filestackptr].file = read_filehandle;
   read_filestack[read_filestackptr].filename = read_filename;
+  read_filestack[read_filestackptr].mapstart = read_mapstart;
+  read_filestack[read_filestackptr].mapptr = read_mapptr;
+  read_filestack[read_filestackptr].mapend = read_mapend;
+  read_filestack[read_filestackptr].mapcached = read_mapcached;
   read_filestack[read_filestackptr].linenumber = read_linenumber;
   read_filestack[read_filestackptr++].okdepth = read_okdepth;
 
@@ -436,12 +571,16 @@ else if (Ustrcmp(read_wordbuffer, "include") == 0)
 
   read_filehandle = f;
   read_filename = mem_copystring(read_stringbuffer);
+  read_mapcached = FALSE;
   read_linenumber = 0;
   read_okdepth = 0;
 
-  /* Check the first line of the file to test for MusicXML. */
+  /* If an up-to-date copy of the file's contents is cached, it has already
+  been checked for MusicXML, and is used instead of reading the file.
+  Otherwise, check the first line of the file to test for MusicXML. */
 
-  if (fgets(CS buffer, sizeof(buffer), f) != NULL)
+  cached = read_include_cached();
+  if (!cached && fgets(CS buffer, sizeof(buffer), f) != NULL)
     {
     uschar *p = buffer;
     if (Ustrncmp(main_readbuffer, "\xef\xbb\xbf", 3) == 0) p += 3;
@@ -455,9 +594,14 @@ else if (Ustrcmp(read_wordbuffer, "include") == 0)
       stave, then restore the variables. Give an error if we are in the middle
       of a PMW stave. Otherwise, we are done. */
 
+      scorecache_nosave("MusicXML input is not cached");
       if (!pmw_reading_stave) xml_read();
       read_filename = read_filestack[--read_filestackptr].filename;
       read_filehandle = read_filestack[read_filestackptr].file;
+      read_mapstart = read_filestack[read_filestackptr].mapstart;
+      read_mapptr = read_filestack[read_filestackptr].mapptr;
+      read_mapend = read_filestack[read_filestackptr].mapend;
+      read_mapcached = read_filestack[read_filestackptr].mapcached;
       read_linenumber = read_filestack[read_filestackptr].linenumber;
       read_okdepth = read_filestack[read_filestackptr].okdepth;
       if (pmw_reading_stave) error(ERR4, "MusicXML");  /* Hard */
@@ -470,6 +614,13 @@ else if (Ustrcmp(read_wordbuffer, "include") == 0)
     else rewind(f);
     }
 
+  /* Map a PMW file into memory and keep a copy of its contents. */
+
+  if (!cached)
+    {
+    read_map_file();
+    read_cache_include();
+    }
   was_include = TRUE;
   }
 
@@ -479,6 +630,7 @@ else if (Ustrcmp(read_wordbuffer, "include") == 0)
 else if (Ustrcmp(read_wordbuffer, "comment") == 0)
   {
   (void)fprintf(stderr, "%s", main_readbuffer + read_i - 1);
+  scorecache_nosave("*comment writes output while reading");
   read_i = main_readlength;
   read_c = '\n';
   }
@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: May 2021 */
-/* This file last modified: January 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -28,6 +28,10 @@ static int32_t ps_fmatrix[6];
 
 static uschar  *ps_IdStrings[font_tablen+1];
 
+static uschar  *ps_header_data = NULL;      /* Preloaded copy of the header */
+static size_t   ps_header_size;
+static const uschar *ps_header_name;
+
 
 /*************************************************
 *         Output ASCII formatted string          *
@@ -231,8 +235,7 @@ static void
 ps_basic_string(uint32_t *s, usint f, fontinststr *fdata, int32_t x, int32_t y,
   BOOL startadjust)
 {
-fontstr *fs = &(font_list[font_table[f & ~font_small]]);
-kerntablestr *ktable = fs->kerns;
+fontstr *fs = font_load(font_table[f & ~font_small]);
 fontinststr tfd = *fdata;
 BOOL instring = FALSE;
 BOOL absolute = TRUE;
@@ -342,28 +345,12 @@ for (p = s; *p != 0; p++)
     }
   else ps_chcount += Cfprintf(out_file, "\\%03o", pc);
 
-  /* If there is another character, scan the kerning table */
+  /* If there is another character, look up the kern for the pair */
 
   if (main_kerning && fs->kerncount > 0 && p[1] != 0)
     {
-    int32_t xadjust = 0, yadjust = 0;
-    int bot = 0;
-    int top = fs->kerncount;
-    uint32_t cc = PCHAR(p[1]);
-    uint32_t pair;
-
-    pair = (c << 16) | cc;
-    while (bot < top)
-      {
-      int mid = (bot + top)/2;
-      kerntablestr *k = &(ktable[mid]);
-      if (pair == k->pair)
-        {
-        xadjust = k->kwidth;
-        break;
-        }
-      if (pair < k->pair) top = mid; else bot = mid + 1;
-      }
+    int32_t xadjust = font_kern(fs, c, PCHAR(p[1]));
+    int32_t yadjust = 0;
 
     /* If a kern was found, scale the adjustment to the font size, and for the
     string rotation and transformation, if any. Then close the previous
@@ -450,7 +437,7 @@ if (!bar_use_draw &&
     (magn <= out_stavemagn || ytop != ybot))
   {
   if (main_righttoleft)
-    x += mac_muldiv(font_list[font_mf].r2ladjusts[type], 10*magn, 1000);
+    x += mac_muldiv(font_load(font_mf)->r2ladjusts[type], 10*magn, 1000);
 
   pout_mfdata.size = 10 * magn;
   if (ps_needchangefont(font_mf, &pout_mfdata, FALSE))
@@ -1174,6 +1161,41 @@ ps_printf("%%%s/%d\n", sfb(curmovt->barvector[barnumber]), stave);
 
 
 
+/*************************************************
+*      Preload the PostScript header file        *
+*************************************************/
+
+/* This is called in server and batch modes, so that the header file is read
+only once, instead of once for each job. If the file cannot be read, nothing
+is preloaded, and any error will be reported when a job tries to use it.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+ps_preload_header(void)
+{
+FILE *f = Ufopen(ps_header, "rb");
+long size;
+
+if (f == NULL) return;
+if (fseek(f, 0, SEEK_END) == 0 && (size = ftell(f)) > 0 &&
+    fseek(f, 0, SEEK_SET) == 0)
+  {
+  ps_header_data = mem_get_independent((size_t)size, mt_misc);
+  if (fread(ps_header_data, 1, (size_t)size, f) == (size_t)size)
+    {
+    ps_header_size = (size_t)size;
+    ps_header_name = ps_header;
+    }
+  else ps_header_data = NULL;
+  }
+(void)fclose(f);
+}
+
+
+
 /*************************************************
 *     Include a file in the PostScript output    *
 *************************************************/
@@ -1207,7 +1229,9 @@ BOOL insert_eps = FALSE;
 while (Ustrlen(s) + 1 > read_stringbuffer_size) string_extend_buffer();
 Ustrcpy(read_stringbuffer, s);
 if (relativize) string_relativize();
-f = Ufopen(read_stringbuffer, "r");
+f = (ps_header_data != NULL && Ustrcmp(read_stringbuffer, ps_header_name) == 0)?
+  fmemopen(ps_header_data, ps_header_size, "r") :
+  Ufopen(read_stringbuffer, "r");
 
 if (f == NULL) error(ERR23, read_stringbuffer, strerror(errno));  /* Hard */
 
@@ -1275,9 +1299,11 @@ else
   fdefault = font_data_default;
   }
 
-/* font_finddata(..., TRUE) gives a hard error if the file cannot be found. */
+/* font_finddata(..., TRUE) gives a hard error if the file cannot be found.
+The music font may have been preloaded. */
 
-f = font_finddata(name, ext, fextra, fdefault, buff, TRUE);
+f = (Ustrcmp(name, "PMW-Music") == 0)? font_open_music(ext, buff) :
+  font_finddata(name, ext, fextra, fdefault, buff, TRUE);
 
 /* Copy from "%%BeginResource:" or the start of the file to "%%EndResource" or
 the end of the file. */
@@ -1482,7 +1508,7 @@ for (int i = 0; i < font_tablen; i++)
   for (j = 0; j < i; j++) if (font_table[i] == font_table[j]) break;
   if (j == i)
     {
-    fontstr *f = font_list + font_table[i];
+    fontstr *f = font_load(font_table[i]);
     if (f->encoding != NULL)
       {
       for (int k = 0; k < FONTWIDTHS_SIZE; k += 256)
@@ -4,9 +4,32 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: December 2020 */
-/* This file last modified: January 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+/* The contents of included files are kept in memory for the life of the
+process, so that a file that is included more than once (for example, in
+several movements) is read only once. A cached copy is used only if the file's
+name, identity, size, and modification time are unchanged. In server and batch
+modes each job runs in its own process, so each job passes the names of the
+files that it includes back to the server, which reads them into its own cache
+for later jobs to inherit. */
+
+typedef struct includecachestr {
+  struct includecachestr *next;
+  uschar  *name;
+  uschar  *data;
+  size_t   size;
+  dev_t    dev;
+  ino_t    ino;
+  time_t   mtime;
+} includecachestr;
+
+static includecachestr *include_cache = NULL;
 
 
 
@@ -44,7 +67,7 @@ read_init_stave(int32_t stave, BOOL ispmw)
 if (stave > MAX_STAVE) error(ERR84, stave);  /* Hard */
 if (curmovt->stavetable[stave] != NULL) error(ERR85, stave);  /* Hard */
 
-curmovt->stavetable[stave] = mem_get(sizeof(stavestr));
+curmovt->stavetable[stave] = mem_get(sizeof(stavestr), mt_stave);
 *(curmovt->stavetable[stave]) = init_stavestr;
 if (stave > curmovt->laststave) curmovt->laststave = stave;
 
@@ -125,7 +148,7 @@ for (int i = 0; i <= curmovt->laststave; i++)
   if (st->barcount < curmovt->barcount)
     {
     b_barlinestr *bl;
-    barstr *empty_bar = mem_get(sizeof(barstr));
+    barstr *empty_bar = mem_get(sizeof(barstr), mt_bar);
     read_lastitem = (bstr *)empty_bar;
 
     empty_bar->next = empty_bar->prev = NULL;
@@ -246,7 +269,7 @@ while (isdigit((unsigned char)*sss))
   if (map != NULL) for (long int i = s; i <= t; i++) *map |= 1ul << i;
   if (slp != NULL)
     {
-    stavelist *sl = mem_get(sizeof(stavelist));
+    stavelist *sl = mem_get(sizeof(stavelist), mt_stave);
     sl->first = s;
     sl->last = t;
     sl->next = NULL;
@@ -333,6 +356,288 @@ while (needed >= st->barindex_size)
 
 
 
+/*************************************************
+*         Set up a newly opened input file       *
+*************************************************/
+
+/* This is called whenever read_filehandle has been set to a newly opened input
+file. If the file is a non-empty regular file, it is mapped into memory so that
+read_physical_line() can find whole lines at once. Otherwise (for example, for
+stdin or a pipe), or if mapping fails, the file is read one character at a
+time.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+read_map_file(void)
+{
+struct stat statbuf;
+void *map;
+
+read_mapstart = read_mapptr = read_mapend = NULL;
+
+if (fstat(fileno(read_filehandle), &statbuf) != 0)
+  {
+  if (scorecache_dir != NULL)
+    scorecache_nosave("an input file could not be checked");
+  return;
+  }
+
+if (!S_ISREG(statbuf.st_mode) ||
+    statbuf.st_size <= 0 ||
+    (uint64_t)statbuf.st_size > SIZE_MAX)
+  {
+  if (scorecache_dir != NULL)
+    {
+    if (S_ISREG(statbuf.st_mode) && statbuf.st_size == 0)
+      scorecache_add_input(NULL, 0);
+    else scorecache_nosave("an input file is not a regular file");
+    }
+  return;
+  }
+
+map = mmap(NULL, (size_t)statbuf.st_size, PROT_READ, MAP_PRIVATE,
+  fileno(read_filehandle), 0);
+if (map == MAP_FAILED)
+  {
+  if (scorecache_dir != NULL)
+    scorecache_nosave("an input file could not be mapped");
+  return;
+  }
+
+read_mapstart = read_mapptr = (uschar *)map;
+read_mapend = read_mapstart + statbuf.st_size;
+if (scorecache_dir != NULL) scorecache_add_input(read_mapstart, statbuf.st_size);
+}
+
+
+
+/*************************************************
+*      Use a cached copy of an included file     *
+*************************************************/
+
+/* This is called when an included file has been opened. If there is an
+up-to-date copy of its contents in the cache, it is used instead of reading the
+file.
+
+Arguments:  none
+Returns:    TRUE if a cached copy is being used
+*/
+
+BOOL
+read_include_cached(void)
+{
+struct stat statbuf;
+
+if (fstat(fileno(read_filehandle), &statbuf) != 0 ||
+    !S_ISREG(statbuf.st_mode))
+  return FALSE;
+
+for (includecachestr *c = include_cache; c != NULL; c = c->next)
+  {
+  if (c->size == (size_t)statbuf.st_size && c->mtime == statbuf.st_mtime &&
+      c->ino == statbuf.st_ino && c->dev == statbuf.st_dev &&
+      Ustrcmp(c->name, read_filename) == 0)
+    {
+    TRACE("using cached copy of %s\n", read_filename);
+    read_mapstart = read_mapptr = c->data;
+    read_mapend = c->data + c->size;
+    read_mapcached = TRUE;
+    if (scorecache_dir != NULL) scorecache_add_input(c->data, c->size);
+    return TRUE;
+    }
+  }
+
+return FALSE;
+}
+
+
+
+/*************************************************
+*         Set up a new include cache entry       *
+*************************************************/
+
+/* The entry is added to the cache, with space for the file's contents, which
+the caller must fill in.
+
+Arguments:
+  name       the file name
+  statbuf    the file's status
+
+Returns:     the new entry, or NULL if memory is not available
+*/
+
+static includecachestr *
+include_cache_new(uschar *name, struct stat *statbuf)
+{
+size_t namelen = Ustrlen(name);
+includecachestr *c = malloc(sizeof(includecachestr) + namelen + 1 +
+  statbuf->st_size);
+
+if (c == NULL) return NULL;
+c->name = (uschar *)(c + 1);
+Ustrcpy(c->name, name);
+c->data = c->name + namelen + 1;
+c->size = statbuf->st_size;
+c->dev = statbuf->st_dev;
+c->ino = statbuf->st_ino;
+c->mtime = statbuf->st_mtime;
+c->next = include_cache;
+include_cache = c;
+return c;
+}
+
+
+
+/*************************************************
+*        Add an included file to the cache       *
+*************************************************/
+
+/* This is called after an included file has been mapped into memory. Its
+contents are copied into the cache, and the copy is used for reading, so that
+the mapping can be removed. Empty files and files that could not be mapped are
+not cached. In a server job, the file's name is passed back to the server.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+read_cache_include(void)
+{
+struct stat statbuf;
+includecachestr *c;
+size_t size = read_mapend - read_mapstart;
+
+if (read_mapstart == NULL || read_mapcached ||
+    fstat(fileno(read_filehandle), &statbuf) != 0 ||
+    (size_t)statbuf.st_size != size)
+  return;
+
+c = include_cache_new(read_filename, &statbuf);
+if (c == NULL) return;    /* The cache is only an optimization */
+memcpy(c->data, read_mapstart, size);
+server_passback_write(pb_include, read_filename, Ustrlen(read_filename) + 1);
+
+(void)munmap(read_mapstart, size);
+read_mapstart = read_mapptr = c->data;
+read_mapend = c->data + size;
+read_mapcached = TRUE;
+}
+
+
+
+/*************************************************
+*    Read an included file in the server         *
+*************************************************/
+
+/* This is called in the server when a job passes back the name of a file that
+it included. The file is read into the cache, replacing any copy that is out
+of date. The job has already checked that it is not a MusicXML file, but it
+may have changed since, so this is checked again. When a later job uses the
+copy, the file's identity, size, and modification time are checked in the
+usual way.
+
+Argument:   the file name
+Returns:    nothing
+*/
+
+void
+read_server_include(uschar *name)
+{
+struct stat statbuf;
+includecachestr *c;
+uschar *p;
+FILE *f = Ufopen(name, "rb");
+
+if (f == NULL) return;
+if (fstat(fileno(f), &statbuf) != 0 || !S_ISREG(statbuf.st_mode) ||
+    statbuf.st_size <= 0 || (uint64_t)statbuf.st_size > SIZE_MAX)
+  goto END;
+
+for (includecachestr **cp = &include_cache; *cp != NULL; cp = &((*cp)->next))
+  {
+  c = *cp;
+  if (Ustrcmp(c->name, name) != 0) continue;
+  if (c->size == (size_t)statbuf.st_size && c->mtime == statbuf.st_mtime &&
+      c->ino == statbuf.st_ino && c->dev == statbuf.st_dev)
+    goto END;
+  *cp = c->next;
+  free(c);
+  break;
+  }
+
+c = include_cache_new(name, &statbuf);
+if (c == NULL) goto END;
+
+if (fread(c->data, 1, c->size, f) == c->size)
+  {
+  p = c->data;
+  if (c->size >= 3 && memcmp(p, "\xef\xbb\xbf", 3) == 0) p += 3;
+  if (c->data + c->size - p < 14 || memcmp(p, "<?xml version=", 14) != 0)
+    goto END;
+  }
+
+/* The file could not be read, or is a MusicXML file. */
+
+include_cache = c->next;
+free(c);
+
+END:
+(void)fclose(f);
+}
+
+
+
+/*************************************************
+*         Free the included file cache           *
+*************************************************/
+
+/*
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+read_free_include_cache(void)
+{
+while (include_cache != NULL)
+  {
+  includecachestr *next = include_cache->next;
+  free(include_cache);
+  include_cache = next;
+  }
+}
+
+
+
+/*************************************************
+*          Close the current input file          *
+*************************************************/
+
+/* Any memory mapping is removed, and the file is closed.
+
+Arguments:  none
+Returns:    the result of fclose()
+*/
+
+int
+read_close_file(void)
+{
+int rc;
+if (read_mapstart != NULL && !read_mapcached)
+  (void)munmap(read_mapstart, read_mapend - read_mapstart);
+read_mapstart = read_mapptr = read_mapend = NULL;
+read_mapcached = FALSE;
+rc = fclose(read_filehandle);
+read_filehandle = NULL;
+return rc;
+}
+
+
+
 /*************************************************
 *        Read the next physical input line       *
 *************************************************/
@@ -341,6 +646,10 @@ while (needed >= st->barindex_size)
 empty, swap the buffers to make it the previous line, for use by the error
 function.
 
+When the file is memory-mapped, the end of the line is found by memchr() and
+the line is copied in large pieces. Otherwise, characters are read one at a
+time. In both cases, binary zeros are removed and give an error.
+
 Argument:  starting offset in line buffer
 Returns:   TRUE if line read, FALSE at EOF
 */
@@ -360,7 +669,67 @@ if (i == 0 && main_readbuffer[0] != 0 && main_readbuffer[0] != '\n')
 
 read_linenumber++;
 
-for (;;)
+/* Handle a memory-mapped file. At end of file, invent a missing newline. */
+
+if (read_mapstart != NULL)
+  {
+  uschar *p = read_mapptr;
+  uschar *nl;
+  size_t len;
+
+  if (p >= read_mapend && i == 0) return FALSE;
+
+  nl = memchr(p, '\n', read_mapend - p);
+  if (nl == NULL) nl = read_mapend;
+  len = nl - p;
+  read_mapptr = (nl < read_mapend)? nl + 1 : nl;
+
+  /* Lines without binary zeros are copied in as large pieces as will fit,
+  extending the buffers as necessary. */
+
+  if (memchr(p, 0, len) == NULL)
+    {
+    for (;;)
+      {
+      size_t room = main_readbuffer_threshold - i;
+      if (room > len) room = len;
+      memcpy(main_readbuffer + i, p, room);
+      i += room;
+      p += room;
+      len -= room;
+      if (len == 0) break;
+      read_extend_buffers();
+      }
+    }
+
+  /* Binary zeros are not supported. Remember where the first one was. */
+
+  else for (; len > 0; p++, len--)
+    {
+    if (*p == 0)
+      {
+      if (!binfound)
+        {
+        binoffset = i;
+        if (binoffset == 0) binoffset++;
+        binfound = TRUE;
+        }
+      continue;
+      }
+    if (i >= main_readbuffer_threshold) read_extend_buffers();
+    main_readbuffer[i++] = *p;
+    }
+
+  /* Remove any white space before the terminating newline. */
+
+  while (i > 0 && isspace(main_readbuffer[i-1])) i--;
+  main_readbuffer[i++] = '\n';
+  main_readbuffer[i] = 0;
+  }
+
+/* Handle a file that is read one character at a time. */
+
+else for (;;)
   {
   int ch = fgetc(read_filehandle);
 
@@ -450,6 +819,13 @@ else if (Ustrncmp(p, "<?xml version=", 14) == 0)
 #else
   if (ft != FT_AUTO && ft != FT_MXML)
     error(ERR4, "MusicXML");  /* Hard */
+
+  /* The XML reader uses stdio, so if the file is mapped, position the stream
+  after the line that has been read. */
+
+  if (read_mapstart != NULL)
+    (void)fseek(read_filehandle, read_mapptr - read_mapstart, SEEK_SET);
+  scorecache_nosave("MusicXML input is not cached");
   xml_read();
 #endif
   }
@@ -462,7 +838,11 @@ else
 
 read_linenumber = 0;  /* No longer in reading phase */
 
-/* Warn for unsupported Unicode code points. */
+/* Warn for unsupported Unicode code points. These warnings are not counted
+as errors, so they must prevent caching explicitly. */
+
+if (read_uunext > 0 || read_uinvnext > 0)
+  scorecache_nosave("there were Unicode warnings");
 
 if (read_uunext > 0)
   {
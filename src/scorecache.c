@@ -0,0 +1,1453 @@
+/*************************************************
+*       PMW cache for data read from a score     *
+*************************************************/
+
+/* Copyright Philip Hazel 2026 */
+/* This file created: October 2026 */
+/* This file last modified: October 2026 */
+
+/* When -scorecache is given, the data structures that are built by reading an
+input file are saved in a cache file after a successful read. A later run that
+has the same input files (checked by size and content hash) and the same
+options that affect reading loads the data from the cache instead of reading
+the input again. Options that affect only the output, such as -p or -midi, do
+not affect the cache.
+
+The cache contains an image of each memory block that holds any of the data,
+and a list of the places in these blocks that contain pointers. Loading just
+copies the blocks into new memory and relocates the pointers. A few pointers
+point to default data that is compiled into PMW; these are recorded as such.
+
+Inputs that cannot easily be recorded, for example MusicXML files or the use of
+*comment, which writes to the terminal, prevent a cache file from being written.
+So do any errors or warnings while reading. The cache is just an optimization,
+so any failure to read or write a cache file is ignored. */
+
+#include "pmw.h"
+
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Magic identifier at the start of a score cache file. Change the number if
+the layout of the file changes. */
+
+#define SCORECACHE_MAGIC  "PMWsc3"
+
+/* Special block numbers in relocations */
+
+#define ROOT_BLOCK     0xffffffffu   /* Location is in the global variables */
+#define STATIC_BLOCK   0xfffffffeu   /* Target is compiled-in default data */
+#define UNUSED_BLOCK   0xffffffffu   /* Block is not in the cache */
+
+/* Sizes for the expandable vectors used while saving. */
+
+#define INPUTS_CHUNKSIZE   16
+#define RELOCS_CHUNKSIZE   4096
+#define VISITED_INITSIZE   4096      /* Must be a power of 2 */
+#define WORK_CHUNKSIZE     1024
+
+/* All items in the cache file are padded to a multiple of 8 bytes. */
+
+#define PAD8(n) (((n) + 7) & ~((size_t)7))
+
+/* The sizes of the structures that are saved in a cache, apart from bar items,
+whose sizes are in bar_item_sizes. These are recorded in the header so that a
+cache written by a build in which any of them is different is not loaded. */
+
+#define STRUCT_SIZES_COUNT 17
+
+static const uint32_t struct_sizes[STRUCT_SIZES_COUNT] = {
+  sizeof(movtstr), sizeof(stavestr), sizeof(tree_node), sizeof(drawitem),
+  sizeof(drawtextstr), sizeof(fontinststr), sizeof(fontsizestr),
+  sizeof(headstr), sizeof(htypestr), sizeof(keytransstr), sizeof(pkeystr),
+  sizeof(ptimestr), sizeof(b_slurmodstr), sizeof(snamestr),
+  sizeof(stavelist), sizeof(trkeystr), sizeof(zerocopystr) };
+
+/* The header of a score cache file. It is followed by a description of each
+input file (with the name padded), a description of each font (with the name
+padded), a description of each memory block, the global variables, the
+relocations, and finally the contents of the memory blocks. */
+
+typedef struct {
+  char     magic[8];
+  char     version[16];
+  uint32_t ptrsize;        /* Size of a pointer */
+  uint32_t sizes[STRUCT_SIZES_COUNT];  /* Sizes of the saved structures */
+  uint64_t itemsizes;      /* Hash of the sizes of bar items */
+  uint64_t fingerprint;    /* Hash of the options that affect reading */
+  uint32_t inputcount;
+  uint32_t fontcount;
+  uint32_t blockcount;
+  uint32_t reloccount;
+  uint64_t rootsize;
+  uint64_t datasize;
+} scorecache_header;
+
+typedef struct {
+  uint64_t size;
+  uint64_t hash;
+  uint32_t namelen;        /* Includes the terminating zero */
+  uint32_t unused;
+} scorecache_input;
+
+typedef struct {
+  uint32_t flags;
+  uint32_t namelen;        /* Includes the terminating zero */
+} scorecache_font;
+
+typedef struct {
+  uint64_t size;
+  uint32_t arena;          /* Non-zero for a block from mem.c */
+  uint32_t unused;
+} scorecache_block;
+
+typedef struct {
+  uint32_t block;          /* Block containing the pointer */
+  uint32_t tblock;         /* Block containing the target */
+  uint64_t offset;         /* Offset of the pointer */
+  uint64_t toffset;        /* Offset of the target, or static index */
+} scorecache_reloc;
+
+/* Memory blocks while saving. Those that are not obtained from mem.c (such as
+bar indexes) may not be completely used; only the valid part is saved. */
+
+typedef struct {
+  uschar  *start;
+  size_t   size;
+  size_t   valid;
+  uint32_t index;          /* Index in the cache file */
+  BOOL     arena;
+  BOOL     used;
+} sc_block;
+
+/* Items in the visited table and the work list */
+
+typedef struct {
+  void  *ptr;
+  usint  type;
+} sc_work;
+
+/* Input files while reading */
+
+typedef struct {
+  uschar  *name;
+  uint64_t size;
+  uint64_t hash;
+} sc_input;
+
+/* Global variables that are set while reading and used afterwards. Those with
+a type other than sc_data are pointers. */
+
+typedef struct {
+  void  *address;
+  size_t size;
+  usint  type;
+} sc_root;
+
+static sc_root roots[] = {
+  { &active_transpose,          sizeof(active_transpose),         sc_data },
+  { &active_transpose_letter,   sizeof(active_transpose_letter),  sc_data },
+  { &active_transposedaccforce, sizeof(active_transposedaccforce), sc_data },
+  { &bar_use_draw,              sizeof(bar_use_draw),             sc_data },
+  { &EPSforced,                 sizeof(EPSforced),                sc_data },
+  { font_table,                 font_tablen * sizeof(uint32_t),   sc_data },
+  { keysigtable,                KEYS_COUNT * (MAX_KEYACCS + 1),   sc_data },
+  { &main_kerning,              sizeof(main_kerning),             sc_data },
+  { &main_landscape,            sizeof(main_landscape),           sc_data },
+  { &main_magnification,        sizeof(main_magnification),       sc_data },
+  { &main_maxstave,             sizeof(main_maxstave),            sc_data },
+  { &main_maxvertjustify,       sizeof(main_maxvertjustify),      sc_data },
+  { &main_midifornotesoff,      sizeof(main_midifornotesoff),     sc_data },
+  { &main_pagelength,           sizeof(main_pagelength),          sc_data },
+  { &main_righttoleft,          sizeof(main_righttoleft),         sc_data },
+  { &main_sheetdepth,           sizeof(main_sheetdepth),          sc_data },
+  { &main_sheetsize,            sizeof(main_sheetsize),           sc_data },
+  { &main_sheetwidth,           sizeof(main_sheetwidth),          sc_data },
+  { &main_transposedaccforce,   sizeof(main_transposedaccforce),  sc_data },
+  { &movement_count,            sizeof(movement_count),           sc_data },
+  { &movements_size,            sizeof(movements_size),           sc_data },
+  { &page_firstnumber,          sizeof(page_firstnumber),         sc_data },
+  { &page_increment,            sizeof(page_increment),           sc_data },
+  { &PDF,                       sizeof(PDF),                      sc_data },
+  { &PDFforced,                 sizeof(PDFforced),                sc_data },
+  { &print_imposition,          sizeof(print_imposition),         sc_data },
+  { &print_incPMWfont,          sizeof(print_incPMWfont),         sc_data },
+  { &PSforced,                  sizeof(PSforced),                 sc_data },
+  { &stave_use_draw,            sizeof(stave_use_draw),           sc_data },
+  { &stave_use_widechars,       sizeof(stave_use_widechars),      sc_data },
+  { &unclosed_slurline,         sizeof(unclosed_slurline),        sc_data },
+
+  { &curmovt,                   sizeof(curmovt),                  sc_movt },
+  { &draw_tree,                 sizeof(draw_tree),                sc_drawnode },
+  { &draw_variable_tree,        sizeof(draw_variable_tree),       sc_varnode },
+  { &main_htypes,               sizeof(main_htypes),              sc_htype },
+  { &main_keytranspose,         sizeof(main_keytranspose),        sc_keytrans },
+  { &main_printkey,             sizeof(main_printkey),            sc_pkey },
+  { &main_printtime,            sizeof(main_printtime),           sc_ptime },
+  { &main_transposedkeys,       sizeof(main_transposedkeys),      sc_trkey },
+  { &movements,                 sizeof(movements),                sc_movements }
+};
+
+static const usint roots_count = sizeof(roots)/sizeof(sc_root);
+
+/* Static variables */
+
+static const char *nosave_reason = NULL;
+static usint       errors_before = 0;
+static BOOL        key_ok = FALSE;
+static uint64_t    fingerprint;
+static uschar      cachename[PATH_MAX + 64];
+static uschar      mainpath[PATH_MAX];
+
+static sc_input   *inputs = NULL;
+static usint       inputs_count = 0;
+static usint       inputs_size = 0;
+
+static sc_block   *blocks = NULL;
+static usint       blocks_count = 0;
+
+static scorecache_reloc *relocs = NULL;
+static size_t      relocs_count = 0;
+static size_t      relocs_size = 0;
+
+static sc_work    *visited = NULL;
+static size_t      visited_count = 0;
+static size_t      visited_size = 0;
+
+static sc_work    *work = NULL;
+static size_t      work_count = 0;
+static size_t      work_size = 0;
+
+static void       *statics[9];
+static usint       statics_count = 0;
+
+
+
+/*************************************************
+*            Hash a block of data                *
+*************************************************/
+
+/* This is the 64-bit FNV-1a hash.
+
+Arguments:
+  hash        the hash so far
+  p           the data
+  len         its length
+
+Returns:      the updated hash
+*/
+
+static uint64_t
+sc_hash(uint64_t hash, const void *p, size_t len)
+{
+const uschar *s = (const uschar *)p;
+for (size_t i = 0; i < len; i++)
+  hash = (hash ^ s[i]) * 1099511628211ull;
+return hash;
+}
+
+
+
+/*************************************************
+*           Hash the contents of a file          *
+*************************************************/
+
+/*
+Arguments:
+  name        the file name
+  sizeptr     where to return the size
+  hashptr     where to return the hash
+
+Returns:      TRUE if the file is a regular file that could be read
+*/
+
+static BOOL
+sc_hash_file(uschar *name, uint64_t *sizeptr, uint64_t *hashptr)
+{
+struct stat st;
+void *map;
+int fd = open(CS name, O_RDONLY);
+
+if (fd < 0) return FALSE;
+if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+  {
+  (void)close(fd);
+  return FALSE;
+  }
+
+*sizeptr = (uint64_t)st.st_size;
+*hashptr = 14695981039346656037ull;
+
+if (st.st_size > 0)
+  {
+  map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (map == MAP_FAILED)
+    {
+    (void)close(fd);
+    return FALSE;
+    }
+  *hashptr = sc_hash(*hashptr, map, st.st_size);
+  (void)munmap(map, st.st_size);
+  }
+
+(void)close(fd);
+return TRUE;
+}
+
+
+
+/*************************************************
+*       Prevent the saving of a cache file       *
+*************************************************/
+
+/* This is called when something is read that cannot be recorded in a cache.
+Only the first reason is remembered.
+
+Argument:  the reason, for tracing
+Returns:   nothing
+*/
+
+void
+scorecache_nosave(const char *reason)
+{
+if (nosave_reason == NULL) nosave_reason = reason;
+}
+
+
+
+/*************************************************
+*           Remember an input file               *
+*************************************************/
+
+/* This is called for the main input file and for each included file when it
+is opened and mapped into memory. The name of the file is in read_filename.
+
+Arguments:
+  data        the file's data (NULL if empty)
+  size        the size of the data
+
+Returns:      nothing
+*/
+
+void
+scorecache_add_input(uschar *data, size_t size)
+{
+char buffer[PATH_MAX];
+sc_input *in;
+
+if (realpath(CS read_filename, buffer) == NULL)
+  {
+  scorecache_nosave("an input file's path could not be found");
+  return;
+  }
+
+if (inputs_count >= inputs_size)
+  {
+  inputs_size += INPUTS_CHUNKSIZE;
+  inputs = realloc(inputs, inputs_size * sizeof(sc_input));
+  if (inputs == NULL)
+    error(ERR0, "re-", "score cache input list", inputs_size * sizeof(sc_input));
+  }
+
+in = inputs + inputs_count++;
+in->name = mem_copystring(US buffer);
+in->size = size;
+in->hash = sc_hash(14695981039346656037ull, data, size);
+}
+
+
+
+/*************************************************
+*          Remember a named input file           *
+*************************************************/
+
+/* This is used for files that are read before the main input, but which affect
+how it is read. A file that does not exist is ignored.
+
+Argument:  the file name
+Returns:   nothing
+*/
+
+static void
+sc_add_named_input(uschar *name)
+{
+uschar *save_filename = read_filename;
+uint64_t size, hash;
+
+if (name == NULL || !sc_hash_file(name, &size, &hash)) return;
+read_filename = name;
+scorecache_add_input(NULL, 0);
+read_filename = save_filename;
+if (inputs_count > 0)
+  {
+  inputs[inputs_count - 1].size = size;
+  inputs[inputs_count - 1].hash = hash;
+  }
+}
+
+
+
+/*************************************************
+*   Set up the cache name and options hash       *
+*************************************************/
+
+/* The fingerprint is a hash of the values of the global variables that
+reading may change (before any reading is done), along with other options that
+affect reading. The cache file's name contains the main input's base name,
+followed by a hash of its full path and the fingerprint.
+
+Arguments:  none
+Returns:    TRUE if all is well
+*/
+
+static BOOL
+sc_make_key(void)
+{
+uschar *base, *ext;
+uint64_t hash = 14695981039346656037ull;
+uint32_t namehash = 2166136261u;    /* FNV-1a */
+int n;
+
+if (realpath(CS main_filename, CS mainpath) == NULL) return FALSE;
+
+for (usint i = 0; i < roots_count; i++)
+  if (roots[i].type == sc_data)
+    hash = sc_hash(hash, roots[i].address, roots[i].size);
+
+hash = sc_hash(hash, &main_selectedstaves, sizeof(main_selectedstaves));
+hash = sc_hash(hash, &main_transpose, sizeof(main_transpose));
+hash = sc_hash(hash, &main_testing, sizeof(main_testing));
+if (main_format != NULL)
+  hash = sc_hash(hash, main_format, Ustrlen(main_format) + 1);
+hash = sc_hash(hash, stdmacs_dir, Ustrlen(stdmacs_dir) + 1);
+fingerprint = hash;
+
+for (uschar *p = mainpath; *p != 0; p++) namehash = (namehash ^ *p) * 16777619u;
+for (int i = 0; i < 8; i++)
+  namehash = (namehash ^ ((fingerprint >> (i*8)) & 0xff)) * 16777619u;
+
+/* Use the final component of the main input's name, without any extension. */
+
+base = Ustrrchr(mainpath, '/');
+base = (base == NULL)? mainpath : base + 1;
+ext = Ustrrchr(base, '.');
+if (ext == NULL || ext == base) ext = base + Ustrlen(base);
+
+n = snprintf(CS cachename, sizeof(cachename), "%s/%.*s-%08x.psc",
+  scorecache_dir, (int)(ext - base), base, namehash);
+return n > 0 && (size_t)n < sizeof(cachename);
+}
+
+
+
+/*************************************************
+*     Set up the list of compiled-in targets     *
+*************************************************/
+
+/* These are the default data items that the default movement points to.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+static void
+sc_setup_statics(void)
+{
+statics_count = 0;
+statics[statics_count++] = default_movtstr.accadjusts;
+statics[statics_count++] = default_movtstr.accspacing;
+statics[statics_count++] = default_movtstr.bracketlist;
+statics[statics_count++] = default_movtstr.fontsizes;
+statics[statics_count++] = default_movtstr.hyphenstring;
+statics[statics_count++] = default_movtstr.joinlist;
+statics[statics_count++] = default_movtstr.stavesizes;
+statics[statics_count++] = default_movtstr.trillstring;
+statics[statics_count++] = default_movtstr.zerocopy;
+}
+
+
+
+/*************************************************
+*      Find the block that contains an address   *
+*************************************************/
+
+/*
+Argument:  the address
+Returns:   the block's index, or -1 if not found
+*/
+
+static int
+sc_find_block(void *p)
+{
+uschar *pp = (uschar *)p;
+int bot = 0;
+int top = blocks_count;
+
+while (bot < top)
+  {
+  int mid = (bot + top)/2;
+  sc_block *b = blocks + mid;
+  if (pp < b->start) top = mid;
+  else if (pp >= b->start + b->size) bot = mid + 1;
+  else return mid;
+  }
+
+return -1;
+}
+
+
+
+/*************************************************
+*         Add a block to the table               *
+*************************************************/
+
+/*
+Arguments:
+  start      the start of the block
+  size       the size of the block
+  valid      the size of its meaningful contents
+  arena      TRUE for a block from mem.c
+
+Returns:     nothing
+*/
+
+static void
+sc_add_block(void *start, size_t size, size_t valid, BOOL arena)
+{
+sc_block *b = blocks + blocks_count++;
+b->start = (uschar *)start;
+b->size = size;
+b->valid = valid;
+b->arena = arena;
+b->used = FALSE;
+b->index = UNUSED_BLOCK;
+}
+
+
+
+/*************************************************
+*         Compare blocks for sorting             *
+*************************************************/
+
+static int
+sc_block_cmp(const void *a, const void *b)
+{
+const sc_block *aa = (const sc_block *)a;
+const sc_block *bb = (const sc_block *)b;
+return (aa->start < bb->start)? -1 : (aa->start > bb->start)? 1 : 0;
+}
+
+
+
+/*************************************************
+*     Set up the table of blocks for saving      *
+*************************************************/
+
+/* The table contains all the blocks that mem.c knows about, plus the movements
+vector and the expandable vectors in each movement, which are obtained by
+malloc() because they can be extended.
+
+Arguments:  none
+Returns:    FALSE if there is any overlap (should never happen)
+*/
+
+static BOOL
+sc_setup_blocks(void)
+{
+memblockstr *memblocks;
+usint memcount = mem_get_blocks(&memblocks);
+usint count = memcount + 1;
+
+for (usint i = 0; i < movement_count; i++)
+  count += MAX_STAVE + 3;
+
+blocks = malloc(count * sizeof(sc_block));
+if (blocks == NULL) return FALSE;
+blocks_count = 0;
+
+for (usint i = 0; i < memcount; i++)
+  sc_add_block(memblocks[i].start, memblocks[i].size, memblocks[i].size, TRUE);
+
+sc_add_block(movements, movements_size * sizeof(movtstr *),
+  movement_count * sizeof(movtstr *), FALSE);
+
+for (usint i = 0; i < movement_count; i++)
+  {
+  movtstr *m = movements[i];
+
+  if (m->barvector != NULL)
+    sc_add_block(m->barvector, m->barvector_size * sizeof(uint32_t),
+      m->barvector_size * sizeof(uint32_t), FALSE);
+
+  if ((m->flags & mf_midistart) != 0)
+    sc_add_block(m->midistart, m->midistart[0] + 1, m->midistart[0] + 1,
+      FALSE);
+
+  for (int j = 0; j <= MAX_STAVE; j++)
+    {
+    stavestr *s = m->stavetable[j];
+    size_t n;
+    if (s == NULL || s->barindex == NULL) continue;
+    n = (s->barcount > m->barcount)? s->barcount : m->barcount;
+    if (n > s->barindex_size) n = s->barindex_size;
+    sc_add_block(s->barindex, s->barindex_size * sizeof(barstr *),
+      n * sizeof(barstr *), FALSE);
+    }
+  }
+
+qsort(blocks, blocks_count, sizeof(sc_block), sc_block_cmp);
+
+for (usint i = 1; i < blocks_count; i++)
+  if (blocks[i-1].start + blocks[i-1].size > blocks[i].start) return FALSE;
+
+return TRUE;
+}
+
+
+
+/*************************************************
+*      Check for and remember a visited item     *
+*************************************************/
+
+/* The visited table is an open-addressing hash table that is doubled in size
+when it gets more than half full.
+
+Arguments:
+  p          the address of the item
+  type       its type
+
+Returns:     TRUE if the item has not previously been seen
+*/
+
+static BOOL
+sc_visit(void *p, usint type)
+{
+size_t h;
+
+if (visited_count >= visited_size/2)
+  {
+  sc_work *old = visited;
+  size_t oldsize = visited_size;
+
+  visited_size = (oldsize == 0)? VISITED_INITSIZE : oldsize * 2;
+  visited = calloc(visited_size, sizeof(sc_work));
+  if (visited == NULL)
+    error(ERR0, "", "score cache table", visited_size * sizeof(sc_work));
+  visited_count = 0;
+  for (size_t i = 0; i < oldsize; i++)
+    if (old[i].ptr != NULL) (void)sc_visit(old[i].ptr, old[i].type);
+  free(old);
+  }
+
+h = ((((uintptr_t)p) >> 2) * 0x9e3779b1u + type) & (visited_size - 1);
+while (visited[h].ptr != NULL)
+  {
+  if (visited[h].ptr == p && visited[h].type == type) return FALSE;
+  h = (h + 1) & (visited_size - 1);
+  }
+
+visited[h].ptr = p;
+visited[h].type = type;
+visited_count++;
+return TRUE;
+}
+
+
+
+/*************************************************
+*         Record a pointer                       *
+*************************************************/
+
+/* The pointer's target is looked up in the block table and a relocation is
+recorded. If the target is of a type that contains pointers and it has not
+been seen before, it is added to the list of items to be scanned.
+
+Arguments:
+  block      the block containing the pointer, or ROOT_BLOCK
+  offset     the offset of the pointer
+  target     the pointer's value
+  type       the type of the target
+
+Returns:     nothing
+*/
+
+static void
+sc_record(uint32_t block, uint64_t offset, void *target, usint type)
+{
+scorecache_reloc *r;
+int n = sc_find_block(target);
+
+if (relocs_count >= relocs_size)
+  {
+  relocs_size += RELOCS_CHUNKSIZE;
+  relocs = realloc(relocs, relocs_size * sizeof(scorecache_reloc));
+  if (relocs == NULL) error(ERR0, "re-", "score cache relocations",
+    relocs_size * sizeof(scorecache_reloc));  /* Hard */
+  }
+
+r = relocs + relocs_count;
+r->block = block;
+r->offset = offset;
+
+if (n >= 0)
+  {
+  blocks[n].used = TRUE;
+  r->tblock = n;
+  r->toffset = (uschar *)target - blocks[n].start;
+  }
+else
+  {
+  usint i;
+  for (i = 0; i < statics_count; i++) if (statics[i] == target) break;
+  if (i >= statics_count)
+    {
+    scorecache_nosave("a pointer to unknown memory was found");
+    return;
+    }
+  r->tblock = STATIC_BLOCK;
+  r->toffset = i;
+  type = sc_data;       /* Compiled-in data is not scanned */
+  }
+
+relocs_count++;
+
+if (type != sc_data && sc_visit(target, type))
+  {
+  if (work_count >= work_size)
+    {
+    work_size += WORK_CHUNKSIZE;
+    work = realloc(work, work_size * sizeof(sc_work));
+    if (work == NULL) error(ERR0, "re-", "score cache work list",
+      work_size * sizeof(sc_work));  /* Hard */
+    }
+  work[work_count].ptr = target;
+  work[work_count++].type = type;
+  }
+}
+
+
+
+/*************************************************
+*          Record a pointer in a data item       *
+*************************************************/
+
+/* This is called for each pointer field in the items that are being saved,
+including from the draw module.
+
+Arguments:
+  loc        the address of the pointer
+  type       the type of the item that it points to
+
+Returns:     nothing
+*/
+
+void
+scorecache_pointer(void **loc, usint type)
+{
+int n;
+if (*loc == NULL || nosave_reason != NULL) return;
+n = sc_find_block(loc);
+if (n < 0)
+  {
+  scorecache_nosave("a pointer in unknown memory was found");
+  return;
+  }
+sc_record(n, (uschar *)loc - blocks[n].start, *loc, type);
+}
+
+/* A macro to save casting. */
+
+#define PTR(field, type) scorecache_pointer((void **)(&(field)), type)
+
+
+
+/*************************************************
+*          Scan an item for pointers             *
+*************************************************/
+
+/* Pointers to items of types that contain pointers cause those items to be
+added to the work list.
+
+Arguments:
+  p          the item
+  type       its type
+
+Returns:     nothing
+*/
+
+static void
+sc_scan(void *p, usint type)
+{
+switch(type)
+  {
+  case sc_drawargs:
+    {
+    drawitem *d = (drawitem *)p;
+    for (int i = 1; i <= d[0].d.val; i++)
+      if (d[i].dtype == dd_text) PTR(d[i].d.ptr, sc_drawtext);
+    }
+  break;
+
+  case sc_drawnode:
+  case sc_varnode:
+    {
+    tree_node *t = (tree_node *)p;
+    PTR(t->left, type);
+    PTR(t->right, type);
+    PTR(t->name, sc_data);
+    if (type == sc_drawnode) PTR(t->data, sc_drawprog);
+    }
+  break;
+
+  case sc_drawprog:
+  draw_cache_program((drawitem *)p);
+  break;
+
+  case sc_drawtext:
+  PTR(((drawtextstr *)p)->text, sc_data);
+  break;
+
+  case sc_fontsizes:
+    {
+    fontinststr *f = (fontinststr *)p;
+    for (size_t i = 0; i < sizeof(fontsizestr)/sizeof(fontinststr); i++)
+      PTR(f[i].matrix, sc_data);
+    }
+  break;
+
+  /* The drawing arguments and the text fields are not set for the other
+  type of heading. */
+
+  case sc_head:
+    {
+    headstr *h = (headstr *)p;
+    PTR(h->next, sc_head);
+    if (h->drawing != NULL)
+      {
+      PTR(h->drawing, sc_drawnode);
+      PTR(h->drawargs, sc_drawargs);
+      }
+    else
+      {
+      for (int i = 0; i < 3; i++) PTR(h->string[i], sc_data);
+      PTR(h->fdata.matrix, sc_data);
+      }
+    }
+  break;
+
+  case sc_htype:
+    {
+    htypestr *h = (htypestr *)p;
+    PTR(h->next, sc_htype);
+    PTR(h->string1, sc_data);
+    PTR(h->string2, sc_data);
+    PTR(h->string3, sc_data);
+    }
+  break;
+
+  case sc_item:
+    {
+    bstr *b = (bstr *)p;
+    PTR(b->next, sc_item);
+    PTR(b->prev, sc_item);
+
+    switch(b->type)
+      {
+      case b_draw:
+      PTR(((b_drawstr *)b)->drawing, sc_drawnode);
+      PTR(((b_drawstr *)b)->drawargs, sc_drawargs);
+      break;
+
+      case b_footnote:
+      sc_scan(&(((b_footnotestr *)b)->h), sc_head);
+      break;
+
+      case b_linegap:
+      case b_slurgap:
+      PTR(((b_slurgapstr *)b)->drawing, sc_drawnode);
+      PTR(((b_slurgapstr *)b)->drawargs, sc_drawargs);
+      PTR(((b_slurgapstr *)b)->gaptext, sc_data);
+      break;
+
+      case b_nbar:
+      PTR(((b_nbarstr *)b)->s, sc_data);
+      break;
+
+      case b_overbeam:
+      PTR(((b_overbeamstr *)b)->nextbar, sc_item);
+      break;
+
+      case b_slur:
+      PTR(((b_slurstr *)b)->mods, sc_slurmod);
+      break;
+
+      case b_text:
+      PTR(((b_textstr *)b)->string, sc_data);
+      break;
+
+      case b_tie:
+      PTR(((b_tiestr *)b)->noteprev, sc_item);
+      break;
+
+      default:
+      break;
+      }
+    }
+  break;
+
+  case sc_keytrans:
+  PTR(((keytransstr *)p)->next, sc_keytrans);
+  break;
+
+  case sc_movements:
+    {
+    movtstr **m = (movtstr **)p;
+    for (usint i = 0; i < movement_count; i++) PTR(m[i], sc_movt);
+    }
+  break;
+
+  /* The position vector is not set up till pagination. */
+
+  case sc_movt:
+    {
+    movtstr *m = (movtstr *)p;
+    if (m->posvector != NULL)
+      {
+      scorecache_nosave("a movement has already been paginated");
+      break;
+      }
+    PTR(m->accadjusts, sc_data);
+    PTR(m->accspacing, sc_data);
+    PTR(m->barvector, sc_data);
+    PTR(m->bracelist, sc_stavelist);
+    PTR(m->bracketlist, sc_stavelist);
+    PTR(m->fontsizes, sc_fontsizes);
+    PTR(m->footing, sc_head);
+    PTR(m->heading, sc_head);
+    PTR(m->hyphenstring, sc_data);
+    PTR(m->joinlist, sc_stavelist);
+    PTR(m->joindottedlist, sc_stavelist);
+    PTR(m->lastfooting, sc_head);
+    PTR(m->layout, sc_data);
+    PTR(m->midistart, sc_data);
+    PTR(m->miditempochanges, sc_data);
+    PTR(m->pagefooting, sc_head);
+    PTR(m->pageheading, sc_head);
+    PTR(m->stavesizes, sc_data);
+    for (int i = 0; i <= MAX_STAVE; i++) PTR(m->stavetable[i], sc_stave);
+    PTR(m->thinbracketlist, sc_stavelist);
+    PTR(m->trillstring, sc_data);
+    PTR(m->zerocopy, sc_zerocopy);
+    }
+  break;
+
+  case sc_pkey:
+    {
+    pkeystr *k = (pkeystr *)p;
+    PTR(k->next, sc_pkey);
+    PTR(k->string, sc_data);
+    PTR(k->cstring, sc_data);
+    }
+  break;
+
+  case sc_ptime:
+    {
+    ptimestr *t = (ptimestr *)p;
+    PTR(t->next, sc_ptime);
+    PTR(t->top, sc_data);
+    PTR(t->bot, sc_data);
+    }
+  break;
+
+  case sc_slurmod:
+  PTR(((b_slurmodstr *)p)->next, sc_slurmod);
+  break;
+
+  case sc_sname:
+    {
+    snamestr *s = (snamestr *)p;
+    PTR(s->next, sc_sname);
+    PTR(s->extra, sc_sname);
+    PTR(s->text, sc_data);
+    PTR(s->drawing, sc_drawnode);
+    PTR(s->drawargs, sc_drawargs);
+    }
+  break;
+
+  /* Only the valid part of a bar index is scanned. */
+
+  case sc_stave:
+    {
+    stavestr *s = (stavestr *)p;
+    int n;
+    PTR(s->stave_name, sc_sname);
+    if (s->barindex == NULL) break;
+    PTR(s->barindex, sc_data);
+    n = sc_find_block(s->barindex);
+    if (n < 0) break;
+    for (size_t i = 0; i < blocks[n].valid/sizeof(barstr *); i++)
+      PTR(s->barindex[i], sc_item);
+    }
+  break;
+
+  case sc_stavelist:
+  PTR(((stavelist *)p)->next, sc_stavelist);
+  PTR(((stavelist *)p)->prev, sc_stavelist);
+  break;
+
+  case sc_trkey:
+  PTR(((trkeystr *)p)->next, sc_trkey);
+  break;
+
+  /* Continuation data is not set up till pagination. */
+
+  case sc_zerocopy:
+  PTR(((zerocopystr *)p)->next, sc_zerocopy);
+  if (((zerocopystr *)p)->cont != NULL)
+    scorecache_nosave("a stave 0 copy has already been used");
+  break;
+
+  default:
+  break;
+  }
+}
+
+
+
+/*************************************************
+*         Free memory used while saving          *
+*************************************************/
+
+static void
+sc_free_save_data(void)
+{
+free(blocks);
+free(relocs);
+free(visited);
+free(work);
+blocks = NULL;
+relocs = NULL;
+visited = NULL;
+work = NULL;
+blocks_count = 0;
+relocs_count = relocs_size = 0;
+visited_count = visited_size = 0;
+work_count = work_size = 0;
+}
+
+
+
+/*************************************************
+*       Write the data to a cache file           *
+*************************************************/
+
+/* The data is written to a temporary file that is then renamed, so that other
+PMW processes that are running at the same time never see a partial file.
+
+Arguments:  none
+Returns:    TRUE if the file was written
+*/
+
+static BOOL
+sc_write(void)
+{
+FILE *f;
+BOOL failed;
+scorecache_header h;
+uschar tempname[PATH_MAX + 80];
+static const uschar zeros[8] = { 0 };
+
+memset(&h, 0, sizeof(h));
+memcpy(h.magic, SCORECACHE_MAGIC, sizeof(SCORECACHE_MAGIC));
+(void)strncpy(h.version, PMW_VERSION, sizeof(h.version) - 1);
+h.ptrsize = sizeof(void *);
+memcpy(h.sizes, struct_sizes, sizeof(struct_sizes));
+h.itemsizes = sc_hash(14695981039346656037ull, bar_item_sizes,
+  b_baditem * sizeof(size_t));
+h.fingerprint = fingerprint;
+h.inputcount = inputs_count;
+h.fontcount = font_count;
+h.reloccount = relocs_count;
+
+for (usint i = 0; i < blocks_count; i++)
+  {
+  if (!blocks[i].used) continue;
+  blocks[i].index = h.blockcount++;
+  h.datasize += PAD8(blocks[i].size);
+  }
+
+for (usint i = 0; i < roots_count; i++) h.rootsize += PAD8(roots[i].size);
+
+if (snprintf(CS tempname, sizeof(tempname), "%s.%d", cachename,
+    (int)getpid()) >= (int)sizeof(tempname)) return FALSE;
+f = Ufopen(tempname, "wb");
+if (f == NULL) return FALSE;
+
+(void)fwrite(&h, sizeof(h), 1, f);
+
+for (usint i = 0; i < inputs_count; i++)
+  {
+  scorecache_input in;
+  memset(&in, 0, sizeof(in));
+  in.size = inputs[i].size;
+  in.hash = inputs[i].hash;
+  in.namelen = Ustrlen(inputs[i].name) + 1;
+  (void)fwrite(&in, sizeof(in), 1, f);
+  (void)fwrite(inputs[i].name, 1, in.namelen, f);
+  (void)fwrite(zeros, 1, PAD8(in.namelen) - in.namelen, f);
+  }
+
+for (usint i = 0; i < font_count; i++)
+  {
+  scorecache_font sf;
+  sf.flags = font_list[i].flags;
+  sf.namelen = Ustrlen(font_list[i].name) + 1;
+  (void)fwrite(&sf, sizeof(sf), 1, f);
+  (void)fwrite(font_list[i].name, 1, sf.namelen, f);
+  (void)fwrite(zeros, 1, PAD8(sf.namelen) - sf.namelen, f);
+  }
+
+for (usint i = 0; i < blocks_count; i++)
+  {
+  scorecache_block sb;
+  if (!blocks[i].used) continue;
+  memset(&sb, 0, sizeof(sb));
+  sb.size = blocks[i].size;
+  sb.arena = blocks[i].arena;
+  (void)fwrite(&sb, sizeof(sb), 1, f);
+  }
+
+for (usint i = 0; i < roots_count; i++)
+  {
+  (void)fwrite(roots[i].address, 1, roots[i].size, f);
+  (void)fwrite(zeros, 1, PAD8(roots[i].size) - roots[i].size, f);
+  }
+
+for (size_t i = 0; i < relocs_count; i++)
+  {
+  scorecache_reloc r = relocs[i];
+  if (r.block != ROOT_BLOCK) r.block = blocks[r.block].index;
+  if (r.tblock != STATIC_BLOCK) r.tblock = blocks[r.tblock].index;
+  (void)fwrite(&r, sizeof(r), 1, f);
+  }
+
+/* Only the valid part of each block is written; the rest is zeroed. */
+
+for (usint i = 0; i < blocks_count; i++)
+  {
+  sc_block *b = blocks + i;
+  if (!b->used) continue;
+  (void)fwrite(b->start, 1, b->valid, f);
+  for (size_t n = PAD8(b->size) - b->valid; n > 0;)
+    {
+    size_t k = (n > sizeof(zeros))? sizeof(zeros) : n;
+    (void)fwrite(zeros, 1, k, f);
+    n -= k;
+    }
+  }
+
+failed = ferror(f) != 0;
+if (fclose(f) != 0) failed = TRUE;
+if (failed || rename(CS tempname, CS cachename) != 0)
+  {
+  (void)unlink(CS tempname);
+  return FALSE;
+  }
+return TRUE;
+}
+
+
+
+/*************************************************
+*        Save the data after reading             *
+*************************************************/
+
+/* This is called after an input file has been read. If all went well, the
+data structures are scanned from the global variables that point to them, and
+then written to a cache file.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+scorecache_save(void)
+{
+size_t rootoffset = 0;
+
+if (scorecache_dir == NULL) return;
+
+#if defined SUPPORT_B2PF && SUPPORT_B2PF != 0
+if (font_call_b2pf) scorecache_nosave("B2PF processing is used");
+#endif
+
+if (error_get_count() != errors_before)
+  scorecache_nosave("errors or warnings occurred");
+if (main_suppress_output || movements == NULL)
+  scorecache_nosave("there is no output");
+if (!key_ok) scorecache_nosave("the cache file name could not be set up");
+
+if (nosave_reason == NULL)
+  {
+  sc_setup_statics();
+  if (!sc_setup_blocks())
+    scorecache_nosave("memory blocks could not be set up");
+  }
+
+/* Record the pointers in the global variables, then scan everything they
+lead to. */
+
+for (usint i = 0; i < roots_count && nosave_reason == NULL; i++)
+  {
+  sc_root *r = roots + i;
+  void *target;
+  if (r->type != sc_data)
+    {
+    memcpy(&target, r->address, sizeof(void *));
+    if (target != NULL) sc_record(ROOT_BLOCK, rootoffset, target, r->type);
+    }
+  rootoffset += PAD8(r->size);
+  }
+
+while (work_count > 0 && nosave_reason == NULL)
+  {
+  sc_work *w = work + --work_count;
+  sc_scan(w->ptr, w->type);
+  }
+
+if (nosave_reason != NULL)
+  {
+  TRACE("Score not cached: %s\n", nosave_reason);
+  }
+else if (sc_write())
+  {
+  TRACE("Wrote score cache %s (%zu relocations)\n", cachename, relocs_count);
+  }
+
+sc_free_save_data();
+}
+
+
+
+/*************************************************
+*           Load data from a cache file          *
+*************************************************/
+
+/* This is called before the main input file is read. If a valid cache file
+exists, its data is loaded and TRUE is returned; the input file need not then
+be read. The file is checked completely before anything is changed.
+
+Arguments:  none
+Returns:    TRUE if the data was loaded
+*/
+
+BOOL
+scorecache_load(void)
+{
+struct stat st;
+scorecache_header *h;
+scorecache_block *sb;
+scorecache_reloc *sr;
+uschar *base, *p, *end, *rootdata, *data;
+uschar **bases;
+uschar *fontnames[FONTLIST_CHUNKSIZE];
+uint32_t fontflags[FONTLIST_CHUNKSIZE];
+size_t expected_rootsize = 0;
+uint64_t datasize = 0;
+BOOL ok = FALSE;
+int fd;
+
+if (scorecache_dir == NULL) return FALSE;
+errors_before = error_get_count();
+
+if (main_filename == NULL)
+  {
+  scorecache_nosave("the input is not a named file");
+  return FALSE;
+  }
+
+if ((debug_selector & ~(D_any|D_trace)) != 0)
+  {
+  scorecache_nosave("debugging is enabled");
+  return FALSE;
+  }
+
+key_ok = sc_make_key();
+if (!key_ok) return FALSE;
+
+/* The MIDI voice and percussion names are used while reading. */
+
+sc_add_named_input(midi_voices);
+sc_add_named_input(midi_perc);
+
+fd = open(CS cachename, O_RDONLY);
+if (fd < 0) return FALSE;
+if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(scorecache_header))
+  {
+  (void)close(fd);
+  return FALSE;
+  }
+
+base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+(void)close(fd);
+if (base == MAP_FAILED) return FALSE;
+
+h = (scorecache_header *)base;
+p = base + sizeof(scorecache_header);
+end = base + st.st_size;
+
+if (memcmp(h->magic, SCORECACHE_MAGIC, sizeof(SCORECACHE_MAGIC)) != 0 ||
+    strncmp(h->version, PMW_VERSION, sizeof(h->version)) != 0 ||
+    h->ptrsize != sizeof(void *) ||
+    memcmp(h->sizes, struct_sizes, sizeof(struct_sizes)) != 0 ||
+    h->itemsizes != sc_hash(14695981039346656037ull, bar_item_sizes,
+      b_baditem * sizeof(size_t)) ||
+    h->fingerprint != fingerprint ||
+    h->fontcount < font_count ||
+    h->fontcount > FONTLIST_CHUNKSIZE ||
+    h->inputcount == 0)
+  goto END;
+
+/* Check that none of the input files has changed. The first must be the main
+input file. */
+
+for (usint i = 0; i < h->inputcount; i++)
+  {
+  scorecache_input *in = (scorecache_input *)p;
+  uschar *name;
+  uint64_t size, hash;
+
+  if ((size_t)(end - p) < sizeof(scorecache_input)) goto END;
+  name = p + sizeof(scorecache_input);
+  if (in->namelen == 0 || (size_t)(end - name) < PAD8(in->namelen) ||
+      name[in->namelen - 1] != 0) goto END;
+  if (i == 0 && Ustrcmp(name, mainpath) != 0) goto END;
+  if (!sc_hash_file(name, &size, &hash) || size != in->size ||
+      hash != in->hash)
+    {
+    TRACE("Score cache %s is out of date\n", cachename);
+    goto END;
+    }
+  p = name + PAD8(in->namelen);
+  }
+
+/* The standard fonts must be the same; others are added. */
+
+for (usint i = 0; i < h->fontcount; i++)
+  {
+  scorecache_font *sf = (scorecache_font *)p;
+  uschar *name;
+
+  if ((size_t)(end - p) < sizeof(scorecache_font)) goto END;
+  name = p + sizeof(scorecache_font);
+  if (sf->namelen == 0 || (size_t)(end - name) < PAD8(sf->namelen) ||
+      name[sf->namelen - 1] != 0) goto END;
+  if (i < font_count && Ustrcmp(name, font_list[i].name) != 0) goto END;
+  fontnames[i] = name;
+  fontflags[i] = sf->flags;
+  p = name + PAD8(sf->namelen);
+  }
+
+/* Check the sizes of the remaining data. */
+
+sb = (scorecache_block *)p;
+if ((size_t)(end - p) / sizeof(scorecache_block) < h->blockcount) goto END;
+p += h->blockcount * sizeof(scorecache_block);
+for (usint i = 0; i < h->blockcount; i++)
+  {
+  if (sb[i].size < sizeof(char *) || sb[i].size > SIZE_MAX/2) goto END;
+  datasize += PAD8(sb[i].size);
+  }
+
+for (usint i = 0; i < roots_count; i++)
+  expected_rootsize += PAD8(roots[i].size);
+rootdata = p;
+if (h->rootsize != expected_rootsize ||
+    (size_t)(end - p) < expected_rootsize) goto END;
+p += expected_rootsize;
+
+sr = (scorecache_reloc *)p;
+if ((size_t)(end - p) / sizeof(scorecache_reloc) < h->reloccount) goto END;
+p += h->reloccount * sizeof(scorecache_reloc);
+
+data = p;
+if (datasize != h->datasize || (uint64_t)(end - p) != datasize) goto END;
+
+sc_setup_statics();
+for (usint i = 0; i < h->reloccount; i++)
+  {
+  scorecache_reloc *r = sr + i;
+  uint64_t size = (r->block == ROOT_BLOCK)? expected_rootsize :
+    (r->block < h->blockcount)? sb[r->block].size : 0;
+  if (r->offset + sizeof(void *) > size) goto END;
+  if (r->tblock == STATIC_BLOCK)
+    {
+    if (r->toffset >= statics_count) goto END;
+    }
+  else if (r->tblock >= h->blockcount || r->toffset >= sb[r->tblock].size)
+    goto END;
+  }
+
+/* All is well. Add any extra fonts, and set the include flags. */
+
+for (usint i = 0; i < h->fontcount; i++)
+  {
+  if (i >= font_count) font_addfont(fontnames[i], font_rm, 0);
+  font_list[i].flags |= fontflags[i] & ff_include;
+  }
+
+/* Copy the blocks into new memory. Those that came from mem.c are registered
+so that they are freed at the end. */
+
+bases = malloc(h->blockcount * sizeof(uschar *));
+if (bases == NULL)
+  error(ERR0, "", "score cache", h->blockcount * sizeof(uschar *));  /* Hard */
+
+for (usint i = 0; i < h->blockcount; i++)
+  {
+  bases[i] = malloc(sb[i].size);
+  if (bases[i] == NULL) error(ERR0, "", "score cache", sb[i].size);  /* Hard */
+  memcpy(bases[i], data, sb[i].size);
+  if (sb[i].arena != 0) mem_register(bases[i], sb[i].size, mt_cache);
+  data += PAD8(sb[i].size);
+  }
+
+/* The global variables are relocated in a copy, then copied into place. */
+
+p = malloc(expected_rootsize);
+if (p == NULL) error(ERR0, "", "score cache", expected_rootsize);  /* Hard */
+memcpy(p, rootdata, expected_rootsize);
+
+for (usint i = 0; i < h->reloccount; i++)
+  {
+  scorecache_reloc *r = sr + i;
+  void *target = (r->tblock == STATIC_BLOCK)? statics[r->toffset] :
+    (void *)(bases[r->tblock] + r->toffset);
+  uschar *loc = (r->block == ROOT_BLOCK)? p : bases[r->block];
+  memcpy(loc + r->offset, &target, sizeof(void *));
+  }
+
+rootdata = p;
+for (usint i = 0; i < roots_count; i++)
+  {
+  memcpy(roots[i].address, p, roots[i].size);
+  p += PAD8(roots[i].size);
+  }
+
+free(rootdata);
+free(bases);
+tree_rehash(draw_tree);
+tree_rehash(draw_variable_tree);
+string_widthcache_flush();
+TRACE("Loaded score cache %s\n", cachename);
+ok = TRUE;
+
+END:
+(void)munmap(base, st.st_size);
+return ok;
+}
+
+/* End of scorecache.c */
@@ -0,0 +1,620 @@
+/*************************************************
+*             PMW server and batch modes         *
+*************************************************/
+
+/* Copyright Philip Hazel 2026 */
+/* This file created: October 2026 */
+/* This file last modified: October 2026 */
+
+/* When -server is given, PMW reads job descriptions from its standard input,
+or from connections to a Unix domain socket if -socket is also given. Before
+reading any jobs, the standard fonts are loaded and the PostScript header file
+and the music font file are read into memory, so that this work is not repeated
+for every job.
+
+PMW's state lives in a great many global variables and in memory that is never
+individually freed, so it cannot be reset in place between jobs. Instead, each
+job is run in a child process that is forked from the warmed-up server. The
+child returns to main(), which processes the job in the normal way and exits,
+discarding all its state. The server waits for each job to finish before
+reading the next one.
+
+Data that a job loads or computes, and that later jobs could use, would be lost
+when the job's process exits. Instead, the job passes it back to the server
+through a pipe, and the server adds it to its own state, from which later jobs
+are forked. Font metrics that were read from files are passed back in the same
+form as a font metrics cache file, remembered string widths are passed back
+unless the job changed the fonts or their metrics, and the names of included
+files are passed back so that the server can read them. Everything that is passed
+back is checked in the same way as when it is used within a single job.
+
+A job is described by a single line containing command line arguments,
+separated by white space, exactly as in a .pmwrc file. These are added to the
+arguments that were given to the server. An argument of the form <<word means
+that the input data follows the line, terminated by a line that consists of
+the word on its own. Empty lines and lines starting with # are ignored, and a
+line containing just "quit" stops the server. When a job has finished, a line
+of the form "done <status>" is written, where the status is the job's exit
+code.
+
+When -batch is given, the jobs are read from a file instead, in the same
+format, and run in the same way. This is intended for processing many input
+files with the same options in one run. Instead of a "done" line for each job,
+a message is written only for those jobs that fail, and the exit code of the
+run is non-zero if any of them did. */
+
+#include "pmw.h"
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* Values returned by read_job() */
+
+enum { job_ok, job_none, job_quit };
+
+/* Inline input for the current job */
+
+static char   *inline_data = NULL;
+static size_t  inline_size = 0;
+
+/* The current job line, its line number, and a flag for a line with too many
+arguments */
+
+static char   *job_line = NULL;
+static int     job_lineno = 0;
+static int     job_startline;
+static BOOL    job_toomany = FALSE;
+
+/* Counts of jobs in batch mode */
+
+static int     jobs_run = 0;
+static int     jobs_failed = 0;
+
+/* Settings that affect the preloaded font metrics */
+
+static uschar *warm_data_extra;
+static BOOL    warm_pdf;
+
+
+
+/*************************************************
+*       Load data that is used by all jobs       *
+*************************************************/
+
+/* The metrics of all the fonts that are known at this point (the standard
+fonts) are loaded, and the PostScript header and the music font file are read.
+The font metrics depend on the font directories and on the output format, so
+these are remembered. The music font file is used only by jobs with the same
+output format and music font directories.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+static void
+warm_up(void)
+{
+warm_data_extra = font_data_extra;
+warm_pdf = PDF;
+for (usint i = 0; i < font_count; i++) (void)font_load(i);
+ps_preload_header();
+font_preload_music();
+}
+
+
+
+/*************************************************
+*         Pass data back to the server           *
+*************************************************/
+
+/* This is called in a job process to send something that the job has loaded
+or computed to the server, so that later jobs can use it. Each item is sent as
+its type and length, followed by the data. This is just an optimization, so any
+failure is ignored.
+
+Arguments:
+  type        the type of data (pb_font etc.)
+  data        the data
+  size        the length of the data
+
+Returns:      nothing
+*/
+
+void
+server_passback_write(int type, const void *data, size_t size)
+{
+uint32_t header[2];
+
+if (server_passback == NULL || size > UINT32_MAX) return;
+header[0] = type;
+header[1] = (uint32_t)size;
+(void)fwrite(header, sizeof(header), 1, server_passback);
+(void)fwrite(data, 1, size, server_passback);
+}
+
+
+
+/*************************************************
+*      Finish passing data back to the server    *
+*************************************************/
+
+/* This is called when a job process exits. Remembered string widths are sent
+at the end of the job, unless they have already been sent.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+static void
+passback_finish(void)
+{
+string_widthcache_passback();
+(void)fclose(server_passback);
+server_passback = NULL;
+}
+
+
+
+/*************************************************
+*      Read data passed back from a job          *
+*************************************************/
+
+/* This is called in the server while a job is running. It reads items from the
+pipe until the job closes it, and hands each one to the module that it belongs
+to. If something goes wrong, the remainder of the data is discarded, but it is
+still read, so that the job is not blocked.
+
+Argument:   the pipe's file descriptor
+Returns:    nothing
+*/
+
+static void
+read_passback(int fd)
+{
+FILE *f = fdopen(fd, "r");
+uschar *data = NULL;
+size_t datasize = 0;
+uint32_t header[2];
+
+if (f == NULL)
+  {
+  (void)close(fd);
+  return;
+  }
+
+while (fread(header, sizeof(header), 1, f) == 1)
+  {
+  if ((size_t)header[1] + 1 > datasize)
+    {
+    uschar *newdata = realloc(data, (size_t)header[1] + 1);
+    if (newdata == NULL) break;
+    data = newdata;
+    datasize = (size_t)header[1] + 1;
+    }
+  if (fread(data, 1, header[1], f) != header[1]) break;
+  data[header[1]] = 0;
+
+  switch (header[0])
+    {
+    case pb_font:
+    font_server_add(data, header[1]);
+    break;
+
+    case pb_include:
+    read_server_include(data);
+    break;
+
+    case pb_width:
+    string_widthcache_add(data, header[1]);
+    break;
+    }
+  }
+
+/* Discard anything that was not processed. */
+
+if (data != NULL) while (fread(data, 1, datasize, f) > 0) {}
+  else while (fgetc(f) != EOF) {}
+
+free(data);
+(void)fclose(f);
+}
+
+
+
+/*************************************************
+*             Read a job description             *
+*************************************************/
+
+/* The line is split up into arguments, which are added to the server's own
+arguments. If there is inline input, it is read into a buffer that is
+obtained with malloc() and extended as necessary.
+
+Arguments:
+  f           the input stream
+  argc        the server's argc
+  argv        the server's argv
+  jobargc     where to return the job's argc
+  jobargv     where to return the job's argv (obtained with malloc)
+
+Returns:      job_ok, job_none at the end of the input, or job_quit
+*/
+
+static int
+read_job(FILE *f, int argc, char **argv, int *jobargc, char ***jobargv)
+{
+char *line = NULL;
+char *terminator = NULL;
+size_t linesize = 0;
+size_t inline_max = 0;
+char **nargv;
+int nargc;
+
+free(inline_data);
+inline_data = NULL;
+inline_size = 0;
+job_toomany = FALSE;
+
+/* Skip empty and comment lines */
+
+for (;;)
+  {
+  char *p;
+  if (getline(&line, &linesize, f) < 0)
+    {
+    free(line);
+    return job_none;
+    }
+  job_lineno++;
+  p = line;
+  while (isspace((unsigned char)*p)) p++;
+  if (*p != 0 && *p != '#') break;
+  }
+
+if (strncmp(line, "quit", 4) == 0 &&
+    line[4 + strspn(line + 4, " \t\r\n")] == 0)
+  {
+  free(line);
+  return job_quit;
+  }
+
+job_startline = job_lineno;
+
+/* Split up the line. The strings are left in the line buffer, which is not
+freed in the job process. */
+
+nargv = malloc(MAX_COMMANDARGS * sizeof(char *));
+if (nargv == NULL) error(ERR0, "", "server job arguments",
+  MAX_COMMANDARGS * sizeof(char *));  /* Hard */
+
+for (nargc = 0; nargc < argc; nargc++) nargv[nargc] = argv[nargc];
+
+for (char *p = line;;)
+  {
+  char *pp;
+  while (isspace((unsigned char)*p)) p++;
+  if (*p == 0) break;
+  pp = p;
+  while (*p != 0 && !isspace((unsigned char)*p)) p++;
+  if (*p != 0) *p++ = 0;
+  if (strncmp(pp, "<<", 2) == 0 && pp[2] != 0) terminator = pp + 2;
+  else
+    {
+    if (nargc >= MAX_COMMANDARGS - 1) job_toomany = TRUE;
+      else nargv[nargc++] = pp;
+    }
+  }
+nargv[nargc] = NULL;
+
+/* Read any inline input */
+
+if (terminator != NULL)
+  {
+  char *data = NULL;
+  size_t datasize = 0;
+  size_t tlen = strlen(terminator);
+  ssize_t len;
+
+  for (;;)
+    {
+    len = getline(&data, &datasize, f);
+    if (len < 0) break;
+    job_lineno++;
+    if ((size_t)len >= tlen && strncmp(data, terminator, tlen) == 0 &&
+        data[tlen + strspn(data + tlen, "\r\n")] == 0)
+      break;
+    while (inline_size + len > inline_max)
+      {
+      inline_max = (inline_max == 0)? 4096 : 2 * inline_max;
+      inline_data = realloc(inline_data, inline_max);
+      if (inline_data == NULL)
+        error(ERR0, "re-", "server inline input", inline_max);  /* Hard */
+      }
+    memcpy(inline_data + inline_size, data, len);
+    inline_size += len;
+    }
+  free(data);
+
+  /* An empty input is represented by a single newline, so that there is
+  something to read. */
+
+  if (inline_data == NULL)
+    {
+    inline_data = malloc(1);
+    if (inline_data == NULL) error(ERR0, "", "server inline input", 1);
+    inline_data[0] = '\n';
+    inline_size = 1;
+    }
+  }
+
+job_line = line;
+*jobargc = nargc;
+*jobargv = nargv;
+return job_ok;
+}
+
+
+
+/*************************************************
+*          Run the jobs from one stream          *
+*************************************************/
+
+/* Each job is run in a child process. In the parent, this function returns
+when there are no more jobs. In the child, it returns the job's arguments.
+
+Arguments:
+  in          the stream of jobs
+  out         where to write job statuses, or NULL in batch mode
+  conn        if not negative, a socket to which job messages are sent
+  argc        the server's argc
+  argv        the server's argv
+  jobargc     where to return the job's argc in a child process
+  jobargv     where to return the job's argv in a child process
+
+Returns:      in a child, job_ok; otherwise, job_none or job_quit
+*/
+
+static int
+run_jobs(FILE *in, FILE *out, int conn, int argc, char **argv, int *jobargc,
+  char ***jobargv)
+{
+for (;;)
+  {
+  int status;
+  int pb[2];
+  pid_t pid;
+  int rc = read_job(in, argc, argv, jobargc, jobargv);
+
+  if (rc != job_ok) return rc;
+
+  if (pipe(pb) != 0) error(ERR205, "job", "pipe", strerror(errno));  /* Hard */
+  (void)fflush(stdout);
+  (void)fflush(stderr);
+  pid = fork();
+  if (pid < 0) error(ERR205, "job", "fork", strerror(errno));  /* Hard */
+
+  /* In the job process, send messages to the socket if there is one, and
+  detach from the stream of jobs so that exiting does not disturb it (the exit
+  processing of a stdio input stream may reset the file position). Then set up
+  the pipe to the server and the inline input, if any, and return. */
+
+  if (pid == 0)
+    {
+    int null = open("/dev/null", O_RDONLY);
+    (void)close(pb[0]);
+    if (conn >= 0)
+      {
+      (void)dup2(conn, 1);
+      (void)dup2(conn, 2);
+      }
+    if (null >= 0)
+      {
+      (void)dup2(null, fileno(in));
+      (void)close(null);
+      }
+    server_passback = fdopen(pb[1], "w");
+    if (server_passback == NULL)
+      error(ERR205, "job", "fdopen", strerror(errno));  /* Hard */
+    if (atexit(passback_finish) != 0) error(ERR25);  /* Hard */
+    if (job_toomany) error(ERR204, "too many arguments");  /* Hard */
+    if (inline_data != NULL)
+      {
+      read_filehandle = fmemopen(inline_data, inline_size, "r");
+      if (read_filehandle == NULL)
+        error(ERR205, "job", "fmemopen", strerror(errno));  /* Hard */
+      read_filename = US "<inline>";
+      }
+    return job_ok;
+    }
+
+  /* In the server, read anything that the job passes back, then wait for it
+  to finish. */
+
+  free(*jobargv);
+  free(job_line);
+  job_line = NULL;
+  (void)close(pb[1]);
+  read_passback(pb[0]);
+  while (waitpid(pid, &status, 0) < 0)
+    if (errno != EINTR) error(ERR205, "job", "waitpid", strerror(errno));
+
+  status = WIFEXITED(status)? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+  jobs_run++;
+
+  if (out != NULL)
+    {
+    (void)fprintf(out, "done %d\n", status);
+    (void)fflush(out);
+    }
+  else if (status != 0)
+    {
+    jobs_failed++;
+    eprintf("** Batch job at line %d failed (exit code %d)\n", job_startline,
+      status);
+    }
+  }
+}
+
+
+
+/*************************************************
+*          Run the server or a batch             *
+*************************************************/
+
+/* This function returns only in a child process that is to run a job.
+
+Arguments:
+  argc        the server's argc
+  argv        the server's argv
+  jobargv     where to return the job's argv
+
+Returns:      the job's argc
+*/
+
+int
+server_run(int argc, char **argv, char ***jobargv)
+{
+struct sockaddr_un addr;
+int jobargc;
+int sock;
+
+if (main_filename != NULL)
+  error(ERR206, (main_batch_file != NULL)? "-batch" : "-server");  /* Hard */
+
+/* Jobs from a file */
+
+if (main_batch_file != NULL)
+  {
+  FILE *f;
+
+  if (main_server) error(ERR207);  /* Hard */
+  if (Ustrcmp(main_batch_file, "-") == 0) f = stdin; else
+    {
+    f = Ufopen(main_batch_file, "r");
+    if (f == NULL)
+      error(ERR23, main_batch_file, strerror(errno));  /* Hard */
+    }
+
+  warm_up();
+  if (run_jobs(f, NULL, -1, argc, argv, &jobargc, jobargv) == job_ok)
+    return jobargc;
+
+  if (main_verify) eprintf("%d batch job%s run\n", jobs_run,
+    (jobs_run == 1)? "" : "s");
+  if (jobs_failed > 0)
+    {
+    eprintf("** %d of %d batch job%s failed\n", jobs_failed, jobs_run,
+      (jobs_run == 1)? "" : "s");
+    exit(EXIT_FAILURE);
+    }
+  exit(EXIT_SUCCESS);
+  }
+
+warm_up();
+(void)signal(SIGPIPE, SIG_IGN);
+
+/* Jobs from the standard input */
+
+if (main_server_socket == NULL)
+  {
+  if (run_jobs(stdin, stdout, -1, argc, argv, &jobargc, jobargv) == job_ok)
+    return jobargc;
+  exit(EXIT_SUCCESS);
+  }
+
+/* Jobs from a socket */
+
+if (Ustrlen(main_server_socket) >= sizeof(addr.sun_path))
+  error(ERR205, main_server_socket, "bind", "path name is too long");
+
+sock = socket(AF_UNIX, SOCK_STREAM, 0);
+if (sock < 0)
+  error(ERR205, main_server_socket, "socket", strerror(errno));  /* Hard */
+
+memset(&addr, 0, sizeof(addr));
+addr.sun_family = AF_UNIX;
+Ustrcpy(addr.sun_path, main_server_socket);
+(void)unlink(CS main_server_socket);
+
+if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+  error(ERR205, main_server_socket, "bind", strerror(errno));  /* Hard */
+if (listen(sock, 5) != 0)
+  error(ERR205, main_server_socket, "listen", strerror(errno));  /* Hard */
+
+/* Each connection may send any number of jobs. */
+
+for (;;)
+  {
+  FILE *in, *out;
+  int rc;
+  int conn = accept(sock, NULL, NULL);
+
+  if (conn < 0)
+    {
+    if (errno == EINTR) continue;
+    error(ERR205, main_server_socket, "accept", strerror(errno));  /* Hard */
+    }
+
+  in = fdopen(conn, "r");
+  out = fdopen(dup(conn), "w");
+  if (in == NULL || out == NULL)
+    error(ERR205, main_server_socket, "fdopen", strerror(errno));  /* Hard */
+
+  rc = run_jobs(in, out, conn, argc, argv, &jobargc, jobargv);
+  if (rc == job_ok)
+    {
+    (void)close(sock);
+    return jobargc;
+    }
+
+  (void)fclose(in);
+  (void)fclose(out);
+  if (rc == job_quit) break;
+  }
+
+(void)close(sock);
+(void)unlink(CS main_server_socket);
+exit(EXIT_SUCCESS);
+}
+
+
+
+/*************************************************
+*         Check a job's arguments                *
+*************************************************/
+
+/* This is called in a job process after its arguments have been decoded. If
+the job has changed the font directories or the output format, the preloaded
+font metrics are discarded so that they are reloaded as required, and so are
+any remembered string widths, which are not passed back to the server.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+server_check_job(void)
+{
+if (font_data_extra != warm_data_extra || PDF != warm_pdf)
+  {
+  for (usint i = 0; i < font_count; i++) font_list[i].flags &= ~ff_loaded;
+  string_widthcache_flush();
+  }
+
+if (read_filehandle != NULL)
+  {
+  if (main_filename != NULL)
+    error(ERR204, "both an input file and inline input were given");
+  }
+else if (main_filename == NULL)
+  error(ERR204, "no input file or inline input was given");
+
+if (out_filename == NULL? main_filename == NULL :
+    Ustrcmp(out_filename, "-") == 0)
+  error(ERR204, "output to the standard output is not allowed");
+}
+
+/* End of server.c */
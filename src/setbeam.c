@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2021 */
 /* This file created: June 2021 */
-/* This file last modified: December 2024 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -1336,7 +1336,7 @@ if (beam_overbeam)
   {
   obeamstr *b;
   if (bar_cont->overbeam == NULL)
-    bar_cont->overbeam = mem_get(sizeof(obeamstr));
+    bar_cont->overbeam = mem_get(sizeof(obeamstr), mt_cont);
 
   b = bar_cont->overbeam;
   b->firstX = beam_firstX - out_poslast->xoff - out_sysblock->barlinewidth;
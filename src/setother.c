@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: June 2021 */
-/* This file last modified: April 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -45,7 +45,7 @@ static void
 setstarthairpin(b_hairpinstr *h, int32_t x)
 {
 hairpinstr *hh = mem_get_cached((void **)(&main_freehairpinstr),
-  sizeof(hairpinstr));
+  sizeof(hairpinstr), mt_cont);
 
 hh->hairpin = h;
 hh->x = x;
@@ -370,7 +370,7 @@ switch (p->type)
         }
       }
 
-    g = mem_get_cached((void **)&main_freegapblocks, sizeof(gapstr));
+    g = mem_get_cached((void **)&main_freegapblocks, sizeof(gapstr), mt_cont);
     g->next = s->gaps;
     s->gaps = g;
     g->gap = pg;
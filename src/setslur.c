@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: July 2021 */
-/* This file last modified: April 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -25,7 +25,8 @@ Returns:    the slur processing structure that was set up
 slurstr *
 slur_startslur(b_slurstr *p)
 {
-slurstr *s = mem_get_cached((void **)(&main_freeslurblocks), sizeof(slurstr));
+slurstr *s = mem_get_cached((void **)(&main_freeslurblocks), sizeof(slurstr),
+  mt_cont);
 
 s->slur = p;
 s->maxy = INT32_MIN;
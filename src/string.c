@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2025 */
 /* This file created: January 2021 */
-/* This file last modified: April 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -19,6 +19,41 @@ static BOOL        fontwarned = FALSE;
 static uint32_t    pbuffer[PSIM*BSIZ];  /* For converted PMW strings */
 static usint       pindex = 0;
 
+/* The string width cache is a hash table of chains of entries. Each entry
+holds a copy of the string that it describes. In a server job, the entries that
+were inherited from the server are marked, so that only new ones are passed
+back. The fields from "hash" onwards are passed back as they are, followed by
+the string. */
+
+#define WIDTHCACHE_SIZE        1024
+#define WIDTHCACHE_MAXENTRIES 20000
+
+typedef struct widthcachestr {
+  struct widthcachestr *next;
+  uint32_t *s;
+  uint32_t  hash;
+  usint     length;
+  int32_t   size;
+  int32_t   spacestretch;
+  int32_t   smallcapsize;
+  int32_t   matrix[4];
+  int32_t   width;
+  int32_t   height;
+  BOOL      hasmatrix;
+  BOOL      kerning;
+  BOOL      inherited;
+} widthcachestr;
+
+#define WIDTHCACHE_DATA  offsetof(widthcachestr, hash)
+
+static widthcachestr *widthcache[WIDTHCACHE_SIZE];
+static int            widthcache_count = 0;
+static int            widthcache_flushes = 0;
+static BOOL           widthcache_sent = FALSE;
+static uint64_t       widthcache_hits = 0;
+static uint64_t       widthcache_misses = 0;
+static uint64_t       widthcache_uncacheable = 0;
+
 static const char *keysuffix[] = { "", "#", "$", "m", "#m", "$m" };
 
 static const char *nlsharp[] = {
@@ -766,20 +801,22 @@ return (*s == 0) & (*t == 0);
 
 
 /*************************************************
-*              Get width of a PMW string         *
+*           Compute width of a PMW string        *
 *************************************************/
 
-/*
+/* This is the function that does the work for string_width() below, which
+remembers its results.
+
 Arguments:
   s            the string
   fdata        points to font instance block
-  heightptr    where to return height if not NULL
+  heightptr    where to return height
 
 Returns:       the width (fixed point)
 */
 
-int32_t
-string_width(uint32_t *s, fontinststr *fdata, int32_t *heightptr)
+static int32_t
+string_width_compute(uint32_t *s, fontinststr *fdata, int32_t *heightptr)
 {
 BOOL ignoreskip = FALSE;
 int32_t yield = 0;
@@ -787,12 +824,6 @@ int32_t yield_height = 0;
 uint32_t lastc = 0;
 uint32_t spacecount = 0;
 
-DEBUG(D_stringwidth)
-  {
-  eprintf("width of ");
-  debug_string(s);
-  }
-
 while (*s != 0)
   {
   uint32_t c = *s++;
@@ -927,6 +958,278 @@ if (fdata->matrix != NULL)
     mac_muldiv(h, fdata->matrix[2], 65536);
   }
 
+*heightptr = yield_height;
+return yield;
+}
+
+
+
+/*************************************************
+*           Flush the string width cache         *
+*************************************************/
+
+/* This must be called whenever something that string_width_compute() depends
+on, other than the values that are part of a cache key, is changed. This
+happens when a font id is re-assigned to a different font, or when character
+widths in a font are adjusted. The cache entries themselves are abandoned. In a
+server job, the entries are first passed back to the server, because they were
+computed with the server's fonts; later ones are not.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+string_widthcache_flush(void)
+{
+string_widthcache_passback();
+if (widthcache_count == 0) return;
+memset(widthcache, 0, sizeof(widthcache));
+widthcache_count = 0;
+widthcache_flushes++;
+}
+
+
+
+/*************************************************
+*    Pass string widths back to the server       *
+*************************************************/
+
+/* This is called in a server job when the cache is first flushed, and at the
+end of the job. Entries that were not inherited from the server are sent, but
+only once, because after a flush the widths may depend on fonts or metrics that
+are particular to the job.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+string_widthcache_passback(void)
+{
+size_t datasize = sizeof(widthcachestr) - WIDTHCACHE_DATA;
+size_t buffersize = 0;
+uschar *buffer = NULL;
+
+if (server_passback == NULL || widthcache_sent) return;
+widthcache_sent = TRUE;
+
+for (int i = 0; i < WIDTHCACHE_SIZE; i++)
+  {
+  for (widthcachestr *wc = widthcache[i]; wc != NULL; wc = wc->next)
+    {
+    size_t sslength = (wc->length + 1) * sizeof(uint32_t);
+
+    if (wc->inherited) continue;
+    if (datasize + sslength > buffersize)
+      {
+      uschar *newbuffer = realloc(buffer, datasize + sslength);
+      if (newbuffer == NULL) continue;
+      buffer = newbuffer;
+      buffersize = datasize + sslength;
+      }
+    memcpy(buffer, (uschar *)wc + WIDTHCACHE_DATA, datasize);
+    memcpy(buffer + datasize, wc->s, sslength);
+    server_passback_write(pb_width, buffer, datasize + sslength);
+    }
+  }
+
+free(buffer);
+}
+
+
+
+/*************************************************
+*   Add a string width passed back by a job      *
+*************************************************/
+
+/* This is called in the server. A job never passes back an entry that it
+inherited, so there is no need to check for duplicates.
+
+Arguments:
+  data       the entry's data, as sent by string_widthcache_passback()
+  size       the length of the data
+
+Returns:     nothing
+*/
+
+void
+string_widthcache_add(uschar *data, size_t size)
+{
+widthcachestr entry;
+widthcachestr *wc;
+widthcachestr **anchor;
+size_t datasize = sizeof(widthcachestr) - WIDTHCACHE_DATA;
+size_t sslength;
+
+if (size <= datasize || widthcache_count >= WIDTHCACHE_MAXENTRIES) return;
+sslength = size - datasize;
+memcpy((uschar *)(&entry) + WIDTHCACHE_DATA, data, datasize);
+if ((entry.length + 1) * sizeof(uint32_t) != sslength ||
+    sizeof(widthcachestr) + sslength > MEMORY_MAXBLOCK)
+  return;
+
+wc = mem_get(sizeof(widthcachestr) + sslength, mt_cache);
+*wc = entry;
+wc->s = (uint32_t *)(wc + 1);
+memcpy(wc->s, data + datasize, sslength);
+wc->inherited = TRUE;
+anchor = widthcache + wc->hash % WIDTHCACHE_SIZE;
+wc->next = *anchor;
+*anchor = wc;
+widthcache_count++;
+}
+
+
+
+/*************************************************
+*        Show string width cache statistics      *
+*************************************************/
+
+/* This is called at the end of a run when the "stringcache" debug selector is
+set.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+string_widthcache_statistics(void)
+{
+uint64_t total = widthcache_hits + widthcache_misses;
+eprintf("String width cache: %" PRIu64 " lookups, %" PRIu64 " hits, %" PRIu64
+  " misses, %" PRIu64 " not cacheable\n", total + widthcache_uncacheable,
+  widthcache_hits, widthcache_misses, widthcache_uncacheable);
+if (total > 0) eprintf("  hit rate %.1f%%, %d entries, %d flushes\n",
+  (100.0 * (double)widthcache_hits)/(double)total, widthcache_count,
+  widthcache_flushes);
+}
+
+
+
+/*************************************************
+*              Get width of a PMW string         *
+*************************************************/
+
+/* The same strings are measured many times, during pagination and again when
+they are output, and a given piece of text often recurs (for example, an
+expression mark or a repeated underlay syllable). The results are therefore
+remembered in a hash table, keyed by the string's contents, the font instance
+data, and the other values on which the width depends. Strings that contain
+page or bar repeat number escapes are never cached because their width depends
+on where they are output.
+
+Arguments:
+  s            the string
+  fdata        points to font instance block
+  heightptr    where to return height if not NULL
+
+Returns:       the width (fixed point)
+*/
+
+int32_t
+string_width(uint32_t *s, fontinststr *fdata, int32_t *heightptr)
+{
+BOOL cacheable = TRUE;
+int32_t yield, yield_height;
+int32_t smallcapsize = (curmovt == NULL)? 0 : (int32_t)curmovt->smallcapsize;
+uint32_t hash = 2166136261u;
+usint length = 0;
+widthcachestr *wc;
+
+DEBUG(D_stringwidth)
+  {
+  eprintf("width of ");
+  debug_string(s);
+  }
+
+/* Hash the string and see if it can be cached. */
+
+for (uint32_t *p = s; *p != 0; p++)
+  {
+  uint32_t c = PCHAR(*p);
+  if (c >= ss_page && c <= ss_repeatnumber2) cacheable = FALSE;
+  hash = (hash ^ *p) * 16777619u;
+  length++;
+  }
+
+if (!cacheable)
+  {
+  widthcache_uncacheable++;
+  wc = NULL;
+  yield = string_width_compute(s, fdata, &yield_height);
+  }
+
+/* Add the remaining key values into the hash and search the chain. */
+
+else
+  {
+  hash = (hash ^ (uint32_t)fdata->size) * 16777619u;
+  hash = (hash ^ (uint32_t)fdata->spacestretch) * 16777619u;
+  hash = (hash ^ (uint32_t)smallcapsize) * 16777619u;
+  if (fdata->matrix != NULL) for (int i = 0; i < 4; i++)
+    hash = (hash ^ (uint32_t)fdata->matrix[i]) * 16777619u;
+
+  for (wc = widthcache[hash % WIDTHCACHE_SIZE]; wc != NULL; wc = wc->next)
+    {
+    if (wc->hash == hash &&
+        wc->length == length &&
+        wc->size == fdata->size &&
+        wc->spacestretch == fdata->spacestretch &&
+        wc->smallcapsize == smallcapsize &&
+        wc->kerning == main_kerning &&
+        ((fdata->matrix == NULL)? !wc->hasmatrix :
+          (wc->hasmatrix &&
+           memcmp(wc->matrix, fdata->matrix, sizeof(wc->matrix)) == 0)) &&
+        memcmp(wc->s, s, length * sizeof(uint32_t)) == 0)
+      break;
+    }
+
+  /* On a hit, use the remembered values. Otherwise, compute the values and
+  add a new entry to the cache unless it is full. */
+
+  if (wc != NULL)
+    {
+    widthcache_hits++;
+    yield = wc->width;
+    yield_height = wc->height;
+    }
+  else
+    {
+    size_t sslength = (length + 1) * sizeof(uint32_t);
+
+    widthcache_misses++;
+    yield = string_width_compute(s, fdata, &yield_height);
+
+    if (widthcache_count < WIDTHCACHE_MAXENTRIES &&
+        sizeof(widthcachestr) + sslength <= MEMORY_MAXBLOCK)
+      {
+      uint32_t *ss;
+      widthcachestr **anchor = widthcache + hash % WIDTHCACHE_SIZE;
+
+      wc = mem_get(sizeof(widthcachestr) + sslength, mt_cache);
+      ss = (uint32_t *)(wc + 1);
+      memcpy(ss, s, sslength);
+      wc->s = ss;
+      wc->hash = hash;
+      wc->length = length;
+      wc->size = fdata->size;
+      wc->spacestretch = fdata->spacestretch;
+      wc->smallcapsize = smallcapsize;
+      wc->kerning = main_kerning;
+      wc->hasmatrix = fdata->matrix != NULL;
+      if (wc->hasmatrix)
+        memcpy(wc->matrix, fdata->matrix, sizeof(wc->matrix));
+      wc->width = yield;
+      wc->height = yield_height;
+      wc->inherited = FALSE;
+      wc->next = *anchor;
+      *anchor = wc;
+      widthcache_count++;
+      }
+    }
+  }
+
 DEBUG(D_stringwidth)
   {
   eprintf(" = %s", sff(yield));
@@ -1135,7 +1438,8 @@ if (call_b2pf)  /* The string contains a font that is set up for B2PF */
   /* Get new buffer if necessary and copy the processed string. */
 
   nlen = p - outbuff;
-  if (nlen > (size_t)(s - str)) str = mem_get_independent(nlen*sizeof(uint32_t));
+  if (nlen > (size_t)(s - str))
+    str = mem_get_independent(nlen*sizeof(uint32_t), mt_string);
   memcpy(str, outbuff, nlen*sizeof(uint32_t));
   }
 
@@ -1166,7 +1470,7 @@ for (uint32_t *s = str; *s != 0; s++)
   /* Handle a genuine character. */
 
   f = PFONT(*s) & ~font_small;
-  fs = &(font_list[font_table[f]]);
+  fs = font_load(font_table[f]);
 
   /* For non-standardly encoded fonts, either the character or its translation
   must be valid. */
@@ -1885,7 +2189,7 @@ block. Otherwise, adjust the size of the malloc() block and register it. */
 
 if (block == NULL)
   {
-  uint32_t *new = mem_get(mem_size);
+  uint32_t *new = mem_get(mem_size, mt_string);
   memcpy(new, yield, mem_size);
   yield = new;
   }
@@ -1895,7 +2199,7 @@ else
   mem_size += sizeof(char *);
   block = realloc(block, mem_size);
   if (block == NULL) error(ERR0, "re-", "PMW string", mem_size);  /* Hard */
-  mem_register(block, mem_size);
+  mem_register(block, mem_size, mt_string);
   yield = (uint32_t *)((char *)(block) + sizeof(char *));
   }
 
@@ -2398,7 +2702,7 @@ if (more)
 
     if (h == NULL)
       {
-      h = mem_get(sizeof(htypestr));
+      h = mem_get(sizeof(htypestr), mt_heading);
       *hh = h;
       h->next = NULL;
       h->string1 = s2a;
@@ -2451,7 +2755,7 @@ if (rehearse) s1->flags = text_rehearse | text_above | curmovt->rehearsalstyle;
 /* Set up a stave text block that is not (yet) connected to the current bar's
 chain of items. */
 
-p = mem_get(sizeof(b_textstr));
+p = mem_get(sizeof(b_textstr), mt_baritem);
 p->type = b_text;
 p->string = s1->string;
 p->x = s1->adjustx;
@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: December 2020 */
-/* This file last modified: April 2026 */
+/* This file last modified: October 2026 */
 
 /* These structures must be defined before the stave data items. */
 
@@ -16,6 +16,7 @@ typedef struct tree_node {
   uschar *name;                  /* node name */
   void   *data;                  /* for pointer values */
   int32_t value;                 /* for numeric values */
+  uint32_t treeid;               /* identifies the tree in the hash index */
   uint8_t balance;               /* balancing factor */
 } tree_node;
 
@@ -407,19 +408,46 @@ typedef struct dirstr {
   int  arg2;
 } dirstr;
 
+/* Structure for a perfect hash of a table of keywords, such as a table of
+directives. */
+
+typedef struct keyhashstr {
+  const void *table;        /* The keyword table */
+  size_t   itemsize;        /* Size of each item */
+  usint    count;           /* Number of items */
+  uint32_t bucketmask;      /* Number of buckets - 1 */
+  uint32_t slotmask;        /* Number of slots - 1 */
+  uint32_t *displacements;  /* Displacement for each bucket */
+  int16_t  *slots;          /* Table index for each slot, or -1 */
+} keyhashstr;
+
 /* Structure for remembering stacked files during include */
 
 typedef struct filestackstr {
   FILE *file;
   uschar *filename;
+  uschar *mapstart;
+  uschar *mapptr;
+  uschar *mapend;
+  BOOL  mapcached;
   int   linenumber;
   int   okdepth;
 } filestackstr;
 
-/* Items in a kerning table, pointed to from a fontstr */
+/* One block of memory that is known to the memory manager */
+
+typedef struct memblockstr {
+  void   *start;
+  size_t  size;
+  usint   arena;
+} memblockstr;
+
+/* Items in a kerning table, pointed to from a fontstr. The same structure is
+used for the hashed kern lookup table. */
 
 typedef struct kerntablestr {
-  uint32_t pair;
+  uint32_t left;
+  uint32_t right;
    int32_t kwidth;
 } kerntablestr;
 
@@ -432,6 +460,40 @@ typedef struct utrtablestr {
 } utrtablestr;
 
 
+/* The parsed metrics of a font that is compiled into PMW. The table of these
+is generated at build time by mkfonttab, which reads the fontmetrics and .utr
+files using PMW's own code. The encodings for PostScript and PDF output may
+differ; everything else is the same for both. */
+
+typedef struct fontbuilthighstr {
+  const char *name;         /* UTF-8 character */
+  int32_t value;            /* Offset above LOWCHARLIMIT */
+} fontbuilthighstr;
+
+typedef struct fontbuiltinstr {
+  const char *name;                /* Font name, e.g. "Times-Roman" */
+  const int32_t *widths;           /* FONTWIDTHS_SIZE widths */
+  const int32_t *r2ladjusts;       /* FONTWIDTHS_SIZE adjustments */
+  const int32_t *heights;          /* 256 heights, or NULL */
+  const kerntablestr *kerns;       /* Kerning pairs */
+  const utrtablestr *utr;          /* Unicode translations */
+  const fontbuilthighstr *high;    /* High character tree items */
+  const char *const *psencoding;   /* Encoding for PostScript, or NULL */
+  const char *const *pdfencoding;  /* Encoding for PDF, or NULL */
+  int32_t kerncount;
+  int32_t utrcount;
+  int32_t highcount;
+  uint32_t flags;                  /* Flags set from the AFM file */
+  uint32_t invalid;
+  int32_t ascent;
+  int32_t descent;
+  int32_t capheight;
+  int32_t italicangle;
+  int32_t stemv;
+  int32_t bbox[4];
+} fontbuiltinstr;
+
+
 /* Font data for a specific typeface */
 
 typedef struct fontstr {
@@ -443,8 +505,12 @@ typedef struct fontstr {
   utrtablestr *utr;         /* Unicode translations or NULL */
   uschar **encoding;        /* Optional encoding */
   tree_node *high_tree;     /* Tree for data for high val stdenc chars */
+  uschar    *subsetname;    /* Subset-tagged name or NULL (PDF) */
   kerntablestr *kerns;      /* Pointer to kerning table */
+  int32_t **kernindex;      /* Direct kern index for chars < KERN_DIRECT */
+  kerntablestr *kernhash;   /* Hashed kerns for other chars */
   int32_t kerncount;        /* Size of kern table */
+  uint32_t kernhashmask;    /* Size of kernhash - 1 */
   int32_t utrcount;         /* Size of utr table */
   uint32_t flags;           /* Various bit flags */
   uint32_t invalid;         /* What to use for unsupported character */
@@ -549,12 +615,30 @@ typedef struct keytransstr {
 } keytransstr;
 
 
+/* When a macro is defined, its replacement text is split up into a list of
+literal segments and argument insertions, so that it need not be scanned each
+time the macro is used. */
+
+typedef struct macrosegstr {
+  int32_t  arg;        /* argument number, or -1 for literal text */
+  uint32_t length;     /* length of literal text */
+  uschar  *text;       /* literal text */
+} macrosegstr;
+
+
 /* Structure for handling macros. We can't unfortunately have a variable length
-vector at the end, as C doesn't support such things. */
+vector at the end, as C doesn't support such things. Macros are kept in a hash
+table, chained through the "next" field. */
 
 typedef struct macrostr {
+  struct macrostr *next; /* next in hash chain */
+  uschar *name;        /* macro name */
+  uint32_t hash;       /* hash of name */
   int  argcount;       /* number of default arguments */
+  usint segcount;      /* number of segments */
+  size_t textlen;      /* length of replacement text */
   uschar *text;        /* replacement text */
+  macrosegstr *segments; /* compiled replacement */
   uschar *args[1];     /* vector of pointers */
 } macrostr;
 
@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: January 2021 */
-/* This file last modified: April 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -53,6 +53,66 @@ const char *clef_names[] = {
   "hclef", "mezzo", "noclef", "soprabass", "soprano", "tenor", "treble",
   "trebledescant", "trebletenor", "trebletenorb" };
 
+/* Names of bar item types, for statistics. Keep in step with the b_ enum in
+pmw.h. */
+
+const char *bar_item_names[] = {
+  "start",
+  "accentmove", "all", "barline", "barnum", "beamacc", "beambreak", "beammove",
+  "beamrit", "beamslope", "bowing", "breakbarline", "caesura", "chord", "clef",
+  "comma", "dotbar", "dotright", "draw", "endline", "endplet", "endslur",
+  "ens", "ensure", "footnote", "hairpin", "justify", "key", "linegap",
+  "lrepeat", "midichange", "move", "name", "nbar", "newline", "newpage",
+  "note", "noteheads", "notes", "ns", "nsm", "olevel", "olhere", "ornament",
+  "overbeam", "page", "pagebotmargin", "pagetopmargin", "plet", "reset",
+  "resume", "rrepeat", "sgabove", "sghere", "sgnext", "slur", "slurgap",
+  "space", "ssabove", "sshere", "ssnext", "suspend", "text", "tick", "tie",
+  "time", "transpose", "tremolo", "tripsw", "ulevel", "ulhere",
+  "unbreakbarline", "zerocopy" };
+
+/* Sizes of the structures for each bar item type, used when bar data is
+compacted after reading. Keep in step with the b_ enum in pmw.h. */
+
+const size_t bar_item_sizes[] = {
+  sizeof(barstr),                                   /* start */
+  sizeof(b_accentmovestr), sizeof(bstr),            /* accentmove, all */
+  sizeof(b_barlinestr), sizeof(b_barnumstr),        /* barline, barnum */
+  sizeof(b_beamaccritstr), sizeof(b_beambreakstr),  /* beamacc, beambreak */
+  sizeof(b_beammovestr), sizeof(b_beamaccritstr),   /* beammove, beamrit */
+  sizeof(b_beamslopestr), sizeof(b_bowingstr),      /* beamslope, bowing */
+  sizeof(bstr), sizeof(bstr),                       /* breakbarline, caesura */
+  sizeof(b_notestr), sizeof(b_clefstr),             /* chord, clef */
+  sizeof(bstr), sizeof(bstr),                       /* comma, dotbar */
+  sizeof(b_dotrightstr), sizeof(b_drawstr),         /* dotright, draw */
+  sizeof(b_endslurstr), sizeof(bstr),               /* endline, endplet */
+  sizeof(b_endslurstr), sizeof(bstr),               /* endslur, ens */
+  sizeof(b_ensurestr), sizeof(b_footnotestr),       /* ensure, footnote */
+  sizeof(b_hairpinstr), sizeof(b_justifystr),       /* hairpin, justify */
+  sizeof(b_keystr), sizeof(b_slurgapstr),           /* key, linegap */
+  sizeof(bstr), sizeof(b_midichangestr),            /* lrepeat, midichange */
+  sizeof(b_movestr), sizeof(b_namestr),             /* move, name */
+  sizeof(b_nbarstr), sizeof(bstr),                  /* nbar, newline */
+  sizeof(bstr), sizeof(b_notestr),                  /* newpage, note */
+  sizeof(b_noteheadsstr), sizeof(b_notesstr),       /* noteheads, notes */
+  sizeof(b_nsstr), sizeof(b_nsmstr),                /* ns, nsm */
+  sizeof(b_uolevelstr), sizeof(b_uolherestr),       /* olevel, olhere */
+  sizeof(b_ornamentstr), sizeof(b_overbeamstr),     /* ornament, overbeam */
+  sizeof(b_pagestr), sizeof(b_pagebotsstr),         /* page, pagebotmargin */
+  sizeof(b_pagetopsstr), sizeof(b_pletstr),         /* pagetopmargin, plet */
+  sizeof(b_resetstr), sizeof(bstr),                 /* reset, resume */
+  sizeof(bstr), sizeof(b_sgstr),                    /* rrepeat, sgabove */
+  sizeof(b_sgstr), sizeof(b_sgstr),                 /* sghere, sgnext */
+  sizeof(b_slurstr), sizeof(b_slurgapstr),          /* slur, slurgap */
+  sizeof(b_spacestr), sizeof(b_ssstr),              /* space, ssabove */
+  sizeof(b_ssstr), sizeof(b_ssstr),                 /* sshere, ssnext */
+  sizeof(bstr), sizeof(b_textstr),                  /* suspend, text */
+  sizeof(bstr), sizeof(b_tiestr),                   /* tick, tie */
+  sizeof(b_timestr), sizeof(b_transposestr),        /* time, transpose */
+  sizeof(b_tremolostr), sizeof(b_tripswstr),        /* tremolo, tripsw */
+  sizeof(b_uolevelstr), sizeof(b_uolherestr),       /* ulevel, ulhere */
+  sizeof(bstr), sizeof(b_zerocopystr)      /* unbreakbarline, zerocopy */
+  };
+
 /* Note letter quartertone pitch offsets into an octave starting at C, and
 adjustments for each accidental. */
 
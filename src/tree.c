@@ -4,7 +4,7 @@
 
 /* Copyright (c) Philip Hazel 2021 */
 /* This file created: December 2020 */
-/* This file last modified: January 2021 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -13,6 +13,249 @@
 #define tree_rbal      2         /* right subtree is longer */
 #define tree_bmask     3         /* mask for flipping bits */
 
+/* Every tree also has its nodes entered in a hash index, which is used for
+searching, so that a lookup costs a hash computation and a short probe rather
+than a sequence of string comparisons down the tree. The AVL structure is
+still maintained because some callers walk the tree in order. Node names are
+interned, so that an entry in the index can be matched by comparing the tree
+identifier and the name pointer. Both tables use open addressing with linear
+probing, and are doubled in size when they become half full. */
+
+#define TREE_INITSIZE  256
+
+typedef struct {
+  uschar  *name;                 /* the interned string, or NULL if unused */
+  uint32_t hash;
+} internstr;
+
+typedef struct {
+  tree_node *node;               /* NULL if unused */
+  uint32_t   hash;               /* hash of the name */
+  uint32_t   treeid;
+} indexstr;
+
+static internstr *intern_table = NULL;
+static usint      intern_size = 0;
+static usint      intern_count = 0;
+
+static indexstr  *index_table = NULL;
+static usint      index_size = 0;
+static usint      index_count = 0;
+
+static uint32_t   next_treeid = 0;
+
+/* Statistics for the "treehash" debug selector */
+
+static uint64_t   stat_searches = 0;
+static uint64_t   stat_hits = 0;
+static uint64_t   stat_notinterned = 0;
+static uint64_t   stat_probes = 0;
+static uint64_t   stat_inserts = 0;
+static usint      stat_maxprobe = 0;
+static uint64_t   stat_interns = 0;
+static uint64_t   stat_internprobes = 0;
+
+
+
+/*************************************************
+*             Hash a node name                   *
+*************************************************/
+
+/* This is FNV-1a, as used for macro names.
+
+Argument:   the name
+Returns:    the hash value
+*/
+
+static uint32_t
+tree_hash(uschar *s)
+{
+uint32_t h = 2166136261u;
+while (*s != 0) h = (h ^ *s++) * 16777619u;
+return h;
+}
+
+
+
+/*************************************************
+*        Find the index slot for a tree and name *
+*************************************************/
+
+/* Because the name is interned, its pointer identifies it. The tree id is
+mixed into the starting position so that trees that contain the same names
+do not pile up in the same slots.
+
+Arguments:
+  treeid      the tree identifier
+  name        the interned name
+  hash        the hash of the name
+  probes      where to return the number of probes, or NULL
+
+Returns:      the slot, which is empty if the node is not in the index
+*/
+
+static indexstr *
+index_slot(uint32_t treeid, uschar *name, uint32_t hash, usint *probes)
+{
+usint mask = index_size - 1;
+usint i = (hash ^ (treeid * 2654435761u)) & mask;
+usint n = 1;
+indexstr *x;
+
+for (;;)
+  {
+  x = index_table + i;
+  if (x->node == NULL ||
+      (x->treeid == treeid && x->node->name == name)) break;
+  i = (i + 1) & mask;
+  n++;
+  }
+
+if (probes != NULL) *probes = n;
+return x;
+}
+
+
+
+/*************************************************
+*          Grow one of the hash tables           *
+*************************************************/
+
+/* The tables are allocated with malloc() because they are abandoned when they
+are doubled in size. These functions are called when the table is half full,
+and when it has not yet been created.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+static void
+intern_grow(void)
+{
+internstr *old = intern_table;
+usint oldsize = intern_size;
+
+intern_size = (oldsize == 0)? TREE_INITSIZE : oldsize * 2;
+intern_table = calloc(intern_size, sizeof(internstr));
+if (intern_table == NULL)
+  error(ERR0, "", "name intern table", intern_size * sizeof(internstr)); /* Hard */
+
+for (usint i = 0; i < oldsize; i++)
+  {
+  usint j;
+  if (old[i].name == NULL) continue;
+  for (j = old[i].hash & (intern_size - 1); intern_table[j].name != NULL;
+       j = (j + 1) & (intern_size - 1)) {}
+  intern_table[j] = old[i];
+  }
+
+free(old);
+}
+
+
+static void
+index_grow(void)
+{
+indexstr *old = index_table;
+usint oldsize = index_size;
+
+index_size = (oldsize == 0)? TREE_INITSIZE : oldsize * 2;
+index_table = calloc(index_size, sizeof(indexstr));
+if (index_table == NULL)
+  error(ERR0, "", "tree index", index_size * sizeof(indexstr));  /* Hard */
+
+for (usint i = 0; i < oldsize; i++)
+  {
+  if (old[i].node == NULL) continue;
+  *index_slot(old[i].treeid, old[i].node->name, old[i].hash, NULL) = old[i];
+  }
+
+free(old);
+}
+
+
+
+/*************************************************
+*         Find or create an interned name        *
+*************************************************/
+
+/*
+Arguments:
+  s          the name
+  hash       its hash value
+  create     TRUE to intern a name that is not already present
+
+Returns:     the interned copy of the name, or NULL if it is not present and
+               create is FALSE
+*/
+
+static uschar *
+intern_find(uschar *s, uint32_t hash, BOOL create)
+{
+usint mask, i;
+size_t len;
+uschar *copy;
+
+if (intern_size == 0)
+  {
+  if (!create) return NULL;
+  intern_grow();
+  }
+
+stat_interns++;
+mask = intern_size - 1;
+for (i = hash & mask; intern_table[i].name != NULL; i = (i + 1) & mask)
+  {
+  stat_internprobes++;
+  if (intern_table[i].hash == hash && Ustrcmp(intern_table[i].name, s) == 0)
+    return intern_table[i].name;
+  }
+stat_internprobes++;
+
+if (!create) return NULL;
+
+len = Ustrlen(s) + 1;
+copy = mem_get(len, mt_tree);
+memcpy(copy, s, len);
+intern_table[i].name = copy;
+intern_table[i].hash = hash;
+
+if (++intern_count * 2 > intern_size) intern_grow();
+return copy;
+}
+
+
+
+/*************************************************
+*          Add a node to the hash index          *
+*************************************************/
+
+/* The node's name is replaced by its interned copy. The caller has checked
+that the name is not already in the tree.
+
+Arguments:
+  node       the node
+  treeid     the identifier of its tree
+
+Returns:     nothing
+*/
+
+static void
+index_add(tree_node *node, uint32_t treeid)
+{
+uint32_t hash = tree_hash(node->name);
+indexstr *x;
+
+node->name = intern_find(node->name, hash, TRUE);
+node->treeid = treeid;
+if (index_size == 0) index_grow();
+x = index_slot(treeid, node->name, hash, NULL);
+x->node = node;
+x->hash = hash;
+x->treeid = treeid;
+if (++index_count * 2 > index_size) index_grow();
+}
+
 
 
 /*************************************************
@@ -20,7 +263,9 @@
 *************************************************/
 
 /* This function is used for a number of different binary trees, which remember
-things that need to be looked up by name.
+things that need to be looked up by name. The node is also entered in the hash
+index, and its name is replaced by an interned copy. A tree is given an
+identifier for the index when its first node is inserted.
 
 Arguments:
   treebase      pointer to the root of the tree
@@ -42,15 +287,22 @@ int a;
 node->left = NULL;
 node->right = NULL;
 node->balance = 0;
+stat_inserts++;
 
 /* Deal with an empty tree */
 
 if (p == NULL)
   {
+  index_add(node, ++next_treeid);
   *treebase = node;
   return TRUE;
   }
 
+/* Check for a duplicate using the index, then add the new node to it. */
+
+if (tree_search(p, node->name) != NULL) return FALSE;
+index_add(node, p->treeid);
+
 /* The tree is not empty. While finding the insertion point, q points to the
 pointer to p, and t points to the pointer to the potential re-balancing point.
 */
@@ -63,7 +315,6 @@ t = q;
 for (;;)
   {
   int c = Ustrcmp(node->name, p->name);
-  if (c == 0) return FALSE;             /* Duplicate found */
 
   /* Deal with climbing down the tree, exiting from the loop when we reach a
   leaf. */
@@ -169,7 +420,9 @@ return TRUE;     /* Successful insertion */
 *          Search tree for node by name          *
 *************************************************/
 
-/*
+/* The search uses the hash index. A name that has never been interned cannot
+be in any tree.
+
 Arguments:
   p          the root node of the tree
   name       the name of the required node
@@ -180,13 +433,109 @@ Returns:     pointer to the found node, or NULL
 tree_node *
 tree_search(tree_node *p, uschar *name)
 {
+uint32_t hash;
+uschar *iname;
+indexstr *x;
+usint probes;
+
+if (p == NULL) return NULL;
+stat_searches++;
+
+hash = tree_hash(name);
+iname = intern_find(name, hash, FALSE);
+if (iname == NULL)
+  {
+  stat_notinterned++;
+  return NULL;
+  }
+
+x = index_slot(p->treeid, iname, hash, &probes);
+stat_probes += probes;
+if (probes > stat_maxprobe) stat_maxprobe = probes;
+if (x->node == NULL) return NULL;
+stat_hits++;
+return x->node;
+}
+
+
+
+/*************************************************
+*        Re-enter a tree in the hash index       *
+*************************************************/
+
+/* This is used for trees whose nodes have been restored from the score cache.
+The pointers in the nodes are valid, but the names are not interned and the
+tree identifier is stale. A new identifier is assigned.
+
+Argument:   the root node of the tree
+Returns:    nothing
+*/
+
+static void
+tree_rehash_nodes(tree_node *p, uint32_t treeid)
+{
 while (p != NULL)
   {
-  int c = Ustrcmp(name, p->name);
-  if (c == 0) return p;
-  p = (c < 0)? p->left : p->right;
+  tree_rehash_nodes(p->left, treeid);
+  index_add(p, treeid);
+  p = p->right;
   }
-return NULL;
+}
+
+void
+tree_rehash(tree_node *p)
+{
+if (p != NULL) tree_rehash_nodes(p, ++next_treeid);
+}
+
+
+
+/*************************************************
+*          Free the hash index tables            *
+*************************************************/
+
+/* The interned names are in mem_get() memory, which is freed separately.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+tree_free_index(void)
+{
+free(intern_table);
+free(index_table);
+intern_table = NULL;
+index_table = NULL;
+intern_size = intern_count = index_size = index_count = 0;
+}
+
+
+
+/*************************************************
+*          Output hash index statistics          *
+*************************************************/
+
+/* This is called at the end of a run when the "treehash" debug selector is
+set.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+tree_statistics(void)
+{
+eprintf("Tree index: %" PRIu64 " inserts, %" PRIu64 " searches, %" PRIu64
+  " hits, %" PRIu64 " names not interned\n", stat_inserts, stat_searches,
+  stat_hits, stat_notinterned);
+if (stat_searches > stat_notinterned)
+  eprintf("  %.2f probes per indexed search, longest %d; %d entries in %d "
+    "slots\n", (double)stat_probes/(double)(stat_searches - stat_notinterned),
+    stat_maxprobe, index_count, index_size);
+eprintf("Name interning: %" PRIu64 " lookups, %.2f probes per lookup, "
+  "%d names in %d slots\n", stat_interns, (stat_interns == 0)? 0.0 :
+  (double)stat_internprobes/(double)stat_interns, intern_count, intern_size);
 }
 
 /* End of tree.c */
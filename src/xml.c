@@ -3,7 +3,7 @@
 *************************************************/
 
 /* Copyright (c) Philip Hazel, 2022 */
-/* This file last updated: May 2022 */
+/* This file last updated: October 2026 */
 
 /* This module contains functions used while creating and processing a chain of
 XML items. */
@@ -142,7 +142,7 @@ uschar buff[256];
 p = tree_search(*tree, buff);
 if (p == NULL)
   {
-  p = mem_get(sizeof(tree_node) + Ustrlen(buff));
+  p = mem_get(sizeof(tree_node) + Ustrlen(buff), mt_tree);
   p->name = mem_copystring(buff);
   (void)tree_insert(tree, p);
   }
@@ -154,7 +154,9 @@ if (p == NULL)
 *          Create a new item with defaults       *
 *************************************************/
 
-/*
+/* Like all the items of the XML input, the new item is in the read arena,
+which is freed when reading is complete.
+
 Arguments:  item name
 Returns:    pointer to the item
 */
@@ -162,7 +164,7 @@ Returns:    pointer to the item
 xml_item *
 xml_new_item(uschar *name)
 {
-xml_item *yield = mem_get(sizeof(xml_item));
+xml_item *yield = mem_arena_get(arena_read, sizeof(xml_item), mt_xml);
 yield->next = NULL;
 yield->prev = NULL;
 yield->partner = yield;
@@ -3,7 +3,7 @@
 *************************************************/
 
 /* Copyright (c) Philip Hazel, 2022 */
-/* File last modified: April 2022 */
+/* File last modified: October 2026 */
 
 /* Analyse XML after it has been read into memory. */
 
@@ -54,7 +54,8 @@ for (mi = part_list->next; mi != part_list->partner; mi = mi->partner->next)
 
     if (ISATTR(mi, "type", "start", TRUE, "start"))
       {
-      xml_group_data *new = mem_get(sizeof(xml_group_data));
+      xml_group_data *new =
+        mem_arena_get(arena_read, sizeof(xml_group_data), mt_xml);
       new->next = xml_groups_list;
       new->prev = NULL;
       if (xml_groups_list != NULL) xml_groups_list->prev = new;
@@ -95,7 +96,8 @@ for (mi = part_list->next; mi != part_list->partner; mi = mi->partner->next)
     {
     xml_attrstr *p;
     xml_item *measure, *part;
-    xml_part_data *new = mem_get(sizeof(xml_part_data));
+    xml_part_data *new = mem_arena_get(arena_read, sizeof(xml_part_data),
+      mt_xml);
 
     *pdlink = new;
     pdlink = &(new->next);
@@ -253,8 +255,8 @@ for (mi = part_list->next; mi != part_list->partner; mi = mi->partner->next)
 
                   if (number_string != NULL)
                     {
-                    xml_attrstr *newattr = mem_get(sizeof(xml_attrstr) +
-                      Ustrlen(number_string));
+                    xml_attrstr *newattr = mem_arena_get(arena_read,
+                      sizeof(xml_attrstr) + Ustrlen(number_string), mt_xml);
                     Ustrcpy(newattr->name, "number");
                     Ustrcpy(newattr->value, number_string);
                     newattr->next = NULL;
@@ -405,7 +407,7 @@ for (mi = part_list->next; mi != part_list->partner; mi = mi->partner->next)
 
       if (group == NULL)
         {
-        group = mem_get(sizeof(xml_group_data));
+        group = mem_arena_get(arena_read, sizeof(xml_group_data), mt_xml);
         group->next = xml_groups_list;
         group->prev = NULL;
         if (xml_groups_list != NULL) xml_groups_list->prev = group;
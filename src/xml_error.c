@@ -3,7 +3,7 @@
 *************************************************/
 
 /* Copyright (c) Philip Hazel, 2022 */
-/* This file last updated: December 2025 */
+/* This file last updated: October 2026 */
 
 /* Error handling routines for XML */
 
@@ -177,7 +177,7 @@ else
         if (tn != NULL) return;
         }
       else onceptr->seen = TRUE;
-      tn = mem_get(sizeof(tree_node) + Ustrlen(buffer));
+      tn = mem_get(sizeof(tree_node) + Ustrlen(buffer), mt_tree);
       tn->name = mem_copystring(buffer);
       (void)tree_insert(&done_warnings, tn);
       break;
@@ -3,7 +3,7 @@
 *************************************************/
 
 /* Copyright (c) Philip Hazel, 2026 */
-/* This file last modified: January 2026 */
+/* This file last modified: October 2026 */
 
 
 /* This module contains functions for processing heading and general
@@ -139,13 +139,13 @@ static int32_t
 handle_headfoot(uschar *sl, uschar *sm, uschar *sr, headstr **oldp,
   int32_t size, uint32_t f)
 {
-headstr *new = mem_get(sizeof(headstr));
+headstr *new = mem_get(sizeof(headstr), mt_heading);
 
 size_t lenl = Ustrlen(sl);
 size_t lenm = Ustrlen(sm);
 size_t lenr = Ustrlen(sr);
 
-uint32_t *ssl = mem_get((lenl + lenm + lenr + 3) * sizeof(uint32_t));
+uint32_t *ssl = mem_get((lenl + lenm + lenr + 3) * sizeof(uint32_t), mt_string);
 uint32_t *ssm = ssl + lenl + 1;
 uint32_t *ssr = ssm + lenm + 1;
 
@@ -447,7 +447,7 @@ if (defaults != NULL)
       fontinststr *fdata;
       if (!MFLAG(mf_copiedfontsizes))
         {
-        fontsizestr *new = mem_get(sizeof(fontsizestr));
+        fontsizestr *new = mem_get(sizeof(fontsizestr), mt_movt);
         *new = *(curmovt->fontsizes);
         curmovt->fontsizes = new;
         curmovt->flags |= mf_copiedfontsizes;
@@ -478,7 +478,7 @@ if (xml_groups_list != NULL)
     if (g->group_symbol != NULL)
       {
       stavelist **slp = NULL;
-      stavelist *sl = mem_get(sizeof(stavelist));
+      stavelist *sl = mem_get(sizeof(stavelist), mt_stave);
 
       sl->first = g->first_pstave;
       sl->last = g->last_pstave;
@@ -534,7 +534,7 @@ for (int n = 1; n < xml_pmw_stave_count; n++)
 if (xml_layout_list != NULL && xml_layout_top > 0)
   {
   uint16_t *pl = curmovt->layout =
-    mem_get((xml_layout_top+1)*2*sizeof(uint16_t));
+    mem_get((xml_layout_top+1)*2*sizeof(uint16_t), mt_movt);
 
   for (size_t ln = 0; ln < xml_layout_top; ln++)
     {
@@ -4,9 +4,11 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: January 2022 */
-/* This file last modified: January 2026 */
+/* This file last modified: October 2026 */
 
-/* This file contains the top-level function for MusicXML input files. */
+/* This file contains the top-level function for MusicXML input files. The
+items that are read are put in the read arena, because they are not needed
+once they have been converted into PMW data structures. */
 
 #include "pmw.h"
 
@@ -77,7 +79,7 @@ if (movement_count == 0)
   if (movements == NULL)
     error(ERR0, "re-", "movements vector", movements_size); /* Hard */
   premovt = &default_movtstr;
-  movements[movement_count++] = curmovt = mem_get(sizeof(movtstr));
+  movements[movement_count++] = curmovt = mem_get(sizeof(movtstr), mt_movt);
   read_init_movement(curmovt, xml_movt_unsetflags, xml_movt_setflags);
   }
 
@@ -91,7 +93,7 @@ xml_do_parts();
 
 if (xml_set_stave_size)
   {
-  int32_t *stavesizes = mem_get((MAX_STAVE+1)*sizeof(int32_t));
+  int32_t *stavesizes = mem_get((MAX_STAVE+1)*sizeof(int32_t), mt_movt);
   memcpy(stavesizes, curmovt->stavesizes, (MAX_STAVE+1)*sizeof(int32_t));
   curmovt->stavesizes = stavesizes;
   for (int i = 1; i <= xml_pmw_stave_count; i++)
@@ -154,7 +156,7 @@ if (c != 0)
   tn = tree_search(xml_unrecognized_element_tree, new->name);
   if (tn == NULL)
     {
-    tn = mem_get(sizeof(tree_node));
+    tn = mem_get(sizeof(tree_node), mt_tree);
     tn->name = mem_copystring(new->name);
     (void)tree_insert(&xml_unrecognized_element_tree, tn);
     }
@@ -172,7 +174,7 @@ if (xml_supported_elements[mid].attrs != NULL &&
   tn = tree_search(xml_ignored_element_tree, new->name);
   if (tn == NULL)
     {
-    tn = mem_get(sizeof(tree_node));
+    tn = mem_get(sizeof(tree_node), mt_tree);
     tn->name = mem_copystring(new->name);
     (void)tree_insert(&xml_ignored_element_tree, tn);
     }
@@ -203,7 +205,7 @@ else for (attr = new->p.attr; attr != NULL; attr = attr->next)
         tn = tree_search(xml_ignored_element_tree, buffer);
         if (tn == NULL)
           {
-          tn = mem_get(sizeof(tree_node));
+          tn = mem_get(sizeof(tree_node), mt_tree);
           tn->name = mem_copystring(buffer);
           (void)tree_insert(&xml_ignored_element_tree, tn);
           }
@@ -218,7 +220,7 @@ else for (attr = new->p.attr; attr != NULL; attr = attr->next)
   tn = tree_search(xml_unrecognized_element_tree, buffer);
   if (tn == NULL)
     {
-    tn = mem_get(sizeof(tree_node));
+    tn = mem_get(sizeof(tree_node), mt_tree);
     tn->name = mem_copystring(buffer);
     (void)tree_insert(&xml_unrecognized_element_tree, tn);
     }
@@ -255,7 +257,8 @@ len = p - pp;
 if (Ustrcmp(xml_read_addto->name, "#TEXT") == 0)
   {
   xml_textblock *tb = xml_read_addto->p.txtblk;
-  xml_textblock *tbnew = mem_get(sizeof(xml_textblock) + tb->length + len + 1);
+  xml_textblock *tbnew = mem_arena_get(arena_read,
+    sizeof(xml_textblock) + tb->length + len + 1, mt_xml);
   tbnew->next = NULL;
 
   (void)memcpy(tbnew->string, tb->string, tb->length);
@@ -274,14 +277,14 @@ else
   xml_item *new;
   xml_textblock *tbnew;
 
-  tbnew = mem_get(sizeof(xml_textblock) + len + 1);
+  tbnew = mem_arena_get(arena_read, sizeof(xml_textblock) + len + 1, mt_xml);
   tbnew->next = NULL;
 
   (void)memcpy(tbnew->string, pp, len);
   tbnew->length = len;
   tbnew->string[tbnew->length] = 0;
 
-  new = mem_get(sizeof(xml_item));
+  new = mem_arena_get(arena_read, sizeof(xml_item), mt_xml);
   new->next = xml_read_addto->next;
   new->prev = xml_read_addto;
   new->partner = new;
@@ -455,7 +458,7 @@ if (ender)
     else
       {
       partner = nest_stack[--nest_stackptr];
-      new = mem_get(sizeof(xml_item));
+      new = mem_arena_get(arena_read, sizeof(xml_item), mt_xml);
       new->prev = xml_read_addto;
       new->next = xml_read_addto->next;
       if (new->next != NULL) new->next->prev = new;
@@ -531,7 +534,7 @@ else
     if (*p != quote) { xml_error(ERR8, quote, attname, quote); break; }
 
     dlen = p - pp;
-    newattr = mem_get(sizeof(xml_attrstr) + dlen);
+    newattr = mem_arena_get(arena_read, sizeof(xml_attrstr) + dlen, mt_xml);
     newattr->next = NULL;
     Ustrcpy(newattr->name, attname);
     Ustrncpy(newattr->value, pp, dlen);
@@ -558,7 +561,7 @@ else
   attributes are not supported, and push it onto the stack for checking its
   partner. */
 
-  new = mem_get(sizeof(xml_item));
+  new = mem_arena_get(arena_read, sizeof(xml_item), mt_xml);
   new->linenumber = xml_read_linenumber;
   new->flags = 0;
   new->partner = ended? new : NULL;
@@ -682,14 +685,15 @@ xml_read_linenumber = 0;
 /* Stick in a dummy element to hold the file name so we can distinguish
 included files in error messages. */
 
-fn = mem_get(sizeof(xml_item));
+fn = mem_arena_get(arena_read, sizeof(xml_item), mt_xml);
 fn->prev = xml_read_addto;
 fn->next = xml_read_addto->next;
 fn->linenumber = 0;
 fn->flags = 0;
 fn->partner = fn;
 Ustrcpy(fn->name, "#FILENAME");
-fn->p.string = mem_get(Ustrlen(xml_read_filename) + 1);
+fn->p.string = mem_arena_get(arena_read, Ustrlen(xml_read_filename) + 1,
+  mt_xml);
 Ustrcpy(fn->p.string, xml_read_filename);
 
 xml_read_addto->next = fn;
@@ -3,7 +3,7 @@
 *************************************************/
 
 /* Copyright (c) Philip Hazel, 2025 */
-/* This file last modified: December 2025 */
+/* This file last modified: October 2026 */
 
 
 /* This module contains functions for generating stave data */
@@ -489,7 +489,7 @@ stave_text_utf(int n, uschar *pre, uschar *t, uschar *post, uint32_t font,
 {
 b_textstr *tx = xml_get_item(n, sizeof(b_textstr), b_text);
 size_t size = Ustrlen(pre) + Ustrlen(t) + Ustrlen(post);
-uint32_t *pmw_string = mem_get(sizeof(uint32_t) * (size + 1));
+uint32_t *pmw_string = mem_get(sizeof(uint32_t) * (size + 1), mt_string);
 uint32_t *p = pmw_string;
 
 p += xml_convert_utf8(p, pre, font, FALSE);
@@ -727,7 +727,7 @@ bar counts. MXL stave numbers start at 1. */
 
 for (int n = 1; n <= scount; n++)
   {
-  barstr *b = mem_get(sizeof(barstr));
+  barstr *b = mem_get(sizeof(barstr), mt_bar);
   b->next = b->prev = NULL;
   b->type = b_start;
   b->repeatnumber = 0;
@@ -1144,7 +1144,7 @@ for (xml_item *mi = measure->next;
         tn = tree_search(xml_ignored_element_tree, buffer);
         if (tn == NULL)
           {
-          tn = mem_get(sizeof(tree_node));
+          tn = mem_get(sizeof(tree_node), mt_tree);
           tn->name = mem_copystring(buffer);
           (void)tree_insert(&xml_ignored_element_tree, tn);
           }
@@ -1405,7 +1405,7 @@ for (xml_item *mi = measure->next;
           else
             {
             b_textstr *tx;
-            uint32_t *mm = mem_get(12 * sizeof(uint32_t));
+            uint32_t *mm = mem_get(12 * sizeof(uint32_t), mt_string);
             uint32_t *pt = mm;
             if (parens) *pt++ = RM|'(';
             *pt++ = MF |(font_small << 24)|note_types[n].pmwchar;
@@ -1631,7 +1631,7 @@ for (xml_item *mi = measure->next;
 
             if (offset != 0)
               {
-              sl->mods = sm = mem_get(sizeof(b_slurmodstr));
+              sl->mods = sm = mem_get(sizeof(b_slurmodstr), mt_baritem);
               memset(sm, 0, sizeof(b_slurmodstr));
               sm->lxoffset = (offset*1000)/divisions;
               }
@@ -1641,7 +1641,7 @@ for (xml_item *mi = measure->next;
               {
               if (sm == NULL)
                 {
-                sl->mods = sm = mem_get(sizeof(b_slurmodstr));
+                sl->mods = sm = mem_get(sizeof(b_slurmodstr), mt_baritem);
                 memset(sm, 0, sizeof(b_slurmodstr));
                 }
               sm->lx = rx;
@@ -1659,7 +1659,7 @@ for (xml_item *mi = measure->next;
               }
             else
               {
-              ss = mem_get(sizeof(sl_start));
+              ss = mem_get(sizeof(sl_start), mt_xml);
               }
 
             ss->next = slur_starts;
@@ -1720,7 +1720,7 @@ for (xml_item *mi = measure->next;
               if (sm == NULL &&
                    (dy != ss->default_y || offset != 0 || abs(rx) >= 100))
                 {
-                sl->mods = sm = mem_get(sizeof(b_slurmodstr));
+                sl->mods = sm = mem_get(sizeof(b_slurmodstr), mt_baritem);
                 memset(sm, 0, sizeof(b_slurmodstr));
                 }
 
@@ -2148,7 +2148,7 @@ for (xml_item *mi = measure->next;
 
           if (dx != INT_MAX || dy != INT_MAX || ry != 0)
             {
-            sm = sl->mods = mem_get(sizeof(b_slurmodstr));
+            sm = sl->mods = mem_get(sizeof(b_slurmodstr), mt_baritem);
             memset(sm, 0, sizeof(b_slurmodstr));
             sm->next = NULL;
 
@@ -2176,7 +2176,7 @@ for (xml_item *mi = measure->next;
             }
           else
             {
-            ss = mem_get(sizeof(sl_start));
+            ss = mem_get(sizeof(sl_start), mt_xml);
             }
 
           ss->next = slur_starts;
@@ -2192,7 +2192,7 @@ for (xml_item *mi = measure->next;
         else if (Ustrcmp(slurtype, "stop") == 0)
           {
           b_slurstr *sl;
-          b_endslurstr *be = mem_get(sizeof(b_endslurstr));
+          b_endslurstr *be = mem_get(sizeof(b_endslurstr), mt_baritem);
           be->type = b_endslur;
           be->value = slurchars[sn];
           slurchars[sn] ^= 0x20u;
@@ -2224,7 +2224,7 @@ for (xml_item *mi = measure->next;
               {
               if (sm == NULL)
                 {
-                sm = sl->mods = mem_get(sizeof(b_slurmodstr));
+                sm = sl->mods = mem_get(sizeof(b_slurmodstr), mt_baritem);
                 memset(sm, 0, sizeof(b_slurmodstr));
                 sm->next = NULL;
                 }
@@ -2313,7 +2313,7 @@ for (xml_item *mi = measure->next;
 
         else
           {
-          bstr *be = mem_get(sizeof(bstr));
+          bstr *be = mem_get(sizeof(bstr), mt_baritem);
           be->type = b_endplet;
           add_pending_post_chord(staff, (bstr *)be);
           end_tuplet[staff] = TRUE;
@@ -2337,7 +2337,7 @@ for (xml_item *mi = measure->next;
               (Ustrcmp(t->value, "start") == 0 ||
                Ustrcmp(t->value, "continue") == 0))
             {
-            b_tiestr *ts = mem_get(sizeof(b_tiestr));
+            b_tiestr *ts = mem_get(sizeof(b_tiestr), mt_baritem);
             uschar *orientation = xml_get_attr_string(ni, US"orientation", US"",
               FALSE);
 
@@ -2477,7 +2477,7 @@ for (xml_item *mi = measure->next;
 
           else
             {
-            uint32_t *pp = ps = mem_get(20 * sizeof(uint32_t));
+            uint32_t *pp = ps = mem_get(20 * sizeof(uint32_t), mt_string);
             const char *t = (accabove == NULL)? turnB :
                             (accbelow == NULL)? turnA : turnC;
 
@@ -3087,7 +3087,7 @@ start. */
 
 if (measure_number_absolute == pending_all_bar)
   {
-  bstr *a = mem_get(sizeof(bstr));
+  bstr *a = mem_get(sizeof(bstr), mt_baritem);
   bstr *b = (bstr *)curmovt->stavetable[prevstave + 1]->
     barindex[measure_number_absolute];
   a->type = b_all;
@@ -3192,7 +3192,7 @@ len = bp - buff;
 
 if (len != 0)
   {
-  sn = mem_get(sizeof(snamestr));
+  sn = mem_get(sizeof(snamestr), mt_stave);
   *sn = init_snamestr;
   sn->linecount = 1;
 
@@ -3205,7 +3205,7 @@ if (len != 0)
     sn->linecount++;
     }
 
-  sn->text = mem_get((len + 1) * sizeof(uint32_t));
+  sn->text = mem_get((len + 1) * sizeof(uint32_t), mt_string);
   memcpy(sn->text, buff, (len + 1) * sizeof(uint32_t));
   }
 
@@ -3285,7 +3285,7 @@ if (sn == NULL) *snptr = gn; else
   this code works only for right-justified texts (the default). */
 
   for (len = 0; s[len] != 0; len++) {}
-  new = mem_get((len+add+1)*sizeof(uint32_t));
+  new = mem_get((len+add+1)*sizeof(uint32_t), mt_string);
   memcpy(new, s, len * sizeof(uint32_t));
   for (int n = 0; n < add; n++) new[len+n] = RM|' ';
   new[len+add] = 0;
@@ -4,7 +4,7 @@
 
 /* Copyright Philip Hazel 2026 */
 /* This file created: August 2025 */
-/* This file last modified: April 2026 */
+/* This file last modified: October 2026 */
 
 #include "pmw.h"
 
@@ -623,7 +623,7 @@ for (uint32_t *p = s; *p != 0; p++)
   else if (c >= LOWCHARLIMIT)
     {
     int f = PBFONT(c);
-    fontstr *fs = &(font_list[font_table[f]]);
+    fontstr *fs = font_load(font_table[f]);
     if ((fs->flags & ff_stdencoding) != 0)
       {
       if (unihigh[0] == 0)
@@ -3686,7 +3686,8 @@ if (suspendmap[1] == NULL)
 
   size_t size = (maxbars + 7) / 8;
 
-  for (int i = 1; i <= maxstave; i++) suspendmap[i] = mem_get(size);
+  for (int i = 1; i <= maxstave; i++)
+    suspendmap[i] = mem_arena_get(arena_xmlout, size, mt_misc);
   }
 
 /* Initialize the suspend maps for the current movement. First clear to zero,
@@ -4382,4 +4383,25 @@ PB("</score-partwise>");
 if (fclose(xml_file) != 0) error(ERR200, "XML file", strerror(errno));
 }
 
+
+
+/*************************************************
+*           Free MusicXML output memory          *
+*************************************************/
+
+/* This is called when all MusicXML output has been written. The suspend maps
+are in the xmlout arena; resetting the first pointer ensures that they would be
+re-created if more output were ever written.
+
+Arguments:  none
+Returns:    nothing
+*/
+
+void
+outxml_free(void)
+{
+mem_arena_free(arena_xmlout);
+suspendmap[1] = NULL;
+}
+
 /* End of xmlout.c */